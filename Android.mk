@@ -120,6 +120,10 @@ LOCAL_SRC_FILES := \
         src/armnn/backends/RefWorkloads/RefMergerUint8Workload.cpp \
         src/armnn/backends/RefWorkloads/RefResizeBilinearUint8Workload.cpp \
         src/armnn/backends/RefWorkloads/FullyConnected.cpp \
+        src/armnn/backends/RefWorkloads/Gemm.cpp \
+        src/armnn/backends/RefWorkloads/Im2ColConvolution.cpp \
+        src/armnn/backends/RefWorkloads/DepthwiseConvolution.cpp \
+        src/armnn/backends/RefWorkloads/WinogradConvolution.cpp \
         src/armnn/backends/RefWorkloads/RefFullyConnectedFloat32Workload.cpp \
         src/armnn/backends/RefWorkloads/RefSoftmaxFloat32Workload.cpp \
         src/armnn/backends/RefWorkloads/RefActivationFloat32Workload.cpp \
@@ -138,7 +142,8 @@ LOCAL_SRC_FILES := \
         src/armnn/backends/RefWorkloads/RefDepthwiseConvolution2dFloat32Workload.cpp \
         src/armnn/backends/RefWorkloads/RefPooling2dUint8Workload.cpp \
         src/armnn/backends/RefWorkloads/RefFloorFloat32Workload.cpp \
-        src/armnn/backends/RefWorkloads/ConvImpl.cpp \
+        src/armnn/backends/RefWorkloads/QuantizedMultiplier.cpp \
+        src/armnn/backends/RefWorkloads/RefThreadPool.cpp \
         src/armnn/backends/RefWorkloads/Activation.cpp \
         src/armnn/backends/RefWorkloads/RefReshapeUint8Workload.cpp \
         src/armnn/backends/RefWorkloads/RefL2NormalizationFloat32Workload.cpp \
@@ -195,6 +200,8 @@ LOCAL_SRC_FILES := \
         src/armnn/Exceptions.cpp \
         src/armnn/Graph.cpp \
         src/armnn/Optimizer.cpp \
+        src/armnn/AsyncExecutor.cpp \
+        src/armnn/InferenceBatcher.cpp \
         src/armnn/Runtime.cpp \
         src/armnn/SerializeLayerParameters.cpp \
         src/armnn/InternalTypes.cpp \
@@ -206,6 +213,8 @@ LOCAL_SRC_FILES := \
         src/armnn/backends/OutputHandler.cpp \
         src/armnn/OpenClTimer.cpp \
         src/armnn/WallClockTimer.cpp \
+        src/armnn/WorkingMemHandle.cpp \
+        src/armnn/WorkloadScheduler.cpp \
         src/armnn/ProfilingEvent.cpp \
         src/armnn/Profiling.cpp \
         src/armnn/JsonPrinter.cpp \
@@ -223,7 +232,8 @@ LOCAL_SRC_FILES := \
         src/armnn/memory/BlobMemoryPool.cpp \
         src/armnn/memory/OffsetLifetimeManager.cpp \
         src/armnn/memory/OffsetMemoryPool.cpp \
-        src/armnn/memory/PoolManager.cpp
+        src/armnn/memory/PoolManager.cpp \
+        src/armnn/memory/RefMemoryManager.cpp
 
 LOCAL_STATIC_LIBRARIES := \
 	armnn-arm_compute \
@@ -274,6 +284,7 @@ LOCAL_CFLAGS := \
 
 LOCAL_SRC_FILES := \
 	src/armnn/test/UnitTests.cpp \
+	src/armnn/test/AllocationCounter.cpp \
 	src/armnn/test/EndToEndTest.cpp \
 	src/armnn/test/UtilsTests.cpp \
 	src/armnn/test/GraphTests.cpp \
@@ -285,12 +296,21 @@ LOCAL_SRC_FILES := \
 	src/armnn/test/OpenClTimerTest.cpp \
 	src/armnn/test/ProfilingEventTest.cpp \
 	src/armnn/test/ObservableTest.cpp \
+	src/armnn/test/WorkloadSchedulerTests.cpp \
 	src/armnn/backends/test/IsLayerSupportedTest.cpp \
 	src/armnn/backends/test/Reference.cpp \
 	src/armnn/backends/test/WorkloadDataValidation.cpp \
 	src/armnn/backends/test/TensorCopyUtils.cpp \
 	src/armnn/backends/test/LayerTests.cpp \
 	src/armnn/backends/test/CreateWorkloadRef.cpp \
+	src/armnn/backends/test/RefMemoryManagerTests.cpp \
+	src/armnn/backends/test/RefThreadPoolTests.cpp \
+	src/armnn/backends/test/Im2ColConvolutionTests.cpp \
+	src/armnn/backends/test/DepthwiseConvolutionTests.cpp \
+	src/armnn/backends/test/WinogradConvolutionTests.cpp \
+	src/armnn/backends/test/DataLayoutTests.cpp \
+	src/armnn/backends/test/BroadcastTests.cpp \
+	src/armnn/backends/test/RefUint8KernelTests.cpp \
 	src/armnn/backends/test/ArmComputeCl.cpp \
 	src/armnn/backends/test/ArmComputeNeon.cpp \
 	src/armnn/backends/test/CreateWorkloadCl.cpp \
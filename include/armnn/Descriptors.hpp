@@ -40,9 +40,10 @@ struct PermuteDescriptor
 
 struct SoftmaxDescriptor
 {
-    SoftmaxDescriptor() : m_Beta(1.0f) {};
+    SoftmaxDescriptor() : m_Beta(1.0f), m_Axis(-1) {};
 
     float              m_Beta;
+    int                m_Axis; // Negative values count back from the last dimension.
 };
 
 
@@ -180,6 +181,7 @@ struct Pooling2dDescriptor
     , m_StrideY(0)
     , m_OutputShapeRounding(OutputShapeRounding::Floor)
     , m_PaddingMethod(PaddingMethod::Exclude)
+    , m_DataLayout(DataLayout::NCHW)
     {};
 
     PoolingAlgorithm    m_PoolType;
@@ -193,6 +195,7 @@ struct Pooling2dDescriptor
     uint32_t            m_StrideY;
     OutputShapeRounding m_OutputShapeRounding;
     PaddingMethod       m_PaddingMethod;
+    DataLayout          m_DataLayout;
 };
 
 struct FullyConnectedDescriptor
@@ -216,6 +219,7 @@ struct Convolution2dDescriptor
     , m_StrideX(0)
     , m_StrideY(0)
     , m_BiasEnabled(false)
+    , m_DataLayout(DataLayout::NCHW)
     {};
 
     uint32_t             m_PadLeft;
@@ -225,6 +229,7 @@ struct Convolution2dDescriptor
     uint32_t             m_StrideX;
     uint32_t             m_StrideY;
     bool                 m_BiasEnabled;
+    DataLayout           m_DataLayout;
 };
 
 struct DepthwiseConvolution2dDescriptor
@@ -237,6 +242,7 @@ struct DepthwiseConvolution2dDescriptor
     ,   m_StrideX(0)
     ,   m_StrideY(0)
     ,   m_BiasEnabled(false)
+    ,   m_DataLayout(DataLayout::NCHW)
     {}
 
     uint32_t m_PadLeft;
@@ -246,6 +252,7 @@ struct DepthwiseConvolution2dDescriptor
     uint32_t m_StrideX;
     uint32_t m_StrideY;
     bool     m_BiasEnabled;
+    DataLayout m_DataLayout;
 };
 
 
@@ -258,6 +265,7 @@ struct NormalizationDescriptor
     , m_Alpha(0.f)
     , m_Beta(0.f)
     , m_K(0.f)
+    , m_DataLayout(DataLayout::NCHW)
     {}
 
     NormalizationAlgorithmChannel m_NormChannelType;
@@ -266,6 +274,7 @@ struct NormalizationDescriptor
     float                         m_Alpha;
     float                         m_Beta;
     float                         m_K;
+    DataLayout                    m_DataLayout;
 };
 
 struct BatchNormalizationDescriptor
@@ -293,10 +302,12 @@ struct ResizeBilinearDescriptor
     ResizeBilinearDescriptor()
     : m_TargetWidth(0)
     , m_TargetHeight(0)
+    , m_DataLayout(DataLayout::NCHW)
     {}
 
     uint32_t m_TargetWidth;
     uint32_t m_TargetHeight;
+    DataLayout m_DataLayout;
 };
 
 struct ReshapeDescriptor
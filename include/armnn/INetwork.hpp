@@ -290,15 +290,21 @@ protected:
 
 struct OptimizerOptions
 {
-    OptimizerOptions() : m_ReduceFp32ToFp16(false) {}
+    OptimizerOptions() : m_ReduceFp32ToFp16(false), m_FusePointwiseConvolutions(false) {}
 
-    OptimizerOptions(bool reduceFp32ToFp16)
+    OptimizerOptions(bool reduceFp32ToFp16, bool fusePointwiseConvolutions = false)
         : m_ReduceFp32ToFp16(reduceFp32ToFp16)
+        , m_FusePointwiseConvolutions(fusePointwiseConvolutions)
     {
     }
 
     // Reduce Fp32 data to Fp16 for faster processing
     bool m_ReduceFp32ToFp16;
+
+    /// Fuse the 1x1 convolutions following CpuRef depthwise convolutions into them, so that the output of the
+    /// depthwise convolution is never written out whole. This saves memory bandwidth on cores with small caches, but
+    /// can be slower than running both layers separately on cores whose caches hold the intermediate tensor.
+    bool m_FusePointwiseConvolutions;
 };
 
 /// Create an optimized version of the network
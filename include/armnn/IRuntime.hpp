@@ -4,6 +4,9 @@
 //
 #pragma once
 
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
 
 #include "Types.hpp"
@@ -22,6 +25,68 @@ class IGpuAccTunedParameters;
 class IRuntime;
 using IRuntimePtr = std::unique_ptr<IRuntime, void(*)(IRuntime* runtime)>;
 
+/// Working memory for the execution of a loaded network: it owns the intermediate tensors and the workloads
+/// operating on them, while the constant tensors of the network are shared by all the handles.
+/// Each thread running inferences on the same network concurrently must use its own handle.
+/// A handle must be destroyed before the network it was created from is unloaded.
+class IWorkingMemHandle
+{
+public:
+    virtual ~IWorkingMemHandle() {}
+
+    /// Returns the unique identifier of the network the working memory was created for.
+    virtual NetworkId GetNetworkId() const = 0;
+};
+
+using IWorkingMemHandlePtr = std::unique_ptr<IWorkingMemHandle>;
+
+/// Called exactly once for each inference enqueued with IRuntime::EnqueueWorkloadAsync(), which reports its errors
+/// only through this callback: the worker thread that ran the inference calls it with the status of the inference,
+/// and the calling thread calls it with Status::Failure straight away if the network is not loaded.
+/// The callback cannot unload any network from a worker thread: IRuntime::UnloadNetwork() then fails.
+using InferenceCompleteCallback = std::function<void(Status status)>;
+
+/// Options of the batching of the samples enqueued for a network with IRuntime::EnqueueSample().
+struct BatchingOptions
+{
+    BatchingOptions()
+        : m_MaxBatchSize(0)
+        , m_Timeout(std::chrono::milliseconds(5))
+    {}
+
+    /// Largest number of samples evaluated in one inference, at most the batch size of the network. If 0, the batch
+    /// size of the network is used.
+    unsigned int m_MaxBatchSize;
+
+    /// Longest time the oldest pending sample waits for others to fill a batch, after which the batch is evaluated
+    /// with the samples pending at that time.
+    std::chrono::microseconds m_Timeout;
+};
+
+/// Outcome of the evaluation of a sample enqueued with IRuntime::EnqueueSample().
+struct SampleResult
+{
+    Status m_Status;
+
+    /// Number of samples evaluated in the same inference, including this one.
+    unsigned int m_BatchSize;
+
+    /// Time from the enqueueing of the sample to the start of the inference of its batch.
+    std::chrono::microseconds m_QueueWaitTime;
+
+    /// Time taken by the inference of the batch, including gathering the inputs of its samples and scattering the
+    /// outputs back to them.
+    std::chrono::microseconds m_ExecuteTime;
+};
+
+/// Called exactly once for each sample enqueued with IRuntime::EnqueueSample(), which reports its errors only through
+/// this callback, as for InferenceCompleteCallback: the thread batching the samples of the network calls it with
+/// the outcome of the evaluation of the sample, and the calling thread calls it straight away with Status::Failure
+/// and a batch size of 0 if the network is not loaded or not batched, or if the tensors do not hold one sample of
+/// its bindings. Exceptions thrown by the callback are logged and discarded. The callback cannot unload the network
+/// of the sample from the batching thread: IRuntime::UnloadNetwork() then fails.
+using SampleCompleteCallback = std::function<void(const SampleResult& result)>;
+
 class IRuntime
 {
 public:
@@ -30,6 +95,9 @@ public:
         CreationOptions()
             : m_GpuAccTunedParameters(nullptr)
             , m_EnableGpuProfiling(false)
+            , m_NumWorkerThreads(0)
+            , m_NumCpuRefThreads(1)
+            , m_NumInterOpThreads(1)
         {}
 
         /// If set, uses the GpuAcc tuned parameters from the given object when executing GPU workloads.
@@ -38,6 +106,22 @@ public:
 
         // Setting this flag will allow the user to obtain GPU profiling information from the runtime.
         bool m_EnableGpuProfiling;
+
+        /// Number of threads of the pool running the inferences enqueued with EnqueueWorkloadAsync().
+        /// If 0, one thread per hardware thread is used. The threads are only started on the first asynchronous
+        /// inference.
+        unsigned int m_NumWorkerThreads;
+
+        /// Number of threads sharing the work of each CpuRef layer. If 0, one thread per hardware thread is used.
+        /// The results do not depend on the number of threads.
+        unsigned int m_NumCpuRefThreads;
+
+        /// Number of threads running the independent layers of a network at the same time, including the thread
+        /// evaluating it. If 1, the layers run one after the other in topological order. If 0, one thread per
+        /// hardware thread is used. Only networks running entirely on CpuRef are affected: their intermediate tensors
+        /// then each get memory of their own, instead of sharing it with the tensors which are not alive at the same
+        /// time. The layers run one after the other while profiling is enabled.
+        unsigned int m_NumInterOpThreads;
     };
 
     static IRuntime* CreateRaw(const CreationOptions& options);
@@ -69,7 +153,80 @@ public:
                                    const InputTensors& inputTensors,
                                    const OutputTensors& outputTensors) = 0;
 
-    /// Unloads a network from the IRuntime.
+    /// Enqueues the evaluation of a network on the worker pool of the runtime, and returns immediately.
+    /// Several inferences, possibly of different networks, may run at the same time. The memory of inputTensors
+    /// and outputTensors must remain valid until the inference has completed.
+    /// @param [in] callback - Notified with the status of the inference, as described for InferenceCompleteCallback.
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      InferenceCompleteCallback callback) = 0;
+
+    /// Enqueues the evaluation of a network on the worker pool of the runtime, and returns immediately.
+    /// The memory of inputTensors and outputTensors must remain valid until the inference has completed.
+    /// @return A future holding the status of the inference once it has completed, or Status::Failure if the network
+    ///         is not loaded.
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors) = 0;
+
+    /// Sets the priority of the asynchronous inferences of a network. Networks have a Medium priority by default.
+    virtual Status SetNetworkPriority(NetworkId networkId, QosExecPriority priority) = 0;
+
+    /// Starts batching the samples enqueued for a network with EnqueueSample(). The first dimension of every input
+    /// and output of the network is its batch size, and the samples of a batch must be evaluated independently of
+    /// each other. Batches of fewer samples than the batch size of the network are padded with unspecified data.
+    /// Fails if the network is not loaded, is already batched, or if its inputs and outputs do not have the same
+    /// batch size.
+    virtual Status EnableBatching(NetworkId networkId, const BatchingOptions& options) = 0;
+
+    /// Enqueues a single sample for a network batched with EnableBatching(), and returns immediately. The sample is
+    /// evaluated with the other samples pending for the network, once there are enough of them to fill a batch or
+    /// once it has waited for the timeout of the batching options. Each tensor holds the data of one sample: its
+    /// size is that of the input or output of the network with the same binding, divided by the batch size.
+    /// The memory of inputTensors and outputTensors must remain valid until the sample has been evaluated.
+    /// @param [in] callback - Notified with the outcome of the evaluation of the sample, as described for
+    ///                        SampleCompleteCallback.
+    virtual void EnqueueSample(NetworkId networkId,
+                               const InputTensors& inputTensors,
+                               const OutputTensors& outputTensors,
+                               SampleCompleteCallback callback) = 0;
+
+    /// Enqueues a single sample for a network batched with EnableBatching(), and returns immediately.
+    /// The memory of inputTensors and outputTensors must remain valid until the sample has been evaluated.
+    /// @return A future holding the outcome of the evaluation of the sample, or Status::Failure if the sample could
+    ///         not be enqueued.
+    virtual std::future<SampleResult> EnqueueSample(NetworkId networkId,
+                                                    const InputTensors& inputTensors,
+                                                    const OutputTensors& outputTensors) = 0;
+
+    /// Creates the working memory needed to execute a loaded network, so that the network can be evaluated
+    /// from several threads at once, each of them using its own working memory.
+    /// Only networks running entirely on the CpuRef backend are supported.
+    /// @param [in] networkId - Unique identifier for the network. Generated in LoadNetwork().
+    /// @return A new working memory handle for the network.
+    virtual IWorkingMemHandlePtr CreateWorkingMemHandle(NetworkId networkId) = 0;
+
+    /// Evaluates a network using the given working memory, input in inputTensors and outputs filled into
+    /// outputTensors. This can be called concurrently for the same network as long as the working memory
+    /// handles differ.
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) = 0;
+
+    /// Binds the memory of inputTensors and outputTensors to the inputs and outputs of the network evaluated
+    /// with the given working memory. The workloads copying data in and out of the network are created once here,
+    /// so that Execute(workingMemHandle) does not allocate anything.
+    /// The memory must remain valid until other tensors are bound or the working memory is destroyed.
+    virtual Status BindTensors(IWorkingMemHandle& workingMemHandle,
+                               const InputTensors& inputTensors,
+                               const OutputTensors& outputTensors) = 0;
+
+    /// Evaluates a network using the given working memory and the tensors previously bound to it with BindTensors().
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle) = 0;
+
+    /// Unloads a network from the IRuntime. The samples still pending for the network, if batched, are evaluated
+    /// first.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
     /// @param [in] networkId - Unique identifier for the network to be unloaded. Generated in LoadNetwork().
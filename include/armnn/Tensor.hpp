@@ -10,6 +10,7 @@
 
 #include <array>
 #include <initializer_list>
+#include <memory>
 #include <vector>
 
 namespace armnn
@@ -159,6 +160,19 @@ public:
     /// Can be implicitly constructed from non-const Tensor.
     ConstTensor(const Tensor& other) : BaseTensor<const void*>(other.GetInfo(), other.GetMemoryArea()) {}
 
+    /// Constructor from a memory region whose ownership is shared with ArmNN.
+    /// @param memoryArea - Region of CPU-addressable memory holding the tensor data, which must not be modified.
+    /// The constant tensors of layers created from this tensor reference the memory region rather than copying it,
+    /// and keep it alive for as long as they need it.
+    ConstTensor(const TensorInfo& info, std::shared_ptr<const void> memoryArea)
+        : BaseTensor<const void*>(info, memoryArea.get())
+        , m_SharedMemoryArea(std::move(memoryArea))
+    {
+    }
+
+    /// Returns the owner of the memory region, if it is shared with ArmNN.
+    const std::shared_ptr<const void>& GetSharedMemoryArea() const { return m_SharedMemoryArea; }
+
     /// Constructor from a backing container.
     /// @param container - An stl-like container type which implements data() and size() methods.
     /// Presence of data() and size() is a strong indicator of the continuous memory layout of the container,
@@ -173,6 +187,9 @@ public:
             throw InvalidArgumentException("Container size is not correct");
         }
     }
+
+private:
+    std::shared_ptr<const void> m_SharedMemoryArea;
 };
 
 using InputTensors = std::vector<std::pair<LayerBindingId, class ConstTensor>>;
@@ -80,6 +80,14 @@ enum class NormalizationAlgorithmMethod
     LocalContrast = 1
 };
 
+/// The order of the dimensions of the 4D tensors of convolution, pooling, normalization and resize layers.
+/// Weights of convolutions are laid out like the data: [O, I, H, W] for NCHW and [O, H, W, I] for NHWC.
+enum class DataLayout
+{
+    NCHW = 0,
+    NHWC = 1
+};
+
 enum class OutputShapeRounding
 {
     Floor       = 0,
@@ -97,6 +105,15 @@ enum class Compute
     Undefined   = 5
 };
 
+/// Priority of the inferences of a network run asynchronously by the runtime.
+/// Pending inferences of higher priority networks are started first.
+enum class QosExecPriority
+{
+    Low     = 0,
+    Medium  = 1,
+    High    = 2
+};
+
 class IDeviceSpec
 {
 protected:
@@ -86,6 +86,16 @@ constexpr char const* GetPaddingMethodAsCString(PaddingMethod method)
     }
 }
 
+constexpr char const* GetDataLayoutAsCString(DataLayout layout)
+{
+    switch (layout)
+    {
+        case DataLayout::NCHW:  return "NCHW";
+        case DataLayout::NHWC:  return "NHWC";
+        default:                return "Unknown";
+    }
+}
+
 constexpr unsigned int GetDataTypeSize(DataType dataType)
 {
     switch (dataType)
@@ -25,13 +25,31 @@ using ITfLiteParserPtr = std::unique_ptr<ITfLiteParser, void(*)(ITfLiteParser* p
 class ITfLiteParser
 {
 public:
-    static ITfLiteParser* CreateRaw();
-    static ITfLiteParserPtr Create();
+    struct CreationOptions
+    {
+        CreationOptions()
+            : m_UseNhwcLayers(false)
+        {
+        }
+
+        /// The convolution and pooling layers work directly on the NHWC tensors of the model, and use its filters
+        /// as they are, rather than on NCHW tensors permuted before and after each of them. This saves the permutes
+        /// and lets mapped models reference their filters, but only the CpuRef backend supports NHWC layers.
+        bool m_UseNhwcLayers;
+    };
+
+    static ITfLiteParser* CreateRaw(const CreationOptions& options = CreationOptions());
+    static ITfLiteParserPtr Create(const CreationOptions& options = CreationOptions());
     static void Destroy(ITfLiteParser* parser);
 
     /// Create the network from a flatbuffers binary file on disk
     virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) = 0;
 
+    /// Create the network from a flatbuffers binary file on disk, which is mapped into memory rather than read.
+    /// The constant tensors of the network point into the mapping where possible, so the file must not be modified
+    /// while it is in use. The mapping is released with the last network, optimized or loaded, which references it.
+    virtual armnn::INetworkPtr CreateNetworkFromMappedBinaryFile(const char* graphFile) = 0;
+
     /// Create the network from a flatbuffers binary
     virtual armnn::INetworkPtr CreateNetworkFromBinary(const std::vector<uint8_t> & binaryContent) = 0;
 
@@ -25,8 +25,21 @@ using ITfParserPtr = std::unique_ptr<ITfParser, void(*)(ITfParser* parser)>;
 class ITfParser
 {
 public:
-    static ITfParser* CreateRaw();
-    static ITfParserPtr Create();
+    struct CreationOptions
+    {
+        CreationOptions()
+            : m_UseNhwcLayers(false)
+        {
+        }
+
+        /// The convolution, pooling, normalization and resize layers work directly on the NHWC tensors of the nodes
+        /// in that data format, rather than on NCHW tensors permuted before and after each of them. This saves the
+        /// permutes, but only the CpuRef backend supports NHWC layers.
+        bool m_UseNhwcLayers;
+    };
+
+    static ITfParser* CreateRaw(const CreationOptions& options = CreationOptions());
+    static ITfParserPtr Create(const CreationOptions& options = CreationOptions());
     static void Destroy(ITfParser* parser);
 
     /// Create the network from a protobuf text file on the disk.
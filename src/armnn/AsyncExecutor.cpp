@@ -0,0 +1,132 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "AsyncExecutor.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+AsyncExecutor::AsyncExecutor(unsigned int numThreads)
+    : m_Stopping(false)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    m_Threads.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Threads.emplace_back(&AsyncExecutor::WorkerLoop, this);
+    }
+
+    BOOST_LOG_TRIVIAL(debug) << "AsyncExecutor: started " << numThreads << " worker threads";
+}
+
+AsyncExecutor::~AsyncExecutor()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_JobAvailable.notify_all();
+
+    for (auto&& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void AsyncExecutor::Schedule(NetworkId networkId, QosExecPriority priority, Job job)
+{
+    BOOST_ASSERT(static_cast<size_t>(priority) < ms_NumPriorities);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_PendingJobs[static_cast<size_t>(priority)].push_back({ networkId, std::move(job) });
+        ++m_NumUnfinishedJobs[networkId];
+    }
+    m_JobAvailable.notify_one();
+}
+
+void AsyncExecutor::WaitForNetwork(NetworkId networkId)
+{
+    BOOST_ASSERT(!IsWorkerThread());
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_JobCompleted.wait(lock, [this, networkId]()
+        {
+            return m_NumUnfinishedJobs.find(networkId) == m_NumUnfinishedJobs.end();
+        });
+}
+
+bool AsyncExecutor::IsWorkerThread() const
+{
+    const std::thread::id threadId = std::this_thread::get_id();
+    return std::any_of(m_Threads.begin(), m_Threads.end(),
+                       [threadId](const std::thread& thread) { return thread.get_id() == threadId; });
+}
+
+std::deque<AsyncExecutor::PendingJob>* AsyncExecutor::GetHighestPriorityQueue()
+{
+    for (auto it = m_PendingJobs.rbegin(); it != m_PendingJobs.rend(); ++it)
+    {
+        if (!it->empty())
+        {
+            return &*it;
+        }
+    }
+    return nullptr;
+}
+
+void AsyncExecutor::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        std::deque<PendingJob>* queue = nullptr;
+        m_JobAvailable.wait(lock, [this, &queue]()
+            {
+                queue = GetHighestPriorityQueue();
+                return queue != nullptr || m_Stopping;
+            });
+
+        if (queue == nullptr)
+        {
+            // Stopping, and every pending job has been started.
+            return;
+        }
+
+        PendingJob pendingJob = std::move(queue->front());
+        queue->pop_front();
+
+        lock.unlock();
+        try
+        {
+            pendingJob.m_Job();
+        }
+        catch (const std::exception& e)
+        {
+            BOOST_LOG_TRIVIAL(error) << "AsyncExecutor: an asynchronous job failed: " << e.what();
+        }
+        catch (...)
+        {
+            BOOST_LOG_TRIVIAL(error) << "AsyncExecutor: an asynchronous job failed with an unknown exception";
+        }
+        lock.lock();
+
+        auto it = m_NumUnfinishedJobs.find(pendingJob.m_NetworkId);
+        BOOST_ASSERT(it != m_NumUnfinishedJobs.end());
+        if (--it->second == 0)
+        {
+            m_NumUnfinishedJobs.erase(it);
+        }
+        m_JobCompleted.notify_all();
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,78 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include "armnn/IRuntime.hpp"
+#include "armnn/Types.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+/// Pool of worker threads running the inferences enqueued asynchronously on a runtime.
+/// Pending jobs are started by decreasing priority, and in submission order for a given priority.
+class AsyncExecutor
+{
+public:
+    using Job = std::function<void()>;
+
+    /// Starts the worker threads. If numThreads is 0, one thread per hardware thread is started.
+    explicit AsyncExecutor(unsigned int numThreads);
+
+    /// Runs the jobs still pending, then stops the worker threads.
+    ~AsyncExecutor();
+
+    AsyncExecutor(const AsyncExecutor&) = delete;
+    AsyncExecutor& operator=(const AsyncExecutor&) = delete;
+
+    /// Enqueues a job working on the given network.
+    void Schedule(NetworkId networkId, QosExecPriority priority, Job job);
+
+    /// Blocks until all the jobs scheduled so far for the given network have completed. Must not be called from a
+    /// worker thread, which would wait for itself.
+    void WaitForNetwork(NetworkId networkId);
+
+    /// Whether the caller is one of the worker threads, i.e. a job.
+    bool IsWorkerThread() const;
+
+    unsigned int GetNumThreads() const { return static_cast<unsigned int>(m_Threads.size()); }
+
+private:
+    struct PendingJob
+    {
+        NetworkId m_NetworkId;
+        Job m_Job;
+    };
+
+    void WorkerLoop();
+
+    /// Returns the queue of the highest priority holding pending jobs, or nullptr if there are none.
+    std::deque<PendingJob>* GetHighestPriorityQueue();
+
+    static constexpr size_t ms_NumPriorities = static_cast<size_t>(QosExecPriority::High) + 1;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_JobAvailable;
+    std::condition_variable m_JobCompleted;
+
+    /// Pending jobs, indexed by priority.
+    std::array<std::deque<PendingJob>, ms_NumPriorities> m_PendingJobs;
+
+    /// Number of jobs pending or running for each network.
+    std::unordered_map<NetworkId, unsigned int> m_NumUnfinishedJobs;
+
+    bool m_Stopping;
+    std::vector<std::thread> m_Threads;
+};
+
+} // namespace armnn
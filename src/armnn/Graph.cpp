@@ -135,7 +135,7 @@ Status Graph::SerializeToDot(std::ostream& stream)
     return Status::Success;
 }
 
-Status Graph::AllocateDynamicBuffers()
+Status Graph::AllocateDynamicBuffers(bool reuseMemory)
 {
     // Layers must be sorted in topological order
     BOOST_ASSERT(m_LayersInOrder);
@@ -189,7 +189,12 @@ Status Graph::AllocateDynamicBuffers()
         {
             ITensorHandle *tensorHandle = TraceSubTensorHandleAncestry(slot->GetOutputHandler().GetData());
 
-            if (tensorHandle && !IsPreallocated(tensorHandle))
+            if (tensorHandle && !IsPreallocated(tensorHandle) && !reuseMemory)
+            {
+                tensorHandle->Allocate();
+                preallocatedTensors.insert(tensorHandle);
+            }
+            else if (tensorHandle && !IsPreallocated(tensorHandle))
             {
                 unsigned int numConnections = slot->GetNumConnections();
                 if (handleReferenceCounts.find(tensorHandle) == handleReferenceCounts.end())
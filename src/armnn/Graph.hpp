@@ -153,7 +153,10 @@ public:
     size_t GetNumLayers() const { return m_Layers.size(); }
 
     /// Allocates memory for all tensors under output tensor handers of each layer.
-    Status AllocateDynamicBuffers();
+    /// If reuseMemory is false, every tensor gets memory of its own rather than sharing it with the tensors whose
+    /// lifetimes do not overlap in topological order, so that the layers may run in any order which respects their
+    /// connections.
+    Status AllocateDynamicBuffers(bool reuseMemory = true);
 
     /// Modifies the graph in-place, removing edges connecting layers using different compute devices,
     /// and relinking them via an intermediary copy layers.
@@ -0,0 +1,251 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "InferenceBatcher.hpp"
+
+#include "armnn/Exceptions.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/format.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace armnn
+{
+
+namespace
+{
+
+unsigned int GetBatchSize(const InferenceBatcher::BindingInfos& inputInfos)
+{
+    if (inputInfos.empty() || inputInfos.front().second.GetNumDimensions() == 0)
+    {
+        throw InvalidArgumentException("InferenceBatcher: the network has no input with a batch dimension");
+    }
+    return inputInfos.front().second.GetShape()[0];
+}
+
+template <typename TensorType>
+const TensorType& GetSampleTensor(LayerBindingId id,
+                                  const std::vector<std::pair<LayerBindingId, TensorType>>& tensors,
+                                  const char* bindingPointDesc)
+{
+    auto it = std::find_if(tensors.begin(), tensors.end(),
+        [id](const std::pair<LayerBindingId, TensorType>& tensor)
+        {
+            return tensor.first == id;
+        });
+
+    if (it == tensors.end())
+    {
+        throw InvalidArgumentException(boost::str(
+            boost::format("InferenceBatcher: no tensor supplied for %1% %2%") % bindingPointDesc % id));
+    }
+    return it->second;
+}
+
+} // anonymous namespace
+
+InferenceBatcher::InferenceBatcher(const BindingInfos& inputInfos,
+                                   const BindingInfos& outputInfos,
+                                   const BatchingOptions& options,
+                                   Executor executor)
+    : m_MaxBatchSize(options.m_MaxBatchSize != 0 ? options.m_MaxBatchSize : GetBatchSize(inputInfos))
+    , m_Timeout(options.m_Timeout)
+    , m_Executor(std::move(executor))
+    , m_Inputs(MakeBindings(inputInfos, GetBatchSize(inputInfos)))
+    , m_Outputs(MakeBindings(outputInfos, GetBatchSize(inputInfos)))
+    , m_Stopping(false)
+{
+    if (m_MaxBatchSize > GetBatchSize(inputInfos))
+    {
+        throw InvalidArgumentException(boost::str(
+            boost::format("InferenceBatcher: the maximum batch size %1% exceeds the batch size of the network %2%")
+            % m_MaxBatchSize % GetBatchSize(inputInfos)));
+    }
+
+    m_Thread = std::thread(&InferenceBatcher::DispatchLoop, this);
+}
+
+InferenceBatcher::~InferenceBatcher()
+{
+    // The batching thread cannot join itself.
+    BOOST_ASSERT(!IsBatchingThread());
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stopping = true;
+    }
+    m_SampleAvailable.notify_all();
+    m_Thread.join();
+}
+
+std::vector<InferenceBatcher::Binding> InferenceBatcher::MakeBindings(const BindingInfos& infos,
+                                                                      unsigned int batchSize)
+{
+    std::vector<Binding> bindings;
+    for (auto&& info : infos)
+    {
+        const TensorShape& shape = info.second.GetShape();
+        if (shape.GetNumDimensions() == 0 || shape[0] != batchSize)
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("InferenceBatcher: binding %1% does not have the batch size %2% of the network")
+                % info.first % batchSize));
+        }
+
+        bindings.push_back({ info.first, info.second, info.second.GetNumBytes() / batchSize,
+                             std::vector<unsigned char>(info.second.GetNumBytes()) });
+    }
+    return bindings;
+}
+
+void InferenceBatcher::Enqueue(const InputTensors& inputTensors,
+                               const OutputTensors& outputTensors,
+                               SampleCompleteCallback callback)
+{
+    if (inputTensors.size() != m_Inputs.size() || outputTensors.size() != m_Outputs.size())
+    {
+        throw InvalidArgumentException("InferenceBatcher: number of tensors provided does not match network.");
+    }
+
+    auto checkSampleSize = [](const Binding& binding, const TensorInfo& info)
+        {
+            if (info.GetDataType() != binding.m_Info.GetDataType() || info.GetNumBytes() != binding.m_SampleNumBytes)
+            {
+                throw InvalidArgumentException(boost::str(
+                    boost::format("InferenceBatcher: the tensor supplied for binding %1% does not hold one sample")
+                    % binding.m_Id));
+            }
+        };
+    for (const Binding& binding : m_Inputs)
+    {
+        checkSampleSize(binding, GetSampleTensor(binding.m_Id, inputTensors, "input").GetInfo());
+    }
+    for (const Binding& binding : m_Outputs)
+    {
+        checkSampleSize(binding, GetSampleTensor(binding.m_Id, outputTensors, "output").GetInfo());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_PendingSamples.push_back({ inputTensors, outputTensors, std::move(callback), Clock::now() });
+    }
+    m_SampleAvailable.notify_one();
+}
+
+void InferenceBatcher::DispatchLoop()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_SampleAvailable.wait(lock, [this]() { return !m_PendingSamples.empty() || m_Stopping; });
+        if (m_PendingSamples.empty())
+        {
+            return;
+        }
+
+        // Waits for the batch to fill up until the oldest sample has waited for the timeout. Once stopping, the
+        // pending samples are evaluated straight away.
+        const Clock::time_point deadline = m_PendingSamples.front().m_EnqueueTime + m_Timeout;
+        m_SampleAvailable.wait_until(lock, deadline, [this]()
+            {
+                return m_PendingSamples.size() >= m_MaxBatchSize || m_Stopping;
+            });
+
+        const auto batchSize = static_cast<std::deque<PendingSample>::difference_type>(
+            std::min(m_PendingSamples.size(), static_cast<size_t>(m_MaxBatchSize)));
+        std::vector<PendingSample> batch(std::make_move_iterator(m_PendingSamples.begin()),
+                                         std::make_move_iterator(m_PendingSamples.begin() + batchSize));
+        m_PendingSamples.erase(m_PendingSamples.begin(), m_PendingSamples.begin() + batchSize);
+
+        // Samples keep queuing up while the batch is evaluated.
+        lock.unlock();
+        RunBatch(batch);
+        lock.lock();
+    }
+}
+
+void InferenceBatcher::RunBatch(std::vector<PendingSample>& batch)
+{
+    BOOST_ASSERT(!batch.empty() && batch.size() <= m_MaxBatchSize);
+    const Clock::time_point start = Clock::now();
+
+    InputTensors inputTensors;
+    for (Binding& binding : m_Inputs)
+    {
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            const ConstTensor& sample = GetSampleTensor(binding.m_Id, batch[i].m_InputTensors, "input");
+            std::memcpy(binding.m_Data.data() + i * binding.m_SampleNumBytes, sample.GetMemoryArea(),
+                        binding.m_SampleNumBytes);
+        }
+        inputTensors.push_back({ binding.m_Id, ConstTensor(binding.m_Info, binding.m_Data.data()) });
+    }
+
+    OutputTensors outputTensors;
+    for (Binding& binding : m_Outputs)
+    {
+        outputTensors.push_back({ binding.m_Id, Tensor(binding.m_Info, binding.m_Data.data()) });
+    }
+
+    Status status = Status::Failure;
+    try
+    {
+        status = m_Executor(inputTensors, outputTensors);
+    }
+    catch (const std::exception& e)
+    {
+        BOOST_LOG_TRIVIAL(error) << "InferenceBatcher: inference of a batch of " << batch.size()
+                                 << " samples failed: " << e.what();
+    }
+    catch (...)
+    {
+        BOOST_LOG_TRIVIAL(error) << "InferenceBatcher: inference of a batch of " << batch.size()
+                                 << " samples failed with an unknown exception";
+    }
+
+    if (status == Status::Success)
+    {
+        for (const Binding& binding : m_Outputs)
+        {
+            for (size_t i = 0; i < batch.size(); ++i)
+            {
+                const Tensor& sample = GetSampleTensor(binding.m_Id, batch[i].m_OutputTensors, "output");
+                std::memcpy(sample.GetMemoryArea(), binding.m_Data.data() + i * binding.m_SampleNumBytes,
+                            binding.m_SampleNumBytes);
+            }
+        }
+    }
+
+    const Clock::time_point end = Clock::now();
+    for (const PendingSample& sample : batch)
+    {
+        SampleResult result;
+        result.m_Status = status;
+        result.m_BatchSize = static_cast<unsigned int>(batch.size());
+        result.m_QueueWaitTime = std::chrono::duration_cast<std::chrono::microseconds>(start - sample.m_EnqueueTime);
+        result.m_ExecuteTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        if (sample.m_Callback)
+        {
+            // A throwing callback must neither terminate the batching thread nor deprive the others of their result.
+            try
+            {
+                sample.m_Callback(result);
+            }
+            catch (const std::exception& e)
+            {
+                BOOST_LOG_TRIVIAL(error) << "InferenceBatcher: sample callback threw an exception: " << e.what();
+            }
+            catch (...)
+            {
+                BOOST_LOG_TRIVIAL(error) << "InferenceBatcher: sample callback threw an unknown exception";
+            }
+        }
+    }
+}
+
+} // namespace armnn
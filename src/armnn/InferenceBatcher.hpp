@@ -0,0 +1,97 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include "armnn/IRuntime.hpp"
+#include "armnn/Tensor.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// Coalesces the single samples enqueued for a network into batches, evaluates each batch with one inference of the
+/// network and scatters the outputs back to the samples.
+/// The batches are formed and evaluated one at a time by a thread of this object, while the next samples queue up.
+class InferenceBatcher
+{
+public:
+    using BindingInfos = std::vector<std::pair<LayerBindingId, TensorInfo>>;
+
+    /// Evaluates the network on whole batches.
+    using Executor = std::function<Status(const InputTensors& inputTensors, const OutputTensors& outputTensors)>;
+
+    /// @param inputInfos, outputInfos - Bindings of the inputs and outputs of the network, whose first dimension is
+    ///                                  the batch size of the network.
+    /// Throws an InvalidArgumentException if the network or the options cannot be batched.
+    InferenceBatcher(const BindingInfos& inputInfos,
+                     const BindingInfos& outputInfos,
+                     const BatchingOptions& options,
+                     Executor executor);
+
+    /// Evaluates the samples still pending, then stops the batching thread. Must not be called from the batching
+    /// thread.
+    ~InferenceBatcher();
+
+    InferenceBatcher(const InferenceBatcher&) = delete;
+    InferenceBatcher& operator=(const InferenceBatcher&) = delete;
+
+    /// Queues a sample, whose tensors are checked against the bindings of the network.
+    void Enqueue(const InputTensors& inputTensors, const OutputTensors& outputTensors, SampleCompleteCallback callback);
+
+    unsigned int GetMaxBatchSize() const { return m_MaxBatchSize; }
+
+    /// Whether the caller is the batching thread, i.e. a SampleCompleteCallback, which must not destroy this object.
+    bool IsBatchingThread() const { return std::this_thread::get_id() == m_Thread.get_id(); }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /// An input or output of the network, with the memory holding it for a whole batch.
+    struct Binding
+    {
+        LayerBindingId m_Id;
+        TensorInfo m_Info;
+        unsigned int m_SampleNumBytes;
+        std::vector<unsigned char> m_Data;
+    };
+
+    struct PendingSample
+    {
+        InputTensors m_InputTensors;
+        OutputTensors m_OutputTensors;
+        SampleCompleteCallback m_Callback;
+        Clock::time_point m_EnqueueTime;
+    };
+
+    static std::vector<Binding> MakeBindings(const BindingInfos& infos, unsigned int batchSize);
+
+    void DispatchLoop();
+    void RunBatch(std::vector<PendingSample>& batch);
+
+    unsigned int m_MaxBatchSize;
+    Clock::duration m_Timeout;
+    Executor m_Executor;
+
+    /// The data of the bindings is only accessed by the batching thread.
+    std::vector<Binding> m_Inputs;
+    std::vector<Binding> m_Outputs;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_SampleAvailable;
+    std::deque<PendingSample> m_PendingSamples;
+    bool m_Stopping;
+
+    std::thread m_Thread;
+};
+
+} // namespace armnn
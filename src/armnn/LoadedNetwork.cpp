@@ -22,6 +22,8 @@
 #include <boost/format.hpp>
 #include <boost/log/trivial.hpp>
 
+#include <cstdint>
+
 namespace armnn
 {
 
@@ -47,16 +49,138 @@ std::string ToErrorMessage(const char * prefix, const cl::Error& error)
 }
 #endif
 
+// Takes the tensor handles out of the output handlers of a graph, giving them back on destruction.
+// This allows new tensor handles to be temporarily created for the graph, without losing the original ones.
+class ScopedTensorHandleStash
+{
+public:
+    explicit ScopedTensorHandleStash(Graph& graph)
+        : m_Graph(graph)
+    {
+        for (auto&& layer : m_Graph)
+        {
+            for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+            {
+                m_TensorHandles.push_back(layer->GetOutputHandler(i).ReleaseData());
+            }
+        }
+    }
+
+    ~ScopedTensorHandleStash()
+    {
+        auto it = m_TensorHandles.begin();
+        for (auto&& layer : m_Graph)
+        {
+            for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+            {
+                BOOST_ASSERT(it != m_TensorHandles.end());
+                layer->GetOutputHandler(i).SetData(std::move(*it++));
+            }
+        }
+    }
+
+private:
+    Graph& m_Graph;
+    std::vector<std::unique_ptr<ITensorHandle>> m_TensorHandles;
+};
+
+// The tensors read and written by the workload of a layer.
+struct WorkloadTensors
+{
+    explicit WorkloadTensors(const Layer& layer)
+    {
+        for (auto&& slot : layer.GetInputSlots())
+        {
+            m_Inputs.push_back(slot.GetConnectedOutputSlot()->GetOutputHandler().GetData());
+        }
+        for (unsigned int i = 0; i < layer.GetNumOutputSlots(); ++i)
+        {
+            m_Outputs.push_back(layer.GetOutputHandler(i).GetData());
+        }
+    }
+
+    std::vector<const ITensorHandle*> m_Inputs;
+    std::vector<const ITensorHandle*> m_Outputs;
+};
+
+struct MemoryRange
+{
+    uintptr_t m_Begin;
+    uintptr_t m_End;
+};
+
+std::vector<MemoryRange> GetMemoryRanges(const std::vector<const ITensorHandle*>& tensorHandles)
+{
+    std::vector<MemoryRange> ranges;
+    for (const ITensorHandle* tensorHandle : tensorHandles)
+    {
+        auto cpuTensorHandle = boost::polymorphic_downcast<const ConstCpuTensorHandle*>(tensorHandle);
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(cpuTensorHandle->GetConstTensor<void>());
+        ranges.push_back({ begin, begin + cpuTensorHandle->GetTensorInfo().GetNumBytes() });
+    }
+    return ranges;
+}
+
+bool Overlap(const std::vector<MemoryRange>& rangesA, const std::vector<MemoryRange>& rangesB)
+{
+    for (const MemoryRange& rangeA : rangesA)
+    {
+        for (const MemoryRange& rangeB : rangesB)
+        {
+            if (rangeA.m_Begin < rangeB.m_End && rangeB.m_Begin < rangeA.m_End)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Makes each workload depend on the earlier ones using memory it writes, or writing memory it reads, so that any
+// order respecting the dependencies gives the same results as the order of the queue. This covers the connections
+// between the layers as well as the sub-tensors of the splitter and merger layers, once the memory of the tensors
+// has been bound.
+std::unique_ptr<WorkloadDependencies> MakeWorkloadDependencies(const std::vector<WorkloadTensors>& workloadTensors)
+{
+    const unsigned int numWorkloads = static_cast<unsigned int>(workloadTensors.size());
+
+    std::vector<std::vector<MemoryRange>> reads;
+    std::vector<std::vector<MemoryRange>> writes;
+    for (const WorkloadTensors& tensors : workloadTensors)
+    {
+        reads.push_back(GetMemoryRanges(tensors.m_Inputs));
+        writes.push_back(GetMemoryRanges(tensors.m_Outputs));
+    }
+
+    auto dependencies = std::make_unique<WorkloadDependencies>(numWorkloads);
+    for (unsigned int successor = 0; successor < numWorkloads; ++successor)
+    {
+        for (unsigned int predecessor = 0; predecessor < successor; ++predecessor)
+        {
+            if (Overlap(writes[predecessor], reads[successor]) ||
+                Overlap(writes[predecessor], writes[successor]) ||
+                Overlap(reads[predecessor], writes[successor]))
+            {
+                dependencies->AddDependency(predecessor, successor);
+            }
+        }
+    }
+    return dependencies;
+}
+
 } // anonymous
 
 std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                                                                std::shared_ptr<RefThreadPool> refThreadPool,
+                                                                std::shared_ptr<WorkloadScheduler> workloadScheduler,
                                                                 std::string & errorMessage)
 {
     std::unique_ptr<LoadedNetwork> loadedNetwork;
 
     try
     {
-        loadedNetwork.reset(new LoadedNetwork(std::move(net)));
+        loadedNetwork.reset(new LoadedNetwork(std::move(net), std::move(refThreadPool),
+                                              std::move(workloadScheduler)));
     }
     catch (const std::runtime_error& error)
     {
@@ -82,9 +206,15 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
     return loadedNetwork;
 }
 
-LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
+LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                             std::shared_ptr<RefThreadPool> refThreadPool,
+                             std::shared_ptr<WorkloadScheduler> workloadScheduler)
     : m_CpuRef()
     , m_OptimizedNetwork(std::move(net))
+    , m_RefThreadPool(std::move(refThreadPool))
+    , m_WorkloadScheduler(std::move(workloadScheduler))
+    , m_SupportsWorkingMemHandles(true)
+    , m_Priority(QosExecPriority::Medium)
 {
     // Create a profiler and register it for the current thread.
     m_Profiler = std::make_shared<Profiler>();
@@ -98,8 +228,20 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
     for (auto&& layer : order)
     {
         layer->CreateTensorHandles(m_OptimizedNetwork->GetGraph(), GetWorkloadFactory(*layer));
+        m_SupportsWorkingMemHandles &= layer->GetComputeDevice() == Compute::CpuRef;
     }
 
+    // Only the CpuRef workloads can run concurrently, as the dependencies between them are found from the memory
+    // of their tensors.
+    if (!m_SupportsWorkingMemHandles)
+    {
+        m_WorkloadScheduler.reset();
+    }
+    std::vector<WorkloadTensors> workloadTensors;
+
+    // The CpuRef workloads size the buffers each thread of the pool works in for the pool they will run on.
+    ScopedRefThreadPool scopedRefThreadPool(m_RefThreadPool.get());
+
     //Then create workloads.
     for (auto&& layer : order)
     {
@@ -110,37 +252,40 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net)
         case LayerType::Input:
         case LayerType::Output:
             {
-                // Inputs and outputs are treated in a special way - see EnqueueInput() and EnqueueOutput().
+                // Inputs and outputs are treated in a special way - see MakeInputWorkload() and MakeOutputWorkload().
                 break;
             }
         default:
             {
-                auto workload = layer->CreateWorkload(m_OptimizedNetwork->GetGraph(), workloadFactory);
-
-                if (!workload)
+                m_WorkloadQueue.push_back(CreateWorkload(*layer, workloadFactory));
+                if (m_WorkloadScheduler)
                 {
-                    const char* const layerName = layer->GetNameStr().length() != 0 ? layer->GetName() : "<Unnamed>";
-                    throw InvalidArgumentException(boost::str(
-                        boost::format("No workload created for layer (name: '%1%' type: '%2%') (compute '%3%')")
-                        % layerName % static_cast<int>(layer->GetType()) % layer->GetComputeDevice()
-                    ));
+                    workloadTensors.emplace_back(*layer);
                 }
 
-                m_WorkloadQueue.push_back(move(workload));
-                // release the constant data in the layer..
-                layer->ReleaseConstantData();
+                // Release the constant data in the layer. Reference workloads read their constants from the layer
+                // rather than copying them, so that every working memory handle can share them.
+                if (layer->GetComputeDevice() != Compute::CpuRef)
+                {
+                    layer->ReleaseConstantData();
+                }
                 break;
             }
         }
     }
 
-    // Set up memory.
-    m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers();
+    // Set up memory. Tensors sharing memory in topological order would serialize the workloads run concurrently.
+    m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers(!m_WorkloadScheduler);
 
     // Finalize the workload factories before execution.
     m_CpuRef.Finalize();
     m_CpuAcc.Finalize();
     m_GpuAcc.Finalize();
+
+    if (m_WorkloadScheduler)
+    {
+        m_WorkloadDependencies = MakeWorkloadDependencies(workloadTensors);
+    }
 }
 
 TensorInfo LoadedNetwork::GetInputTensorInfo(LayerBindingId layerId) const
@@ -172,6 +317,44 @@ TensorInfo LoadedNetwork::GetOutputTensorInfo(LayerBindingId layerId) const
     throw InvalidArgumentException(boost::str(boost::format("No output layer is associated with id %1%") % layerId));
 }
 
+std::vector<std::pair<LayerBindingId, TensorInfo>> LoadedNetwork::GetInputBindingInfos() const
+{
+    std::vector<std::pair<LayerBindingId, TensorInfo>> bindingInfos;
+    for (auto&& inputLayer : m_OptimizedNetwork->GetGraph().GetInputLayers())
+    {
+        bindingInfos.emplace_back(inputLayer->GetBindingId(), inputLayer->GetOutputSlot(0).GetTensorInfo());
+    }
+    return bindingInfos;
+}
+
+std::vector<std::pair<LayerBindingId, TensorInfo>> LoadedNetwork::GetOutputBindingInfos() const
+{
+    std::vector<std::pair<LayerBindingId, TensorInfo>> bindingInfos;
+    for (auto&& outputLayer : m_OptimizedNetwork->GetGraph().GetOutputLayers())
+    {
+        bindingInfos.emplace_back(outputLayer->GetBindingId(),
+                                  outputLayer->GetInputSlot(0).GetConnection()->GetTensorInfo());
+    }
+    return bindingInfos;
+}
+
+std::unique_ptr<IWorkload> LoadedNetwork::CreateWorkload(const Layer& layer,
+                                                         const IWorkloadFactory& workloadFactory) const
+{
+    auto workload = layer.CreateWorkload(m_OptimizedNetwork->GetGraph(), workloadFactory);
+
+    if (!workload)
+    {
+        const char* const layerName = layer.GetNameStr().length() != 0 ? layer.GetName() : "<Unnamed>";
+        throw InvalidArgumentException(boost::str(
+            boost::format("No workload created for layer (name: '%1%' type: '%2%') (compute '%3%')")
+            % layerName % static_cast<int>(layer.GetType()) % layer.GetComputeDevice()
+        ));
+    }
+
+    return workload;
+}
+
 const IWorkloadFactory& LoadedNetwork::GetWorkloadFactory(const Layer& layer) const
 {
     const IWorkloadFactory* workloadFactory = nullptr;
@@ -253,6 +436,25 @@ static const TensorPin& GetTensorPin(LayerBindingId id,
     }
 }
 
+template <typename TensorType>
+const TensorType& GetBoundTensor(LayerBindingId id,
+    const std::vector<std::pair<LayerBindingId, TensorType>>& tensors,
+    char const* bindingPointDesc)
+{
+    auto it = std::find_if(tensors.begin(), tensors.end(),
+        [id](const std::pair<LayerBindingId, TensorType>& tensor)
+    {
+        return tensor.first == id;
+    });
+
+    if (it == tensors.end())
+    {
+        throw InvalidArgumentException(boost::str(
+            boost::format("No tensor supplied for %1% %2%") % bindingPointDesc % id));
+    }
+    return it->second;
+}
+
 // Stores data that needs to be kept accessible for the entire execution of a workload.
 class WorkloadData
 {
@@ -308,6 +510,9 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
 
+    // The workload queue and the intermediate tensors of the graph are shared by every caller.
+    std::lock_guard<std::mutex> lockGuard(m_WorkloadQueueMutex);
+
     const Graph& graph = m_OptimizedNetwork->GetGraph();
 
     // Walk graph to determine the order of execution.
@@ -325,18 +530,28 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         throw InvalidArgumentException("Number of inputs provided does not match network.");
     }
 
-    // For each input to the network, call EnqueueInput with the data passed by the user.
+    // For each input to the network, creates a workload copying the data passed by the user into the network.
+    WorkloadQueue inputWorkloads;
+    inputWorkloads.reserve(graph.GetNumInputs());
     for (const BindableLayer* inputLayer : graph.GetInputLayers())
     {
+        BOOST_ASSERT_MSG(inputLayer->GetNumOutputSlots() == 1, "Can only handle Input Layer with one output");
         const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
-        EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+        inputWorkloads.push_back(MakeInputWorkload(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(),
+                                                   inputLayer->GetOutputHandler().GetData()));
     }
 
-    // For each output to the network, call EnqueueOutput with the data passed by the user.
+    // For each output to the network, creates a workload copying the result into the data passed by the user.
+    WorkloadQueue outputWorkloads;
+    outputWorkloads.reserve(graph.GetNumOutputs());
     for (const BindableLayer* outputLayer : graph.GetOutputLayers())
     {
+        BOOST_ASSERT_MSG(outputLayer->GetNumInputSlots() == 1, "Output Layer should have exactly one input.");
         const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
-        EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+        const OutputHandler& outputHandler =
+            outputLayer->GetInputSlots()[0].GetConnectedOutputSlot()->GetOutputHandler();
+        outputWorkloads.push_back(MakeOutputWorkload(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(),
+                                                     outputHandler.GetData()));
     }
 
     bool executionSucceeded = true;
@@ -344,25 +559,40 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
         ARMNN_SCOPED_HEAP_PROFILING("Executing");
-        executionSucceeded = Execute();
-    }
 
-    // Hack: get rid of inputs and outputs we added.
-    TidyWorkloadQueue(graph.GetNumInputs(), graph.GetNumOutputs());
+        m_CpuRef.Acquire();
+        m_CpuAcc.Acquire();
+        m_GpuAcc.Acquire();
+
+        // The events of the workloads run on other threads would be missing from the profile of this one.
+        Profiler* profiler = ProfilerManager::GetInstance().GetProfiler();
+        const bool isProfiling = profiler && profiler->IsProfilingEnabled();
+
+        executionSucceeded = Execute(inputWorkloads, m_WorkloadQueue, outputWorkloads,
+                                     isProfiling ? nullptr : m_WorkloadDependencies.get());
+
+        // Informs the memory managers to release memory in it's respective memory group
+        m_CpuRef.Release();
+        m_CpuAcc.Release();
+        m_GpuAcc.Release();
+    }
 
     return executionSucceeded ? Status::Success : Status::Failure;
 }
 
-void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+std::unique_ptr<IWorkload> LoadedNetwork::MakeInputWorkload(const BindableLayer& layer,
+                                                            ITensorHandle* tensorHandle,
+                                                            const TensorInfo& tensorInfo,
+                                                            ITensorHandle* layerOutputHandle) const
 {
     if (layer.GetType() != LayerType::Input)
     {
-        throw InvalidArgumentException("EnqueueInput: given layer not an InputLayer");
+        throw InvalidArgumentException("MakeInputWorkload: given layer not an InputLayer");
     }
 
     if (tensorHandle == nullptr)
     {
-        throw InvalidArgumentException("EnqueueInput: tensorHandle must not be NULL");
+        throw InvalidArgumentException("MakeInputWorkload: tensorHandle must not be NULL");
     }
 
     InputQueueDescriptor inputQueueDescriptor;
@@ -372,30 +602,31 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
     info.m_InputTensorInfos.push_back(tensorInfo);
 
     BOOST_ASSERT_MSG(layer.GetNumOutputSlots() == 1, "Can only handle Input Layer with one output");
-    const OutputHandler& handler = layer.GetOutputHandler();
-    const TensorInfo& outputTensorInfo = handler.GetTensorInfo();
-    ITensorHandle* outputTensorHandle = handler.GetData();
-    BOOST_ASSERT_MSG(outputTensorHandle != nullptr,
+    const TensorInfo& outputTensorInfo = layer.GetOutputHandler().GetTensorInfo();
+    BOOST_ASSERT_MSG(layerOutputHandle != nullptr,
                      "Data should have been allocated.");
-    inputQueueDescriptor.m_Outputs.push_back(outputTensorHandle);
+    inputQueueDescriptor.m_Outputs.push_back(layerOutputHandle);
     info.m_OutputTensorInfos.push_back(outputTensorInfo);
 
     const IWorkloadFactory& workloadFactory = GetWorkloadFactory(layer);
     auto inputWorkload = workloadFactory.CreateInput(inputQueueDescriptor, info);
     BOOST_ASSERT_MSG(inputWorkload, "No input workload created");
-    m_WorkloadQueue.insert(m_WorkloadQueue.begin(), move(inputWorkload));
+    return inputWorkload;
 }
 
-void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+std::unique_ptr<IWorkload> LoadedNetwork::MakeOutputWorkload(const BindableLayer& layer,
+                                                             ITensorHandle* tensorHandle,
+                                                             const TensorInfo& tensorInfo,
+                                                             ITensorHandle* layerInputHandle) const
 {
     if (layer.GetType() != LayerType::Output)
     {
-        throw InvalidArgumentException("EnqueueOutput: given layer not an OutputLayer");
+        throw InvalidArgumentException("MakeOutputWorkload: given layer not an OutputLayer");
     }
 
     if (tensorHandle == nullptr)
     {
-        throw InvalidArgumentException("EnqueueOutput: tensorHandle must not be NULL");
+        throw InvalidArgumentException("MakeOutputWorkload: tensorHandle must not be NULL");
     }
 
     OutputQueueDescriptor outputQueueDescriptor;
@@ -406,35 +637,247 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
 
     BOOST_ASSERT_MSG(layer.GetNumInputSlots() == 1, "Output Layer should have exactly one input.");
 
-    // Gets the output handler from the previous node.
-    const OutputHandler& outputHandler = layer.GetInputSlots()[0].GetConnectedOutputSlot()->GetOutputHandler();
-
-    const TensorInfo& inputTensorInfo = outputHandler.GetTensorInfo();
-    ITensorHandle* inputTensorHandle = outputHandler.GetData();
-    BOOST_ASSERT_MSG(inputTensorHandle != nullptr, "Data should have been allocated.");
+    const TensorInfo& inputTensorInfo = layer.GetInputSlots()[0].GetConnection()->GetTensorInfo();
+    BOOST_ASSERT_MSG(layerInputHandle != nullptr, "Data should have been allocated.");
 
-    outputQueueDescriptor.m_Inputs.push_back(inputTensorHandle);
+    outputQueueDescriptor.m_Inputs.push_back(layerInputHandle);
     info.m_InputTensorInfos.push_back(inputTensorInfo);
 
     const IWorkloadFactory& workloadFactory = GetWorkloadFactory(layer);
     auto outputWorkload = workloadFactory.CreateOutput(outputQueueDescriptor, info);
     BOOST_ASSERT_MSG(outputWorkload, "No output workload created");
-    m_WorkloadQueue.push_back(move(outputWorkload));
+    return outputWorkload;
+}
+
+std::unique_ptr<WorkingMemHandle> LoadedNetwork::CreateWorkingMemHandle(NetworkId networkId)
+{
+    Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (!m_SupportsWorkingMemHandles)
+    {
+        throw InvalidArgumentException(boost::str(
+            boost::format("Working memory handles are only supported for networks running entirely on %1%")
+            % Compute::CpuRef));
+    }
+
+    auto workingMemHandle = std::make_unique<WorkingMemHandle>(networkId);
+    RefWorkloadFactory& workloadFactory = workingMemHandle->GetWorkloadFactory();
+
+    std::lock_guard<std::mutex> lockGuard(m_WorkloadQueueMutex);
+
+    // Creates the tensors of the working memory in place of the ones of the graph, so that the workloads can be
+    // created exactly as in the constructor. The graph gets its own tensors back once this scope is left.
+    ScopedTensorHandleStash stash(graph);
+
+    for (auto&& layer : graph)
+    {
+        layer->CreateTensorHandles(graph, workloadFactory);
+    }
+
+    ScopedRefThreadPool scopedRefThreadPool(m_RefThreadPool.get());
+
+    for (auto&& layer : graph)
+    {
+        if (layer->GetType() != LayerType::Input && layer->GetType() != LayerType::Output)
+        {
+            workingMemHandle->GetWorkloadQueue().push_back(CreateWorkload(*layer, workloadFactory));
+        }
+    }
+
+    graph.AllocateDynamicBuffers();
+    workloadFactory.Finalize();
+
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        workingMemHandle->SetInputHandle(inputLayer->GetBindingId(), inputLayer->GetOutputHandler().GetData());
+    }
+
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        const OutputHandler& outputHandler =
+            outputLayer->GetInputSlots()[0].GetConnectedOutputSlot()->GetOutputHandler();
+        workingMemHandle->SetOutputHandle(outputLayer->GetBindingId(), outputHandler.GetData());
+    }
+
+    for (auto&& layer : graph)
+    {
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            workingMemHandle->AddTensorHandle(layer->GetOutputHandler(i).ReleaseData());
+        }
+    }
+
+    return workingMemHandle;
 }
 
-bool LoadedNetwork::Execute()
+Status LoadedNetwork::Execute(WorkingMemHandle& workingMemHandle,
+                              const InputTensors& inputTensors,
+                              const OutputTensors& outputTensors)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
+
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    // Data that must be kept alive for the entire execution of the workload.
+    WorkloadData workloadData(inputTensors, outputTensors);
+
+    // The input and output workloads only live for this call, so they are not kept in the working memory.
+    WorkloadQueue inputWorkloads;
+    inputWorkloads.reserve(graph.GetNumInputs());
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
+        inputWorkloads.push_back(MakeInputWorkload(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(),
+                                                   workingMemHandle.GetInputHandle(inputLayer->GetBindingId())));
+    }
+
+    WorkloadQueue outputWorkloads;
+    outputWorkloads.reserve(graph.GetNumOutputs());
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
+        outputWorkloads.push_back(MakeOutputWorkload(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(),
+                                                     workingMemHandle.GetOutputHandle(outputLayer->GetBindingId())));
+    }
+
+    const bool success = Execute(inputWorkloads, workingMemHandle.GetWorkloadQueue(), outputWorkloads);
+    return success ? Status::Success : Status::Failure;
+}
+
+Status LoadedNetwork::BindTensors(WorkingMemHandle& workingMemHandle,
+                                  const InputTensors& inputTensors,
+                                  const OutputTensors& outputTensors)
+{
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    if (graph.GetNumOutputs() != outputTensors.size())
+    {
+        throw InvalidArgumentException("Number of outputs provided does not match network.");
+    }
+
+    std::vector<std::unique_ptr<ITensorHandle>> tensorHandles;
+    tensorHandles.reserve(inputTensors.size() + outputTensors.size());
+
+    WorkloadQueue inputWorkloads;
+    inputWorkloads.reserve(graph.GetNumInputs());
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        const LayerBindingId bindingId = inputLayer->GetBindingId();
+        const ConstTensor& tensor = GetBoundTensor(bindingId, inputTensors, "input");
+
+        auto tensorHandle = std::make_unique<ConstPassthroughCpuTensorHandle>(tensor.GetInfo(),
+                                                                              tensor.GetMemoryArea());
+        inputWorkloads.push_back(MakeInputWorkload(*inputLayer, tensorHandle.get(), tensor.GetInfo(),
+                                                   workingMemHandle.GetInputHandle(bindingId)));
+        tensorHandles.push_back(std::move(tensorHandle));
+    }
+
+    WorkloadQueue outputWorkloads;
+    outputWorkloads.reserve(graph.GetNumOutputs());
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        const LayerBindingId bindingId = outputLayer->GetBindingId();
+        const Tensor& tensor = GetBoundTensor(bindingId, outputTensors, "output");
+
+        auto tensorHandle = std::make_unique<PassthroughCpuTensorHandle>(tensor.GetInfo(), tensor.GetMemoryArea());
+        outputWorkloads.push_back(MakeOutputWorkload(*outputLayer, tensorHandle.get(), tensor.GetInfo(),
+                                                     workingMemHandle.GetOutputHandle(bindingId)));
+        tensorHandles.push_back(std::move(tensorHandle));
+    }
+
+    workingMemHandle.SetBoundTensors(std::move(tensorHandles), std::move(inputWorkloads), std::move(outputWorkloads));
+    return Status::Success;
+}
+
+Status LoadedNetwork::Execute(WorkingMemHandle& workingMemHandle)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
+
+    if (!workingMemHandle.HasBoundTensors())
+    {
+        throw InvalidArgumentException("Execute: no tensors have been bound to the working memory");
+    }
+
+    const bool success = Execute(workingMemHandle.GetBoundInputWorkloads(),
+                                 workingMemHandle.GetWorkloadQueue(),
+                                 workingMemHandle.GetBoundOutputWorkloads());
+    return success ? Status::Success : Status::Failure;
+}
+
+Status LoadedNetwork::EnqueueWorkloadConcurrently(NetworkId networkId,
+                                                  const InputTensors& inputTensors,
+                                                  const OutputTensors& outputTensors)
+{
+    if (!m_SupportsWorkingMemHandles)
+    {
+        return EnqueueWorkload(inputTensors, outputTensors);
+    }
+
+    std::unique_ptr<WorkingMemHandle> workingMemHandle;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_IdleWorkingMemHandlesMutex);
+        if (!m_IdleWorkingMemHandles.empty())
+        {
+            workingMemHandle = std::move(m_IdleWorkingMemHandles.back());
+            m_IdleWorkingMemHandles.pop_back();
+        }
+    }
+
+    // There are at most as many working memories as threads evaluating the network at the same time.
+    if (!workingMemHandle)
+    {
+        workingMemHandle = CreateWorkingMemHandle(networkId);
+    }
+
+    const Status status = Execute(*workingMemHandle, inputTensors, outputTensors);
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_IdleWorkingMemHandlesMutex);
+        m_IdleWorkingMemHandles.push_back(std::move(workingMemHandle));
+    }
+
+    return status;
+}
+
+bool LoadedNetwork::Execute(const WorkloadQueue& inputWorkloads,
+                            const WorkloadQueue& workloadQueue,
+                            const WorkloadQueue& outputWorkloads,
+                            const WorkloadDependencies* dependencies) const
 {
     bool success = true;
 
-    m_CpuRef.Acquire();
-    m_CpuAcc.Acquire();
-    m_GpuAcc.Acquire();
+    ScopedRefThreadPool scopedRefThreadPool(m_RefThreadPool.get());
 
     try
     {
-        for (size_t i = 0; i < m_WorkloadQueue.size(); ++i)
+        for (auto&& workload : inputWorkloads)
+        {
+            workload->Execute();
+        }
+        if (dependencies)
+        {
+            m_WorkloadScheduler->Run(workloadQueue, *dependencies);
+        }
+        else
+        {
+            for (auto&& workload : workloadQueue)
+            {
+                workload->Execute();
+            }
+        }
+        for (auto&& workload : outputWorkloads)
         {
-            m_WorkloadQueue[i]->Execute();
+            workload->Execute();
         }
     }
 #if ARMCOMPUTECL_ENABLED
@@ -451,18 +894,7 @@ bool LoadedNetwork::Execute()
         success = false;
     }
 
-    // Informs the memory managers to release memory in it's respective memory group
-    m_CpuRef.Release();
-    m_CpuAcc.Release();
-    m_GpuAcc.Release();
-
     return success;
 }
 
-void LoadedNetwork::TidyWorkloadQueue(size_t numInputs, size_t numOutputs)
-{
-    m_WorkloadQueue.erase(m_WorkloadQueue.begin(), m_WorkloadQueue.begin() + boost::numeric_cast<long>(numInputs));
-    m_WorkloadQueue.erase(m_WorkloadQueue.end() - boost::numeric_cast<long>(numOutputs), m_WorkloadQueue.end());
-}
-
 }
@@ -9,12 +9,18 @@
 #include "Network.hpp"
 #include "LayerFwd.hpp"
 #include "Profiling.hpp"
+#include "WorkingMemHandle.hpp"
+#include "WorkloadScheduler.hpp"
 #include "backends/RefWorkloadFactory.hpp"
+#include "backends/RefWorkloads/RefThreadPool.hpp"
 #include "backends/NeonWorkloadFactory.hpp"
 #include "backends/ClWorkloadFactory.hpp"
 #include "backends/Workload.hpp"
 #include "backends/WorkloadFactory.hpp"
 
+#include <atomic>
+#include <mutex>
+
 namespace cl
 {
     class Context;
@@ -28,12 +34,44 @@ namespace armnn
 class LoadedNetwork
 {
 public:
+    using WorkloadQueue = std::vector<std::unique_ptr<IWorkload>>;
+
     TensorInfo GetInputTensorInfo(LayerBindingId layerId) const;
     TensorInfo GetOutputTensorInfo(LayerBindingId layerId) const;
 
+    /// Gets the binding ids of the inputs and outputs of the network, with their tensor infos.
+    std::vector<std::pair<LayerBindingId, TensorInfo>> GetInputBindingInfos() const;
+    std::vector<std::pair<LayerBindingId, TensorInfo>> GetOutputBindingInfos() const;
+
     Status EnqueueWorkload(const InputTensors& inputTensors, const OutputTensors& outputTensors);
 
+    /// Creates a working memory owning its own intermediate tensors and workloads, so that the network
+    /// can be executed from several threads at once.
+    std::unique_ptr<WorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId);
+
+    Status Execute(WorkingMemHandle& workingMemHandle,
+                   const InputTensors& inputTensors,
+                   const OutputTensors& outputTensors);
+
+    Status BindTensors(WorkingMemHandle& workingMemHandle,
+                       const InputTensors& inputTensors,
+                       const OutputTensors& outputTensors);
+
+    Status Execute(WorkingMemHandle& workingMemHandle);
+
+    /// Evaluates the network in a way that allows other threads to evaluate it at the same time: if the network
+    /// supports working memory handles, one is taken from a pool owned by this network, otherwise this falls back
+    /// to EnqueueWorkload().
+    Status EnqueueWorkloadConcurrently(NetworkId networkId,
+                                       const InputTensors& inputTensors,
+                                       const OutputTensors& outputTensors);
+
+    QosExecPriority GetPriority() const { return m_Priority; }
+    void SetPriority(QosExecPriority priority) { m_Priority = priority; }
+
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                                                            std::shared_ptr<RefThreadPool> refThreadPool,
+                                                            std::shared_ptr<WorkloadScheduler> workloadScheduler,
                                                             std::string & errorMessage);
 
     // NOTE we return by reference as the purpose of this method is only to provide
@@ -42,15 +80,26 @@ public:
     const std::shared_ptr<Profiler>& GetProfiler() const { return m_Profiler; }
 
 private:
-    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net);
+    LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
+                  std::shared_ptr<RefThreadPool> refThreadPool,
+                  std::shared_ptr<WorkloadScheduler> workloadScheduler);
 
-    void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    std::unique_ptr<IWorkload> CreateWorkload(const Layer& layer, const IWorkloadFactory& workloadFactory) const;
 
-    void EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
+    std::unique_ptr<IWorkload> MakeInputWorkload(const BindableLayer& layer,
+                                                 ITensorHandle* tensorHandle,
+                                                 const TensorInfo& tensorInfo,
+                                                 ITensorHandle* layerOutputHandle) const;
 
-    bool Execute();
+    std::unique_ptr<IWorkload> MakeOutputWorkload(const BindableLayer& layer,
+                                                  ITensorHandle* tensorHandle,
+                                                  const TensorInfo& tensorInfo,
+                                                  ITensorHandle* layerInputHandle) const;
 
-    void TidyWorkloadQueue(size_t numInputs, size_t numOutputs);
+    bool Execute(const WorkloadQueue& inputWorkloads,
+                 const WorkloadQueue& workloadQueue,
+                 const WorkloadQueue& outputWorkloads,
+                 const WorkloadDependencies* dependencies = nullptr) const;
 
     const IWorkloadFactory& GetWorkloadFactory(const Layer& layer) const;
 
@@ -59,8 +108,29 @@ private:
     ClWorkloadFactory   m_GpuAcc;
 
     std::unique_ptr<OptimizedNetwork> m_OptimizedNetwork;
-    std::vector< std::unique_ptr<IWorkload> > m_WorkloadQueue;
+    WorkloadQueue m_WorkloadQueue;
     std::shared_ptr<Profiler> m_Profiler;
+
+    /// Thread pool sharing the work of the CpuRef layers, or nullptr to run them on the calling thread.
+    std::shared_ptr<RefThreadPool> m_RefThreadPool;
+
+    /// Runs the independent workloads of m_WorkloadQueue at the same time, or nullptr to run them one after the other.
+    std::shared_ptr<WorkloadScheduler> m_WorkloadScheduler;
+
+    /// Dependencies between the workloads of m_WorkloadQueue, when they are run by m_WorkloadScheduler.
+    std::unique_ptr<WorkloadDependencies> m_WorkloadDependencies;
+
+    /// Serializes the uses of m_WorkloadQueue and of the tensor handles owned by the graph.
+    std::mutex m_WorkloadQueueMutex;
+
+    /// Whether every layer runs on CpuRef, which is required to create working memory handles.
+    bool m_SupportsWorkingMemHandles;
+
+    /// Working memories available to EnqueueWorkloadConcurrently().
+    std::vector<std::unique_ptr<WorkingMemHandle>> m_IdleWorkingMemHandles;
+    std::mutex m_IdleWorkingMemHandlesMutex;
+
+    std::atomic<QosExecPriority> m_Priority;
 };
 
 }
@@ -7,6 +7,7 @@
 #include "Layer.hpp"
 #include "DeviceSpec.hpp"
 #include "backends/CpuTensorHandle.hpp"
+#include "backends/RefWorkloadFactory.hpp"
 #include "backends/WorkloadFactory.hpp"
 #include "Optimizer.hpp"
 #include "armnn/Exceptions.hpp"
@@ -91,11 +92,25 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
                                                                 OptimizeInversePermutes(),
                                                                 MovePermuteUp(),
                                                                 PermuteAsReshape(),
-                                                                OptimizeConsecutiveReshapes()));
+                                                                OptimizeConsecutiveReshapes(),
+                                                                FoldBatchNormalizationIntoConvolution2d(),
+                                                                FoldBatchNormalizationIntoDepthwiseConvolution2d(),
+                                                                FoldBatchNormalizationIntoFullyConnected()));
 
     // Infer the tensor infos for all output slots. Throws an exception on failure.
     optNetObjPtr->GetGraph().InferTensorInfos();
 
+    // Compute once the layers which only depend on constants, rather than on every inference.
+    RefWorkloadFactory foldingFactory;
+    FoldConstantsStatistics foldedConstants;
+    Optimizer::Pass(optNetObjPtr->GetGraph(), MakeOptimizations(FoldConstants(foldingFactory, &foldedConstants)));
+    if (foldedConstants.m_NumFoldedLayers > 0)
+    {
+        BOOST_LOG_TRIVIAL(info) << "Folded " << foldedConstants.m_NumFoldedLayers << " layers which only depend on "
+                                << "constants, saving " << foldedConstants.m_NumFoldedBytes << " bytes of output "
+                                << "per inference.";
+    }
+
     // if Fp32 to Fp16 optimization is set convert Fp32 network to Fp16
     if (options.m_ReduceFp32ToFp16)
     {
@@ -248,6 +263,17 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         }
     }
 
+    // Fusing activations depends on the backend of the layers, so it can only be done now.
+    Optimizer::Pass(optNetObjPtr->GetGraph(), MakeOptimizations(FuseActivationIntoConvolution2d(),
+                                                                FuseActivationIntoDepthwiseConvolution2d(),
+                                                                FuseActivationIntoFullyConnected()));
+
+    // The pointwise convolutions of depthwise separable convolutions are fused with their activations.
+    if (options.m_FusePointwiseConvolutions)
+    {
+        Optimizer::Pass(optNetObjPtr->GetGraph(), MakeOptimizations(FusePointwiseIntoDepthwiseConvolution2d()));
+    }
+
     Optimizer::Pass(optNetObjPtr->GetGraph(), MakeOptimizations(OptimizeInverseConversionsFp16(),
                                                                 OptimizeInverseConversionsFp32()));
 
@@ -120,8 +120,9 @@ class ScopedProfilingEvent
 public:
     using InstrumentPtr = std::unique_ptr<Instrument>;
 
+    // The name is only converted to a string when profiling is enabled, so that nothing is allocated otherwise.
     template<typename... Args>
-    ScopedProfilingEvent(Compute compute, const std::string& name, Args... args)
+    ScopedProfilingEvent(Compute compute, const char* name, Args... args)
         : m_Event(nullptr)
         , m_Profiler(ProfilerManager::GetInstance().GetProfiler())
     {
@@ -134,6 +135,12 @@ public:
         }
     }
 
+    template<typename... Args>
+    ScopedProfilingEvent(Compute compute, const std::string& name, Args... args)
+        : ScopedProfilingEvent(compute, name.c_str(), args...)
+    {
+    }
+
     ~ScopedProfilingEvent()
     {
         if (m_Profiler && m_Event)
@@ -56,6 +56,8 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut,
     IOptimizedNetwork* rawNetwork = inNetwork.release();
     unique_ptr<LoadedNetwork> loadedNetwork = LoadedNetwork::MakeLoadedNetwork(
         std::unique_ptr<OptimizedNetwork>(boost::polymorphic_downcast<OptimizedNetwork*>(rawNetwork)),
+        m_RefThreadPool,
+        m_WorkloadScheduler,
         errorMessage);
 
     if (!loadedNetwork)
@@ -95,15 +97,48 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
     }
 #endif
 
+    // A worker thread cannot wait for the inferences of the network, its own included.
+    {
+        std::lock_guard<std::mutex> lockGuard(m_AsyncExecutorMutex);
+        if (m_AsyncExecutor && m_AsyncExecutor->IsWorkerThread())
+        {
+            BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::UnloadNetwork(): " << networkId
+                                       << " cannot be unloaded from the callback of an asynchronous inference";
+            return Status::Failure;
+        }
+    }
+
+    std::unique_ptr<LoadedNetwork> loadedNetwork;
+    std::unique_ptr<InferenceBatcher> batcher;
+
     {
         std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
-        if (m_LoadedNetworks.erase(networkId) == 0)
+        auto it = m_LoadedNetworks.find(networkId);
+        if (it == m_LoadedNetworks.end())
         {
             BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::UnloadNetwork(): " << networkId << " not found!";
             return Status::Failure;
         }
 
+        // The batching thread cannot wait for itself to evaluate the samples still pending.
+        auto batcherIt = m_Batchers.find(networkId);
+        if (batcherIt != m_Batchers.end() && batcherIt->second->IsBatchingThread())
+        {
+            BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::UnloadNetwork(): " << networkId
+                                       << " cannot be unloaded from the callback of one of its samples";
+            return Status::Failure;
+        }
+
+        loadedNetwork = std::move(it->second);
+        m_LoadedNetworks.erase(it);
+
+        if (batcherIt != m_Batchers.end())
+        {
+            batcher = std::move(batcherIt->second);
+            m_Batchers.erase(batcherIt);
+        }
+
 #ifdef ARMCOMPUTECL_ENABLED
         if (arm_compute::CLScheduler::get().context()() != NULL && m_LoadedNetworks.empty())
         {
@@ -113,6 +148,20 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
 #endif
     }
 
+    // The network can no longer be found by new asynchronous inferences, but it must outlive the ones in flight,
+    // starting with the evaluation of the samples still pending.
+    batcher.reset();
+    AsyncExecutor* asyncExecutor = nullptr;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_AsyncExecutorMutex);
+        asyncExecutor = m_AsyncExecutor.get();
+    }
+    if (asyncExecutor)
+    {
+        asyncExecutor->WaitForNetwork(networkId);
+    }
+    loadedNetwork.reset();
+
     BOOST_LOG_TRIVIAL(debug) << "Runtime::UnloadNetwork(): Unloaded network with ID: " << networkId;
     return Status::Success;
 }
@@ -133,6 +182,11 @@ Runtime::Runtime(const CreationOptions& options)
     : m_ClContextControl(options.m_GpuAccTunedParameters.get(),
                          options.m_EnableGpuProfiling)
     , m_NetworkIdCounter(0)
+    , m_NumWorkerThreads(options.m_NumWorkerThreads)
+    , m_RefThreadPool(options.m_NumCpuRefThreads != 1 ? std::make_shared<RefThreadPool>(options.m_NumCpuRefThreads)
+                                                       : nullptr)
+    , m_WorkloadScheduler(options.m_NumInterOpThreads != 1
+                          ? std::make_shared<WorkloadScheduler>(options.m_NumInterOpThreads) : nullptr)
 {
     BOOST_LOG_TRIVIAL(info) << "ArmNN v" << ARMNN_VERSION << "\n";
 
@@ -209,4 +263,217 @@ Status Runtime::EnqueueWorkload(NetworkId networkId,
     return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors);
 }
 
+AsyncExecutor& Runtime::GetAsyncExecutor()
+{
+    std::lock_guard<std::mutex> lockGuard(m_AsyncExecutorMutex);
+    if (!m_AsyncExecutor)
+    {
+        m_AsyncExecutor = std::make_unique<AsyncExecutor>(m_NumWorkerThreads);
+    }
+    return *m_AsyncExecutor;
+}
+
+void Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   InferenceCompleteCallback callback)
+{
+    AsyncExecutor& asyncExecutor = GetAsyncExecutor();
+
+    // The job is scheduled while the network is known to be loaded, so that UnloadNetwork() waits for it.
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    auto it = m_LoadedNetworks.find(networkId);
+    if (it == m_LoadedNetworks.end())
+    {
+        lock.unlock();
+        BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::EnqueueWorkloadAsync(): " << networkId << " not found!";
+        if (callback)
+        {
+            callback(Status::Failure);
+        }
+        return;
+    }
+    LoadedNetwork* loadedNetwork = it->second.get();
+
+    asyncExecutor.Schedule(networkId, loadedNetwork->GetPriority(),
+        [loadedNetwork, networkId, inputTensors, outputTensors, callback]()
+        {
+            Status status = Status::Failure;
+            try
+            {
+                status = loadedNetwork->EnqueueWorkloadConcurrently(networkId, inputTensors, outputTensors);
+            }
+            catch (const std::exception& e)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Runtime::EnqueueWorkloadAsync(): inference of network " << networkId
+                                         << " failed: " << e.what();
+            }
+            catch (...)
+            {
+                BOOST_LOG_TRIVIAL(error) << "Runtime::EnqueueWorkloadAsync(): inference of network " << networkId
+                                         << " failed with an unknown exception";
+            }
+
+            if (callback)
+            {
+                callback(status);
+            }
+        });
+}
+
+std::future<Status> Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                                  const InputTensors& inputTensors,
+                                                  const OutputTensors& outputTensors)
+{
+    auto promise = std::make_shared<std::promise<Status>>();
+    std::future<Status> future = promise->get_future();
+
+    EnqueueWorkloadAsync(networkId, inputTensors, outputTensors, [promise](Status status)
+        {
+            promise->set_value(status);
+        });
+
+    return future;
+}
+
+Status Runtime::SetNetworkPriority(NetworkId networkId, QosExecPriority priority)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    auto it = m_LoadedNetworks.find(networkId);
+    if (it == m_LoadedNetworks.end())
+    {
+        BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::SetNetworkPriority(): " << networkId << " not found!";
+        return Status::Failure;
+    }
+
+    it->second->SetPriority(priority);
+    return Status::Success;
+}
+
+Status Runtime::EnableBatching(NetworkId networkId, const BatchingOptions& options)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    auto it = m_LoadedNetworks.find(networkId);
+    if (it == m_LoadedNetworks.end())
+    {
+        BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::EnableBatching(): " << networkId << " not found!";
+        return Status::Failure;
+    }
+
+    if (m_Batchers.find(networkId) != m_Batchers.end())
+    {
+        BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::EnableBatching(): " << networkId << " is already batched";
+        return Status::Failure;
+    }
+
+    // The batches are evaluated with a working memory of their own, so that they do not wait for the inferences
+    // enqueued without batching.
+    LoadedNetwork* loadedNetwork = it->second.get();
+    try
+    {
+        m_Batchers[networkId] = std::make_unique<InferenceBatcher>(
+            loadedNetwork->GetInputBindingInfos(), loadedNetwork->GetOutputBindingInfos(), options,
+            [loadedNetwork, networkId](const InputTensors& inputTensors, const OutputTensors& outputTensors)
+            {
+                return loadedNetwork->EnqueueWorkloadConcurrently(networkId, inputTensors, outputTensors);
+            });
+    }
+    catch (const InvalidArgumentException& e)
+    {
+        BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::EnableBatching(): " << e.what();
+        return Status::Failure;
+    }
+
+    return Status::Success;
+}
+
+void Runtime::EnqueueSample(NetworkId networkId,
+                            const InputTensors& inputTensors,
+                            const OutputTensors& outputTensors,
+                            SampleCompleteCallback callback)
+{
+    {
+        // The sample is queued while the network is known to be loaded, so that UnloadNetwork() evaluates it.
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+        auto it = m_Batchers.find(networkId);
+        if (it == m_Batchers.end())
+        {
+            BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::EnqueueSample(): " << networkId
+                                       << " is not loaded or not batched";
+        }
+        else
+        {
+            try
+            {
+                it->second->Enqueue(inputTensors, outputTensors, callback);
+                return;
+            }
+            catch (const InvalidArgumentException& e)
+            {
+                BOOST_LOG_TRIVIAL(warning) << "WARNING: Runtime::EnqueueSample(): " << e.what();
+            }
+        }
+    }
+
+    // Like the inferences enqueued with EnqueueWorkloadAsync(), samples which cannot be enqueued are reported through
+    // their callback, once the runtime is unlocked.
+    if (callback)
+    {
+        SampleResult result;
+        result.m_Status = Status::Failure;
+        result.m_BatchSize = 0;
+        result.m_QueueWaitTime = std::chrono::microseconds(0);
+        result.m_ExecuteTime = std::chrono::microseconds(0);
+        callback(result);
+    }
+}
+
+std::future<SampleResult> Runtime::EnqueueSample(NetworkId networkId,
+                                                 const InputTensors& inputTensors,
+                                                 const OutputTensors& outputTensors)
+{
+    auto promise = std::make_shared<std::promise<SampleResult>>();
+    std::future<SampleResult> future = promise->get_future();
+
+    EnqueueSample(networkId, inputTensors, outputTensors, [promise](const SampleResult& result)
+        {
+            promise->set_value(result);
+        });
+
+    return future;
+}
+
+IWorkingMemHandlePtr Runtime::CreateWorkingMemHandle(NetworkId networkId)
+{
+    return GetLoadedNetworkPtr(networkId)->CreateWorkingMemHandle(networkId);
+}
+
+Status Runtime::Execute(IWorkingMemHandle& workingMemHandle,
+                        const InputTensors& inputTensors,
+                        const OutputTensors& outputTensors)
+{
+    WorkingMemHandle& handle = *boost::polymorphic_downcast<WorkingMemHandle*>(&workingMemHandle);
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(handle.GetNetworkId());
+    return loadedNetwork->Execute(handle, inputTensors, outputTensors);
+}
+
+Status Runtime::BindTensors(IWorkingMemHandle& workingMemHandle,
+                            const InputTensors& inputTensors,
+                            const OutputTensors& outputTensors)
+{
+    WorkingMemHandle& handle = *boost::polymorphic_downcast<WorkingMemHandle*>(&workingMemHandle);
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(handle.GetNetworkId());
+    return loadedNetwork->BindTensors(handle, inputTensors, outputTensors);
+}
+
+Status Runtime::Execute(IWorkingMemHandle& workingMemHandle)
+{
+    WorkingMemHandle& handle = *boost::polymorphic_downcast<WorkingMemHandle*>(&workingMemHandle);
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(handle.GetNetworkId());
+    return loadedNetwork->Execute(handle);
+}
+
 }
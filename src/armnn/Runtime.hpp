@@ -4,12 +4,16 @@
 //
 #pragma once
 
+#include "AsyncExecutor.hpp"
+#include "InferenceBatcher.hpp"
 #include "LoadedNetwork.hpp"
 #include "DeviceSpec.hpp"
+#include "WorkloadScheduler.hpp"
 #include "armnn/INetwork.hpp"
 #include "armnn/IRuntime.hpp"
 #include "armnn/Tensor.hpp"
 #include "backends/ClContextControl.hpp"
+#include "backends/RefWorkloads/RefThreadPool.hpp"
 
 #include <mutex>
 #include <unordered_map>
@@ -45,6 +49,40 @@ public:
         const InputTensors& inputTensors,
         const OutputTensors& outputTensors) override;
 
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+        const InputTensors& inputTensors,
+        const OutputTensors& outputTensors,
+        InferenceCompleteCallback callback) override;
+
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+        const InputTensors& inputTensors,
+        const OutputTensors& outputTensors) override;
+
+    virtual Status SetNetworkPriority(NetworkId networkId, QosExecPriority priority) override;
+
+    virtual Status EnableBatching(NetworkId networkId, const BatchingOptions& options) override;
+
+    virtual void EnqueueSample(NetworkId networkId,
+        const InputTensors& inputTensors,
+        const OutputTensors& outputTensors,
+        SampleCompleteCallback callback) override;
+
+    virtual std::future<SampleResult> EnqueueSample(NetworkId networkId,
+        const InputTensors& inputTensors,
+        const OutputTensors& outputTensors) override;
+
+    virtual IWorkingMemHandlePtr CreateWorkingMemHandle(NetworkId networkId) override;
+
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle,
+        const InputTensors& inputTensors,
+        const OutputTensors& outputTensors) override;
+
+    virtual Status BindTensors(IWorkingMemHandle& workingMemHandle,
+        const InputTensors& inputTensors,
+        const OutputTensors& outputTensors) override;
+
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle) override;
+
     /// Unloads a network from the Runtime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -73,15 +111,32 @@ private:
 
     LoadedNetwork* GetLoadedNetworkPtr(NetworkId networkId) const;
 
+    /// Gets the worker pool running asynchronous inferences, starting it if needed.
+    AsyncExecutor& GetAsyncExecutor();
+
     mutable std::mutex m_Mutex;
 
     std::unordered_map<NetworkId, std::unique_ptr<LoadedNetwork>> m_LoadedNetworks;
 
+    /// Batchers of the networks whose samples are batched, guarded by m_Mutex.
+    std::unordered_map<NetworkId, std::unique_ptr<InferenceBatcher>> m_Batchers;
+
     ClContextControl m_ClContextControl;
 
     int m_NetworkIdCounter;
 
     DeviceSpec m_DeviceSpec;
+
+    unsigned int m_NumWorkerThreads;
+
+    /// Shared by the networks loaded in this runtime, or nullptr if CpuRef layers run on a single thread.
+    std::shared_ptr<RefThreadPool> m_RefThreadPool;
+
+    /// Shared by the networks loaded in this runtime, or nullptr if their layers run one after the other.
+    std::shared_ptr<WorkloadScheduler> m_WorkloadScheduler;
+
+    std::mutex m_AsyncExecutorMutex;
+    std::unique_ptr<AsyncExecutor> m_AsyncExecutor;
 };
 
 }
@@ -68,6 +68,7 @@ StringifyLayerParameters<Convolution2dDescriptor>::Serialize(ParameterStringifyF
     }
 
     fn("BiasEnabled",(desc.m_BiasEnabled?"true":"false"));
+    fn("DataLayout", GetDataLayoutAsCString(desc.m_DataLayout));
 }
 
 void
@@ -95,6 +96,7 @@ StringifyLayerParameters<DepthwiseConvolution2dDescriptor>::Serialize(ParameterS
     }
 
     fn("BiasEnabled",(desc.m_BiasEnabled?"true":"false"));
+    fn("DataLayout", GetDataLayoutAsCString(desc.m_DataLayout));
 }
 
 void
@@ -123,6 +125,7 @@ StringifyLayerParameters<Pooling2dDescriptor>::Serialize(ParameterStringifyFunct
 
     fn("OutputShapeRounding", GetOutputShapeRoundingAsCString(desc.m_OutputShapeRounding));
     fn("PaddingMethod", GetPaddingMethodAsCString(desc.m_PaddingMethod));
+    fn("DataLayout", GetDataLayoutAsCString(desc.m_DataLayout));
 }
 
 void
@@ -130,6 +133,7 @@ StringifyLayerParameters<SoftmaxDescriptor>::Serialize(ParameterStringifyFunctio
                                                        const SoftmaxDescriptor & desc)
 {
     fn("Beta", std::to_string(desc.m_Beta));
+    fn("Axis", std::to_string(desc.m_Axis));
 }
 
 void
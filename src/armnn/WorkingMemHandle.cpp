@@ -0,0 +1,53 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "WorkingMemHandle.hpp"
+
+#include "armnn/Exceptions.hpp"
+
+#include <boost/format.hpp>
+
+namespace armnn
+{
+
+namespace
+{
+
+ITensorHandle* GetBoundHandle(LayerBindingId bindingId,
+                              const std::unordered_map<LayerBindingId, ITensorHandle*>& handles,
+                              char const* bindingPointDesc)
+{
+    auto it = handles.find(bindingId);
+    if (it == handles.end())
+    {
+        throw InvalidArgumentException(boost::str(
+            boost::format("No %1% layer is associated with id %2%") % bindingPointDesc % bindingId));
+    }
+    return it->second;
+}
+
+} // anonymous namespace
+
+ITensorHandle* WorkingMemHandle::GetInputHandle(LayerBindingId bindingId) const
+{
+    return GetBoundHandle(bindingId, m_InputHandles, "input");
+}
+
+ITensorHandle* WorkingMemHandle::GetOutputHandle(LayerBindingId bindingId) const
+{
+    return GetBoundHandle(bindingId, m_OutputHandles, "output");
+}
+
+void WorkingMemHandle::SetBoundTensors(std::vector<std::unique_ptr<ITensorHandle>> boundTensorHandles,
+                                       std::vector<std::unique_ptr<IWorkload>> inputWorkloads,
+                                       std::vector<std::unique_ptr<IWorkload>> outputWorkloads)
+{
+    // The workloads refer to the tensor handles, so they are replaced first.
+    m_BoundInputWorkloads = std::move(inputWorkloads);
+    m_BoundOutputWorkloads = std::move(outputWorkloads);
+    m_BoundTensorHandles = std::move(boundTensorHandles);
+    m_HasBoundTensors = true;
+}
+
+} // namespace armnn
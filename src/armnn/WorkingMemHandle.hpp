@@ -0,0 +1,88 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include "armnn/IRuntime.hpp"
+#include "armnn/Types.hpp"
+#include "backends/ITensorHandle.hpp"
+#include "backends/RefWorkloadFactory.hpp"
+#include "backends/Workload.hpp"
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+class WorkingMemHandle final : public IWorkingMemHandle
+{
+public:
+    explicit WorkingMemHandle(NetworkId networkId)
+        : m_NetworkId(networkId)
+        , m_HasBoundTensors(false)
+    {
+    }
+
+    virtual NetworkId GetNetworkId() const override { return m_NetworkId; }
+
+    /// Gets the factory creating the intermediate tensors of this working memory.
+    RefWorkloadFactory& GetWorkloadFactory() { return m_WorkloadFactory; }
+
+    /// Gets the tensor the data bound to the given network input is copied into.
+    ITensorHandle* GetInputHandle(LayerBindingId bindingId) const;
+
+    /// Gets the tensor the data bound to the given network output is copied from.
+    ITensorHandle* GetOutputHandle(LayerBindingId bindingId) const;
+
+    void SetInputHandle(LayerBindingId bindingId, ITensorHandle* tensorHandle)
+    {
+        m_InputHandles[bindingId] = tensorHandle;
+    }
+
+    void SetOutputHandle(LayerBindingId bindingId, ITensorHandle* tensorHandle)
+    {
+        m_OutputHandles[bindingId] = tensorHandle;
+    }
+
+    /// Takes ownership of an intermediate tensor.
+    void AddTensorHandle(std::unique_ptr<ITensorHandle> tensorHandle)
+    {
+        m_TensorHandles.push_back(std::move(tensorHandle));
+    }
+
+    const std::vector<std::unique_ptr<IWorkload>>& GetWorkloadQueue() const { return m_WorkloadQueue; }
+    std::vector<std::unique_ptr<IWorkload>>& GetWorkloadQueue() { return m_WorkloadQueue; }
+
+    /// Keeps the tensors bound by the user, and the workloads copying data from and to them, until other tensors
+    /// are bound.
+    void SetBoundTensors(std::vector<std::unique_ptr<ITensorHandle>> boundTensorHandles,
+                         std::vector<std::unique_ptr<IWorkload>> inputWorkloads,
+                         std::vector<std::unique_ptr<IWorkload>> outputWorkloads);
+
+    bool HasBoundTensors() const { return m_HasBoundTensors; }
+
+    const std::vector<std::unique_ptr<IWorkload>>& GetBoundInputWorkloads() const { return m_BoundInputWorkloads; }
+    const std::vector<std::unique_ptr<IWorkload>>& GetBoundOutputWorkloads() const { return m_BoundOutputWorkloads; }
+
+private:
+    NetworkId m_NetworkId;
+
+    // Declaration order matters: the workloads must be destroyed before the tensors they operate on,
+    // which in turn must be destroyed before the factory holding their memory.
+    RefWorkloadFactory m_WorkloadFactory;
+    std::vector<std::unique_ptr<ITensorHandle>> m_TensorHandles;
+    std::vector<std::unique_ptr<IWorkload>> m_WorkloadQueue;
+
+    std::unordered_map<LayerBindingId, ITensorHandle*> m_InputHandles;
+    std::unordered_map<LayerBindingId, ITensorHandle*> m_OutputHandles;
+
+    bool m_HasBoundTensors;
+    std::vector<std::unique_ptr<ITensorHandle>> m_BoundTensorHandles;
+    std::vector<std::unique_ptr<IWorkload>> m_BoundInputWorkloads;
+    std::vector<std::unique_ptr<IWorkload>> m_BoundOutputWorkloads;
+};
+
+} // namespace armnn
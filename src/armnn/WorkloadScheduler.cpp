@@ -0,0 +1,260 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "WorkloadScheduler.hpp"
+
+#include "backends/RefWorkloads/RefThreadPool.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+#include <exception>
+
+namespace armnn
+{
+
+WorkloadDependencies::WorkloadDependencies(unsigned int numWorkloads)
+    : m_NumPredecessors(numWorkloads, 0)
+    , m_Successors(numWorkloads)
+{
+}
+
+void WorkloadDependencies::AddDependency(unsigned int predecessor, unsigned int successor)
+{
+    BOOST_ASSERT(predecessor < successor);
+    BOOST_ASSERT(successor < GetNumWorkloads());
+
+    m_Successors[predecessor].push_back(successor);
+    ++m_NumPredecessors[successor];
+}
+
+/// State of a call to Run().
+struct WorkloadScheduler::Execution
+{
+    Execution(const WorkloadQueue& workloads, const WorkloadDependencies& dependencies, RefThreadPool* refThreadPool)
+        : m_Workloads(workloads)
+        , m_Dependencies(dependencies)
+        , m_RefThreadPool(refThreadPool)
+        , m_NumPendingPredecessors(new std::atomic<unsigned int>[dependencies.GetNumWorkloads()])
+        , m_NumUnfinishedWorkloads(dependencies.GetNumWorkloads())
+        , m_Failed(false)
+    {
+        for (unsigned int i = 0; i < dependencies.GetNumWorkloads(); ++i)
+        {
+            m_NumPendingPredecessors[i] = dependencies.GetNumPredecessors(i);
+        }
+    }
+
+    const WorkloadQueue& m_Workloads;
+    const WorkloadDependencies& m_Dependencies;
+    RefThreadPool* const m_RefThreadPool;
+
+    /// Number of predecessors of each workload which have not finished yet.
+    std::unique_ptr<std::atomic<unsigned int>[]> m_NumPendingPredecessors;
+
+    /// The execution is over once this reaches 0, after which the threads of the pool no longer access it.
+    std::atomic<unsigned int> m_NumUnfinishedWorkloads;
+
+    std::atomic<bool> m_Failed;
+
+    /// First exception thrown by a workload, guarded by m_ExceptionMutex.
+    std::mutex m_ExceptionMutex;
+    std::exception_ptr m_Exception;
+};
+
+WorkloadScheduler::WorkloadScheduler(unsigned int numThreads)
+    : m_NumQueuedTasks(0)
+    , m_Stopping(false)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // The threads calling Run() take their share of the workloads, from a queue of their own.
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Queues.push_back(std::make_unique<TaskQueue>());
+    }
+
+    m_Threads.reserve(numThreads - 1);
+    for (unsigned int i = 0; i + 1 < numThreads; ++i)
+    {
+        m_Threads.emplace_back(&WorkloadScheduler::WorkerLoop, this, i);
+    }
+
+    BOOST_LOG_TRIVIAL(debug) << "WorkloadScheduler: started " << numThreads - 1 << " worker threads";
+}
+
+WorkloadScheduler::~WorkloadScheduler()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        BOOST_ASSERT_MSG(m_NumQueuedTasks == 0, "WorkloadScheduler destroyed while running workloads");
+        m_Stopping = true;
+    }
+    m_StateChanged.notify_all();
+
+    for (auto&& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void WorkloadScheduler::Run(const WorkloadQueue& workloads, const WorkloadDependencies& dependencies)
+{
+    BOOST_ASSERT(workloads.size() == dependencies.GetNumWorkloads());
+    if (workloads.empty())
+    {
+        return;
+    }
+
+    Execution execution(workloads, dependencies, ScopedRefThreadPool::GetCurrent());
+    const unsigned int queueIndex = static_cast<unsigned int>(m_Queues.size()) - 1;
+
+    // The workloads without predecessors are pushed last first, so that the calling thread starts with the first
+    // one while the pool steals the others.
+    for (unsigned int i = dependencies.GetNumWorkloads(); i-- > 0;)
+    {
+        if (dependencies.GetNumPredecessors(i) == 0)
+        {
+            Push(queueIndex, { &execution, i });
+        }
+    }
+
+    // Helps with the ready workloads, possibly of other executions, until all the workloads of this one have
+    // finished.
+    while (execution.m_NumUnfinishedWorkloads > 0)
+    {
+        Task task;
+        if (TryPop(queueIndex, task))
+        {
+            RunTask(queueIndex, task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_StateChanged.wait(lock, [this, &execution]()
+            {
+                return m_NumQueuedTasks > 0 || execution.m_NumUnfinishedWorkloads == 0;
+            });
+    }
+
+    if (execution.m_Exception)
+    {
+        std::rethrow_exception(execution.m_Exception);
+    }
+}
+
+void WorkloadScheduler::Push(unsigned int queueIndex, const Task& task)
+{
+    // Counted first, so that the count never drops below the number of tasks in the queues.
+    ++m_NumQueuedTasks;
+    {
+        TaskQueue& queue = *m_Queues[queueIndex];
+        std::lock_guard<std::mutex> lock(queue.m_Mutex);
+        queue.m_Tasks.push_back(task);
+    }
+
+    // A thread which found no task before the count was increased is waiting, or about to wait, with m_Mutex held.
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+    }
+    m_StateChanged.notify_one();
+}
+
+bool WorkloadScheduler::TryPop(unsigned int queueIndex, Task& task)
+{
+    const unsigned int numQueues = static_cast<unsigned int>(m_Queues.size());
+    for (unsigned int i = 0; i < numQueues; ++i)
+    {
+        const unsigned int victimIndex = (queueIndex + i) % numQueues;
+        TaskQueue& queue = *m_Queues[victimIndex];
+
+        std::lock_guard<std::mutex> lock(queue.m_Mutex);
+        if (queue.m_Tasks.empty())
+        {
+            continue;
+        }
+
+        if (victimIndex == queueIndex)
+        {
+            task = queue.m_Tasks.back();
+            queue.m_Tasks.pop_back();
+        }
+        else
+        {
+            task = queue.m_Tasks.front();
+            queue.m_Tasks.pop_front();
+        }
+        --m_NumQueuedTasks;
+        return true;
+    }
+    return false;
+}
+
+void WorkloadScheduler::RunTask(unsigned int queueIndex, const Task& task)
+{
+    Execution& execution = *task.m_Execution;
+
+    if (!execution.m_Failed)
+    {
+        try
+        {
+            ScopedRefThreadPool scopedRefThreadPool(execution.m_RefThreadPool);
+            execution.m_Workloads[task.m_Workload]->Execute();
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(execution.m_ExceptionMutex);
+            if (!execution.m_Exception)
+            {
+                execution.m_Exception = std::current_exception();
+            }
+            execution.m_Failed = true;
+        }
+    }
+
+    // The successors are pushed last first, so that this thread goes on with the first one.
+    const std::vector<unsigned int>& successors = execution.m_Dependencies.GetSuccessors(task.m_Workload);
+    for (auto it = successors.rbegin(); it != successors.rend(); ++it)
+    {
+        if (--execution.m_NumPendingPredecessors[*it] == 0)
+        {
+            Push(queueIndex, { &execution, *it });
+        }
+    }
+
+    if (--execution.m_NumUnfinishedWorkloads == 0)
+    {
+        // The execution may be destroyed from here on.
+        {
+            std::lock_guard<std::mutex> lock(m_Mutex);
+        }
+        m_StateChanged.notify_all();
+    }
+}
+
+void WorkloadScheduler::WorkerLoop(unsigned int queueIndex)
+{
+    while (true)
+    {
+        Task task;
+        if (TryPop(queueIndex, task))
+        {
+            RunTask(queueIndex, task);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_StateChanged.wait(lock, [this]() { return m_NumQueuedTasks > 0 || m_Stopping; });
+        if (m_NumQueuedTasks == 0)
+        {
+            return;
+        }
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,101 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include "backends/Workload.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// Dependencies between the workloads of a queue: each workload may only start once all its predecessors, which
+/// come before it in the queue, have finished.
+class WorkloadDependencies
+{
+public:
+    explicit WorkloadDependencies(unsigned int numWorkloads);
+
+    /// Makes the workload at index successor wait for the one at index predecessor, which must be lower.
+    void AddDependency(unsigned int predecessor, unsigned int successor);
+
+    unsigned int GetNumWorkloads() const { return static_cast<unsigned int>(m_NumPredecessors.size()); }
+    unsigned int GetNumPredecessors(unsigned int workload) const { return m_NumPredecessors[workload]; }
+    const std::vector<unsigned int>& GetSuccessors(unsigned int workload) const { return m_Successors[workload]; }
+
+private:
+    std::vector<unsigned int> m_NumPredecessors;
+    std::vector<std::vector<unsigned int>> m_Successors;
+};
+
+/// Pool of threads running the workloads of a queue concurrently, each as soon as its predecessors have finished,
+/// so that the independent branches of a network overlap.
+/// Every thread takes the workloads made ready by the ones it runs from the back of its own queue, so that they read
+/// the tensors it has just written, and steals from the front of the queues of the other threads when its own is
+/// empty. Several queues, possibly of different networks, may be run on the same pool at the same time.
+class WorkloadScheduler
+{
+public:
+    using WorkloadQueue = std::vector<std::unique_ptr<IWorkload>>;
+
+    /// @param numThreads - Number of threads running the workloads of a queue, including the thread calling Run().
+    ///                     If 0, one per hardware thread is used.
+    explicit WorkloadScheduler(unsigned int numThreads);
+    ~WorkloadScheduler();
+
+    WorkloadScheduler(const WorkloadScheduler&) = delete;
+    WorkloadScheduler& operator=(const WorkloadScheduler&) = delete;
+
+    unsigned int GetNumThreads() const { return static_cast<unsigned int>(m_Threads.size()) + 1; }
+
+    /// Executes the given workloads in an order respecting their dependencies, from the calling thread and the
+    /// threads of the pool, and returns once all of them have finished. The workloads share the CpuRef thread pool
+    /// of the calling thread. If a workload throws, the workloads which have not started yet are skipped and the
+    /// first exception is rethrown once the others have finished.
+    void Run(const WorkloadQueue& workloads, const WorkloadDependencies& dependencies);
+
+private:
+    struct Execution;
+
+    struct Task
+    {
+        Execution* m_Execution;
+        unsigned int m_Workload;
+    };
+
+    /// Queue of ready tasks, pushed and popped at the back by the thread owning it and stolen from the front by
+    /// the others.
+    struct TaskQueue
+    {
+        std::mutex m_Mutex;
+        std::deque<Task> m_Tasks;
+    };
+
+    void Push(unsigned int queueIndex, const Task& task);
+    bool TryPop(unsigned int queueIndex, Task& task);
+    void RunTask(unsigned int queueIndex, const Task& task);
+    void WorkerLoop(unsigned int queueIndex);
+
+    /// One queue per thread of the pool, followed by the queue shared by the threads calling Run().
+    std::vector<std::unique_ptr<TaskQueue>> m_Queues;
+
+    /// Number of tasks pushed to the queues and not popped yet.
+    std::atomic<unsigned int> m_NumQueuedTasks;
+
+    /// Guards the waits for tasks and for the end of executions.
+    std::mutex m_Mutex;
+    std::condition_variable m_StateChanged;
+
+    bool m_Stopping;
+    std::vector<std::thread> m_Threads;
+};
+
+} // namespace armnn
@@ -347,7 +347,14 @@ bool IsSoftmaxSupportedCl(const TensorInfo& input,
                           const SoftmaxDescriptor& descriptor,
                           std::string* reasonIfUnsupported)
 {
-    ignore_unused(descriptor);
+    if (descriptor.m_Axis != -1 && descriptor.m_Axis != static_cast<int>(input.GetNumDimensions()) - 1)
+    {
+        if (reasonIfUnsupported)
+        {
+            *reasonIfUnsupported = "Softmax is only supported along the last dimension.";
+        }
+        return false;
+    }
     FORWARD_WORKLOAD_VALIDATE_FUNC(ClSoftmaxWorkloadValidate, reasonIfUnsupported, input, output);
 }
 
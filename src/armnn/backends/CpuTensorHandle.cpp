@@ -4,6 +4,7 @@
 //
 #include "armnn/Exceptions.hpp"
 #include "CpuTensorHandle.hpp"
+#include "memory/RefMemoryManager.hpp"
 
 #include <cstring>
 
@@ -19,7 +20,7 @@ ConstCpuTensorHandle::ConstCpuTensorHandle(const TensorInfo& tensorInfo)
 template <>
 const void* ConstCpuTensorHandle::GetConstTensor() const
 {
-    return m_Memory;
+    return GetConstMemory();
 }
 
 CpuTensorHandle::CpuTensorHandle(const TensorInfo& tensorInfo)
@@ -31,7 +32,7 @@ CpuTensorHandle::CpuTensorHandle(const TensorInfo& tensorInfo)
 template <>
 void* CpuTensorHandle::GetTensor() const
 {
-    return m_MutableMemory;
+    return GetMemory();
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const TensorInfo& tensorInfo)
@@ -42,7 +43,14 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const TensorInfo& tensorInfo)
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstTensor& tensor)
 : ScopedCpuTensorHandle(tensor.GetInfo())
 {
-    CopyFrom(tensor.GetMemoryArea(), tensor.GetNumBytes());
+    if (tensor.GetSharedMemoryArea())
+    {
+        ShareFrom(tensor.GetSharedMemoryArea());
+    }
+    else
+    {
+        CopyFrom(tensor.GetMemoryArea(), tensor.GetNumBytes());
+    }
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle)
@@ -54,27 +62,24 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorH
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other)
 : CpuTensorHandle(other.GetTensorInfo())
 {
-    CopyFrom(other);
+    ShareFrom(other);
 }
 
 ScopedCpuTensorHandle& ScopedCpuTensorHandle::operator=(const ScopedCpuTensorHandle& other)
 {
-    ::operator delete(GetTensor<void>());
-    SetMemory(nullptr);
-    CopyFrom(other);
+    BOOST_ASSERT(GetTensorInfo().GetNumBytes() == other.GetTensorInfo().GetNumBytes());
+    ShareFrom(other);
     return *this;
 }
 
-ScopedCpuTensorHandle::~ScopedCpuTensorHandle()
-{
-    ::operator delete(GetTensor<void>());
-}
+ScopedCpuTensorHandle::~ScopedCpuTensorHandle() = default;
 
 void ScopedCpuTensorHandle::Allocate()
 {
     if (GetTensor<void>() == nullptr)
     {
-        SetMemory(::operator new(GetTensorInfo().GetNumBytes()));
+        m_Memory.reset(::operator new(GetTensorInfo().GetNumBytes()), [](void* memory) { ::operator delete(memory); });
+        SetMemory(m_Memory.get());
     }
     else
     {
@@ -83,11 +88,6 @@ void ScopedCpuTensorHandle::Allocate()
     }
 }
 
-void ScopedCpuTensorHandle::CopyFrom(const ScopedCpuTensorHandle& other)
-{
-    CopyFrom(other.GetTensor<void>(), other.GetTensorInfo().GetNumBytes());
-}
-
 void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numBytes)
 {
     BOOST_ASSERT(GetTensor<void>() == nullptr);
@@ -100,6 +100,91 @@ void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numByte
     }
 }
 
+void ScopedCpuTensorHandle::ShareFrom(const ScopedCpuTensorHandle& other)
+{
+    m_Memory = other.m_Memory;
+    SetMemory(m_Memory.get());
+}
+
+void ScopedCpuTensorHandle::ShareFrom(const std::shared_ptr<const void>& memory)
+{
+    // The handle never writes to the memory region, whose owner promised it would not be modified.
+    m_Memory = std::const_pointer_cast<void>(memory);
+    SetMemory(m_Memory.get());
+}
+
+ManagedCpuTensorHandle::ManagedCpuTensorHandle(const TensorInfo& tensorInfo,
+                                               std::shared_ptr<RefMemoryManager> memoryManager)
+: CpuTensorHandle(tensorInfo)
+, m_MemoryManager(std::move(memoryManager))
+, m_IsManaged(false)
+, m_IsAllocated(false)
+{
+    BOOST_ASSERT(m_MemoryManager);
+}
+
+ManagedCpuTensorHandle::~ManagedCpuTensorHandle()
+{
+    if (m_IsManaged)
+    {
+        m_MemoryManager->Forget(this);
+    }
+    else
+    {
+        ::operator delete(GetTensor<void>());
+    }
+}
+
+void ManagedCpuTensorHandle::Manage()
+{
+    if (m_IsManaged || m_IsAllocated)
+    {
+        throw InvalidArgumentException("ManagedCpuTensorHandle::Manage Trying to manage a ManagedCpuTensorHandle"
+            " whose lifetime has already been started");
+    }
+
+    m_MemoryManager->StartLifetime(this, GetTensorInfo().GetNumBytes());
+    m_IsManaged = true;
+}
+
+void ManagedCpuTensorHandle::Allocate()
+{
+    if (m_IsAllocated)
+    {
+        throw InvalidArgumentException("ManagedCpuTensorHandle::Allocate Trying to allocate a"
+            " ManagedCpuTensorHandle that already has allocated memory.");
+    }
+
+    if (m_IsManaged)
+    {
+        // The memory will be bound when the memory manager is finalized.
+        m_MemoryManager->EndLifetime(this);
+    }
+    else
+    {
+        SetMemory(::operator new(GetTensorInfo().GetNumBytes()));
+    }
+    m_IsAllocated = true;
+}
+
+CpuSubTensorHandle::CpuSubTensorHandle(CpuTensorHandle* parent, const TensorShape& shape, unsigned int offsetInBytes)
+: CpuTensorHandle(TensorInfo(shape,
+                             parent->GetTensorInfo().GetDataType(),
+                             parent->GetTensorInfo().GetQuantizationScale(),
+                             parent->GetTensorInfo().GetQuantizationOffset()))
+, m_Parent(parent)
+, m_OffsetInBytes(offsetInBytes)
+{
+    BOOST_ASSERT(offsetInBytes + GetTensorInfo().GetNumBytes() <= parent->GetTensorInfo().GetNumBytes());
+}
+
+void* CpuSubTensorHandle::GetMemory() const
+{
+    // The memory of the parent may only be bound once the memory manager is finalized, so it is looked up each time.
+    unsigned char* parentMemory = static_cast<unsigned char*>(m_Parent->GetTensor<void>());
+    return parentMemory ? parentMemory + m_OffsetInBytes : nullptr;
+}
+
 void PassthroughCpuTensorHandle::Allocate()
 {
     throw InvalidArgumentException("PassthroughCpuTensorHandle::Allocate() should never be called");
@@ -10,10 +10,14 @@
 #include "OutputHandler.hpp"
 
 #include <algorithm>
+#include <array>
+#include <memory>
 
 namespace armnn
 {
 
+class RefMemoryManager;
+
 // Abstract tensor handles wrapping a CPU-readable region of memory, interpreting it as tensor data.
 class ConstCpuTensorHandle : public ITensorHandle
 {
@@ -22,7 +26,7 @@ public:
     const T* GetConstTensor() const
     {
         BOOST_ASSERT(GetTensorInfo().GetDataType() == GetDataType<T>());
-        return reinterpret_cast<const T*>(m_Memory);
+        return reinterpret_cast<const T*>(GetConstMemory());
     }
 
     const TensorInfo& GetTensorInfo() const
@@ -39,7 +43,7 @@ public:
 
     virtual ITensorHandle* GetParent() const override { return nullptr; }
 
-    virtual const void* Map(bool /* blocking = true */) const override { return m_Memory; }
+    virtual const void* Map(bool /* blocking = true */) const override { return GetConstMemory(); }
     virtual void Unmap() const override {}
 
     TensorShape GetStrides() const override
@@ -47,7 +51,7 @@ public:
         TensorShape shape(m_TensorInfo.GetShape());
         auto size = GetDataTypeSize(m_TensorInfo.GetDataType());
         auto runningSize = size;
-        std::vector<unsigned int> strides(shape.GetNumDimensions());
+        std::array<unsigned int, MaxNumOfTensorDimensions> strides;
         auto lastIdx = shape.GetNumDimensions()-1;
         for (unsigned int i=0; i < lastIdx ; i++)
         {
@@ -64,6 +68,8 @@ protected:
 
     void SetConstMemory(const void* mem) { m_Memory = mem; }
 
+    virtual const void* GetConstMemory() const { return m_Memory; }
+
 private:
     ConstCpuTensorHandle(const ConstCpuTensorHandle& other) = delete;
     ConstCpuTensorHandle& operator=(const ConstCpuTensorHandle& other) = delete;
@@ -80,7 +86,7 @@ public:
     T* GetTensor() const
     {
         BOOST_ASSERT(GetTensorInfo().GetDataType() == GetDataType<T>());
-        return reinterpret_cast<T*>(m_MutableMemory);
+        return reinterpret_cast<T*>(GetMemory());
     }
 
 protected:
@@ -92,6 +98,8 @@ protected:
         SetConstMemory(m_MutableMemory);
     }
 
+    virtual void* GetMemory() const { return m_MutableMemory; }
+
 private:
 
     CpuTensorHandle(const CpuTensorHandle& other) = delete;
@@ -99,27 +107,63 @@ private:
     void* m_MutableMemory;
 };
 
-// A CpuTensorHandle that owns the wrapped memory region.
+// A CpuTensorHandle that owns the wrapped memory region, together with its copies.
+//
+// Copying a ScopedCpuTensorHandle does not copy the memory region: the copies reference the same bytes, which are
+// freed with the last of them. This lets the constant tensors of a network be shared by its optimized graphs and
+// their workloads, so the memory region must not be written to once the handle has been copied, or if it was
+// shared by the ConstTensor the handle was created from.
 class ScopedCpuTensorHandle : public CpuTensorHandle
 {
 public:
     explicit ScopedCpuTensorHandle(const TensorInfo& tensorInfo);
 
-    // Copies contents from Tensor.
+    // Copies contents from Tensor, unless it shares the ownership of its memory region, which is then shared too.
     explicit ScopedCpuTensorHandle(const ConstTensor& tensor);
 
     // Copies contents from ConstCpuTensorHandle
     explicit ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle);
 
+    // Shares the memory region of other.
     ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other);
     ScopedCpuTensorHandle& operator=(const ScopedCpuTensorHandle& other);
     ~ScopedCpuTensorHandle();
 
     virtual void Allocate() override;
 
+    // Returns true if the memory region is referenced by other copies of this handle.
+    bool IsShared() const { return m_Memory.use_count() > 1; }
+
 private:
-    void CopyFrom(const ScopedCpuTensorHandle& other);
     void CopyFrom(const void* srcMemory, unsigned int numBytes);
+    void ShareFrom(const ScopedCpuTensorHandle& other);
+    void ShareFrom(const std::shared_ptr<const void>& memory);
+
+    std::shared_ptr<void> m_Memory;
+};
+
+// A CpuTensorHandle whose memory is provided by a RefMemoryManager.
+//
+// If Manage() is called before Allocate(), the two calls delimit the lifetime of the tensor and its memory is
+// assigned a region of the memory manager's slab once the manager is finalized. Otherwise Allocate() gives the
+// handle its own memory region.
+class ManagedCpuTensorHandle : public CpuTensorHandle
+{
+public:
+    ManagedCpuTensorHandle(const TensorInfo& tensorInfo, std::shared_ptr<RefMemoryManager> memoryManager);
+    ~ManagedCpuTensorHandle();
+
+    virtual void Manage() override;
+    virtual void Allocate() override;
+
+private:
+    friend class RefMemoryManager;
+
+    void SetManagedMemory(void* mem) { SetMemory(mem); }
+
+    std::shared_ptr<RefMemoryManager> m_MemoryManager;
+    bool m_IsManaged;
+    bool m_IsAllocated;
 };
 
 // A CpuTensorHandle that wraps an already allocated memory region.
@@ -140,6 +184,29 @@ public:
     virtual void Allocate() override;
 };
 
+// A CpuTensorHandle that references a region of the memory of another, so that the outputs of a Splitter layer and
+// the inputs of a Merger layer share the memory of the tensor they are views of.
+//
+// Workloads read and write the region as a tensor of its own, so it must be contiguous in the parent. The memory
+// belongs to the parent, whose lifetime covers the sub-tensor's: allocating a CpuSubTensorHandle does nothing.
+class CpuSubTensorHandle : public CpuTensorHandle
+{
+public:
+    CpuSubTensorHandle(CpuTensorHandle* parent, const TensorShape& shape, unsigned int offsetInBytes);
+
+    virtual ITensorHandle* GetParent() const override { return m_Parent; }
+
+    virtual void Allocate() override {}
+
+protected:
+    virtual const void* GetConstMemory() const override { return GetMemory(); }
+    virtual void* GetMemory() const override;
+
+private:
+    CpuTensorHandle* m_Parent;
+    unsigned int m_OffsetInBytes;
+};
+
 // A ConstCpuTensorHandle that wraps an already allocated memory region.
 //
 // This allows users to pass in const memory to a network.
@@ -52,6 +52,10 @@ public:
 
     void SetData(std::unique_ptr<ITensorHandle> data) { m_TensorHandle = std::move(data); }
 
+    /// @brief - Gives up the ownership of the tensor handle, leaving this output handler without one.
+    /// @return - The tensor handle previously owned by this output handler.
+    std::unique_ptr<ITensorHandle> ReleaseData() { return std::move(m_TensorHandle); }
+
     /// @brief Returns true if SetTensorInfo() has been called at least once on this.
     bool IsTensorInfoSet() const { return m_bTensorInfoSet; }
 private:
@@ -301,7 +301,6 @@ bool IsLstmSupportedRef(const TensorInfo& input, const TensorInfo& outputStateIn
                         const TensorInfo* projectionBias, const TensorInfo* cellToForgetWeights,
                         const TensorInfo* cellToOutputWeights, std::string* reasonIfUnsupported)
 {
-    ignore_unused(input);
     ignore_unused(outputStateIn);
     ignore_unused(cellStateIn);
     ignore_unused(scratchBuffer);
@@ -326,7 +325,10 @@ bool IsLstmSupportedRef(const TensorInfo& input, const TensorInfo& outputStateIn
     ignore_unused(projectionBias);
     ignore_unused(cellToForgetWeights);
     ignore_unused(cellToOutputWeights);
-    return false;
+    return IsSupportedForDataTypeRef(reasonIfUnsupported,
+                                     input.GetDataType(),
+                                     &TrueFunc<>,
+                                     &FalseFuncU8<>);
 }
 
 bool IsConvertFp16ToFp32SupportedRef(const TensorInfo& input,
@@ -10,6 +10,7 @@
 #include "MakeWorkloadHelper.hpp"
 
 #include <boost/log/trivial.hpp>
+#include <boost/polymorphic_cast.hpp>
 
 namespace armnn
 {
@@ -22,6 +23,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::MakeWorkload(const QueueDescripto
 }
 
 RefWorkloadFactory::RefWorkloadFactory()
+    : m_MemoryManager(std::make_shared<RefMemoryManager>())
 {
 }
 
@@ -33,7 +35,44 @@ bool RefWorkloadFactory::IsLayerSupported(const Layer& layer, boost::optional<Da
 
 std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateTensorHandle(const TensorInfo& tensorInfo) const
 {
-    return std::make_unique<ScopedCpuTensorHandle>(tensorInfo);
+    return std::make_unique<ManagedCpuTensorHandle>(tensorInfo, m_MemoryManager);
+}
+
+std::unique_ptr<ITensorHandle> RefWorkloadFactory::CreateSubTensorHandle(ITensorHandle& parent,
+                                                                         TensorShape const& subTensorShape,
+                                                                         unsigned int const* subTensorOrigin) const
+{
+    CpuTensorHandle* cpuParent = boost::polymorphic_downcast<CpuTensorHandle*>(&parent);
+    const TensorInfo& parentInfo = cpuParent->GetTensorInfo();
+    const TensorShape& parentShape = parentInfo.GetShape();
+    const unsigned int numDimensions = subTensorShape.GetNumDimensions();
+    BOOST_ASSERT(parentShape.GetNumDimensions() == numDimensions);
+
+    // The view is contiguous if it covers the parent in all the dimensions inside its outermost one of size above 1,
+    // as when concatenating NCHW tensors along their channels.
+    unsigned int outermostDimension = 0;
+    while (outermostDimension < numDimensions && subTensorShape[outermostDimension] == 1)
+    {
+        ++outermostDimension;
+    }
+    for (unsigned int i = outermostDimension + 1; i < numDimensions; ++i)
+    {
+        if (subTensorShape[i] != parentShape[i])
+        {
+            return nullptr;
+        }
+    }
+
+    unsigned int offset = 0;
+    unsigned int stride = 1;
+    for (unsigned int i = numDimensions; i-- > 0;)
+    {
+        offset += subTensorOrigin[i] * stride;
+        stride *= parentShape[i];
+    }
+
+    return std::make_unique<CpuSubTensorHandle>(cpuParent, subTensorShape,
+                                                offset * GetDataTypeSize(parentInfo.GetDataType()));
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateInput(const InputQueueDescriptor& descriptor,
@@ -221,4 +260,9 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateConvertFp32ToFp16(
     return std::make_unique<RefConvertFp32ToFp16Workload>(descriptor, info);
 }
 
+void RefWorkloadFactory::Finalize()
+{
+    m_MemoryManager->Finalize();
+}
+
 } // namespace armnn
@@ -7,7 +7,8 @@
 #include "WorkloadFactory.hpp"
 #include "OutputHandler.hpp"
 
-#include <boost/core/ignore_unused.hpp>
+#include "memory/RefMemoryManager.hpp"
+
 #include <boost/optional.hpp>
 
 namespace armnn
@@ -37,15 +38,13 @@ public:
     static bool IsLayerSupported(const Layer& layer, boost::optional<DataType> dataType,
                                  std::string& outReasonIfUnsupported);
 
-    virtual bool SupportsSubTensors() const override { return false; }
+    virtual bool SupportsSubTensors() const override { return true; }
 
+    /// Returns nullptr unless the view is contiguous in the memory of the parent, as reference workloads cannot read
+    /// strided tensors. The Splitter and Merger workloads copy the views without sub-tensors.
     virtual std::unique_ptr<ITensorHandle> CreateSubTensorHandle(ITensorHandle& parent,
                                                                  TensorShape const& subTensorShape,
-                                                                 unsigned int const* subTensorOrigin) const override
-    {
-        boost::ignore_unused(parent, subTensorShape, subTensorOrigin);
-        return nullptr;
-    }
+                                                                 unsigned int const* subTensorOrigin) const override;
 
     virtual std::unique_ptr<ITensorHandle> CreateTensorHandle(const TensorInfo& tensorInfo) const override;
 
@@ -124,11 +123,18 @@ public:
     virtual std::unique_ptr<IWorkload> CreateConvertFp32ToFp16(const ConvertFp32ToFp16QueueDescriptor& descriptor,
                                                                const WorkloadInfo& info) const override;
 
+    virtual void Finalize() override;
+
+    /// Gives access to the memory manager serving the tensor handles created by this factory,
+    /// e.g. to compare the planned peak memory with the memory needed without buffer reuse.
+    const RefMemoryManager& GetMemoryManager() const { return *m_MemoryManager; }
+
 private:
 
     template <typename F32Workload, typename U8Workload, typename QueueDescriptorType>
     std::unique_ptr<IWorkload> MakeWorkload(const QueueDescriptorType& descriptor, const WorkloadInfo& info) const;
 
+    std::shared_ptr<RefMemoryManager> m_MemoryManager;
 };
 
 } // namespace armnn
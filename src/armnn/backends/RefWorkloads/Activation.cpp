@@ -5,13 +5,65 @@
 
 #include "Activation.hpp"
 
-#include <boost/log/trivial.hpp>
+#include <armnn/Exceptions.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 namespace armnn
 {
 
+float Activation(float in, ActivationFunction function, float a, float b)
+{
+    switch (function)
+    {
+        case ActivationFunction::Linear:
+        {
+            return a * in + b;
+        }
+        case ActivationFunction::Sigmoid:
+        {
+            return 1.f / (1.f + expf(-in));
+        }
+        case ActivationFunction::ReLu:
+        {
+            return std::max(0.f, in);
+        }
+        case ActivationFunction::BoundedReLu:
+        {
+            return std::min(a, std::max(b, in));
+        }
+        case ActivationFunction::SoftReLu:
+        {
+            return logf(1.0f + expf(in));
+        }
+        case ActivationFunction::LeakyReLu:
+        {
+            return in > 0.0f ? in : (in * a);
+        }
+        case ActivationFunction::Abs:
+        {
+            return in < 0 ? -in : in;
+        }
+        case ActivationFunction::Sqrt:
+        {
+            return sqrtf(in);
+        }
+        case ActivationFunction::Square:
+        {
+            return in * in;
+        }
+        case ActivationFunction::TanH:
+        {
+            return a * tanhf(b * in);
+        }
+        default:
+        {
+            throw InvalidArgumentException("Unsupported activation function");
+        }
+    }
+}
+
 void Activation(const float* in,
                float* out,
                const TensorInfo& tensorInfo,
@@ -21,70 +73,7 @@ void Activation(const float* in,
 {
     for (size_t i = 0; i<tensorInfo.GetNumElements(); i++)
     {
-        float input = in[i];
-        float output;
-
-        // Compute the result of the activation function.
-        switch (function)
-        {
-            case ActivationFunction::Linear:
-            {
-                output = a * input + b;
-                break;
-            }
-            case ActivationFunction::Sigmoid:
-            {
-                output = 1.f / (1.f + expf(-input));
-                break;
-            }
-            case ActivationFunction::ReLu:
-            {
-                output = std::max(0.f, input);
-                break;
-            }
-            case ActivationFunction::BoundedReLu:
-            {
-                output = std::min(a, std::max(b, input));
-                break;
-            }
-            case ActivationFunction::SoftReLu:
-            {
-                output = logf(1.0f + expf(input));
-                break;
-            }
-            case ActivationFunction::LeakyReLu:
-            {
-                output = input > 0.0f ? input : (input * a);
-                break;
-            }
-            case ActivationFunction::Abs:
-            {
-                output = input < 0 ? -input : input;
-                break;
-            }
-            case ActivationFunction::Sqrt:
-            {
-                output = sqrtf(input);
-                break;
-            }
-            case ActivationFunction::Square:
-            {
-                output = input * input;
-                break;
-            }
-            case ActivationFunction::TanH:
-            {
-                output = a * tanhf(b * input);
-                break;
-            }
-            default:
-            {
-                BOOST_LOG_TRIVIAL(error) << "Unsupported activation function";
-                return;
-            }
-        }
-
-        out[i] = output;
+        out[i] = Activation(in[i], function, a, b);
     }
 }
 
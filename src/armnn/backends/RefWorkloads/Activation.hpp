@@ -3,12 +3,17 @@
 // See LICENSE file in the project root for full license information.
 //
 
+#pragma once
+
 #include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
 namespace armnn
 {
 
+/// Returns the result of the ActivationFunction for a single value.
+float Activation(float in, ActivationFunction function, float a, float b);
+
 /// Performs the ActivationFunction elementwise on the inputs to give the outputs.
 void Activation(const float* in,
                 float* out,
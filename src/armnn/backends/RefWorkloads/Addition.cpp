@@ -5,21 +5,13 @@
 
 #include "Addition.hpp"
 #include "Broadcast.hpp"
+#include "QuantizedMultiplier.hpp"
 
-#include <functional>
+#include <armnn/TypesUtils.hpp>
 
-namespace
-{
+#include <algorithm>
 
-void ElementwiseAddition(unsigned int numElements, const float* inData0, const float* inData1, float* outData)
-{
-    for (unsigned int i = 0; i < numElements; ++i)
-    {
-        outData[i] = inData0[i] + inData1[i];
-    }
-}
-
-} // namespace
+#include <functional>
 
 namespace armnn
 {
@@ -31,14 +23,58 @@ void Addition(const TensorShape& inShape0,
               const float* inData1,
               float* outData)
 {
-    if (inShape0 == inShape1)
-    {
-        ElementwiseAddition(inShape0.GetNumElements(), inData0, inData1, outData);
-    }
-    else
+    ElementwiseBinaryOperation(inShape0, inShape1, outShape, inData0, inData1, outData, std::plus<float>());
+}
+
+void Addition(const TensorInfo& inputInfo0,
+              const TensorInfo& inputInfo1,
+              const TensorInfo& outputInfo,
+              const uint8_t* inData0,
+              const uint8_t* inData1,
+              uint8_t* outData)
+{
+    const float inputScale0  = inputInfo0.GetQuantizationScale();
+    const float inputScale1  = inputInfo1.GetQuantizationScale();
+    const float outputScale  = outputInfo.GetQuantizationScale();
+    const int32_t inputOffset0 = inputInfo0.GetQuantizationOffset();
+    const int32_t inputOffset1 = inputInfo1.GetQuantizationOffset();
+    const int32_t outputOffset = outputInfo.GetQuantizationOffset();
+
+    // The inputs are shifted left to keep the precision of their rescaling to a common scale, twice the largest
+    // input scale so that both multipliers are smaller than one. Their sum is then rescaled to the output scale.
+    const int32_t leftShiftFactor = 1 << 20;
+    const float twiceMaxInputScale = 2.0f * std::max(inputScale0, inputScale1);
+    const float outputMultiplier = twiceMaxInputScale / (static_cast<float>(leftShiftFactor) * outputScale);
+
+    if (outputMultiplier >= 1.0f)
     {
-        BroadcastLoop(inShape0, inShape1, outShape).Unroll(std::plus<float>(), 0, inData0, inData1, outData);
+        // The output scale is too small for the integer rescaling.
+        ElementwiseBinaryOperation(inputInfo0.GetShape(), inputInfo1.GetShape(), outputInfo.GetShape(),
+                                   inData0, inData1, outData,
+                                   [&](uint8_t in0, uint8_t in1)
+                                   {
+                                       return Quantize<uint8_t>(Dequantize(in0, inputScale0, inputOffset0) +
+                                                                Dequantize(in1, inputScale1, inputOffset1),
+                                                                outputScale, outputOffset);
+                                   });
+        return;
     }
+
+    const QuantizedMultiplierSmallerThanOne inputMultiplier0(inputScale0 / twiceMaxInputScale);
+    const QuantizedMultiplierSmallerThanOne inputMultiplier1(inputScale1 / twiceMaxInputScale);
+    const QuantizedMultiplierSmallerThanOne outputRescale(outputMultiplier);
+
+    ElementwiseBinaryOperation(inputInfo0.GetShape(), inputInfo1.GetShape(), outputInfo.GetShape(),
+                               inData0, inData1, outData,
+                               [&](uint8_t in0, uint8_t in1)
+                               {
+                                   const int32_t scaled0 = inputMultiplier0 *
+                                       ((static_cast<int32_t>(in0) - inputOffset0) * leftShiftFactor);
+                                   const int32_t scaled1 = inputMultiplier1 *
+                                       ((static_cast<int32_t>(in1) - inputOffset1) * leftShiftFactor);
+                                   const int32_t result = (outputRescale * (scaled0 + scaled1)) + outputOffset;
+                                   return static_cast<uint8_t>(std::min(std::max(result, 0), 255));
+                               });
 }
 
 } //namespace armnn
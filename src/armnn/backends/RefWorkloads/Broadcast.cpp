@@ -9,25 +9,62 @@ namespace armnn
 {
 
 BroadcastLoop::BroadcastLoop(const TensorShape& inShape0, const TensorShape& inShape1, const TensorShape& outShape)
-: m_DimData(outShape.GetNumDimensions())
+: m_NumDimensions(0)
 {
-    const unsigned int numDims = GetNumDimensions();
+    const unsigned int numDims = outShape.GetNumDimensions();
+    BOOST_ASSERT(numDims <= MaxNumOfTensorDimensions);
 
+    std::array<unsigned int, MaxNumOfTensorDimensions> strides0;
+    std::array<unsigned int, MaxNumOfTensorDimensions> strides1;
     unsigned int sIn0 = 1;
     unsigned int sIn1 = 1;
-    unsigned int sOut = 1;
 
-    for (unsigned int j = numDims - 1, k = 0; k < numDims ; k++, j--)
+    for (unsigned int j = numDims; j-- > 0;)
     {
-        m_DimData[j].m_DimSize = outShape[j];
-        m_DimData[j].m_Stride1 = (inShape0[j] > 1) ? sIn0 : 0;
-        m_DimData[j].m_Stride2 = (inShape1[j] > 1) ? sIn1 : 0;
-        m_DimData[j].m_StrideOut = sOut;
+        strides0[j] = (inShape0[j] > 1) ? sIn0 : 0;
+        strides1[j] = (inShape1[j] > 1) ? sIn1 : 0;
 
         sIn0 *= inShape0[j];
         sIn1 *= inShape1[j];
-        sOut *= outShape[j];
     }
+
+    for (unsigned int j = 0; j < numDims; ++j)
+    {
+        if (outShape[j] == 1)
+        {
+            continue;
+        }
+
+        // Merges the dimension into the previous one if stepping over all of its elements is the same as stepping
+        // once in the previous one, in the output and in both inputs.
+        if (m_NumDimensions > 0)
+        {
+            BroadcastDimensionData& previous = m_DimData[m_NumDimensions - 1];
+            if (previous.m_Stride1 == strides0[j] * outShape[j] && previous.m_Stride2 == strides1[j] * outShape[j])
+            {
+                previous.m_DimSize *= outShape[j];
+                previous.m_Stride1 = strides0[j];
+                previous.m_Stride2 = strides1[j];
+                continue;
+            }
+        }
+
+        m_DimData[m_NumDimensions].m_DimSize = outShape[j];
+        m_DimData[m_NumDimensions].m_Stride1 = strides0[j];
+        m_DimData[m_NumDimensions].m_Stride2 = strides1[j];
+        ++m_NumDimensions;
+    }
+
+    unsigned int sOut = 1;
+    for (unsigned int j = m_NumDimensions; j-- > 0;)
+    {
+        m_DimData[j].m_StrideOut = sOut;
+        sOut *= m_DimData[j].m_DimSize;
+    }
+
+    // Along the innermost dimension, each input is either contiguous or broadcast.
+    BOOST_ASSERT(m_NumDimensions == 0 || m_DimData[m_NumDimensions - 1].m_Stride1 <= 1);
+    BOOST_ASSERT(m_NumDimensions == 0 || m_DimData[m_NumDimensions - 1].m_Stride2 <= 1);
 }
 
 } // namespace armnn
@@ -3,46 +3,112 @@
 // See LICENSE file in the project root for full license information.
 //
 
+#pragma once
+
 #include <armnn/Tensor.hpp>
 
-#include <functional>
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
 
 namespace armnn
 {
 
+/// Loops over the elements of the output of a binary operation whose inputs are broadcast to the output shape.
+/// The dimensions of size 1 in the output are left out, and consecutive dimensions which are laid out contiguously
+/// in both inputs, or broadcast in the same way, are merged when it's constructed. The innermost dimension is then
+/// a contiguous run, with each input either contiguous or broadcast, which is computed with a tight loop: tensors of
+/// the same shape are a single run, and a per-channel bias is one input broadcast along each run (NCHW) or
+/// contiguous in each run (NHWC).
 struct BroadcastLoop
 {
     BroadcastLoop(const TensorShape& inShape0, const TensorShape& inShape1, const TensorShape& outShape);
 
-    unsigned int GetNumDimensions()
+    unsigned int GetNumDimensions() const
     {
-        return static_cast<unsigned int>(m_DimData.size());
+        return m_NumDimensions;
     }
 
     template <typename T0, typename T1, typename U, typename Func>
-    void Unroll(Func operationFunc,
-                unsigned int dimension,
-                const T0* inData0,
-                const T1* inData1,
-                U* outData)
+    void Unroll(Func operationFunc, const T0* inData0, const T1* inData1, U* outData) const
     {
-        if (dimension >= GetNumDimensions())
+        if (m_NumDimensions == 0)
         {
             *outData = operationFunc(*inData0, *inData1);
             return;
         }
 
-        for (unsigned int i = 0; i < m_DimData[dimension].m_DimSize; i++)
+        // Iterates over the outer dimensions, innermost first, without recursing.
+        const unsigned int numOuterDimensions = m_NumDimensions - 1;
+        const BroadcastDimensionData& run = m_DimData[numOuterDimensions];
+        std::array<unsigned int, MaxNumOfTensorDimensions> index = {};
+        for (;;)
         {
-            Unroll(operationFunc, dimension + 1, inData0, inData1, outData);
+            UnrollRun(operationFunc, run.m_DimSize, run.m_Stride1 != 0, run.m_Stride2 != 0, inData0, inData1, outData);
+
+            unsigned int dimension = numOuterDimensions;
+            for (;;)
+            {
+                if (dimension == 0)
+                {
+                    return;
+                }
+                --dimension;
 
-            inData0 += m_DimData[dimension].m_Stride1;
-            inData1 += m_DimData[dimension].m_Stride2;
-            outData += m_DimData[dimension].m_StrideOut;
+                const BroadcastDimensionData& dimData = m_DimData[dimension];
+                if (++index[dimension] < dimData.m_DimSize)
+                {
+                    inData0 += dimData.m_Stride1;
+                    inData1 += dimData.m_Stride2;
+                    outData += dimData.m_StrideOut;
+                    break;
+                }
+
+                // Goes back to the start of this dimension, before moving on in the next outer one.
+                index[dimension] = 0;
+                inData0 -= dimData.m_Stride1 * (dimData.m_DimSize - 1);
+                inData1 -= dimData.m_Stride2 * (dimData.m_DimSize - 1);
+                outData -= dimData.m_StrideOut * (dimData.m_DimSize - 1);
+            }
         }
     }
 
 private:
+    /// Computes a contiguous run of the output, from inputs which are each either contiguous or broadcast along it.
+    template <typename T0, typename T1, typename U, typename Func>
+    static void UnrollRun(Func& operationFunc, unsigned int size, bool contiguous0, bool contiguous1,
+                          const T0* inData0, const T1* inData1, U* outData)
+    {
+        if (contiguous0 && contiguous1)
+        {
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                outData[i] = operationFunc(inData0[i], inData1[i]);
+            }
+        }
+        else if (contiguous0)
+        {
+            const T1 in1 = *inData1;
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                outData[i] = operationFunc(inData0[i], in1);
+            }
+        }
+        else if (contiguous1)
+        {
+            const T0 in0 = *inData0;
+            for (unsigned int i = 0; i < size; ++i)
+            {
+                outData[i] = operationFunc(in0, inData1[i]);
+            }
+        }
+        else
+        {
+            std::fill_n(outData, size, operationFunc(*inData0, *inData1));
+        }
+    }
+
     // Struct to hold the dimension data.
     struct BroadcastDimensionData
     {
@@ -52,7 +118,22 @@ private:
         unsigned int m_Stride2;
     };
 
-    std::vector<BroadcastDimensionData> m_DimData;
+    unsigned int m_NumDimensions;
+    std::array<BroadcastDimensionData, MaxNumOfTensorDimensions> m_DimData;
 };
 
-} //namespace armnn
\ No newline at end of file
+/// Sets each element of the output to operationFunc applied to the matching elements of the inputs, which are
+/// broadcast to the output shape if their shapes differ.
+template <typename T0, typename T1, typename U, typename Func>
+void ElementwiseBinaryOperation(const TensorShape& inShape0,
+                                const TensorShape& inShape1,
+                                const TensorShape& outShape,
+                                const T0* inData0,
+                                const T1* inData1,
+                                U* outData,
+                                Func operationFunc)
+{
+    BroadcastLoop(inShape0, inShape1, outShape).Unroll(operationFunc, inData0, inData1, outData);
+}
+
+} //namespace armnn
@@ -0,0 +1,456 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#include "DepthwiseConvolution.hpp"
+
+#include "Activation.hpp"
+#include "DataLayoutIndexed.hpp"
+#include "Gemm.hpp"
+#include "RefThreadPool.hpp"
+
+#include <Permute.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Maximum number of elements of the tile of depthwise output buffered for a fused pointwise convolution, which
+// keeps it in the L2 cache between the two convolutions.
+constexpr unsigned int MaxTileSize = 64 * 1024;
+
+// Gets the first output position whose window starts inside the input, and one past the last one whose window
+// ends inside it.
+void GetInteriorRange(unsigned int inputSize, unsigned int outputSize, unsigned int filterSize, unsigned int stride,
+                      unsigned int padBefore, unsigned int& begin, unsigned int& end)
+{
+    begin = std::min(outputSize, (padBefore + stride - 1) / stride);
+    end = inputSize + padBefore >= filterSize ?
+        std::min(outputSize, (inputSize + padBefore - filterSize) / stride + 1) : 0;
+    end = std::max(begin, end);
+}
+
+// Computes n elements of an output row of a 3x3 convolution from the three input rows its windows read, starting
+// at the first element of the window of the first output element.
+template <unsigned int Stride>
+void Convolve3x3Row(const float* row0, const float* row1, const float* row2, const float* weights, float bias,
+                    float* outputRow, unsigned int n)
+{
+    const float w0 = weights[0], w1 = weights[1], w2 = weights[2];
+    const float w3 = weights[3], w4 = weights[4], w5 = weights[5];
+    const float w6 = weights[6], w7 = weights[7], w8 = weights[8];
+
+    for (unsigned int x = 0; x < n; ++x)
+    {
+        const unsigned int i = x * Stride;
+        outputRow[x] = bias + w0 * row0[i] + w1 * row0[i + 1] + w2 * row0[i + 2]
+                            + w3 * row1[i] + w4 * row1[i + 1] + w5 * row1[i + 2]
+                            + w6 * row2[i] + w7 * row2[i + 1] + w8 * row2[i + 2];
+    }
+}
+
+// Computes n elements of an output row of any other convolution from the first element of the window of the first
+// output element, one filter weight at a time.
+void ConvolveRow(const float* input, unsigned int inputRowStride, const float* weights,
+                 unsigned int heightFilter, unsigned int widthFilter, unsigned int stride, float bias,
+                 float* outputRow, unsigned int n)
+{
+    std::fill(outputRow, outputRow + n, bias);
+    for (unsigned int yFilter = 0; yFilter < heightFilter; ++yFilter)
+    {
+        for (unsigned int xFilter = 0; xFilter < widthFilter; ++xFilter)
+        {
+            const float weight = weights[yFilter * widthFilter + xFilter];
+            const float* const inputRow = input + yFilter * inputRowStride + xFilter;
+            for (unsigned int x = 0; x < n; ++x)
+            {
+                outputRow[x] += weight * inputRow[x * stride];
+            }
+        }
+    }
+}
+
+void ApplyActivation(float* data, unsigned int size, const ActivationDescriptor& activation)
+{
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        data[i] = Activation(data[i], activation.m_Function, activation.m_A, activation.m_B);
+    }
+}
+
+} // anonymous namespace
+
+DepthwiseConvolution::DepthwiseConvolution(const TensorInfo& inputInfo,
+                                           const TensorInfo& filterInfo,
+                                           const float* filterData,
+                                           const DepthwiseConvolution2dDescriptor& descriptor,
+                                           const TensorInfo* pointwiseFilterInfo,
+                                           const float* pointwiseFilterData)
+    : m_BatchSize(inputInfo.GetShape()[0])
+    , m_DepthMultiplier(filterInfo.GetShape()[0])
+    , m_Descriptor(descriptor)
+    , m_PointwiseChannelsOutput(pointwiseFilterInfo != nullptr ? pointwiseFilterInfo->GetShape()[0] : 0)
+    , m_PointwiseWeights(pointwiseFilterData)
+    , m_TileRows(0)
+{
+    BOOST_ASSERT(descriptor.m_StrideX > 0 && descriptor.m_StrideY > 0);
+
+    // The filter is laid out like the data, with the depth multiplier first.
+    const armnnUtils::DataLayoutIndexed dataLayout(descriptor.m_DataLayout);
+    const TensorShape& filterShape = filterInfo.GetShape();
+    m_ChannelsInput  = filterShape[dataLayout.GetChannelsIndex()];
+    m_HeightInput    = inputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    m_WidthInput     = inputInfo.GetShape()[dataLayout.GetWidthIndex()];
+    m_HeightFilter   = filterShape[dataLayout.GetHeightIndex()];
+    m_WidthFilter    = filterShape[dataLayout.GetWidthIndex()];
+    m_ChannelsOutput = m_ChannelsInput * m_DepthMultiplier;
+    m_HeightOutput   = (m_HeightInput + descriptor.m_PadTop + descriptor.m_PadBottom - m_HeightFilter) /
+                       descriptor.m_StrideY + 1;
+    m_WidthOutput    = (m_WidthInput + descriptor.m_PadLeft + descriptor.m_PadRight - m_WidthFilter) /
+                       descriptor.m_StrideX + 1;
+
+    GetInteriorRange(m_HeightInput, m_HeightOutput, m_HeightFilter, descriptor.m_StrideY, descriptor.m_PadTop,
+                     m_InteriorYBegin, m_InteriorYEnd);
+    GetInteriorRange(m_WidthInput, m_WidthOutput, m_WidthFilter, descriptor.m_StrideX, descriptor.m_PadLeft,
+                     m_InteriorXBegin, m_InteriorXEnd);
+
+    // Output channel c * depthMultiplier + m is the convolution of input channel c by filter m.
+    m_Weights.resize(m_ChannelsOutput * m_HeightFilter * m_WidthFilter);
+    for (unsigned int m = 0; m < m_DepthMultiplier; ++m)
+    {
+        for (unsigned int c = 0; c < m_ChannelsInput; ++c)
+        {
+            const unsigned int cOutput = c * m_DepthMultiplier + m;
+            for (unsigned int yFilter = 0; yFilter < m_HeightFilter; ++yFilter)
+            {
+                for (unsigned int xFilter = 0; xFilter < m_WidthFilter; ++xFilter)
+                {
+                    const unsigned int index = IsNhwc() ?
+                        (yFilter * m_WidthFilter + xFilter) * m_ChannelsOutput + cOutput :
+                        (cOutput * m_HeightFilter + yFilter) * m_WidthFilter + xFilter;
+                    m_Weights[index] = filterData[dataLayout.GetIndex(filterShape, m, c, yFilter, xFilter)];
+                }
+            }
+        }
+    }
+
+    if (m_PointwiseChannelsOutput == 0)
+    {
+        return;
+    }
+
+    BOOST_ASSERT(pointwiseFilterData != nullptr);
+    BOOST_ASSERT(pointwiseFilterInfo->GetNumElements() == m_PointwiseChannelsOutput * m_ChannelsOutput);
+
+    // The tile of an NHWC convolution holds the depthwise output pixel by pixel, so it is multiplied by the
+    // transpose of the pointwise filter.
+    if (IsNhwc())
+    {
+        m_TransposedPointwiseWeights.resize(m_ChannelsOutput * m_PointwiseChannelsOutput);
+        armnnUtils::Permute(TensorShape({ m_ChannelsOutput, m_PointwiseChannelsOutput }), { 1, 0 },
+                            pointwiseFilterData, m_TransposedPointwiseWeights.data());
+    }
+
+    m_TileRows = std::min(m_HeightOutput, std::max(1u, MaxTileSize / (m_ChannelsOutput * m_WidthOutput)));
+    m_Tile.resize(m_ChannelsOutput * m_WidthOutput * m_TileRows);
+}
+
+bool DepthwiseConvolution::IsPointwiseSupported(const TensorInfo& depthwiseOutputInfo,
+                                                const TensorInfo& pointwiseFilterInfo,
+                                                const Convolution2dDescriptor& pointwiseDescriptor,
+                                                DataLayout depthwiseDataLayout)
+{
+    if (pointwiseDescriptor.m_DataLayout != depthwiseDataLayout ||
+        depthwiseOutputInfo.GetDataType() != DataType::Float32 ||
+        pointwiseFilterInfo.GetDataType() != DataType::Float32 ||
+        depthwiseOutputInfo.GetNumDimensions() != 4 || pointwiseFilterInfo.GetNumDimensions() != 4)
+    {
+        return false;
+    }
+
+    // A depthwise output which fits in a single tile stays in the caches anyway, and is better multiplied whole.
+    const armnnUtils::DataLayoutIndexed dataLayout(depthwiseDataLayout);
+    const TensorShape& outputShape = depthwiseOutputInfo.GetShape();
+    if (outputShape[dataLayout.GetChannelsIndex()] * outputShape[dataLayout.GetHeightIndex()] *
+        outputShape[dataLayout.GetWidthIndex()] <= MaxTileSize)
+    {
+        return false;
+    }
+
+    const TensorShape& filterShape = pointwiseFilterInfo.GetShape();
+    return filterShape[dataLayout.GetHeightIndex()] == 1 && filterShape[dataLayout.GetWidthIndex()] == 1 &&
+           filterShape[dataLayout.GetChannelsIndex()] == outputShape[dataLayout.GetChannelsIndex()] &&
+           pointwiseDescriptor.m_StrideX == 1 && pointwiseDescriptor.m_StrideY == 1 &&
+           pointwiseDescriptor.m_PadLeft == 0 && pointwiseDescriptor.m_PadRight == 0 &&
+           pointwiseDescriptor.m_PadTop == 0 && pointwiseDescriptor.m_PadBottom == 0;
+}
+
+void DepthwiseConvolution::ComputeNchwRow(const float* inputPlane, const float* weights, float bias,
+                                          unsigned int yOutput, float* outputRow) const
+{
+    const int yInput = static_cast<int>(yOutput * m_Descriptor.m_StrideY) - static_cast<int>(m_Descriptor.m_PadTop);
+    const int heightInput  = static_cast<int>(m_HeightInput);
+    const int widthInput   = static_cast<int>(m_WidthInput);
+    const int heightFilter = static_cast<int>(m_HeightFilter);
+    const int widthFilter  = static_cast<int>(m_WidthFilter);
+    const int yFilterBegin = std::max(0, -yInput);
+    const int yFilterEnd   = std::min(heightFilter, heightInput - yInput);
+
+    // Clamps the window of each pixel to the input.
+    auto convolveBorder = [&](unsigned int xBegin, unsigned int xEnd)
+    {
+        for (unsigned int xOutput = xBegin; xOutput < xEnd; ++xOutput)
+        {
+            const int xInput = static_cast<int>(xOutput * m_Descriptor.m_StrideX) -
+                               static_cast<int>(m_Descriptor.m_PadLeft);
+            const int xFilterBegin = std::max(0, -xInput);
+            const int xFilterEnd   = std::min(widthFilter, widthInput - xInput);
+
+            float sum = bias;
+            for (int yFilter = yFilterBegin; yFilter < yFilterEnd; ++yFilter)
+            {
+                const float* const inputRow = inputPlane + (yInput + yFilter) * widthInput + xInput;
+                const float* const weightRow = weights + yFilter * widthFilter;
+                for (int xFilter = xFilterBegin; xFilter < xFilterEnd; ++xFilter)
+                {
+                    sum += weightRow[xFilter] * inputRow[xFilter];
+                }
+            }
+            outputRow[xOutput] = sum;
+        }
+    };
+
+    if (yOutput < m_InteriorYBegin || yOutput >= m_InteriorYEnd)
+    {
+        convolveBorder(0, m_WidthOutput);
+        return;
+    }
+
+    convolveBorder(0, m_InteriorXBegin);
+
+    const unsigned int interiorWidth = m_InteriorXEnd - m_InteriorXBegin;
+    const float* const input = inputPlane + static_cast<unsigned int>(yInput) * m_WidthInput +
+                               m_InteriorXBegin * m_Descriptor.m_StrideX - m_Descriptor.m_PadLeft;
+    float* const interiorRow = outputRow + m_InteriorXBegin;
+    if (m_HeightFilter == 3 && m_WidthFilter == 3 && m_Descriptor.m_StrideX == 1)
+    {
+        Convolve3x3Row<1>(input, input + m_WidthInput, input + 2 * m_WidthInput, weights, bias,
+                          interiorRow, interiorWidth);
+    }
+    else if (m_HeightFilter == 3 && m_WidthFilter == 3 && m_Descriptor.m_StrideX == 2)
+    {
+        Convolve3x3Row<2>(input, input + m_WidthInput, input + 2 * m_WidthInput, weights, bias,
+                          interiorRow, interiorWidth);
+    }
+    else
+    {
+        ConvolveRow(input, m_WidthInput, weights, m_HeightFilter, m_WidthFilter, m_Descriptor.m_StrideX, bias,
+                    interiorRow, interiorWidth);
+    }
+
+    convolveBorder(m_InteriorXEnd, m_WidthOutput);
+}
+
+void DepthwiseConvolution::ComputeNhwcPixel(const float* inputData, unsigned int yOutput, unsigned int xOutput,
+                                            float* outputPixel) const
+{
+    const int yInput = static_cast<int>(yOutput * m_Descriptor.m_StrideY) - static_cast<int>(m_Descriptor.m_PadTop);
+    const int xInput = static_cast<int>(xOutput * m_Descriptor.m_StrideX) - static_cast<int>(m_Descriptor.m_PadLeft);
+    const int yFilterBegin = std::max(0, -yInput);
+    const int yFilterEnd   = std::min(static_cast<int>(m_HeightFilter), static_cast<int>(m_HeightInput) - yInput);
+    const int xFilterBegin = std::max(0, -xInput);
+    const int xFilterEnd   = std::min(static_cast<int>(m_WidthFilter), static_cast<int>(m_WidthInput) - xInput);
+
+    for (int yFilter = yFilterBegin; yFilter < yFilterEnd; ++yFilter)
+    {
+        for (int xFilter = xFilterBegin; xFilter < xFilterEnd; ++xFilter)
+        {
+            const unsigned int inputIndex = static_cast<unsigned int>((yInput + yFilter) *
+                static_cast<int>(m_WidthInput) + xInput + xFilter) * m_ChannelsInput;
+            const float* const inputPixel = inputData + inputIndex;
+            const float* const weights = m_Weights.data() +
+                static_cast<unsigned int>(yFilter * static_cast<int>(m_WidthFilter) + xFilter) * m_ChannelsOutput;
+
+            if (m_DepthMultiplier == 1)
+            {
+                for (unsigned int c = 0; c < m_ChannelsInput; ++c)
+                {
+                    outputPixel[c] += inputPixel[c] * weights[c];
+                }
+            }
+            else
+            {
+                for (unsigned int c = 0; c < m_ChannelsInput; ++c)
+                {
+                    for (unsigned int m = 0; m < m_DepthMultiplier; ++m)
+                    {
+                        const unsigned int cOutput = c * m_DepthMultiplier + m;
+                        outputPixel[cOutput] += inputPixel[c] * weights[cOutput];
+                    }
+                }
+            }
+        }
+    }
+}
+
+void DepthwiseConvolution::ComputeRows(const float* inputData, const float* biasData,
+                                       const ActivationDescriptor* activation, unsigned int rowBegin,
+                                       unsigned int rowEnd, float* dst, unsigned int dstChannelStride) const
+{
+    if (IsNhwc())
+    {
+        // The pixels of a row need all the channels of the input rows their windows read, so the rows are shared
+        // between the threads of the pool.
+        ParallelFor(rowBegin, rowEnd, [&](unsigned int yBegin, unsigned int yEnd)
+        {
+            for (unsigned int yOutput = yBegin; yOutput < yEnd; ++yOutput)
+            {
+                for (unsigned int xOutput = 0; xOutput < m_WidthOutput; ++xOutput)
+                {
+                    float* const outputPixel = dst + ((yOutput - rowBegin) * m_WidthOutput + xOutput) *
+                                                     m_ChannelsOutput;
+                    if (biasData != nullptr)
+                    {
+                        std::copy(biasData, biasData + m_ChannelsOutput, outputPixel);
+                    }
+                    else
+                    {
+                        std::fill(outputPixel, outputPixel + m_ChannelsOutput, 0.0f);
+                    }
+
+                    ComputeNhwcPixel(inputData, yOutput, xOutput, outputPixel);
+
+                    if (activation != nullptr)
+                    {
+                        ApplyActivation(outputPixel, m_ChannelsOutput, *activation);
+                    }
+                }
+            }
+        });
+        return;
+    }
+
+    // Each output plane is computed from a single input plane, so the output channels are shared between the
+    // threads of the pool.
+    ParallelFor(0, m_ChannelsOutput, [&](unsigned int channelBegin, unsigned int channelEnd)
+    {
+        for (unsigned int cOutput = channelBegin; cOutput < channelEnd; ++cOutput)
+        {
+            const float* const inputPlane = inputData + (cOutput / m_DepthMultiplier) * m_HeightInput * m_WidthInput;
+            const float* const weights = m_Weights.data() + cOutput * m_HeightFilter * m_WidthFilter;
+            const float bias = biasData != nullptr ? biasData[cOutput] : 0.0f;
+
+            for (unsigned int yOutput = rowBegin; yOutput < rowEnd; ++yOutput)
+            {
+                float* const outputRow = dst + cOutput * dstChannelStride + (yOutput - rowBegin) * m_WidthOutput;
+                ComputeNchwRow(inputPlane, weights, bias, yOutput, outputRow);
+
+                if (activation != nullptr)
+                {
+                    ApplyActivation(outputRow, m_WidthOutput, *activation);
+                }
+            }
+        }
+    });
+}
+
+void DepthwiseConvolution::Execute(const float* inputData,
+                                   const float* biasData,
+                                   float* outputData,
+                                   const ActivationDescriptor* activation,
+                                   const float* pointwiseBiasData,
+                                   const ActivationDescriptor* pointwiseActivation) const
+{
+    BOOST_ASSERT(!m_Descriptor.m_BiasEnabled || biasData != nullptr);
+
+    const float* const bias = m_Descriptor.m_BiasEnabled ? biasData : nullptr;
+    const unsigned int numPixels = m_HeightOutput * m_WidthOutput;
+
+    for (unsigned int batchIdx = 0; batchIdx < m_BatchSize; ++batchIdx)
+    {
+        const float* const batchInput = inputData + batchIdx * m_ChannelsInput * m_HeightInput * m_WidthInput;
+
+        if (m_PointwiseChannelsOutput == 0)
+        {
+            ComputeRows(batchInput, bias, activation, 0, m_HeightOutput,
+                        outputData + batchIdx * m_ChannelsOutput * numPixels, numPixels);
+            continue;
+        }
+
+        float* const batchOutput = outputData + batchIdx * m_PointwiseChannelsOutput * numPixels;
+        for (unsigned int rowBegin = 0; rowBegin < m_HeightOutput; rowBegin += m_TileRows)
+        {
+            const unsigned int rowEnd = std::min(m_HeightOutput, rowBegin + m_TileRows);
+            const unsigned int tileBegin = rowBegin * m_WidthOutput;
+            const unsigned int tileSize = (rowEnd - rowBegin) * m_WidthOutput;
+
+            ComputeRows(batchInput, bias, activation, rowBegin, rowEnd, m_Tile.data(), tileSize);
+
+            // The multiplication accumulates into the output, which therefore starts with the pointwise bias.
+            if (IsNhwc())
+            {
+                float* const outputTile = batchOutput + tileBegin * m_PointwiseChannelsOutput;
+                for (unsigned int i = 0; i < tileSize; ++i)
+                {
+                    float* const outputPixel = outputTile + i * m_PointwiseChannelsOutput;
+                    if (pointwiseBiasData != nullptr)
+                    {
+                        std::copy(pointwiseBiasData, pointwiseBiasData + m_PointwiseChannelsOutput, outputPixel);
+                    }
+                    else
+                    {
+                        std::fill(outputPixel, outputPixel + m_PointwiseChannelsOutput, 0.0f);
+                    }
+                }
+
+                Gemm(tileSize, m_PointwiseChannelsOutput, m_ChannelsOutput,
+                     m_Tile.data(), m_ChannelsOutput,
+                     m_TransposedPointwiseWeights.data(), m_PointwiseChannelsOutput,
+                     outputTile, m_PointwiseChannelsOutput);
+
+                if (pointwiseActivation != nullptr)
+                {
+                    ParallelFor(0, tileSize, [&](unsigned int pixelBegin, unsigned int pixelEnd)
+                    {
+                        ApplyActivation(outputTile + pixelBegin * m_PointwiseChannelsOutput,
+                                        (pixelEnd - pixelBegin) * m_PointwiseChannelsOutput, *pointwiseActivation);
+                    });
+                }
+                continue;
+            }
+
+            for (unsigned int cOutput = 0; cOutput < m_PointwiseChannelsOutput; ++cOutput)
+            {
+                float* const outputRow = batchOutput + cOutput * numPixels + tileBegin;
+                std::fill(outputRow, outputRow + tileSize,
+                          pointwiseBiasData != nullptr ? pointwiseBiasData[cOutput] : 0.0f);
+            }
+
+            Gemm(m_PointwiseChannelsOutput, tileSize, m_ChannelsOutput,
+                 m_PointwiseWeights, m_ChannelsOutput,
+                 m_Tile.data(), tileSize,
+                 batchOutput + tileBegin, numPixels);
+
+            if (pointwiseActivation != nullptr)
+            {
+                ParallelFor(0, m_PointwiseChannelsOutput, [&](unsigned int channelBegin, unsigned int channelEnd)
+                {
+                    for (unsigned int cOutput = channelBegin; cOutput < channelEnd; ++cOutput)
+                    {
+                        ApplyActivation(batchOutput + cOutput * numPixels + tileBegin, tileSize,
+                                        *pointwiseActivation);
+                    }
+                });
+            }
+        }
+    }
+}
+
+} //namespace armnn
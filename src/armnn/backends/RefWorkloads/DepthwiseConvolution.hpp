@@ -0,0 +1,104 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Float32 depthwise convolution, optionally followed by a fused pointwise (1x1, unit stride, unpadded) convolution.
+/// The weights are rearranged when the convolution is created: per output channel for NCHW, so that each output
+/// plane is the convolution of one input plane by a few contiguous weights, and per filter position for NHWC, so
+/// that the innermost loop runs over the contiguous channels of a pixel.
+/// The windows of the NCHW output pixels in the interior of a plane do not read the padding and are computed without
+/// bounds checks, with unrolled loops for the 3x3 filters with strides 1 and 2 of MobileNet-style networks; only the
+/// border is clamped. NHWC windows are clamped once per pixel for all of its channels.
+/// When a pointwise convolution is fused, the depthwise output is computed a tile of rows at a time into a buffer
+/// which stays in the caches, and is multiplied from there by the pointwise filter into the output, rather than
+/// written to and read back from a whole intermediate tensor.
+class DepthwiseConvolution
+{
+public:
+    /// Rearranges the weights of the given convolution. pointwiseFilterInfo and pointwiseFilterData describe the
+    /// filter of the fused pointwise convolution, [outputChannels, inputChannels, 1, 1] for NCHW or
+    /// [outputChannels, 1, 1, inputChannels] for NHWC, or are nullptr if there is none.
+    DepthwiseConvolution(const TensorInfo& inputInfo,
+                         const TensorInfo& filterInfo,
+                         const float* filterData,
+                         const DepthwiseConvolution2dDescriptor& descriptor,
+                         const TensorInfo* pointwiseFilterInfo = nullptr,
+                         const float* pointwiseFilterData = nullptr);
+
+    /// Returns whether a pointwise convolution can be fused with the given depthwise convolution, and whether its
+    /// output is large enough to be split in several tiles, without which fusing them brings nothing.
+    static bool IsPointwiseSupported(const TensorInfo& depthwiseOutputInfo,
+                                     const TensorInfo& pointwiseFilterInfo,
+                                     const Convolution2dDescriptor& pointwiseDescriptor,
+                                     DataLayout depthwiseDataLayout);
+
+    /// Runs the convolution. biasData may be nullptr if the bias is disabled. If activation is not nullptr, it is
+    /// applied to the output of the depthwise convolution as it is computed. The arguments of the pointwise
+    /// convolution are ignored if none is fused; its bias may be nullptr.
+    /// Must not be called from several threads at the same time.
+    void Execute(const float* inputData,
+                 const float* biasData,
+                 float* outputData,
+                 const ActivationDescriptor* activation = nullptr,
+                 const float* pointwiseBiasData = nullptr,
+                 const ActivationDescriptor* pointwiseActivation = nullptr) const;
+
+private:
+    /// Computes rows [rowBegin, rowEnd) of every channel of the depthwise output of one batch. For NCHW, element
+    /// (channel, y, x) is written to dst[channel * dstChannelStride + (y - rowBegin) * m_WidthOutput + x]; for NHWC,
+    /// the rows are written contiguously from dst.
+    void ComputeRows(const float* inputData, const float* biasData, const ActivationDescriptor* activation,
+                     unsigned int rowBegin, unsigned int rowEnd, float* dst, unsigned int dstChannelStride) const;
+
+    void ComputeNchwRow(const float* inputPlane, const float* weights, float bias, unsigned int yOutput,
+                        float* outputRow) const;
+
+    void ComputeNhwcPixel(const float* inputData, unsigned int yOutput, unsigned int xOutput,
+                          float* outputPixel) const;
+
+    bool IsNhwc() const { return m_Descriptor.m_DataLayout == DataLayout::NHWC; }
+
+    unsigned int m_BatchSize;
+    unsigned int m_ChannelsInput;
+    unsigned int m_HeightInput;
+    unsigned int m_WidthInput;
+    unsigned int m_DepthMultiplier;
+    unsigned int m_ChannelsOutput;
+    unsigned int m_HeightOutput;
+    unsigned int m_WidthOutput;
+    unsigned int m_HeightFilter;
+    unsigned int m_WidthFilter;
+    DepthwiseConvolution2dDescriptor m_Descriptor;
+
+    /// The output rows and columns whose windows lie entirely inside the input.
+    unsigned int m_InteriorYBegin;
+    unsigned int m_InteriorYEnd;
+    unsigned int m_InteriorXBegin;
+    unsigned int m_InteriorXEnd;
+
+    /// The weights, [outputChannels, filterHeight, filterWidth] for NCHW and [filterHeight, filterWidth,
+    /// outputChannels] for NHWC.
+    std::vector<float> m_Weights;
+
+    /// The fused pointwise convolution: its number of output channels (0 if there is none), its filter, borrowed for
+    /// NCHW and transposed to [inputChannels, outputChannels] for NHWC, and the buffer of a tile of m_TileRows rows of
+    /// the depthwise output.
+    unsigned int m_PointwiseChannelsOutput;
+    const float* m_PointwiseWeights;
+    std::vector<float> m_TransposedPointwiseWeights;
+    unsigned int m_TileRows;
+    mutable std::vector<float> m_Tile;
+};
+
+} //namespace armnn
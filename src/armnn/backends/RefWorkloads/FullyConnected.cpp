@@ -5,56 +5,74 @@
 
 #include "FullyConnected.hpp"
 
+#include "Activation.hpp"
+#include "Gemm.hpp"
+
 #include <boost/assert.hpp>
 
+#include <algorithm>
+
 namespace armnn
 {
 
-void FullyConnected(const float*      inputData,
-                    float*            outputData,
-                    const TensorInfo& inputTensorInfo,
-                    const TensorInfo& outputTensorInfo,
-                    const float*      weightData,
-                    const float*      biasData,
-                    bool              transposeWeights)
+namespace
 {
-    unsigned int N = outputTensorInfo.GetShape()[1]; // Outputs Vector Size.
 
+// Returns the number of activations of each batch of the input.
+unsigned int GetInputSize(const TensorInfo& inputTensorInfo)
+{
     BOOST_ASSERT(inputTensorInfo.GetNumDimensions() > 1); // Needs some data.
 
-    unsigned int K = 1; // Total number of activations in the input.
+    unsigned int K = 1;
     for (unsigned int i = 1; i < inputTensorInfo.GetNumDimensions(); i++)
     {
         K *= inputTensorInfo.GetShape()[i];
     }
+    return K;
+}
+
+} // anonymous namespace
+
+void FullyConnected(const float*                inputData,
+                    float*                      outputData,
+                    const TensorInfo&           inputTensorInfo,
+                    const TensorInfo&           outputTensorInfo,
+                    const float*                weightData,
+                    const float*                biasData,
+                    bool                        transposeWeights,
+                    const ActivationDescriptor* activation)
+{
+    const unsigned int M = inputTensorInfo.GetShape()[0];  // Batch size.
+    const unsigned int N = outputTensorInfo.GetShape()[1]; // Outputs Vector Size.
+    const unsigned int K = GetInputSize(inputTensorInfo);  // Total number of activations in the input.
+
+    for (unsigned int n = 0; n < M; n++)
+    {
+        if (biasData)
+        {
+            std::copy(biasData, biasData + N, outputData + n * N);
+        }
+        else
+        {
+            std::fill(outputData + n * N, outputData + (n + 1) * N, 0.0f);
+        }
+    }
+
+    // The whole batch is multiplied at once, so that each block of the weights is loaded once for all of it.
+    if (transposeWeights)
+    {
+        GemmTransposedB(M, N, K, inputData, K, weightData, K, outputData, N);
+    }
+    else
+    {
+        Gemm(M, N, K, inputData, K, weightData, N, outputData, N);
+    }
 
-    for (unsigned int n = 0; n < inputTensorInfo.GetShape()[0]; n++)
+    if (activation)
     {
-        for (unsigned int channelOutput = 0; channelOutput < N; channelOutput++)
+        for (unsigned int i = 0; i < M * N; i++)
         {
-            float outval = 0.f;
-
-            for (unsigned int channelInput = 0; channelInput < K; channelInput++)
-            {
-                float weight;
-                if (transposeWeights)
-                {
-                    weight = weightData[channelOutput * K + channelInput];
-                }
-                else
-                {
-                    weight = weightData[channelInput * N + channelOutput];
-                }
-
-                outval += weight * inputData[n * K + channelInput];
-            }
-
-            if (biasData)
-            {
-                outval += biasData[channelOutput];
-            }
-
-            outputData[n * N + channelOutput] = outval;
+            outputData[i] = Activation(outputData[i], activation->m_Function, activation->m_A, activation->m_B);
         }
     }
 }
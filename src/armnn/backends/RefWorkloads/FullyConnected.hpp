@@ -5,18 +5,21 @@
 
 #pragma once
 
+#include <armnn/Descriptors.hpp>
 #include <armnn/Tensor.hpp>
 
 namespace armnn
 {
 
-/// Performs a matrix multiplication and optionally adds a bias.
-void FullyConnected(const float*      inputData,
-                    float*            outputData,
-                    const TensorInfo& inputTensorInfo,
-                    const TensorInfo& outputTensorInfo,
-                    const float*      weightData,
-                    const float*      biasData,
-                    bool              transposeWeights);
+/// Performs a matrix multiplication of the whole batch by the weight matrix, optionally adds a bias and applies an
+/// activation to the result. Transposed weights, stored one output per row, are read in place.
+void FullyConnected(const float*                inputData,
+                    float*                      outputData,
+                    const TensorInfo&           inputTensorInfo,
+                    const TensorInfo&           outputTensorInfo,
+                    const float*                weightData,
+                    const float*                biasData,
+                    bool                        transposeWeights,
+                    const ActivationDescriptor* activation = nullptr);
 
 } //namespace armnn
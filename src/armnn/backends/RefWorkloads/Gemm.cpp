@@ -0,0 +1,271 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#include "Gemm.hpp"
+
+#include "RefThreadPool.hpp"
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Number of rows of C computed together by the micro-kernel, which lets each loaded element of B be used
+// MicroKernelRows times.
+constexpr unsigned int MicroKernelRows = 4;
+
+// Block sizes: a KBlockSize x NBlockSize block of B (64 KiB) stays in the L2 cache while GemmRows() multiplies it by
+// every row of A it was given, and the MicroKernelRows x NBlockSize accumulators stay in the L1 cache.
+constexpr unsigned int NBlockSize = 64;
+constexpr unsigned int KBlockSize = 256;
+
+// Computes Rows x nc elements of C from a block of kc columns of A and kc rows of B.
+// The accumulators are local arrays, which cannot alias A, B or C, so that the compiler vectorises the innermost
+// loop without runtime checks.
+template <unsigned int Rows, typename T, typename AccumulatorType>
+void MicroKernel(unsigned int nc, unsigned int kc,
+                 const T* A, unsigned int lda,
+                 const T* B, unsigned int ldb,
+                 AccumulatorType* C, unsigned int ldc)
+{
+    AccumulatorType accumulators[Rows][NBlockSize];
+    for (unsigned int r = 0; r < Rows; ++r)
+    {
+        std::copy(C + r * ldc, C + r * ldc + nc, accumulators[r]);
+    }
+
+    for (unsigned int k = 0; k < kc; ++k)
+    {
+        const T* const rowB = B + k * ldb;
+        for (unsigned int r = 0; r < Rows; ++r)
+        {
+            const AccumulatorType a = A[r * lda + k];
+            AccumulatorType* const accumulator = accumulators[r];
+            for (unsigned int n = 0; n < nc; ++n)
+            {
+                accumulator[n] += a * static_cast<AccumulatorType>(rowB[n]);
+            }
+        }
+    }
+
+    for (unsigned int r = 0; r < Rows; ++r)
+    {
+        std::copy(accumulators[r], accumulators[r] + nc, C + r * ldc);
+    }
+}
+
+// Number of partial sums of each dot product of GemmTransposedB(), over interleaved elements, which lets the compiler
+// vectorise the dot products without reordering the additions of any partial sum.
+constexpr unsigned int DotProductLanes = 8;
+
+// Number of rows of B, and so of columns of C, GemmTransposedB() computes together, which lets each loaded element
+// of A be used DotProductColumns times.
+constexpr unsigned int DotProductColumns = 4;
+
+// Adds to Columns consecutive elements of a row of C the dot products of a row of A with Columns rows of B.
+template <unsigned int Columns, typename T, typename AccumulatorType>
+void DotProductKernel(unsigned int K, const T* rowA, const T* B, unsigned int ldb, AccumulatorType* rowC)
+{
+    AccumulatorType partialSums[Columns][DotProductLanes] = {};
+
+    const unsigned int laneK = K - K % DotProductLanes;
+    for (unsigned int k = 0; k < laneK; k += DotProductLanes)
+    {
+        for (unsigned int c = 0; c < Columns; ++c)
+        {
+            const T* const rowB = B + c * ldb + k;
+            for (unsigned int lane = 0; lane < DotProductLanes; ++lane)
+            {
+                partialSums[c][lane] +=
+                    static_cast<AccumulatorType>(rowA[k + lane]) * static_cast<AccumulatorType>(rowB[lane]);
+            }
+        }
+    }
+
+    for (unsigned int c = 0; c < Columns; ++c)
+    {
+        AccumulatorType sum = 0;
+        for (unsigned int lane = 0; lane < DotProductLanes; ++lane)
+        {
+            sum += partialSums[c][lane];
+        }
+        for (unsigned int k = laneK; k < K; ++k)
+        {
+            sum += static_cast<AccumulatorType>(rowA[k]) * static_cast<AccumulatorType>(B[c * ldb + k]);
+        }
+        rowC[c] += sum;
+    }
+}
+
+template <typename T, typename AccumulatorType>
+void GemmRows(unsigned int rowBegin, unsigned int rowEnd, unsigned int N, unsigned int K,
+              const T* A, unsigned int lda,
+              const T* B, unsigned int ldb,
+              AccumulatorType* C, unsigned int ldc)
+{
+    for (unsigned int nBlock = 0; nBlock < N; nBlock += NBlockSize)
+    {
+        const unsigned int nc = std::min(NBlockSize, N - nBlock);
+        for (unsigned int kBlock = 0; kBlock < K; kBlock += KBlockSize)
+        {
+            const unsigned int kc = std::min(KBlockSize, K - kBlock);
+            const T* const blockB = B + kBlock * ldb + nBlock;
+
+            unsigned int row = rowBegin;
+            for (; row + MicroKernelRows <= rowEnd; row += MicroKernelRows)
+            {
+                MicroKernel<MicroKernelRows>(nc, kc, A + row * lda + kBlock, lda, blockB, ldb,
+                                             C + row * ldc + nBlock, ldc);
+            }
+            for (; row < rowEnd; ++row)
+            {
+                MicroKernel<1>(nc, kc, A + row * lda + kBlock, lda, blockB, ldb, C + row * ldc + nBlock, ldc);
+            }
+        }
+    }
+}
+
+template <typename T, typename AccumulatorType>
+void GemmImpl(unsigned int M, unsigned int N, unsigned int K,
+              const T* A, unsigned int lda,
+              const T* B, unsigned int ldb,
+              AccumulatorType* C, unsigned int ldc)
+{
+    // A product with a single column of B, such as the output layer of a regression model, is a dot product per row
+    // of A, which the micro-kernel would compute one multiplication per loop.
+    if (N == 1)
+    {
+        ParallelFor(0, M, [&](unsigned int rowBegin, unsigned int rowEnd)
+        {
+            for (unsigned int row = rowBegin; row < rowEnd; ++row)
+            {
+                AccumulatorType sum = C[row * ldc];
+                for (unsigned int k = 0; k < K; ++k)
+                {
+                    sum += static_cast<AccumulatorType>(A[row * lda + k]) * static_cast<AccumulatorType>(B[k * ldb]);
+                }
+                C[row * ldc] = sum;
+            }
+        });
+        return;
+    }
+
+    // Blocks of MicroKernelRows rows and NBlockSize columns of C are shared between the threads, so that products
+    // with a single row, such as fully connected layers with a batch of one, are too. The blocks are numbered
+    // column-major, and the consecutive blocks of a column which a thread computes are passed to GemmRows() together,
+    // so that each block of B is multiplied by all of their rows while it is in the cache.
+    const unsigned int numRowGroups = (M + MicroKernelRows - 1) / MicroKernelRows;
+    const unsigned int numColumnBlocks = (N + NBlockSize - 1) / NBlockSize;
+    ParallelFor(0, numRowGroups * numColumnBlocks, [&](unsigned int blockBegin, unsigned int blockEnd)
+    {
+        for (unsigned int block = blockBegin; block < blockEnd;)
+        {
+            const unsigned int columnBlock = block / numRowGroups;
+            const unsigned int columnEnd = std::min(blockEnd, (columnBlock + 1) * numRowGroups);
+            const unsigned int rowBegin = (block - columnBlock * numRowGroups) * MicroKernelRows;
+            const unsigned int rowEnd = std::min((columnEnd - columnBlock * numRowGroups) * MicroKernelRows, M);
+            const unsigned int column = columnBlock * NBlockSize;
+            GemmRows(rowBegin, rowEnd, std::min(NBlockSize, N - column), K, A, lda, B + column, ldb, C + column, ldc);
+            block = columnEnd;
+        }
+    });
+}
+
+template <typename T, typename AccumulatorType>
+void GemmTransposedBImpl(unsigned int M, unsigned int N, unsigned int K,
+                         const T* A, unsigned int lda,
+                         const T* B, unsigned int ldb,
+                         AccumulatorType* C, unsigned int ldc)
+{
+    // Groups of DotProductColumns rows of B are shared between the threads, and each group is multiplied by every
+    // row of A while it is in the cache.
+    const unsigned int numColumnGroups = (N + DotProductColumns - 1) / DotProductColumns;
+    ParallelFor(0, numColumnGroups, [&](unsigned int groupBegin, unsigned int groupEnd)
+    {
+        for (unsigned int group = groupBegin; group < groupEnd; ++group)
+        {
+            const unsigned int column = group * DotProductColumns;
+            for (unsigned int row = 0; row < M; ++row)
+            {
+                const T* const rowA = A + row * lda;
+                if (column + DotProductColumns <= N)
+                {
+                    DotProductKernel<DotProductColumns>(K, rowA, B + column * ldb, ldb, C + row * ldc + column);
+                }
+                else
+                {
+                    for (unsigned int c = column; c < N; ++c)
+                    {
+                        DotProductKernel<1>(K, rowA, B + c * ldb, ldb, C + row * ldc + c);
+                    }
+                }
+            }
+        }
+    });
+}
+
+} // anonymous namespace
+
+void Gemm(unsigned int M, unsigned int N, unsigned int K,
+          const float* A, unsigned int lda,
+          const float* B, unsigned int ldb,
+          float* C, unsigned int ldc)
+{
+    GemmImpl(M, N, K, A, lda, B, ldb, C, ldc);
+}
+
+void GemmTransposedB(unsigned int M, unsigned int N, unsigned int K,
+                     const float* A, unsigned int lda,
+                     const float* B, unsigned int ldb,
+                     float* C, unsigned int ldc)
+{
+    GemmTransposedBImpl(M, N, K, A, lda, B, ldb, C, ldc);
+}
+
+void Gemm(unsigned int M, unsigned int N, unsigned int K,
+          const uint8_t* A, unsigned int lda,
+          const uint8_t* B, unsigned int ldb,
+          int32_t* C, unsigned int ldc)
+{
+    GemmImpl(M, N, K, A, lda, B, ldb, C, ldc);
+}
+
+void GemmTransposedB(unsigned int M, unsigned int N, unsigned int K,
+                     const uint8_t* A, unsigned int lda,
+                     const uint8_t* B, unsigned int ldb,
+                     int32_t* C, unsigned int ldc)
+{
+    GemmTransposedBImpl(M, N, K, A, lda, B, ldb, C, ldc);
+}
+
+void SumRows(unsigned int M, unsigned int K, const uint8_t* A, unsigned int lda, int32_t* sums)
+{
+    for (unsigned int m = 0; m < M; ++m)
+    {
+        int32_t sum = 0;
+        for (unsigned int k = 0; k < K; ++k)
+        {
+            sum += A[m * lda + k];
+        }
+        sums[m] = sum;
+    }
+}
+
+void SumColumns(unsigned int K, unsigned int N, const uint8_t* B, unsigned int ldb, int32_t* sums)
+{
+    std::fill(sums, sums + N, 0);
+    for (unsigned int k = 0; k < K; ++k)
+    {
+        for (unsigned int n = 0; n < N; ++n)
+        {
+            sums[n] += B[k * ldb + n];
+        }
+    }
+}
+
+} //namespace armnn
@@ -0,0 +1,56 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace armnn
+{
+
+/// Computes C += A * B, where A is an M x K matrix, B is a K x N matrix and C is an M x N matrix, all of them
+/// stored row-major with the given distances (in elements) between the starts of consecutive rows.
+/// The blocks of C are shared between the threads of the current RefThreadPool, and each element of C is always
+/// accumulated in the same order, so the results do not depend on the number of threads.
+void Gemm(unsigned int M, unsigned int N, unsigned int K,
+          const float* A, unsigned int lda,
+          const float* B, unsigned int ldb,
+          float* C, unsigned int ldc);
+
+/// Computes C += A * transpose(B), where B is an N x K matrix stored row-major, such as the weights of a fully
+/// connected layer stored one output per row. Each element of C is then the dot product of a row of A with a row of
+/// B, which are both contiguous, so B is read in place rather than transposed first.
+/// The columns of C are shared between the threads of the current RefThreadPool, and the results do not depend on
+/// the number of threads.
+void GemmTransposedB(unsigned int M, unsigned int N, unsigned int K,
+                     const float* A, unsigned int lda,
+                     const float* B, unsigned int ldb,
+                     float* C, unsigned int ldc);
+
+/// Computes C += A * B on the raw values of uint8 matrices, accumulating the products in int32.
+/// For quantized matrices with zero points aOffset and bOffset, the products of the real values are recovered from
+/// the sums of the rows of A and of the columns of B, which can be computed once for constant matrices:
+///     sum((A[m][k] - aOffset) * (B[k][n] - bOffset)) =
+///         C[m][n] - bOffset * rowSumA[m] - aOffset * columnSumB[n] + K * aOffset * bOffset
+void Gemm(unsigned int M, unsigned int N, unsigned int K,
+          const uint8_t* A, unsigned int lda,
+          const uint8_t* B, unsigned int ldb,
+          int32_t* C, unsigned int ldc);
+
+/// Computes C += A * transpose(B) on the raw values of uint8 matrices, accumulating the products in int32, where B is
+/// an N x K matrix stored row-major. The zero points are removed as for Gemm(), with the sums of the rows of B in
+/// place of the sums of its columns.
+void GemmTransposedB(unsigned int M, unsigned int N, unsigned int K,
+                     const uint8_t* A, unsigned int lda,
+                     const uint8_t* B, unsigned int ldb,
+                     int32_t* C, unsigned int ldc);
+
+/// Computes the sum of each row of the M x K matrix A.
+void SumRows(unsigned int M, unsigned int K, const uint8_t* A, unsigned int lda, int32_t* sums);
+
+/// Computes the sum of each column of the K x N matrix B.
+void SumColumns(unsigned int K, unsigned int N, const uint8_t* B, unsigned int ldb, int32_t* sums);
+
+} //namespace armnn
@@ -0,0 +1,363 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#include "Im2ColConvolution.hpp"
+
+#include "Activation.hpp"
+#include "DataLayoutIndexed.hpp"
+#include "Gemm.hpp"
+#include "RefThreadPool.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Maximum number of elements of the im2col matrix of a tile. Bigger tiles would no longer fit in the caches and
+// make the memory used by large layers grow with their output size.
+constexpr unsigned int MaxColumnsSize = 256 * 1024;
+
+// Minimum number of output pixels of a tile, below which the matrix multiplications get too narrow to be efficient.
+constexpr unsigned int MinTileSize = 16;
+
+bool IsQuantized(const TensorInfo& inputInfo)
+{
+    return inputInfo.GetDataType() == DataType::QuantisedAsymm8;
+}
+
+// The factor which converts the int32 products of the quantized input and filter to the scale of the output.
+float GetOutputMultiplier(const TensorInfo& inputInfo, const TensorInfo& outputInfo, const TensorInfo& filterInfo)
+{
+    return IsQuantized(inputInfo) ?
+        inputInfo.GetQuantizationScale() * filterInfo.GetQuantizationScale() / outputInfo.GetQuantizationScale() :
+        0.0f;
+}
+
+} // anonymous namespace
+
+bool Im2ColConvolution::IsSupported(const TensorInfo& inputInfo,
+                                    const TensorInfo& outputInfo,
+                                    const TensorInfo& filterInfo,
+                                    const Convolution2dDescriptor& descriptor)
+{
+    if (inputInfo.GetNumDimensions() != 4 || outputInfo.GetNumDimensions() != 4 ||
+        filterInfo.GetNumDimensions() != 4 || descriptor.m_StrideX == 0 || descriptor.m_StrideY == 0)
+    {
+        return false;
+    }
+
+    // Filters with so many weights that a tile of MinTileSize pixels would not fit in the im2col matrix are left to
+    // the direct convolution.
+    const TensorShape& filterShape = filterInfo.GetShape();
+    const unsigned int patchSize = filterShape[1] * filterShape[2] * filterShape[3];
+    if (patchSize * MinTileSize > MaxColumnsSize)
+    {
+        return false;
+    }
+
+    // The requantization of the int32 products only handles multipliers smaller than one, as ConvImpl() does.
+    if (IsQuantized(inputInfo))
+    {
+        const float multiplier = outputInfo.GetQuantizationScale() != 0.0f ?
+            GetOutputMultiplier(inputInfo, outputInfo, filterInfo) : 0.0f;
+        return multiplier > 0.0f && multiplier < 1.0f;
+    }
+    return true;
+}
+
+Im2ColConvolution::Im2ColConvolution(const TensorInfo& inputInfo,
+                                     const TensorInfo& outputInfo,
+                                     const TensorInfo& filterInfo,
+                                     const Convolution2dDescriptor& descriptor)
+    : m_BatchSize(outputInfo.GetShape()[0])
+    , m_ChannelsOutput(filterInfo.GetShape()[0])
+    , m_Descriptor(descriptor)
+    , m_InputOffset(inputInfo.GetQuantizationOffset())
+    , m_FilterOffset(filterInfo.GetQuantizationOffset())
+    , m_OutputOffset(outputInfo.GetQuantizationOffset())
+    , m_OutputMultiplier(GetOutputMultiplier(inputInfo, outputInfo, filterInfo))
+{
+    BOOST_ASSERT(IsSupported(inputInfo, outputInfo, filterInfo, descriptor));
+
+    // The filter is laid out like the data.
+    const armnnUtils::DataLayoutIndexed dataLayout(descriptor.m_DataLayout);
+    m_ChannelsInput = filterInfo.GetShape()[dataLayout.GetChannelsIndex()];
+    m_HeightInput   = inputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    m_WidthInput    = inputInfo.GetShape()[dataLayout.GetWidthIndex()];
+    m_HeightOutput  = outputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    m_WidthOutput   = outputInfo.GetShape()[dataLayout.GetWidthIndex()];
+    m_HeightFilter  = filterInfo.GetShape()[dataLayout.GetHeightIndex()];
+    m_WidthFilter   = filterInfo.GetShape()[dataLayout.GetWidthIndex()];
+
+    // The input of an NHWC pointwise convolution holds the transpose of the matrix the filter is multiplied by.
+    m_IsPointwise = !IsNhwc() && m_HeightFilter == 1 && m_WidthFilter == 1 &&
+                    descriptor.m_StrideX == 1 && descriptor.m_StrideY == 1 &&
+                    descriptor.m_PadLeft == 0 && descriptor.m_PadRight == 0 &&
+                    descriptor.m_PadTop == 0 && descriptor.m_PadBottom == 0 &&
+                    m_HeightInput == m_HeightOutput && m_WidthInput == m_WidthOutput;
+
+    const unsigned int numPixels = m_HeightOutput * m_WidthOutput;
+    const unsigned int patchSize = m_ChannelsInput * m_HeightFilter * m_WidthFilter;
+    if (!IsQuantized(inputInfo))
+    {
+        m_TileSize = m_IsPointwise ? numPixels : std::min(numPixels, MaxColumnsSize / patchSize);
+        if (IsNhwc())
+        {
+            m_TileSize = std::min(m_TileSize, std::max(MinTileSize, MaxColumnsSize / m_ChannelsOutput));
+            m_Products.resize(m_ChannelsOutput * m_TileSize);
+        }
+        if (!m_IsPointwise)
+        {
+            m_Columns.resize(patchSize * m_TileSize);
+        }
+        return;
+    }
+
+    // The int32 products of a tile need to be requantized before being written to the output, so pointwise
+    // convolutions are tiled as well to bound the memory they use.
+    m_TileSize = m_IsPointwise ?
+        std::min(numPixels, std::max(MinTileSize, MaxColumnsSize / m_ChannelsOutput)) :
+        std::min(numPixels, MaxColumnsSize / patchSize);
+    if (!m_IsPointwise)
+    {
+        m_QuantizedColumns.resize(patchSize * m_TileSize);
+    }
+    m_ColumnSums.resize(m_TileSize);
+    m_Accumulators.resize(m_ChannelsOutput * m_TileSize);
+}
+
+template <typename T>
+void Im2ColConvolution::Im2Col(const T* inputData, T paddingValue, T* columns, unsigned int tileBegin,
+                               unsigned int tileSize) const
+{
+    const unsigned int patchSize = m_ChannelsInput * m_HeightFilter * m_WidthFilter;
+    const int padTop  = static_cast<int>(m_Descriptor.m_PadTop);
+    const int padLeft = static_cast<int>(m_Descriptor.m_PadLeft);
+    const int heightInput = static_cast<int>(m_HeightInput);
+    const int widthInput  = static_cast<int>(m_WidthInput);
+
+    // Distances between the elements of consecutive channels, rows and columns of the input.
+    const unsigned int channelStride = IsNhwc() ? 1 : m_HeightInput * m_WidthInput;
+    const unsigned int rowStride     = IsNhwc() ? m_WidthInput * m_ChannelsInput : m_WidthInput;
+    const unsigned int columnStride  = IsNhwc() ? m_ChannelsInput : 1;
+
+    // Each row of the matrix holds the input element read by one filter weight for every pixel of the tile.
+    ParallelFor(0, patchSize, [&](unsigned int rowBegin, unsigned int rowEnd)
+    {
+        for (unsigned int row = rowBegin; row < rowEnd; ++row)
+        {
+            // The weights of each output channel are ordered like the filter: CHW for NCHW and HWC for NHWC.
+            const unsigned int cInput = IsNhwc() ? row % m_ChannelsInput : row / (m_HeightFilter * m_WidthFilter);
+            const unsigned int filterPosition = IsNhwc() ? row / m_ChannelsInput :
+                                                           row % (m_HeightFilter * m_WidthFilter);
+            const int yFilter = static_cast<int>(filterPosition / m_WidthFilter);
+            const int xFilter = static_cast<int>(filterPosition % m_WidthFilter);
+
+            const T* const channelData = inputData + cInput * channelStride;
+            T* column = columns + row * m_TileSize;
+
+            // Walks the pixels of the tile one output row segment at a time.
+            unsigned int pixel = tileBegin;
+            const unsigned int tileEnd = tileBegin + tileSize;
+            while (pixel < tileEnd)
+            {
+                const unsigned int yOutput = pixel / m_WidthOutput;
+                const unsigned int xBegin  = pixel % m_WidthOutput;
+                const unsigned int xEnd    = std::min(m_WidthOutput, xBegin + tileEnd - pixel);
+
+                const int yInput = static_cast<int>(yOutput * m_Descriptor.m_StrideY) + yFilter - padTop;
+                if (yInput < 0 || yInput >= heightInput)
+                {
+                    std::fill(column, column + (xEnd - xBegin), paddingValue);
+                }
+                else
+                {
+                    const T* const rowData = channelData + static_cast<unsigned int>(yInput) * rowStride;
+                    for (unsigned int xOutput = xBegin; xOutput < xEnd; ++xOutput)
+                    {
+                        const int xInput = static_cast<int>(xOutput * m_Descriptor.m_StrideX) + xFilter - padLeft;
+                        column[xOutput - xBegin] = (xInput < 0 || xInput >= widthInput) ?
+                            paddingValue : rowData[static_cast<unsigned int>(xInput) * columnStride];
+                    }
+                }
+
+                column += xEnd - xBegin;
+                pixel  += xEnd - xBegin;
+            }
+        }
+    });
+}
+
+void Im2ColConvolution::Execute(const float* inputData,
+                                const float* filterData,
+                                const float* biasData,
+                                float* outputData,
+                                const ActivationDescriptor* activation) const
+{
+    BOOST_ASSERT(!m_Descriptor.m_BiasEnabled || biasData != nullptr);
+
+    const unsigned int patchSize = m_ChannelsInput * m_HeightFilter * m_WidthFilter;
+    const unsigned int numPixels = m_HeightOutput * m_WidthOutput;
+
+    for (unsigned int batchIdx = 0; batchIdx < m_BatchSize; ++batchIdx)
+    {
+        const float* const batchInput = inputData + batchIdx * m_ChannelsInput * m_HeightInput * m_WidthInput;
+        float* const batchOutput = outputData + batchIdx * m_ChannelsOutput * numPixels;
+
+        for (unsigned int tileBegin = 0; tileBegin < numPixels; tileBegin += m_TileSize)
+        {
+            const unsigned int tileSize = std::min(m_TileSize, numPixels - tileBegin);
+
+            if (IsNhwc())
+            {
+                Im2Col(batchInput, 0.0f, m_Columns.data(), tileBegin, tileSize);
+
+                std::fill(m_Products.begin(), m_Products.begin() + m_ChannelsOutput * tileSize, 0.0f);
+                Gemm(m_ChannelsOutput, tileSize, patchSize,
+                     filterData, patchSize,
+                     m_Columns.data(), m_TileSize,
+                     m_Products.data(), tileSize);
+
+                // The channels of each output pixel are contiguous.
+                ParallelFor(0, tileSize, [&](unsigned int pixelBegin, unsigned int pixelEnd)
+                {
+                    for (unsigned int i = pixelBegin; i < pixelEnd; ++i)
+                    {
+                        float* const outputPixel = batchOutput + (tileBegin + i) * m_ChannelsOutput;
+                        for (unsigned int cOutput = 0; cOutput < m_ChannelsOutput; ++cOutput)
+                        {
+                            float value = m_Products[cOutput * tileSize + i] +
+                                (m_Descriptor.m_BiasEnabled ? biasData[cOutput] : 0.0f);
+                            if (activation != nullptr)
+                            {
+                                value = Activation(value, activation->m_Function, activation->m_A, activation->m_B);
+                            }
+                            outputPixel[cOutput] = value;
+                        }
+                    }
+                });
+                continue;
+            }
+
+            // The multiplication accumulates into the output, which therefore starts with the bias.
+            for (unsigned int cOutput = 0; cOutput < m_ChannelsOutput; ++cOutput)
+            {
+                float* const outputRow = batchOutput + cOutput * numPixels + tileBegin;
+                std::fill(outputRow, outputRow + tileSize, m_Descriptor.m_BiasEnabled ? biasData[cOutput] : 0.0f);
+            }
+
+            const float* columns;
+            unsigned int columnsStride;
+            if (m_IsPointwise)
+            {
+                columns = batchInput + tileBegin;
+                columnsStride = numPixels;
+            }
+            else
+            {
+                Im2Col(batchInput, 0.0f, m_Columns.data(), tileBegin, tileSize);
+                columns = m_Columns.data();
+                columnsStride = m_TileSize;
+            }
+
+            Gemm(m_ChannelsOutput, tileSize, patchSize,
+                 filterData, patchSize,
+                 columns, columnsStride,
+                 batchOutput + tileBegin, numPixels);
+
+            if (activation != nullptr)
+            {
+                ParallelFor(0, m_ChannelsOutput, [&](unsigned int channelBegin, unsigned int channelEnd)
+                {
+                    for (unsigned int cOutput = channelBegin; cOutput < channelEnd; ++cOutput)
+                    {
+                        float* const outputRow = batchOutput + cOutput * numPixels + tileBegin;
+                        for (unsigned int i = 0; i < tileSize; ++i)
+                        {
+                            outputRow[i] = Activation(outputRow[i], activation->m_Function,
+                                                      activation->m_A, activation->m_B);
+                        }
+                    }
+                });
+            }
+        }
+    }
+}
+
+void Im2ColConvolution::Execute(const uint8_t* inputData,
+                                const uint8_t* filterData,
+                                const int32_t* filterSums,
+                                const int32_t* biasData,
+                                uint8_t* outputData) const
+{
+    BOOST_ASSERT(!m_Descriptor.m_BiasEnabled || biasData != nullptr);
+
+    const unsigned int patchSize = m_ChannelsInput * m_HeightFilter * m_WidthFilter;
+    const unsigned int numPixels = m_HeightOutput * m_WidthOutput;
+
+    // The padding holds the quantized value of zero.
+    const uint8_t paddingValue = static_cast<uint8_t>(m_InputOffset);
+    const int32_t offsetsProduct = static_cast<int32_t>(patchSize) * m_InputOffset * m_FilterOffset;
+
+    for (unsigned int batchIdx = 0; batchIdx < m_BatchSize; ++batchIdx)
+    {
+        const uint8_t* const batchInput = inputData + batchIdx * m_ChannelsInput * m_HeightInput * m_WidthInput;
+        uint8_t* const batchOutput = outputData + batchIdx * m_ChannelsOutput * numPixels;
+
+        for (unsigned int tileBegin = 0; tileBegin < numPixels; tileBegin += m_TileSize)
+        {
+            const unsigned int tileSize = std::min(m_TileSize, numPixels - tileBegin);
+
+            const uint8_t* columns;
+            unsigned int columnsStride;
+            if (m_IsPointwise)
+            {
+                columns = batchInput + tileBegin;
+                columnsStride = numPixels;
+            }
+            else
+            {
+                Im2Col(batchInput, paddingValue, m_QuantizedColumns.data(), tileBegin, tileSize);
+                columns = m_QuantizedColumns.data();
+                columnsStride = m_TileSize;
+            }
+
+            SumColumns(patchSize, tileSize, columns, columnsStride, m_ColumnSums.data());
+
+            std::fill(m_Accumulators.begin(), m_Accumulators.begin() + m_ChannelsOutput * tileSize, 0);
+            Gemm(m_ChannelsOutput, tileSize, patchSize,
+                 filterData, patchSize,
+                 columns, columnsStride,
+                 m_Accumulators.data(), tileSize);
+
+            // Removes the zero points from the products and requantizes them to the output, transposing them for NHWC.
+            ParallelFor(0, m_ChannelsOutput, [&](unsigned int channelBegin, unsigned int channelEnd)
+            {
+                for (unsigned int cOutput = channelBegin; cOutput < channelEnd; ++cOutput)
+                {
+                    const int32_t channelOffset = offsetsProduct - m_InputOffset * filterSums[cOutput] +
+                        (m_Descriptor.m_BiasEnabled ? biasData[cOutput] : 0);
+                    const int32_t* const accumulatorRow = m_Accumulators.data() + cOutput * tileSize;
+                    uint8_t* const outputRow = IsNhwc() ? batchOutput + tileBegin * m_ChannelsOutput + cOutput :
+                                                          batchOutput + cOutput * numPixels + tileBegin;
+                    const unsigned int pixelStride = IsNhwc() ? m_ChannelsOutput : 1;
+                    for (unsigned int i = 0; i < tileSize; ++i)
+                    {
+                        const int32_t sum = accumulatorRow[i] + channelOffset - m_FilterOffset * m_ColumnSums[i];
+                        const int32_t value = (m_OutputMultiplier * sum) + m_OutputOffset;
+                        outputRow[i * pixelStride] = static_cast<uint8_t>(std::min(255, std::max(0, value)));
+                    }
+                }
+            });
+        }
+    }
+}
+
+} //namespace armnn
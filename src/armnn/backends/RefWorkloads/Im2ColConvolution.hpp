@@ -0,0 +1,95 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#pragma once
+
+#include "QuantizedMultiplier.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace armnn
+{
+
+/// Float32 and QuantisedAsymm8 convolution lowered to matrix multiplications: for each tile of output pixels, the
+/// input patches they read are copied into the columns of a matrix (im2col) which is multiplied by the filter
+/// matrix, seen as [outputChannels, inputChannels * filterHeight * filterWidth]. Float32 products are accumulated
+/// straight into the output tensor, uint8 ones into an int32 tile which is then requantized.
+/// 1x1 convolutions with unit strides and no padding multiply the input tensor directly.
+/// NHWC tensors, whose filters are [outputChannels, filterHeight, filterWidth, inputChannels], are multiplied the
+/// same way, with the products of each tile transposed into the output.
+class Im2ColConvolution
+{
+public:
+    /// Returns whether the given convolution can be run by this class. Otherwise ConvImpl() must be used.
+    static bool IsSupported(const TensorInfo& inputInfo,
+                            const TensorInfo& outputInfo,
+                            const TensorInfo& filterInfo,
+                            const Convolution2dDescriptor& descriptor);
+
+    /// Allocates the memory needed to run the given convolution, which must be supported. The data type of the input
+    /// selects which Execute() can be called.
+    Im2ColConvolution(const TensorInfo& inputInfo,
+                      const TensorInfo& outputInfo,
+                      const TensorInfo& filterInfo,
+                      const Convolution2dDescriptor& descriptor);
+
+    /// Runs the convolution. biasData may be nullptr if the bias is disabled. If activation is not nullptr, it is
+    /// applied to each tile of the output right after it is computed, while it is still in the caches.
+    /// Must not be called from several threads at the same time.
+    void Execute(const float* inputData, const float* filterData, const float* biasData, float* outputData,
+                 const ActivationDescriptor* activation = nullptr) const;
+
+    /// Runs the quantized convolution. filterSums holds the sum of the raw weights of each output channel, see
+    /// SumRows(). biasData may be nullptr if the bias is disabled.
+    /// Must not be called from several threads at the same time.
+    void Execute(const uint8_t* inputData, const uint8_t* filterData, const int32_t* filterSums,
+                 const int32_t* biasData, uint8_t* outputData) const;
+
+private:
+    template <typename T>
+    void Im2Col(const T* inputData, T paddingValue, T* columns, unsigned int tileBegin, unsigned int tileSize) const;
+
+    bool IsNhwc() const { return m_Descriptor.m_DataLayout == DataLayout::NHWC; }
+
+    unsigned int m_BatchSize;
+    unsigned int m_ChannelsInput;
+    unsigned int m_HeightInput;
+    unsigned int m_WidthInput;
+    unsigned int m_ChannelsOutput;
+    unsigned int m_HeightOutput;
+    unsigned int m_WidthOutput;
+    unsigned int m_HeightFilter;
+    unsigned int m_WidthFilter;
+    Convolution2dDescriptor m_Descriptor;
+
+    /// Number of output pixels computed by each matrix multiplication.
+    unsigned int m_TileSize;
+
+    /// Whether the input tensor can be multiplied directly, without im2col.
+    bool m_IsPointwise;
+
+    /// Holds the im2col matrix of a tile, with m_TileSize columns.
+    mutable std::vector<float> m_Columns;
+
+    /// Holds the products of a tile of an NHWC convolution before they are transposed into the output.
+    mutable std::vector<float> m_Products;
+
+    /// The quantization parameters of the tensors, used by the uint8 Execute() only.
+    int32_t m_InputOffset;
+    int32_t m_FilterOffset;
+    int32_t m_OutputOffset;
+    QuantizedMultiplierSmallerThanOne m_OutputMultiplier;
+
+    /// The uint8 im2col matrix of a tile, the sums of its columns and the int32 products of the tile.
+    mutable std::vector<uint8_t> m_QuantizedColumns;
+    mutable std::vector<int32_t> m_ColumnSums;
+    mutable std::vector<int32_t> m_Accumulators;
+};
+
+} //namespace armnn
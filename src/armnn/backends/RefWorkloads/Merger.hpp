@@ -6,76 +6,42 @@
 #pragma once
 
 #include "RefWorkloadUtils.hpp"
+#include "TensorViews.hpp"
 
 #include "backends/WorkloadData.hpp"
 
 #include <armnn/Tensor.hpp>
 
+#include <algorithm>
+
 namespace armnn
 {
 
 template <typename DataType>
 void Merger(const MergerQueueDescriptor& data)
 {
-    const TensorInfo& outputInfo0 = GetTensorInfo(data.m_Outputs[0]);
+    const TensorShape& outputShape = GetTensorInfo(data.m_Outputs[0]).GetShape();
+    DataType* outputData = GetOutputTensorData<DataType>(0, data);
 
-    for (unsigned int index = 0 ; index < outputInfo0.GetNumElements(); ++index)
+    // The views are copied last to first, so that the first one wins where they overlap.
+    for (unsigned int viewIdx = static_cast<unsigned int>(data.m_ViewOrigins.size()); viewIdx-- > 0;)
     {
-        unsigned int indices[MaxNumOfTensorDimensions] = { 0 };
-
-        unsigned int indexRemainder = index;
-        unsigned int dimensionStride = outputInfo0.GetNumElements();
+        const std::vector<unsigned int>& origin = data.m_ViewOrigins[viewIdx].m_Origin;
+        const DataType* inputData = GetInputTensorData<DataType>(viewIdx, data);
 
-        for (unsigned int i=0; i<outputInfo0.GetNumDimensions(); i++)
+        // Inputs which are sub-tensors of the output have already been written in place by the layers producing them.
+        if (inputData == outputData + GetViewOffset(outputShape, origin))
         {
-            dimensionStride /= outputInfo0.GetShape()[i];
-            indices[i] = indexRemainder / dimensionStride; // Use integer division to round down.
-            indexRemainder -= indices[i] * dimensionStride;
+            continue;
         }
 
-        for (unsigned int viewIdx = 0; viewIdx < data.m_ViewOrigins.size(); ++viewIdx)
-        {
-            MergerQueueDescriptor::ViewOrigin const& view = data.m_ViewOrigins[viewIdx];
-
-            //Split view extents are defined by the size of (the corresponding) input tensor.
-            const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[viewIdx]);
-            BOOST_ASSERT(inputInfo.GetNumDimensions() == outputInfo0.GetNumDimensions());
-
-            // Check all dimensions to see if this element is inside the given input view.
-            bool insideView = true;
-            for (unsigned int i=0; i<inputInfo.GetNumDimensions(); i++)
+        //Split view extents are defined by the size of (the corresponding) input tensor.
+        const TensorShape& inputShape = GetTensorInfo(data.m_Inputs[viewIdx]).GetShape();
+        ForEachViewRun(outputShape, origin, inputShape,
+            [&](unsigned int outputOffset, unsigned int inputOffset, unsigned int length)
             {
-                if (indices[i] < view.m_Origin[i])
-                {
-                    insideView = false;
-                }
-                if (indices[i] >= view.m_Origin[i] + inputInfo.GetShape()[i])
-                {
-                    insideView = false;
-                }
-            }
-
-            if (insideView)
-            {
-                unsigned int inIndex = 0;
-                unsigned int dimensionStride = 1;
-
-                for (unsigned int i = inputInfo.GetNumDimensions(); i-- > 0;)
-                {
-                    inIndex += dimensionStride * (indices[i] - view.m_Origin[i]);
-                    dimensionStride *= inputInfo.GetShape()[i];
-                }
-
-                //We are within the view, copy input data to the output corresponding to this view.
-                (GetOutputTensorData<DataType>(0, data))[index] =
-                    (GetInputTensorData<DataType>(viewIdx, data))[inIndex];
-
-                //What should we do if input views overlap on the output tensor?
-                //We could error, take the average, or shm else...
-                //For now just stop after finding first view (input) that matches.
-                break;
-            }
-        }
+                std::copy_n(inputData + inputOffset, length, outputData + outputOffset);
+            });
     }
 }
 
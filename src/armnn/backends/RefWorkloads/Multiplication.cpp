@@ -5,24 +5,13 @@
 
 #include "Multiplication.hpp"
 #include "Broadcast.hpp"
+#include "QuantizedMultiplier.hpp"
 
-#include <functional>
+#include <armnn/TypesUtils.hpp>
 
-namespace
-{
+#include <algorithm>
 
-void ElementwiseMultiplication(unsigned int numElements,
-                               const float* inData0,
-                               const float* inData1,
-                               float* outData)
-{
-    for (unsigned int i = 0; i < numElements; ++i)
-    {
-        outData[i] = inData0[i] * inData1[i];
-    }
-}
-
-} // namespace
+#include <functional>
 
 namespace armnn
 {
@@ -34,19 +23,51 @@ void Multiplication(const TensorShape& inShape0,
                     const float* inData1,
                     float* outData)
 {
-    if (inShape0 == inShape1)
-    {
-        ElementwiseMultiplication(inShape0.GetNumElements(), inData0, inData1, outData);
-    }
-    else
+    ElementwiseBinaryOperation(inShape0, inShape1, outShape, inData0, inData1, outData, std::multiplies<float>());
+}
+
+void Multiplication(const TensorInfo& inputInfo0,
+                    const TensorInfo& inputInfo1,
+                    const TensorInfo& outputInfo,
+                    const uint8_t* inData0,
+                    const uint8_t* inData1,
+                    uint8_t* outData)
+{
+    const float inputScale0  = inputInfo0.GetQuantizationScale();
+    const float inputScale1  = inputInfo1.GetQuantizationScale();
+    const float outputScale  = outputInfo.GetQuantizationScale();
+    const int32_t inputOffset0 = inputInfo0.GetQuantizationOffset();
+    const int32_t inputOffset1 = inputInfo1.GetQuantizationOffset();
+    const int32_t outputOffset = outputInfo.GetQuantizationOffset();
+
+    // The product of the inputs relative to their offsets is exact in 32 bits and only needs to be rescaled.
+    const float multiplier = inputScale0 * inputScale1 / outputScale;
+
+    if (multiplier >= 1.0f)
     {
-        BroadcastLoop(inShape0, inShape1, outShape).Unroll(
-            std::multiplies<float>(),
-            0,
-            inData0,
-            inData1,
-            outData);
+        // The output scale is too small for the integer rescaling.
+        ElementwiseBinaryOperation(inputInfo0.GetShape(), inputInfo1.GetShape(), outputInfo.GetShape(),
+                                   inData0, inData1, outData,
+                                   [&](uint8_t in0, uint8_t in1)
+                                   {
+                                       return Quantize<uint8_t>(Dequantize(in0, inputScale0, inputOffset0) *
+                                                                Dequantize(in1, inputScale1, inputOffset1),
+                                                                outputScale, outputOffset);
+                                   });
+        return;
     }
+
+    const QuantizedMultiplierSmallerThanOne outputRescale(multiplier);
+
+    ElementwiseBinaryOperation(inputInfo0.GetShape(), inputInfo1.GetShape(), outputInfo.GetShape(),
+                               inData0, inData1, outData,
+                               [&](uint8_t in0, uint8_t in1)
+                               {
+                                   const int32_t product = (static_cast<int32_t>(in0) - inputOffset0) *
+                                                           (static_cast<int32_t>(in1) - inputOffset1);
+                                   const int32_t result = (outputRescale * product) + outputOffset;
+                                   return static_cast<uint8_t>(std::min(std::max(result, 0), 255));
+                               });
 }
 
 } //namespace armnn
@@ -17,4 +17,12 @@ void Multiplication(const TensorShape& inShape0,
                     const float* inData1,
                     float* outData);
 
+/// Multiplies quantized tensors using integer arithmetic, without converting them to float.
+void Multiplication(const TensorInfo& inputInfo0,
+                    const TensorInfo& inputInfo1,
+                    const TensorInfo& outputInfo,
+                    const uint8_t* inData0,
+                    const uint8_t* inData1,
+                    uint8_t* outData);
+
 } //namespace armnn
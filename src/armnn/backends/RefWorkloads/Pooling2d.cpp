@@ -4,238 +4,407 @@
 //
 
 #include "Pooling2d.hpp"
+#include "DataLayoutIndexed.hpp"
+#include "RefThreadPool.hpp"
 
 #include <armnn/Exceptions.hpp>
 #include <armnn/Types.hpp>
+#include <armnn/TypesUtils.hpp>
 
 #include <boost/numeric/conversion/cast.hpp>
 
-#include <limits>
 #include <algorithm>
-#include <functional>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace armnn
+{
 
 namespace
 {
-    using PoolingAlgorithm = armnn::PoolingAlgorithm;
 
-    float DefaultInitializer(PoolingAlgorithm algorithm)
+std::vector<PoolingExtent> GetPoolingExtents(int outputSize,
+                                             int inputSize,
+                                             int poolSize,
+                                             int stride,
+                                             int padBefore,
+                                             int padAfter,
+                                             PaddingMethod paddingMethod)
+{
+    std::vector<PoolingExtent> extents(boost::numeric_cast<size_t>(outputSize));
+    for (int output = 0; output < outputSize; ++output)
     {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return std::numeric_limits<float>::lowest();
-            }
-            case PoolingAlgorithm::Average:
-            case PoolingAlgorithm::L2:
-            {
-                return 0.0f;
-            }
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
+        const int start = output * stride - padBefore;
+
+        // Clamp the pooling region inside the valid input area (which includes the padding).
+        // This is necessary because the final pooling in a row may overlap beyond the padding.
+        const int end = std::min(start + poolSize, inputSize + padAfter);
+
+        PoolingExtent& extent = extents[boost::numeric_cast<size_t>(output)];
+        extent.m_Start = std::min(std::max(start, 0), inputSize);
+        extent.m_End   = std::min(std::max(end, 0), inputSize);
+
+        // When we exclude the padding, it means we calculate with a smaller kernel size.
+        extent.m_Size = paddingMethod == PaddingMethod::Exclude ? extent.m_End - extent.m_Start : end - start;
+
+        // Special case: when the pooling kernel is over a padding region and the padding
+        //               size is larger or equal to the kernel and the kernel only covers
+        //               padding and no real values, then we initialize the result as zero
+        //               by convention. This is because we need to choose a value here and
+        //               all values we have are padding, which we ignore.
+        extent.m_OnPaddingOnly = end <= 0 || start > (inputSize - padAfter);
     }
+    return extents;
+}
 
-    using Accumulator = std::function<void(float & accu, float value)>;
+// The pooling algorithms the kernels are specialised for. Each one starts the result of a window, accumulates the
+// input values of the window into it, then finishes it into the output value.
 
-    Accumulator GetAccumulator(PoolingAlgorithm algorithm)
-    {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return [](float & accu, float value) {
-                    if (value > accu) {
-                        accu = value;
-                    }
-                };
-            }
+template <typename T>
+struct MaxPooling;
 
-            case PoolingAlgorithm::Average:
-            {
-                return [](float & accu, float value) {
-                    accu += value;
-                };
-            }
+template <typename T>
+struct AveragePooling;
 
-            case PoolingAlgorithm::L2:
-            {
-                return [](float & accu, float value) {
-                    accu += (value*value);
-                };
-            }
+template <typename T>
+struct L2Pooling;
 
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
-    }
+template <>
+struct MaxPooling<float>
+{
+    using Accumulator = float;
 
-    using Executor = std::function<void(float & accumulated, float kernelSize)>;
+    MaxPooling(const TensorInfo&, const TensorInfo&) {}
 
-    Executor GetExecutor(PoolingAlgorithm algorithm)
-    {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return [](float & accumulated, float kernelSize) {};
-            }
+    float Start(bool onPaddingOnly) const { return onPaddingOnly ? 0.0f : std::numeric_limits<float>::lowest(); }
+    void Accumulate(float& result, float value) const { result = std::max(result, value); }
+    float Finish(float result, int) const { return result; }
+};
 
-            case PoolingAlgorithm::Average:
-            {
-                return [](float & accumulated, float kernelSize) {
-                    accumulated /= kernelSize;
-                };
-            }
+template <>
+struct AveragePooling<float>
+{
+    using Accumulator = float;
 
-            case PoolingAlgorithm::L2:
-            {
-                return [](float & accumulated, float kernelSize) {
-                    accumulated = sqrtf(accumulated / kernelSize);
-                };
-            }
+    AveragePooling(const TensorInfo&, const TensorInfo&) {}
 
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
+    float Start(bool) const { return 0.0f; }
+    void Accumulate(float& result, float value) const { result += value; }
+    float Finish(float result, int poolSize) const { return result / boost::numeric_cast<float>(poolSize); }
+};
+
+template <>
+struct L2Pooling<float>
+{
+    using Accumulator = float;
+
+    L2Pooling(const TensorInfo&, const TensorInfo&) {}
+
+    float Start(bool) const { return 0.0f; }
+    void Accumulate(float& result, float value) const { result += value * value; }
+    float Finish(float result, int poolSize) const { return sqrtf(result / boost::numeric_cast<float>(poolSize)); }
+};
+
+/// Rounds numerator / denominator to the nearest integer, halfway cases away from zero like std::round.
+int RoundingDivide(int numerator, int denominator)
+{
+    const int halfDenominator = denominator / 2;
+    return numerator >= 0 ? (numerator + halfDenominator) / denominator
+                          : -((-numerator + halfDenominator) / denominator);
+}
+
+/// The quantization parameters of the uint8 poolings, which accumulate integers without converting them to float.
+struct QuantizedPooling
+{
+    using Accumulator = int;
+
+    QuantizedPooling(const TensorInfo& inputInfo, const TensorInfo& outputInfo)
+        : m_InputScale(inputInfo.GetQuantizationScale())
+        , m_InputOffset(inputInfo.GetQuantizationOffset())
+        , m_OutputScale(outputInfo.GetQuantizationScale())
+        , m_OutputOffset(outputInfo.GetQuantizationOffset())
+        , m_SameQuantization(m_InputScale == m_OutputScale && m_InputOffset == m_OutputOffset)
+    {
     }
 
-    bool OnPaddingOnly(int start, int end, int maxRange, int padding)
+    /// Requantizes a value expressed in steps of the input scale, relative to the input offset.
+    uint8_t Requantize(int value) const
     {
-        if (end <= 0 || start > (maxRange - padding))
+        if (m_SameQuantization)
         {
-            return true;
-        }
-        else
-        {
-            return false;
+            return static_cast<uint8_t>(std::min(std::max(value + m_OutputOffset, 0), 255));
         }
+        return Quantize<uint8_t>(m_InputScale * boost::numeric_cast<float>(value), m_OutputScale, m_OutputOffset);
     }
 
+    float m_InputScale;
+    int m_InputOffset;
+    float m_OutputScale;
+    int m_OutputOffset;
+    bool m_SameQuantization;
+};
+
+/// The quantization is monotonic, so the maximum is taken directly on the quantized values.
+template <>
+struct MaxPooling<uint8_t> : QuantizedPooling
+{
+    using QuantizedPooling::QuantizedPooling;
+
+    int Start(bool onPaddingOnly) const { return onPaddingOnly ? m_InputOffset : 0; }
+    void Accumulate(int& result, uint8_t value) const { result = std::max(result, static_cast<int>(value)); }
+    uint8_t Finish(int result, int) const { return Requantize(result - m_InputOffset); }
+};
 
-    bool ClampRange(int & start, int & end, int maxRange)
+/// The sum is exact in integers; only its division by the pool size is rounded.
+template <>
+struct AveragePooling<uint8_t> : QuantizedPooling
+{
+    using QuantizedPooling::QuantizedPooling;
+
+    int Start(bool) const { return 0; }
+    void Accumulate(int& sum, uint8_t value) const { sum += static_cast<int>(value) - m_InputOffset; }
+
+    uint8_t Finish(int sum, int poolSize) const
     {
-        if (start < 0 || end > maxRange)
-        {
-            start = std::min(std::max(start, 0), maxRange);
-            end   = std::min(std::max(end, 0), maxRange);
-            return true;
-        }
-        else
+        if (m_SameQuantization)
         {
-            return false;
+            return Requantize(RoundingDivide(sum, poolSize));
         }
+        const float average = m_InputScale * boost::numeric_cast<float>(sum) / boost::numeric_cast<float>(poolSize);
+        return Quantize<uint8_t>(average, m_OutputScale, m_OutputOffset);
     }
-}
+};
 
-namespace armnn
+template <>
+struct L2Pooling<uint8_t> : QuantizedPooling
 {
+    using QuantizedPooling::QuantizedPooling;
 
-void Pooling2d(const float* in,
-               float* out,
-               const TensorInfo& inputInfo,
-               const TensorInfo& outputInfo,
-               const Pooling2dDescriptor& params)
-{
-    const int batchSize    = boost::numeric_cast<int>(outputInfo.GetShape()[0]);
-    const int channels     = boost::numeric_cast<int>(outputInfo.GetShape()[1]);
-    const int heightOutput = boost::numeric_cast<int>(outputInfo.GetShape()[2]);
-    const int widthOutput  = boost::numeric_cast<int>(outputInfo.GetShape()[3]);
-    const int heightInput  = boost::numeric_cast<int>(inputInfo.GetShape()[2]);
-    const int widthInput   = boost::numeric_cast<int>(inputInfo.GetShape()[3]);
-    const int padLeft      = boost::numeric_cast<int>(params.m_PadLeft);
-    const int padRight     = boost::numeric_cast<int>(params.m_PadRight);
-    const int padTop       = boost::numeric_cast<int>(params.m_PadTop);
-    const int padBottom    = boost::numeric_cast<int>(params.m_PadBottom);
-    const int strideX      = boost::numeric_cast<int>(params.m_StrideX);
-    const int strideY      = boost::numeric_cast<int>(params.m_StrideY);
-    const int poolHeight   = boost::numeric_cast<int>(params.m_PoolHeight);
-    const int poolWidth    = boost::numeric_cast<int>(params.m_PoolWidth);
-
-    float defaultInitializer = DefaultInitializer(params.m_PoolType);
-
-    Accumulator accumulate = GetAccumulator(params.m_PoolType);
-    Executor execute       = GetExecutor(params.m_PoolType);
+    int Start(bool) const { return 0; }
 
-    // Check supported padding methods outside the loop to simplify
-    // the inner loop.
-    if (params.m_PaddingMethod != PaddingMethod::Exclude &&
-        params.m_PaddingMethod != PaddingMethod::IgnoreValue)
+    void Accumulate(int& sumOfSquares, uint8_t value) const
     {
-        throw armnn::InvalidArgumentException("Unsupported padding type");
+        const int difference = static_cast<int>(value) - m_InputOffset;
+        sumOfSquares += difference * difference;
     }
 
-    for (int n = 0; n < batchSize; n++)
+    uint8_t Finish(int sumOfSquares, int poolSize) const
     {
-        for (int c = 0; c < channels; c++)
+        const float result = m_InputScale * sqrtf(boost::numeric_cast<float>(sumOfSquares) /
+                                                  boost::numeric_cast<float>(poolSize));
+        return Quantize<uint8_t>(result, m_OutputScale, m_OutputOffset);
+    }
+};
+
+/// Pools every channel of every batch of an NCHW tensor independently, its rows being contiguous.
+template <typename T, typename Pooling>
+void PoolNchw(const T* in, T* out, const PoolingShape& shape, const Pooling& pooling)
+{
+    const unsigned int inputPlaneSize  = shape.m_HeightInput * shape.m_WidthInput;
+    const int widthInput = boost::numeric_cast<int>(shape.m_WidthInput);
+    const unsigned int outputPlaneSize =
+        boost::numeric_cast<unsigned int>(shape.m_Rows.size() * shape.m_Columns.size());
+
+    ParallelFor(0, shape.m_BatchSize * shape.m_Channels, [&](unsigned int planeBegin, unsigned int planeEnd)
+    {
+        for (unsigned int plane = planeBegin; plane < planeEnd; ++plane)
         {
-            for (int yOutput = 0; yOutput < heightOutput; yOutput++)
+            const T* const inPlane = in + plane * inputPlaneSize;
+            T* outElement = out + plane * outputPlaneSize;
+
+            for (const PoolingExtent& rows : shape.m_Rows)
             {
-                for (int xOutput = 0; xOutput < widthOutput; xOutput++)
+                for (const PoolingExtent& columns : shape.m_Columns)
                 {
-                    int hstart = (yOutput * strideY) - padTop;
-                    int wstart = (xOutput * strideX) - padLeft;
-                    int hend = hstart + poolHeight;
-                    int wend = wstart + poolWidth;
-
-                    // Clamp the pooling region inside the valid input area (which includes the padding).
-                    // This is necessary because the final pooling in a row may overlap beyond the padding.
-                    hend = std::min(hend, heightInput + padBottom);
-                    wend = std::min(wend, widthInput + padRight);
-
-                    float result = defaultInitializer;
-                    float poolAreaSize = boost::numeric_cast<float>((hend - hstart) * (wend - wstart));
-
-                    // Special case: when the pooling kernel is over a padding region and the padding
-                    //               size is larger or equal to the kernel and the kernel only covers
-                    //               padding and no real values, then we initialize the result as zero
-                    //               by convention. This is because we need to choose a value here and
-                    //               all values we have are padding, which we ignore.
-                    if (OnPaddingOnly(hstart, hend, heightInput, padBottom) ||
-                        OnPaddingOnly(wstart, wend, widthInput, padRight))
+                    typename Pooling::Accumulator result =
+                        pooling.Start(rows.m_OnPaddingOnly || columns.m_OnPaddingOnly);
+
+                    for (int yInput = rows.m_Start; yInput < rows.m_End; ++yInput)
                     {
-                        result = 0.0f;
+                        const T* const row = inPlane + yInput * widthInput;
+                        for (int xInput = columns.m_Start; xInput < columns.m_End; ++xInput)
+                        {
+                            pooling.Accumulate(result, row[xInput]);
+                        }
                     }
 
-                    bool clamped = ClampRange(wstart, wend, widthInput);
-                    clamped |= ClampRange(hstart, hend, heightInput);
+                    *outElement++ = pooling.Finish(result, rows.m_Size * columns.m_Size);
+                }
+            }
+        }
+    });
+}
+
+/// Pools the channels of an NHWC tensor in blocks, accumulating the contiguous channels of the block of each input
+/// element of a window at once. The results of a block are kept on the stack.
+template <typename T, typename Pooling>
+void PoolNhwc(const T* in, T* out, const PoolingShape& shape, const Pooling& pooling)
+{
+    constexpr unsigned int channelBlockSize = 64;
 
-                    if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
-                    {
-                        // When we exclude the padding, it means we calculate with a smaller
-                        // kernel size, so I changed the divisor here.
-                        poolAreaSize = boost::numeric_cast<float>((hend - hstart) * (wend - wstart));
-                    }
+    const unsigned int channels       = shape.m_Channels;
+    const unsigned int heightOutput   = boost::numeric_cast<unsigned int>(shape.m_Rows.size());
+    const unsigned int widthOutput    = boost::numeric_cast<unsigned int>(shape.m_Columns.size());
+    const unsigned int inputImageSize = shape.m_HeightInput * shape.m_WidthInput * channels;
+    const int inputRowSize = boost::numeric_cast<int>(shape.m_WidthInput * channels);
+    const int inputColumnSize = boost::numeric_cast<int>(channels);
+
+    ParallelFor(0, shape.m_BatchSize * heightOutput, [&](unsigned int outputRowBegin, unsigned int outputRowEnd)
+    {
+        std::array<typename Pooling::Accumulator, channelBlockSize> results;
 
-                    for (auto yInput = hstart; yInput < hend; yInput++)
+        for (unsigned int outputRow = outputRowBegin; outputRow < outputRowEnd; ++outputRow)
+        {
+            const T* const inImage = in + (outputRow / heightOutput) * inputImageSize;
+            const PoolingExtent& rows = shape.m_Rows[outputRow % heightOutput];
+            T* outElement = out + outputRow * widthOutput * channels;
+
+            for (const PoolingExtent& columns : shape.m_Columns)
+            {
+                const typename Pooling::Accumulator start =
+                    pooling.Start(rows.m_OnPaddingOnly || columns.m_OnPaddingOnly);
+                const int poolSize = rows.m_Size * columns.m_Size;
+
+                for (unsigned int blockBegin = 0; blockBegin < channels; blockBegin += channelBlockSize)
+                {
+                    const unsigned int blockSize = std::min(channelBlockSize, channels - blockBegin);
+                    std::fill(results.begin(), results.begin() + blockSize, start);
+
+                    for (int yInput = rows.m_Start; yInput < rows.m_End; ++yInput)
                     {
-                        for (auto xInput = wstart; xInput < wend; xInput++)
+                        for (int xInput = columns.m_Start; xInput < columns.m_End; ++xInput)
                         {
-                            float inval = in[n * widthInput * heightInput * channels +
-                                             c * widthInput * heightInput +
-                                             yInput * widthInput +
-                                             xInput];
-
-                            accumulate(result, inval);
+                            const T* const inElement =
+                                inImage + yInput * inputRowSize + xInput * inputColumnSize + blockBegin;
+                            for (unsigned int c = 0; c < blockSize; ++c)
+                            {
+                                pooling.Accumulate(results[c], inElement[c]);
+                            }
                         }
                     }
 
-                    execute(result, poolAreaSize);
-
-                    out[n * widthOutput * heightOutput * channels +
-                        c * widthOutput * heightOutput +
-                        yOutput * widthOutput +
-                        xOutput] = result;
+                    for (unsigned int c = 0; c < blockSize; ++c)
+                    {
+                        *outElement++ = pooling.Finish(results[c], poolSize);
+                    }
                 }
             }
         }
+    });
+}
+
+template <typename T, template <typename> class Pooling>
+void Pool(const T* in, T* out, const TensorInfo& inputInfo, const TensorInfo& outputInfo,
+          const PoolingShape& shape, DataLayout dataLayout)
+{
+    const Pooling<T> pooling(inputInfo, outputInfo);
+    if (dataLayout == DataLayout::NHWC)
+    {
+        PoolNhwc(in, out, shape, pooling);
+    }
+    else
+    {
+        PoolNchw(in, out, shape, pooling);
+    }
+}
+
+} // anonymous namespace
+
+Pooling2d::Pooling2d(const TensorInfo& inputInfo, const TensorInfo& outputInfo, const Pooling2dDescriptor& params)
+    : m_InputInfo(inputInfo)
+    , m_OutputInfo(outputInfo)
+    , m_PoolType(params.m_PoolType)
+    , m_DataLayout(params.m_DataLayout)
+{
+    // Check supported padding methods outside the loop to simplify
+    // the inner loop.
+    if (params.m_PaddingMethod != PaddingMethod::Exclude &&
+        params.m_PaddingMethod != PaddingMethod::IgnoreValue)
+    {
+        throw armnn::InvalidArgumentException("Unsupported padding type");
+    }
+
+    const armnnUtils::DataLayoutIndexed dataLayout(params.m_DataLayout);
+
+    m_Shape.m_BatchSize   = outputInfo.GetShape()[0];
+    m_Shape.m_Channels    = outputInfo.GetShape()[dataLayout.GetChannelsIndex()];
+    m_Shape.m_HeightInput = inputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    m_Shape.m_WidthInput  = inputInfo.GetShape()[dataLayout.GetWidthIndex()];
+
+    const unsigned int heightOutput = outputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    const unsigned int widthOutput  = outputInfo.GetShape()[dataLayout.GetWidthIndex()];
+
+    const bool isGlobal = heightOutput == 1 && widthOutput == 1 &&
+                          params.m_PoolHeight == m_Shape.m_HeightInput && params.m_PoolWidth == m_Shape.m_WidthInput &&
+                          params.m_PadTop == 0 && params.m_PadBottom == 0 &&
+                          params.m_PadLeft == 0 && params.m_PadRight == 0;
+    if (isGlobal)
+    {
+        // Global pooling, which most classifiers end with, reduces each channel to a single value: the rows of the
+        // input are then pooled as one, which the kernels read in a single run.
+        m_Shape.m_WidthInput *= m_Shape.m_HeightInput;
+        m_Shape.m_HeightInput = 1;
+
+        const int size = boost::numeric_cast<int>(m_Shape.m_WidthInput);
+        m_Shape.m_Rows    = GetPoolingExtents(1, 1, 1, 1, 0, 0, params.m_PaddingMethod);
+        m_Shape.m_Columns = GetPoolingExtents(1, size, size, 1, 0, 0, params.m_PaddingMethod);
+    }
+    else
+    {
+        m_Shape.m_Rows = GetPoolingExtents(boost::numeric_cast<int>(heightOutput),
+                                           boost::numeric_cast<int>(m_Shape.m_HeightInput),
+                                           boost::numeric_cast<int>(params.m_PoolHeight),
+                                           boost::numeric_cast<int>(params.m_StrideY),
+                                           boost::numeric_cast<int>(params.m_PadTop),
+                                           boost::numeric_cast<int>(params.m_PadBottom),
+                                           params.m_PaddingMethod);
+        m_Shape.m_Columns = GetPoolingExtents(boost::numeric_cast<int>(widthOutput),
+                                              boost::numeric_cast<int>(m_Shape.m_WidthInput),
+                                              boost::numeric_cast<int>(params.m_PoolWidth),
+                                              boost::numeric_cast<int>(params.m_StrideX),
+                                              boost::numeric_cast<int>(params.m_PadLeft),
+                                              boost::numeric_cast<int>(params.m_PadRight),
+                                              params.m_PaddingMethod);
+    }
+}
+
+template <typename T>
+void Pooling2d::ExecuteImpl(const T* in, T* out) const
+{
+    switch (m_PoolType)
+    {
+        case PoolingAlgorithm::Max:
+        {
+            Pool<T, MaxPooling>(in, out, m_InputInfo, m_OutputInfo, m_Shape, m_DataLayout);
+            break;
+        }
+        case PoolingAlgorithm::Average:
+        {
+            Pool<T, AveragePooling>(in, out, m_InputInfo, m_OutputInfo, m_Shape, m_DataLayout);
+            break;
+        }
+        case PoolingAlgorithm::L2:
+        {
+            Pool<T, L2Pooling>(in, out, m_InputInfo, m_OutputInfo, m_Shape, m_DataLayout);
+            break;
+        }
+        default:
+        {
+            throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
+        }
     }
 }
 
+void Pooling2d::Execute(const float* in, float* out) const
+{
+    ExecuteImpl(in, out);
+}
+
+void Pooling2d::Execute(const uint8_t* in, uint8_t* out) const
+{
+    ExecuteImpl(in, out);
+}
+
 } //namespace armnn
@@ -8,14 +8,56 @@
 #include <armnn/Descriptors.hpp>
 #include <armnn/Tensor.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
-/// Computes the Pooling2d operation.
-void Pooling2d(const float* in,
-               float* out,
-               const TensorInfo& inputInfo,
-               const TensorInfo& outputInfo,
-               const Pooling2dDescriptor& params);
+/// The rows or the columns of the input a pooling window covers, for one row or column of the output.
+/// The windows are the products of their extents along the height and the width, so the padding is handled once per
+/// row and column of the output, rather than for every element.
+struct PoolingExtent
+{
+    /// The range of input coordinates the window covers, clamped to the input tensor.
+    int m_Start;
+    int m_End;
+    /// Size of the window along this axis for the division of average and L2 poolings.
+    int m_Size;
+    /// Whether the window only covers padding along this axis.
+    bool m_OnPaddingOnly;
+};
+
+/// The dimensions of a pooling, and the extents of its windows.
+struct PoolingShape
+{
+    unsigned int m_BatchSize;
+    unsigned int m_Channels;
+    unsigned int m_HeightInput;
+    unsigned int m_WidthInput;
+    std::vector<PoolingExtent> m_Rows;
+    std::vector<PoolingExtent> m_Columns;
+};
+
+/// Computes the Pooling2d operation. Quantized tensors are pooled without converting them to float.
+/// The extents of the windows are worked out once, when the pooling is created, so that Execute() allocates nothing.
+class Pooling2d
+{
+public:
+    /// Throws an InvalidArgumentException if the padding method is not supported.
+    Pooling2d(const TensorInfo& inputInfo, const TensorInfo& outputInfo, const Pooling2dDescriptor& params);
+
+    void Execute(const float* in, float* out) const;
+    void Execute(const uint8_t* in, uint8_t* out) const;
+
+private:
+    template <typename T>
+    void ExecuteImpl(const T* in, T* out) const;
+
+    TensorInfo m_InputInfo;
+    TensorInfo m_OutputInfo;
+    PoolingAlgorithm m_PoolType;
+    DataLayout m_DataLayout;
+    PoolingShape m_Shape;
+};
 
 } //namespace armnn
@@ -3,7 +3,7 @@
 // See LICENSE file in the project root for full license information.
 //
 
-#include "ConvImpl.hpp"
+#include "QuantizedMultiplier.hpp"
 
 #include <boost/assert.hpp>
 
@@ -10,29 +10,62 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
+#include <armnn/TypesUtils.hpp>
 
 namespace armnn
 {
 
-void RefActivationUint8Workload::Execute() const
+RefActivationUint8Workload::RefActivationUint8Workload(const ActivationQueueDescriptor& descriptor,
+                                                       const WorkloadInfo& info)
+    : Uint8Workload<ActivationQueueDescriptor>(descriptor, info)
 {
-    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefActivationUint8Workload_Execute");
+    // A quantized input can only take 256 values, so the activation is computed once for each of them.
+    const TensorInfo& inputInfo  = info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = info.m_OutputTensorInfos[0];
+
+    m_LookupTable.fill(0);
+    if (inputInfo.GetQuantizationScale() == 0.0f || outputInfo.GetQuantizationScale() == 0.0f)
+    {
+        // The quantization parameters are not known yet, e.g. when the workload is only created to check that the
+        // layer is supported.
+        return;
+    }
+
+    std::array<float, 256> values;
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        values[i] = Dequantize(static_cast<uint8_t>(i),
+                               inputInfo.GetQuantizationScale(),
+                               inputInfo.GetQuantizationOffset());
+    }
 
-    const TensorInfo& tensorInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    Activation(values.data(),
+               values.data(),
+               TensorInfo({ static_cast<unsigned int>(values.size()) }, DataType::Float32),
+               descriptor.m_Parameters.m_Function,
+               descriptor.m_Parameters.m_A,
+               descriptor.m_Parameters.m_B);
 
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), tensorInfo);
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        m_LookupTable[i] = Quantize<uint8_t>(values[i],
+                                             outputInfo.GetQuantizationScale(),
+                                             outputInfo.GetQuantizationOffset());
+    }
+}
 
-    std::vector<float> results(tensorInfo.GetNumElements());
+void RefActivationUint8Workload::Execute() const
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefActivationUint8Workload_Execute");
 
-    Activation(dequant.data(),
-               results.data(),
-               tensorInfo,
-               m_Data.m_Parameters.m_Function,
-               m_Data.m_Parameters.m_A,
-               m_Data.m_Parameters.m_B);
+    const unsigned int numElements = GetTensorInfo(m_Data.m_Inputs[0]).GetNumElements();
+    const uint8_t* const inputData = GetInputTensorDataU8(0, m_Data);
+    uint8_t* const outputData      = GetOutputTensorDataU8(0, m_Data);
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), GetTensorInfo(m_Data.m_Outputs[0]));
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        outputData[i] = m_LookupTable[inputData[i]];
+    }
 }
 
 } //namespace armnn
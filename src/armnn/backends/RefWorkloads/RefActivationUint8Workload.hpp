@@ -8,14 +8,21 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include <array>
+#include <cstdint>
+
 namespace armnn
 {
 
 class RefActivationUint8Workload : public Uint8Workload<ActivationQueueDescriptor>
 {
 public:
-    using Uint8Workload<ActivationQueueDescriptor>::Uint8Workload;
+    explicit RefActivationUint8Workload(const ActivationQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+
+private:
+    /// Output value for each of the 256 possible input values.
+    std::array<uint8_t, 256> m_LookupTable;
 };
 
 } //namespace armnn
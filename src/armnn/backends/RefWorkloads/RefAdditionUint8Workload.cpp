@@ -10,8 +10,6 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
@@ -23,19 +21,12 @@ void RefAdditionUint8Workload::Execute() const
     const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
-    auto dequant0 = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo0);
-    auto dequant1 = Dequantize(GetInputTensorDataU8(1, m_Data), inputInfo1);
-
-    std::vector<float> results(outputInfo.GetNumElements());
-
-    Addition(inputInfo0.GetShape(),
-             inputInfo1.GetShape(),
-             outputInfo.GetShape(),
-             dequant0.data(),
-             dequant1.data(),
-             results.data());
-
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    Addition(inputInfo0,
+             inputInfo1,
+             outputInfo,
+             GetInputTensorDataU8(0, m_Data),
+             GetInputTensorDataU8(1, m_Data),
+             GetOutputTensorDataU8(0, m_Data));
 }
 
 } //namespace armnn
@@ -15,10 +15,10 @@ namespace armnn
 RefBatchNormalizationFloat32Workload::RefBatchNormalizationFloat32Workload(
    const BatchNormalizationQueueDescriptor& descriptor, const WorkloadInfo& info)
       : Float32Workload<BatchNormalizationQueueDescriptor>(descriptor, info),
-        m_Mean(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Mean))),
-        m_Variance(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Variance))),
-        m_Beta(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Beta))),
-        m_Gamma(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Gamma))) {}
+        m_Mean(descriptor.m_Mean),
+        m_Variance(descriptor.m_Variance),
+        m_Beta(descriptor.m_Beta),
+        m_Gamma(descriptor.m_Gamma) {}
 
 void RefBatchNormalizationFloat32Workload::Execute() const
 {
@@ -17,20 +17,20 @@ namespace armnn
 RefBatchNormalizationUint8Workload::RefBatchNormalizationUint8Workload(
     const BatchNormalizationQueueDescriptor& descriptor, const WorkloadInfo& info)
        : Uint8Workload<BatchNormalizationQueueDescriptor>(descriptor, info),
-         m_Mean(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Mean))),
-         m_Variance(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Variance))),
-         m_Beta(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Beta))),
-         m_Gamma(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Gamma))) {}
+         m_Mean(descriptor.m_Mean),
+         m_Variance(descriptor.m_Variance),
+         m_Beta(descriptor.m_Beta),
+         m_Gamma(descriptor.m_Gamma) {}
 
 void RefBatchNormalizationUint8Workload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefBatchNormalizationUint8Workload_Execute");
 
     const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& varInfo = GetTensorInfo(m_Variance.get());
-    const TensorInfo& meanInfo = GetTensorInfo(m_Mean.get());
-    const TensorInfo& gammaInfo = GetTensorInfo(m_Gamma.get());
-    const TensorInfo& betaInfo = GetTensorInfo(m_Beta.get());
+    const TensorInfo& varInfo = GetTensorInfo(m_Variance);
+    const TensorInfo& meanInfo = GetTensorInfo(m_Mean);
+    const TensorInfo& gammaInfo = GetTensorInfo(m_Gamma);
+    const TensorInfo& betaInfo = GetTensorInfo(m_Beta);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
     auto input = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo0);
@@ -5,6 +5,7 @@
 
 #include "RefConvolution2dFloat32Workload.hpp"
 
+#include "Activation.hpp"
 #include "ConvImpl.hpp"
 #include "RefWorkloadUtils.hpp"
 
@@ -15,9 +16,24 @@ namespace armnn
 RefConvolution2dFloat32Workload::RefConvolution2dFloat32Workload(
     const Convolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Float32Workload<Convolution2dQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_Weight(descriptor.m_Weight),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? descriptor.m_Bias : nullptr)
+{
+    const TensorInfo& inputInfo  = info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = info.m_OutputTensorInfos[0];
+    const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
+    if (WinogradConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor.m_Parameters))
+    {
+        m_WinogradConvolution = std::make_unique<WinogradConvolution>(inputInfo, outputInfo, filterInfo,
+            m_Weight->GetConstTensor<float>(), descriptor.m_Parameters);
+    }
+    else if (Im2ColConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor.m_Parameters))
+    {
+        m_Im2ColConvolution = std::make_unique<Im2ColConvolution>(inputInfo, outputInfo, filterInfo,
+                                                                  descriptor.m_Parameters);
+    }
+}
 
 void RefConvolution2dFloat32Workload::Execute() const
 {
@@ -28,10 +44,29 @@ void RefConvolution2dFloat32Workload::Execute() const
     const float* weightData = m_Weight->template GetConstTensor<float>();
     const float* biasData   = m_Data.m_Parameters.m_BiasEnabled ?
         m_Bias->template GetConstTensor<float>() : nullptr;
-    const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
 
+    if (m_WinogradConvolution)
+    {
+        m_WinogradConvolution->Execute(inputData, biasData, outputData, m_Data.m_FusedActivation);
+        return;
+    }
+
+    if (m_Im2ColConvolution)
+    {
+        m_Im2ColConvolution->Execute(inputData, weightData, biasData, outputData, m_Data.m_FusedActivation);
+        return;
+    }
+
+    const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
     ConvImpl<armnn::Convolution2dQueueDescriptor, float, float, float>(
         m_Data, inputData, 0.0f, 0, weightData, 0.0f, 0, biasData, outputData, 0.0f, 0, filterInfo);
+
+    if (m_Data.m_FusedActivation != nullptr)
+    {
+        const ActivationDescriptor& activation = *m_Data.m_FusedActivation;
+        Activation(outputData, outputData, GetTensorInfo(m_Data.m_Outputs[0]),
+                   activation.m_Function, activation.m_A, activation.m_B);
+    }
 }
 
 } //namespace armnn
@@ -8,6 +8,11 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include "Im2ColConvolution.hpp"
+#include "WinogradConvolution.hpp"
+
+#include <memory>
+
 namespace armnn
 {
 
@@ -19,9 +24,14 @@ public:
     virtual void Execute() const override;
 
 private:
-    std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
-    std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    const ConstCpuTensorHandle* m_Weight;
+    const ConstCpuTensorHandle* m_Bias;
+
+    /// Runs 3x3 convolutions with unit strides with the Winograd algorithm, or nullptr for other convolutions.
+    std::unique_ptr<WinogradConvolution> m_WinogradConvolution;
 
+    /// Runs the convolution as matrix multiplications, or nullptr if the shapes require the direct ConvImpl().
+    std::unique_ptr<Im2ColConvolution> m_Im2ColConvolution;
 };
 
 } //namespace armnn
@@ -6,6 +6,7 @@
 #include "RefConvolution2dUint8Workload.hpp"
 
 #include "ConvImpl.hpp"
+#include "Gemm.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
@@ -15,9 +16,24 @@ namespace armnn
 RefConvolution2dUint8Workload::RefConvolution2dUint8Workload(
     const Convolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Uint8Workload<Convolution2dQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_Weight(descriptor.m_Weight),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? descriptor.m_Bias : nullptr)
+{
+    const TensorInfo& inputInfo  = info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = info.m_OutputTensorInfos[0];
+    const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
+    if (Im2ColConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor.m_Parameters))
+    {
+        m_Im2ColConvolution = std::make_unique<Im2ColConvolution>(inputInfo, outputInfo, filterInfo,
+                                                                  descriptor.m_Parameters);
+
+        const unsigned int channelsOutput = filterInfo.GetShape()[0];
+        const unsigned int patchSize = filterInfo.GetNumElements() / channelsOutput;
+        m_FilterSums.resize(channelsOutput);
+        SumRows(channelsOutput, patchSize, m_Weight->GetConstTensor<uint8_t>(), patchSize, m_FilterSums.data());
+    }
+}
 
 void RefConvolution2dUint8Workload::Execute() const
 {
@@ -26,7 +42,7 @@ void RefConvolution2dUint8Workload::Execute() const
     const uint8_t* inputData = GetInputTensorDataU8(0, m_Data);
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const uint8_t* weightsData = m_Weight->template GetConstTensor<uint8_t>();
-    const TensorInfo& weightsInfo = GetTensorInfo(m_Weight.get());
+    const TensorInfo& weightsInfo = GetTensorInfo(m_Weight);
     const int32_t* biasData = m_Data.m_Parameters.m_BiasEnabled ?
         m_Bias->template GetConstTensor<int32_t>() :
         nullptr;
@@ -34,6 +50,12 @@ void RefConvolution2dUint8Workload::Execute() const
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
     const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
 
+    if (m_Im2ColConvolution)
+    {
+        m_Im2ColConvolution->Execute(inputData, weightsData, m_FilterSums.data(), biasData, outputData);
+        return;
+    }
+
     ConvImpl<armnn::Convolution2dQueueDescriptor, uint8_t, int32_t, int32_t>(
         m_Data,
         inputData, inputInfo.GetQuantizationScale(),  inputInfo.GetQuantizationOffset(),
@@ -8,6 +8,11 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include "Im2ColConvolution.hpp"
+
+#include <memory>
+#include <vector>
+
 namespace armnn
 {
 
@@ -20,9 +25,13 @@ public:
     virtual void Execute() const override;
 
 private:
-    std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
-    std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    const ConstCpuTensorHandle* m_Weight;
+    const ConstCpuTensorHandle* m_Bias;
 
+    /// Runs the convolution as integer matrix multiplications, or nullptr if it requires the direct ConvImpl().
+    std::unique_ptr<Im2ColConvolution> m_Im2ColConvolution;
+    /// The sum of the weights of each output channel.
+    std::vector<int32_t> m_FilterSums;
 };
 
 } //namespace armnn
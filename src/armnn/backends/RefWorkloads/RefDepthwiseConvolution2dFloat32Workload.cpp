@@ -5,7 +5,6 @@
 
 #include "RefDepthwiseConvolution2dFloat32Workload.hpp"
 
-#include "ConvImpl.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
@@ -15,9 +14,17 @@ namespace armnn
 RefDepthwiseConvolution2dFloat32Workload::RefDepthwiseConvolution2dFloat32Workload(
     const DepthwiseConvolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Float32Workload<DepthwiseConvolution2dQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_Weight(descriptor.m_Weight),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? descriptor.m_Bias : nullptr),
+          m_Convolution(info.m_InputTensorInfos[0],
+                        m_Weight->GetTensorInfo(),
+                        m_Weight->GetConstTensor<float>(),
+                        descriptor.m_Parameters,
+                        descriptor.m_PointwiseWeight ? &descriptor.m_PointwiseWeight->GetTensorInfo() : nullptr,
+                        descriptor.m_PointwiseWeight ? descriptor.m_PointwiseWeight->GetConstTensor<float>() : nullptr)
+{
+}
 
 void RefDepthwiseConvolution2dFloat32Workload::Execute() const
 {
@@ -25,13 +32,13 @@ void RefDepthwiseConvolution2dFloat32Workload::Execute() const
 
     float*       outputData = GetOutputTensorDataFloat(0, m_Data);
     const float* inputData  = GetInputTensorDataFloat(0, m_Data);
-    const float* weightData = m_Weight->template GetConstTensor<float>();
     const float* biasData   = m_Data.m_Parameters.m_BiasEnabled ?
         m_Bias->template GetConstTensor<float>() : nullptr;
-    const TensorInfo& filterInfo = m_Weight->GetTensorInfo();
+    const float* pointwiseBiasData = m_Data.m_PointwiseBias ?
+        m_Data.m_PointwiseBias->template GetConstTensor<float>() : nullptr;
 
-    ConvImpl<armnn::DepthwiseConvolution2dQueueDescriptor, float, float, float>
-        (m_Data, inputData, 0.0f, 0, weightData, 0.0f, 0, biasData, outputData, 0.0f, 0, filterInfo, true);
+    m_Convolution.Execute(inputData, biasData, outputData, m_Data.m_FusedActivation,
+                          pointwiseBiasData, m_Data.m_PointwiseActivation);
 }
 
 } //namespace armnn
@@ -8,6 +8,8 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include "DepthwiseConvolution.hpp"
+
 namespace armnn
 {
 
@@ -20,8 +22,11 @@ public:
     virtual void Execute() const override;
 
 private:
-    std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
-    std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    const ConstCpuTensorHandle* m_Weight;
+    const ConstCpuTensorHandle* m_Bias;
+
+    /// Runs the convolution, and the pointwise convolution fused with it if any.
+    DepthwiseConvolution m_Convolution;
 };
 
 } //namespace armnn
@@ -16,9 +16,9 @@ namespace armnn
 RefDepthwiseConvolution2dUint8Workload::RefDepthwiseConvolution2dUint8Workload(
         const DepthwiseConvolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Uint8Workload<DepthwiseConvolution2dQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_Weight(descriptor.m_Weight),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? descriptor.m_Bias : nullptr) {}
 
 void RefDepthwiseConvolution2dUint8Workload::Execute() const
 {
@@ -27,7 +27,7 @@ void RefDepthwiseConvolution2dUint8Workload::Execute() const
     const uint8_t* inputData = GetInputTensorDataU8(0, m_Data);
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const uint8_t* weightsData = m_Weight->template GetConstTensor<uint8_t>();
-    const TensorInfo& weightsInfo = GetTensorInfo(m_Weight.get());
+    const TensorInfo& weightsInfo = GetTensorInfo(m_Weight);
     const int32_t* biasData = m_Data.m_Parameters.m_BiasEnabled ?
         m_Bias->template GetConstTensor<int32_t>() :
         nullptr;
@@ -15,9 +15,9 @@ namespace armnn
 RefFullyConnectedFloat32Workload::RefFullyConnectedFloat32Workload(
     const FullyConnectedQueueDescriptor& descriptor, const WorkloadInfo& info)
         : Float32Workload<FullyConnectedQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_Weight(descriptor.m_Weight),
           m_Bias(descriptor.m_Parameters.m_BiasEnabled
-                 ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+                 ? descriptor.m_Bias : nullptr) {}
 
 void RefFullyConnectedFloat32Workload::Execute() const
 {
@@ -37,7 +37,8 @@ void RefFullyConnectedFloat32Workload::Execute() const
                    outputInfo,
                    weightData,
                    biasData,
-                   m_Data.m_Parameters.m_TransposeWeightMatrix);
+                   m_Data.m_Parameters.m_TransposeWeightMatrix,
+                   m_Data.m_FusedActivation);
 }
 
 } //namespace armnn
@@ -6,61 +6,173 @@
 #include "RefFullyConnectedUint8Workload.hpp"
 
 #include "FullyConnected.hpp"
+#include "Gemm.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
 
-#include <vector>
+#include <algorithm>
+#include <cmath>
 
 namespace armnn
 {
+
+namespace
+{
+
+// The factor which converts the int32 products of the quantized input and weights to the scale of the output,
+// or 0 if they cannot be requantized with integer arithmetic.
+float GetOutputMultiplier(const TensorInfo& inputInfo, const TensorInfo& weightInfo, const TensorInfo& outputInfo)
+{
+    if (outputInfo.GetQuantizationScale() == 0.0f)
+    {
+        // The quantization parameters are not known yet, e.g. when the workload is only created to check that the
+        // layer is supported.
+        return 0.0f;
+    }
+
+    const float multiplier =
+        inputInfo.GetQuantizationScale() * weightInfo.GetQuantizationScale() / outputInfo.GetQuantizationScale();
+    return multiplier < 1.0f ? multiplier : 0.0f;
+}
+
+} // anonymous namespace
+
 RefFullyConnectedUint8Workload::RefFullyConnectedUint8Workload(
     const FullyConnectedQueueDescriptor& descriptor, const WorkloadInfo& info)
-     : Uint8Workload<FullyConnectedQueueDescriptor>(descriptor, info),
-        m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
-        m_Bias(descriptor.m_Parameters.m_BiasEnabled
-               ? std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias)) : nullptr) {}
+     : Uint8Workload<FullyConnectedQueueDescriptor>(descriptor, info)
+     , m_BatchSize(info.m_InputTensorInfos[0].GetShape()[0])
+     , m_InputSize(info.m_InputTensorInfos[0].GetNumElements() / m_BatchSize)
+     , m_OutputSize(info.m_OutputTensorInfos[0].GetShape()[1])
+     , m_InputOffset(info.m_InputTensorInfos[0].GetQuantizationOffset())
+     , m_WeightOffset(descriptor.m_Weight->GetTensorInfo().GetQuantizationOffset())
+     , m_OutputOffset(info.m_OutputTensorInfos[0].GetQuantizationOffset())
+     , m_OutputMultiplier(GetOutputMultiplier(info.m_InputTensorInfos[0], descriptor.m_Weight->GetTensorInfo(),
+                                              info.m_OutputTensorInfos[0]))
+     , m_IsIntegerGemm(GetOutputMultiplier(info.m_InputTensorInfos[0], descriptor.m_Weight->GetTensorInfo(),
+                                           info.m_OutputTensorInfos[0]) > 0.0f)
+     , m_Weight(descriptor.m_Weight)
+     , m_TransposeWeights(descriptor.m_Parameters.m_TransposeWeightMatrix)
+{
+    const TensorInfo& inputInfo  = info.m_InputTensorInfos[0];
+    const TensorInfo& weightInfo = descriptor.m_Weight->GetTensorInfo();
+    const uint8_t* const weightData = descriptor.m_Weight->GetConstTensor<uint8_t>();
+    const ConstCpuTensorHandle* const bias = descriptor.m_Parameters.m_BiasEnabled ? descriptor.m_Bias : nullptr;
+
+    if (!m_IsIntegerGemm)
+    {
+        m_DequantizedWeights = Dequantize(weightData, weightInfo);
+        if (bias != nullptr)
+        {
+            m_DequantizedBias = Dequantize(bias->GetConstTensor<int32_t>(), bias->GetTensorInfo());
+        }
+        m_DequantizedInput.resize(inputInfo.GetNumElements());
+        m_DequantizedOutput.resize(info.m_OutputTensorInfos[0].GetNumElements());
+        return;
+    }
+
+    // The weights are read in place: an OutputSize x InputSize weight matrix is multiplied as transpose(B), and its
+    // rows hold the weights of each output.
+    std::vector<int32_t> weightSums(m_OutputSize);
+    if (m_TransposeWeights)
+    {
+        SumRows(m_OutputSize, m_InputSize, weightData, m_InputSize, weightSums.data());
+    }
+    else
+    {
+        SumColumns(m_InputSize, m_OutputSize, weightData, m_OutputSize, weightSums.data());
+    }
+
+    // The bias is normally quantized with the scale of the products, in which case it is added as it is.
+    const float productScale = inputInfo.GetQuantizationScale() * weightInfo.GetQuantizationScale();
+    const int32_t offsetsProduct = static_cast<int32_t>(m_InputSize) * m_InputOffset * m_WeightOffset;
+    m_OutputTerms.resize(m_OutputSize);
+    for (unsigned int output = 0; output < m_OutputSize; ++output)
+    {
+        int32_t biasValue = 0;
+        if (bias != nullptr)
+        {
+            const float biasScale = bias->GetTensorInfo().GetQuantizationScale();
+            biasValue = bias->GetConstTensor<int32_t>()[output];
+            if (biasScale != productScale)
+            {
+                biasValue = static_cast<int32_t>(std::round(static_cast<double>(biasValue) * biasScale / productScale));
+            }
+        }
+        m_OutputTerms[output] = biasValue + offsetsProduct - m_InputOffset * weightSums[output];
+    }
+
+    m_InputSums.resize(m_BatchSize);
+    m_Accumulators.resize(m_BatchSize * m_OutputSize);
+}
 
 void RefFullyConnectedUint8Workload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedUint8Workload_Execute");
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-
-    const uint8_t* weightData = m_Weight->GetConstTensor<uint8_t>();
-
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), inputInfo);
+    if (!m_IsIntegerGemm)
+    {
+        ExecuteDequantized();
+        return;
+    }
 
-    auto weight = Dequantize(weightData, m_Weight->GetTensorInfo());
+    const uint8_t* const inputData = GetInputTensorDataU8(0, m_Data);
+    uint8_t* const outputData = GetOutputTensorDataU8(0, m_Data);
+    const uint8_t* const weightData = m_Weight->GetConstTensor<uint8_t>();
 
-    std::vector<float> results(outputInfo.GetNumElements());
+    SumRows(m_BatchSize, m_InputSize, inputData, m_InputSize, m_InputSums.data());
 
-    if (m_Data.m_Parameters.m_BiasEnabled)
+    std::fill(m_Accumulators.begin(), m_Accumulators.end(), 0);
+    if (m_TransposeWeights)
     {
-        const int32_t* biasData = m_Bias->GetConstTensor<int32_t>();
-        auto           bias     = Dequantize(biasData, m_Bias->GetTensorInfo());
-
-        FullyConnected(dequant.data(),
-                       results.data(),
-                       inputInfo,
-                       outputInfo,
-                       weight.data(),
-                       bias.data(),
-                       m_Data.m_Parameters.m_TransposeWeightMatrix);
+        GemmTransposedB(m_BatchSize, m_OutputSize, m_InputSize,
+                        inputData, m_InputSize,
+                        weightData, m_InputSize,
+                        m_Accumulators.data(), m_OutputSize);
     }
     else
     {
-        FullyConnected(dequant.data(),
-                       results.data(),
-                       inputInfo,
-                       outputInfo,
-                       weight.data(),
-                       nullptr,
-                       m_Data.m_Parameters.m_TransposeWeightMatrix);
+        Gemm(m_BatchSize, m_OutputSize, m_InputSize,
+             inputData, m_InputSize,
+             weightData, m_OutputSize,
+             m_Accumulators.data(), m_OutputSize);
     }
 
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), outputInfo);
+    // Removes the zero points from the products and requantizes them to the output.
+    for (unsigned int batch = 0; batch < m_BatchSize; ++batch)
+    {
+        const int32_t inputTerm = m_WeightOffset * m_InputSums[batch];
+        for (unsigned int output = 0; output < m_OutputSize; ++output)
+        {
+            const unsigned int index = batch * m_OutputSize + output;
+            const int32_t sum = m_Accumulators[index] + m_OutputTerms[output] - inputTerm;
+            const int32_t value = (m_OutputMultiplier * sum) + m_OutputOffset;
+            outputData[index] = static_cast<uint8_t>(std::min(255, std::max(0, value)));
+        }
+    }
+}
+
+void RefFullyConnectedUint8Workload::ExecuteDequantized() const
+{
+    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+
+    const uint8_t* const inputData = GetInputTensorDataU8(0, m_Data);
+    for (unsigned int i = 0; i < m_DequantizedInput.size(); ++i)
+    {
+        m_DequantizedInput[i] = armnn::Dequantize(inputData[i], inputInfo.GetQuantizationScale(),
+                                                  inputInfo.GetQuantizationOffset());
+    }
+
+    FullyConnected(m_DequantizedInput.data(),
+                   m_DequantizedOutput.data(),
+                   inputInfo,
+                   outputInfo,
+                   m_DequantizedWeights.data(),
+                   m_DequantizedBias.empty() ? nullptr : m_DequantizedBias.data(),
+                   m_Data.m_Parameters.m_TransposeWeightMatrix);
+
+    Quantize(GetOutputTensorDataU8(0, m_Data), m_DequantizedOutput.data(), outputInfo);
 }
 
 } //namespace armnn
@@ -8,6 +8,11 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include "QuantizedMultiplier.hpp"
+
+#include <cstdint>
+#include <vector>
+
 namespace armnn
 {
 
@@ -19,8 +24,38 @@ public:
     virtual void Execute() const override;
 
 private:
-    std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
-    std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    void ExecuteDequantized() const;
+
+    unsigned int m_BatchSize;
+    unsigned int m_InputSize;
+    unsigned int m_OutputSize;
+
+    int32_t m_InputOffset;
+    int32_t m_WeightOffset;
+    int32_t m_OutputOffset;
+    QuantizedMultiplierSmallerThanOne m_OutputMultiplier;
+
+    /// Whether the products can be requantized with m_OutputMultiplier. Otherwise the layer is computed on
+    /// dequantized values.
+    bool m_IsIntegerGemm;
+
+    const ConstCpuTensorHandle* m_Weight;
+    /// Whether the weight tensor is an OutputSize x InputSize matrix rather than an InputSize x OutputSize one.
+    bool m_TransposeWeights;
+
+    /// The terms of each output which do not depend on the input: the bias and the parts of the products of the
+    /// zero points which only depend on the weights.
+    std::vector<int32_t> m_OutputTerms;
+
+    /// The weights, in the layout of the weight tensor, and the bias of the dequantized computation.
+    std::vector<float> m_DequantizedWeights;
+    std::vector<float> m_DequantizedBias;
+
+    // Scratch buffers, allocated once here so that Execute() does not allocate.
+    mutable std::vector<int32_t> m_InputSums;
+    mutable std::vector<int32_t> m_Accumulators;
+    mutable std::vector<float> m_DequantizedInput;
+    mutable std::vector<float> m_DequantizedOutput;
 };
 
 } //namespace armnn
@@ -5,12 +5,250 @@
 
 #include "RefLstmFloat32Workload.hpp"
 
+#include "Activation.hpp"
+#include "Gemm.hpp"
+#include "RefWorkloadUtils.hpp"
+
+#include "Profiling.hpp"
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <cmath>
+
 namespace armnn
 {
 
+namespace
+{
+
+inline float Sigmoid(float value)
+{
+    return 1.f / (1.f + expf(-value));
+}
+
+// A threshold of 0 disables the clipping.
+inline float Clip(float value, float threshold)
+{
+    return threshold > 0.0f ? std::min(threshold, std::max(-threshold, value)) : value;
+}
+
+// Copies a numUnits x size weight matrix, transposed, into the columns of the gate weights matrix starting at
+// firstColumn and its rows starting at firstRow.
+void PackGateWeights(const ConstCpuTensorHandle* weights, unsigned int numUnits, unsigned int size,
+                     unsigned int firstRow, unsigned int firstColumn,
+                     std::vector<float>& gateWeights, unsigned int numColumns)
+{
+    const float* const weightData = weights->GetConstTensor<float>();
+    for (unsigned int unit = 0; unit < numUnits; ++unit)
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            gateWeights[(firstRow + i) * numColumns + firstColumn + unit] = weightData[unit * size + i];
+        }
+    }
+}
+
+} // anonymous namespace
+
+RefLstmFloat32Workload::RefLstmFloat32Workload(const LstmQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : Float32Workload<LstmQueueDescriptor>(descriptor, info)
+    , m_BatchSize(info.m_InputTensorInfos[0].GetShape()[0])
+    , m_InputSize(info.m_InputTensorInfos[0].GetShape()[1])
+    , m_NumUnits(descriptor.m_InputToForgetWeights->GetTensorInfo().GetShape()[0])
+    , m_OutputSize(descriptor.m_RecurrentToForgetWeights->GetTensorInfo().GetShape()[1])
+    , m_NumGates(descriptor.m_Parameters.m_CifgEnabled ? 3 : 4)
+    , m_CellActivationA(0.0f)
+    , m_CellActivationB(0.0f)
+{
+    const LstmDescriptor& params = m_Data.m_Parameters;
+
+    // The activation function codes are those of the Android NN API.
+    switch (params.m_ActivationFunc)
+    {
+        case 0:
+            m_CellActivation = ActivationFunction::Linear;
+            m_CellActivationA = 1.0f;
+            break;
+        case 1:
+            m_CellActivation = ActivationFunction::ReLu;
+            break;
+        case 3:
+            m_CellActivation = ActivationFunction::BoundedReLu;
+            m_CellActivationA = 6.0f;
+            break;
+        case 4:
+            m_CellActivation = ActivationFunction::TanH;
+            m_CellActivationA = 1.0f;
+            m_CellActivationB = 1.0f;
+            break;
+        case 6:
+            m_CellActivation = ActivationFunction::Sigmoid;
+            break;
+        default:
+            throw InvalidArgumentException(boost::str(
+                boost::format("RefLstmFloat32Workload: Unsupported activation function %1%")
+                % params.m_ActivationFunc));
+    }
+
+    // The gates are stored in the order input (unless CIFG computes it from the forget gate), forget, cell, output.
+    const unsigned int gateInputSize = m_InputSize + m_OutputSize;
+    const unsigned int gatesSize = m_NumGates * m_NumUnits;
+    m_GateWeights.resize(gateInputSize * gatesSize);
+    m_GateBias.resize(gatesSize);
+
+    auto packGate = [&](unsigned int gate, const ConstCpuTensorHandle* inputWeights,
+                        const ConstCpuTensorHandle* recurrentWeights, const ConstCpuTensorHandle* bias)
+    {
+        PackGateWeights(inputWeights, m_NumUnits, m_InputSize, 0, gate * m_NumUnits, m_GateWeights, gatesSize);
+        PackGateWeights(recurrentWeights, m_NumUnits, m_OutputSize, m_InputSize, gate * m_NumUnits,
+                        m_GateWeights, gatesSize);
+        const float* const biasData = bias->GetConstTensor<float>();
+        std::copy(biasData, biasData + m_NumUnits, m_GateBias.begin() + gate * m_NumUnits);
+    };
+
+    const unsigned int forgetGate = m_NumGates - 3;
+    if (!params.m_CifgEnabled)
+    {
+        packGate(0, m_Data.m_InputToInputWeights, m_Data.m_RecurrentToInputWeights, m_Data.m_InputGateBias);
+    }
+    packGate(forgetGate,     m_Data.m_InputToForgetWeights, m_Data.m_RecurrentToForgetWeights,
+             m_Data.m_ForgetGateBias);
+    packGate(forgetGate + 1, m_Data.m_InputToCellWeights,   m_Data.m_RecurrentToCellWeights,   m_Data.m_CellBias);
+    packGate(forgetGate + 2, m_Data.m_InputToOutputWeights, m_Data.m_RecurrentToOutputWeights,
+             m_Data.m_OutputGateBias);
+
+    if (params.m_ProjectionEnabled)
+    {
+        const float* const projectionData = m_Data.m_ProjectionWeights->GetConstTensor<float>();
+        m_ProjectionWeights.resize(m_NumUnits * m_OutputSize);
+        for (unsigned int output = 0; output < m_OutputSize; ++output)
+        {
+            for (unsigned int unit = 0; unit < m_NumUnits; ++unit)
+            {
+                m_ProjectionWeights[unit * m_OutputSize + output] = projectionData[output * m_NumUnits + unit];
+            }
+        }
+    }
+
+    m_GateInputs.resize(m_BatchSize * gateInputSize);
+    m_Gates.resize(m_BatchSize * gatesSize);
+    m_CellOutput.resize(m_BatchSize * m_NumUnits);
+}
+
 void RefLstmFloat32Workload::Execute() const
 {
-    throw armnn::Exception("No implementation of Lstm in the Ref backend!");
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefLstmFloat32Workload_Execute");
+
+    const LstmDescriptor& params = m_Data.m_Parameters;
+
+    const float* const inputData      = GetInputTensorDataFloat(0, m_Data);
+    const float* const outputStateIn  = GetInputTensorDataFloat(1, m_Data);
+    const float* const cellStateIn    = GetInputTensorDataFloat(2, m_Data);
+    // Output 0 is the scratch buffer of the Android NN API, which this implementation does not need.
+    float* const outputStateOut       = GetOutputTensorDataFloat(1, m_Data);
+    float* const cellStateOut         = GetOutputTensorDataFloat(2, m_Data);
+    float* const outputData           = GetOutputTensorDataFloat(3, m_Data);
+
+    const unsigned int gateInputSize = m_InputSize + m_OutputSize;
+    const unsigned int gatesSize = m_NumGates * m_NumUnits;
+
+    // Each row of the multiplication is the input of one batch followed by its previous output state, and each row
+    // of the result starts with the biases of the gates.
+    for (unsigned int b = 0; b < m_BatchSize; ++b)
+    {
+        float* const gateInputs = m_GateInputs.data() + b * gateInputSize;
+        std::copy(inputData + b * m_InputSize, inputData + (b + 1) * m_InputSize, gateInputs);
+        std::copy(outputStateIn + b * m_OutputSize, outputStateIn + (b + 1) * m_OutputSize, gateInputs + m_InputSize);
+        std::copy(m_GateBias.begin(), m_GateBias.end(), m_Gates.begin() + b * gatesSize);
+    }
+
+    Gemm(m_BatchSize, gatesSize, gateInputSize,
+         m_GateInputs.data(), gateInputSize,
+         m_GateWeights.data(), gatesSize,
+         m_Gates.data(), gatesSize);
+
+    const bool hasCellToInputWeights = params.m_PeepholeEnabled && !params.m_CifgEnabled &&
+                                       m_Data.m_CellToInputWeights != nullptr;
+    const float* const cellToInputWeights =
+        hasCellToInputWeights ? m_Data.m_CellToInputWeights->GetConstTensor<float>() : nullptr;
+    const float* const cellToForgetWeights =
+        params.m_PeepholeEnabled ? m_Data.m_CellToForgetWeights->GetConstTensor<float>() : nullptr;
+    const float* const cellToOutputWeights =
+        params.m_PeepholeEnabled ? m_Data.m_CellToOutputWeights->GetConstTensor<float>() : nullptr;
+
+    const TensorInfo unitsInfo({ m_NumUnits }, DataType::Float32);
+    for (unsigned int b = 0; b < m_BatchSize; ++b)
+    {
+        float* const inputGate  = m_Gates.data() + b * gatesSize;
+        float* const forgetGate = inputGate + (m_NumGates - 3) * m_NumUnits;
+        float* const cellGate   = forgetGate + m_NumUnits;
+        float* const outputGate = cellGate + m_NumUnits;
+
+        const float* const cellIn = cellStateIn + b * m_NumUnits;
+        float* const cellOut      = cellStateOut + b * m_NumUnits;
+        float* const cellOutput   = m_CellOutput.data() + b * m_NumUnits;
+
+        Activation(cellGate, cellGate, unitsInfo, m_CellActivation, m_CellActivationA, m_CellActivationB);
+
+        for (unsigned int u = 0; u < m_NumUnits; ++u)
+        {
+            const float previousCell = cellIn[u];
+
+            const float forget = Sigmoid(forgetGate[u] +
+                (cellToForgetWeights != nullptr ? cellToForgetWeights[u] * previousCell : 0.0f));
+            const float input = params.m_CifgEnabled ? 1.0f - forget : Sigmoid(inputGate[u] +
+                (cellToInputWeights != nullptr ? cellToInputWeights[u] * previousCell : 0.0f));
+
+            const float cell = Clip(forget * previousCell + input * cellGate[u], params.m_ClippingThresCell);
+            cellOut[u] = cell;
+
+            // The output gate peeks at the new cell state.
+            outputGate[u] = Sigmoid(outputGate[u] +
+                (cellToOutputWeights != nullptr ? cellToOutputWeights[u] * cell : 0.0f));
+        }
+
+        Activation(cellOut, cellOutput, unitsInfo, m_CellActivation, m_CellActivationA, m_CellActivationB);
+        for (unsigned int u = 0; u < m_NumUnits; ++u)
+        {
+            cellOutput[u] *= outputGate[u];
+        }
+    }
+
+    if (params.m_ProjectionEnabled)
+    {
+        const float* const projectionBias =
+            m_Data.m_ProjectionBias != nullptr ? m_Data.m_ProjectionBias->GetConstTensor<float>() : nullptr;
+        for (unsigned int b = 0; b < m_BatchSize; ++b)
+        {
+            float* const outputRow = outputData + b * m_OutputSize;
+            if (projectionBias != nullptr)
+            {
+                std::copy(projectionBias, projectionBias + m_OutputSize, outputRow);
+            }
+            else
+            {
+                std::fill(outputRow, outputRow + m_OutputSize, 0.0f);
+            }
+        }
+
+        Gemm(m_BatchSize, m_OutputSize, m_NumUnits,
+             m_CellOutput.data(), m_NumUnits,
+             m_ProjectionWeights.data(), m_OutputSize,
+             outputData, m_OutputSize);
+
+        if (params.m_ClippingThresProj > 0.0f)
+        {
+            std::transform(outputData, outputData + m_BatchSize * m_OutputSize, outputData,
+                           [&](float value) { return Clip(value, params.m_ClippingThresProj); });
+        }
+    }
+    else
+    {
+        std::copy(m_CellOutput.begin(), m_CellOutput.end(), outputData);
+    }
+
+    std::copy(outputData, outputData + m_BatchSize * m_OutputSize, outputStateOut);
 }
 
 } //namespace armnn
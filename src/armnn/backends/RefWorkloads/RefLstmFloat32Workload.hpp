@@ -8,14 +8,39 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include <vector>
+
 namespace armnn
 {
 
 class RefLstmFloat32Workload : public Float32Workload<LstmQueueDescriptor>
 {
 public:
-    using Float32Workload<LstmQueueDescriptor>::Float32Workload;
+    explicit RefLstmFloat32Workload(const LstmQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+
+private:
+    unsigned int m_BatchSize;
+    unsigned int m_InputSize;
+    unsigned int m_NumUnits;
+    unsigned int m_OutputSize;
+    unsigned int m_NumGates;
+
+    ActivationFunction m_CellActivation;
+    float m_CellActivationA;
+    float m_CellActivationB;
+
+    /// The input and recurrent weights of all the gates, stored as a single (InputSize + OutputSize) x
+    /// (NumGates * NumUnits) matrix so that one multiplication computes every gate of every batch.
+    std::vector<float> m_GateWeights;
+    std::vector<float> m_GateBias;
+    /// The projection weights, transposed to NumUnits x OutputSize.
+    std::vector<float> m_ProjectionWeights;
+
+    // Scratch buffers, allocated once here so that Execute() does not allocate.
+    mutable std::vector<float> m_GateInputs;
+    mutable std::vector<float> m_Gates;
+    mutable std::vector<float> m_CellOutput;
 };
 
 } //namespace armnn
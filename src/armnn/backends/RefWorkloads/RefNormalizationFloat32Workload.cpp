@@ -5,6 +5,8 @@
 
 #include "RefNormalizationFloat32Workload.hpp"
 
+#include "DataLayoutIndexed.hpp"
+#include "RefThreadPool.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
@@ -12,128 +14,301 @@
 #include <armnn/Tensor.hpp>
 
 #include <boost/log/trivial.hpp>
-#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
 
 namespace armnn
 {
 
+namespace
+{
+
+/// Number of adjacent elements of the planes of an NCHW tensor normalized across channels together.
+constexpr unsigned int NormalizationBlockSize = 256;
+
+/// Computes the scale applied to an element from the sum of the squares of the elements in its window.
+class LocalBrightnessScale
+{
+public:
+    LocalBrightnessScale(float alpha, float beta, float kappa)
+        : m_Alpha(alpha)
+        , m_Beta(beta)
+        , m_Kappa(kappa)
+    {}
+
+    float operator()(double sumOfSquares) const
+    {
+        const float base = m_Kappa + static_cast<float>(sumOfSquares) * m_Alpha;
+
+        // The beta of AlexNet, GoogLeNet and the Caffe Cifar10 model, which only needs square roots.
+        if (m_Beta == 0.75f)
+        {
+            return 1.0f / std::sqrt(base * std::sqrt(base));
+        }
+        return powf(base, -m_Beta);
+    }
+
+private:
+    float m_Alpha;
+    float m_Beta;
+    float m_Kappa;
+};
+
+inline double Square(float value)
+{
+    return static_cast<double>(value) * static_cast<double>(value);
+}
+
+// Normalizes count adjacent elements across their channels, channelStride apart, sliding the sums of the squares in
+// their windows from one channel to the next. The squares of floats are exact in double, so the sums don't drift.
+void NormalizeAcrossLines(const float*                inputData,
+                          float*                      outputData,
+                          unsigned int                depth,
+                          unsigned int                channelStride,
+                          unsigned int                count,
+                          unsigned int                radius,
+                          const LocalBrightnessScale& scale)
+{
+    std::array<double, NormalizationBlockSize> sums;
+    std::fill_n(sums.begin(), count, 0.0);
+
+    for (unsigned int k = 0; k < std::min(radius, depth); k++)
+    {
+        const float* inputChannel = inputData + k * channelStride;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            sums[i] += Square(inputChannel[i]);
+        }
+    }
+
+    for (unsigned int c = 0; c < depth; c++)
+    {
+        if (c + radius < depth)
+        {
+            const float* enteringChannel = inputData + (c + radius) * channelStride;
+            for (unsigned int i = 0; i < count; i++)
+            {
+                sums[i] += Square(enteringChannel[i]);
+            }
+        }
+        if (c > radius)
+        {
+            const float* leavingChannel = inputData + (c - radius - 1) * channelStride;
+            for (unsigned int i = 0; i < count; i++)
+            {
+                sums[i] -= Square(leavingChannel[i]);
+            }
+        }
+
+        const float* inputChannel = inputData + c * channelStride;
+        float* outputChannel = outputData + c * channelStride;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            outputChannel[i] = inputChannel[i] * scale(sums[i]);
+        }
+    }
+}
+
+// Normalizes a plane within itself, as a box filter of the squares separated into a pass sliding along the rows and
+// one sliding down the columns. rowSums and sums are scratch buffers of rows * cols and cols elements.
+void NormalizeWithinPlane(const float*                inputData,
+                          float*                      outputData,
+                          unsigned int                rows,
+                          unsigned int                cols,
+                          unsigned int                rowStride,
+                          unsigned int                colStride,
+                          unsigned int                radius,
+                          const LocalBrightnessScale& scale,
+                          double*                     rowSums,
+                          double*                     sums)
+{
+    for (unsigned int h = 0; h < rows; h++)
+    {
+        const float* inputRow = inputData + h * rowStride;
+        double* rowSum = rowSums + h * cols;
+
+        double sum = 0.0;
+        for (unsigned int x = 0; x < std::min(radius, cols); x++)
+        {
+            sum += Square(inputRow[x * colStride]);
+        }
+        for (unsigned int w = 0; w < cols; w++)
+        {
+            if (w + radius < cols)
+            {
+                sum += Square(inputRow[(w + radius) * colStride]);
+            }
+            if (w > radius)
+            {
+                sum -= Square(inputRow[(w - radius - 1) * colStride]);
+            }
+            rowSum[w] = sum;
+        }
+    }
+
+    std::fill_n(sums, cols, 0.0);
+    for (unsigned int y = 0; y < std::min(radius, rows); y++)
+    {
+        for (unsigned int w = 0; w < cols; w++)
+        {
+            sums[w] += rowSums[y * cols + w];
+        }
+    }
+
+    for (unsigned int h = 0; h < rows; h++)
+    {
+        if (h + radius < rows)
+        {
+            const double* enteringRow = rowSums + (h + radius) * cols;
+            for (unsigned int w = 0; w < cols; w++)
+            {
+                sums[w] += enteringRow[w];
+            }
+        }
+        if (h > radius)
+        {
+            const double* leavingRow = rowSums + (h - radius - 1) * cols;
+            for (unsigned int w = 0; w < cols; w++)
+            {
+                sums[w] -= leavingRow[w];
+            }
+        }
+
+        for (unsigned int w = 0; w < cols; w++)
+        {
+            const unsigned int index = h * rowStride + w * colStride;
+            outputData[index] = inputData[index] * scale(sums[w]);
+        }
+    }
+}
+
+} // anonymous namespace
+
 // Helper function to compute "Within" normalization using Krichevsky 2012: Local Brightness Normalization.
 static void NormalizeWithinUingLbr(const float*       inputData,
                                    float*             outputData,
                                    const TensorShape& tensorShape,
+                                   DataLayout         dataLayout,
                                    uint32_t           norm_size,
                                    float              alpha,
                                    float              beta,
-                                   float              kappa)
+                                   float              kappa,
+                                   unsigned int       numScratchBuffers,
+                                   double*            rowSums,
+                                   double*            sums)
 {
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
     const unsigned int batchSize = tensorShape[0];
-    const unsigned int depth = tensorShape[1];
-    const unsigned int rows = tensorShape[2];
-    const unsigned int cols = tensorShape[3];
+    const unsigned int depth = tensorShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int rows = tensorShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int cols = tensorShape[dataLayoutIndexed.GetWidthIndex()];
+
+    const unsigned int radius = norm_size / 2u; /* Strong Assumption on rounding Mode */
+    const LocalBrightnessScale scale(alpha, beta, kappa);
 
-    int radius = boost::numeric_cast<int>(norm_size / 2u); /* Strong Assumption on rounding Mode */
+    const bool isNhwc = dataLayout == DataLayout::NHWC;
+    const unsigned int rowStride = isNhwc ? cols * depth : cols;
+    const unsigned int colStride = isNhwc ? depth : 1;
 
-    for (unsigned int n = 0; n < batchSize; n++)
+    // Every channel of every batch is computed independently, so they are shared between the threads of the pool,
+    // in as many ranges as there are sets of scratch buffers.
+    const unsigned int numPlanes = batchSize * depth;
+    ParallelFor(0, numScratchBuffers, [&](unsigned int scratchBegin, unsigned int scratchEnd)
     {
-        for (unsigned int c = 0; c < depth; c++)
+        for (unsigned int scratch = scratchBegin; scratch < scratchEnd; scratch++)
         {
-            for (unsigned int h = 0; h < rows; h++)
+            double* const scratchRowSums = rowSums + scratch * rows * cols;
+            double* const scratchSums = sums + scratch * cols;
+
+            const unsigned int planeBegin = numPlanes * scratch / numScratchBuffers;
+            const unsigned int planeEnd = numPlanes * (scratch + 1) / numScratchBuffers;
+            for (unsigned int plane = planeBegin; plane < planeEnd; plane++)
             {
-                for (unsigned int w = 0; w < cols; w++)
-                {
-                    float accumulated_scale = 0.0;
-                    for (int y = -radius; y <= radius; y++)
-                    {
-                        for (int x = -radius; x <= radius; x++)
-                        {
-                            int i = boost::numeric_cast<int>(w) + x;
-                            int j = boost::numeric_cast<int>(h) + y;
-
-                            if ((i < 0) || (i >= boost::numeric_cast<int>(cols)))
-                            {
-                                continue;
-                            }
-
-                            if ((j < 0) || (j >= boost::numeric_cast<int>(rows)))
-                            {
-                                continue;
-                            }
-
-                            float inval = inputData[n * cols * rows * depth +
-                                                    c * cols * rows +
-                                                    boost::numeric_cast<unsigned int>(j) * cols +
-                                                    boost::numeric_cast<unsigned int>(i)];
-
-                            accumulated_scale += inval*inval;
-                        }
-                    }
-                    outputData[n * cols * rows * depth +
-                               c * cols * rows +
-                               h * cols +
-                               w] = inputData[n * cols * rows * depth +
-                                              c * cols * rows +
-                                              h * cols +
-                                              w] / (powf((kappa + (accumulated_scale * alpha)), beta));
-                }
+                const unsigned int n = plane / depth;
+                const unsigned int c = plane % depth;
+                const unsigned int offset = dataLayoutIndexed.GetIndex(tensorShape, n, c, 0, 0);
+
+                NormalizeWithinPlane(inputData + offset, outputData + offset, rows, cols, rowStride, colStride,
+                                     radius, scale, scratchRowSums, scratchSums);
             }
         }
-    }
+    });
 }
 
 // Helper function to compute "Across" normalization using Krichevsky 2012: Local Brightness Normalization.
 void NormalizeAcrossUingLbr(const float*       inputData,
                             float*             outputData,
                             const TensorShape& tensorShape,
+                            DataLayout         dataLayout,
                             uint32_t           norm_size,
                             float              alpha,
                             float              beta,
                             float              kappa)
 {
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
     const unsigned int batchSize = tensorShape[0];
-    const unsigned int depth     = tensorShape[1];
-    const unsigned int rows      = tensorShape[2];
-    const unsigned int cols      = tensorShape[3];
+    const unsigned int depth     = tensorShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int rows      = tensorShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int cols      = tensorShape[dataLayoutIndexed.GetWidthIndex()];
 
-    int radius = boost::numeric_cast<int>(norm_size / 2u); /* Strong Assumption on rounding Mode */
+    const unsigned int radius = norm_size / 2u; /* Strong Assumption on rounding Mode */
+    const LocalBrightnessScale scale(alpha, beta, kappa);
 
-    for (unsigned int n = 0; n < batchSize; n++)
+    if (dataLayout == DataLayout::NHWC)
     {
-        for (unsigned int c = 0; c < depth; c++)
+        // The channels of every element are contiguous, so the elements are shared between the threads of the pool.
+        ParallelFor(0, batchSize * rows * cols, [&](unsigned int elementBegin, unsigned int elementEnd)
         {
-            for (unsigned int h = 0; h < rows; h++)
+            for (unsigned int element = elementBegin; element < elementEnd; element++)
             {
-                for (unsigned int w = 0; w < cols; w++)
-                {
-                    float accumulated_scale = 0.0;
-                    for (int z = -radius; z <= radius; z++)
-                    {
-                        int k = boost::numeric_cast<int>(c) + z;
-
-                        if ((k < 0) || (k >= boost::numeric_cast<int>(depth)))
-                        {
-                            continue;
-                        }
-
-                        float inval = inputData[n * cols * rows * depth +
-                                                boost::numeric_cast<unsigned int>(k) * cols * rows +
-                                                h * cols +
-                                                w];
-
-                        accumulated_scale += inval*inval;
-                    }
-                    float scale = kappa + (accumulated_scale * alpha);
-                    scale = powf(scale, -beta);
-                    outputData[n * cols * rows * depth +
-                               c * cols * rows +
-                               h * cols +
-                               w] = scale *
-                                   inputData[n * cols * rows * depth +
-                                             c * cols * rows +
-                                             h * cols +
-                                             w];
-                }
+                NormalizeAcrossLines(inputData + element * depth, outputData + element * depth, depth, 1, 1, radius,
+                                     scale);
             }
+        });
+        return;
+    }
+
+    // Blocks of adjacent elements of the planes of every batch are computed independently, so they are shared between
+    // the threads of the pool.
+    const unsigned int planeSize = rows * cols;
+    const unsigned int numBlocks = (planeSize + NormalizationBlockSize - 1) / NormalizationBlockSize;
+    ParallelFor(0, batchSize * numBlocks, [&](unsigned int blockBegin, unsigned int blockEnd)
+    {
+        for (unsigned int block = blockBegin; block < blockEnd; block++)
+        {
+            const unsigned int n = block / numBlocks;
+            const unsigned int first = (block % numBlocks) * NormalizationBlockSize;
+            const unsigned int offset = n * depth * planeSize + first;
+
+            NormalizeAcrossLines(inputData + offset, outputData + offset, depth, planeSize,
+                                 std::min(NormalizationBlockSize, planeSize - first), radius, scale);
         }
+    });
+}
+
+RefNormalizationFloat32Workload::RefNormalizationFloat32Workload(const NormalizationQueueDescriptor& descriptor,
+                                                                 const WorkloadInfo& info)
+    : Float32Workload<NormalizationQueueDescriptor>(descriptor, info)
+    , m_NumScratchBuffers(0)
+{
+    if (descriptor.m_Parameters.m_NormMethodType == NormalizationAlgorithmMethod::LocalBrightness &&
+        descriptor.m_Parameters.m_NormChannelType == NormalizationAlgorithmChannel::Within)
+    {
+        const armnnUtils::DataLayoutIndexed dataLayoutIndexed(descriptor.m_Parameters.m_DataLayout);
+        const TensorShape& shape = info.m_InputTensorInfos[0].GetShape();
+        const unsigned int numPlanes = shape[0] * shape[dataLayoutIndexed.GetChannelsIndex()];
+        const unsigned int rows = shape[dataLayoutIndexed.GetHeightIndex()];
+        const unsigned int cols = shape[dataLayoutIndexed.GetWidthIndex()];
+
+        const RefThreadPool* const threadPool = ScopedRefThreadPool::GetCurrent();
+        const unsigned int numThreads = threadPool != nullptr ? threadPool->GetNumThreads() : 1;
+        m_NumScratchBuffers = std::max(std::min(numThreads, numPlanes), 1u);
+
+        m_RowSums.resize(m_NumScratchBuffers * rows * cols);
+        m_ColumnSums.resize(m_NumScratchBuffers * cols);
     }
 }
 
@@ -154,16 +329,21 @@ void RefNormalizationFloat32Workload::Execute() const
             NormalizeWithinUingLbr(inputData,
                                    outputData,
                                    inputInfo.GetShape(),
+                                   m_Data.m_Parameters.m_DataLayout,
                                    m_Data.m_Parameters.m_NormSize,
                                    m_Data.m_Parameters.m_Alpha,
                                    m_Data.m_Parameters.m_Beta,
-                                   m_Data.m_Parameters.m_K);
+                                   m_Data.m_Parameters.m_K,
+                                   m_NumScratchBuffers,
+                                   m_RowSums.data(),
+                                   m_ColumnSums.data());
         }
         else if (NormalizationAlgorithmChannel::Across == m_Data.m_Parameters.m_NormChannelType)
         {
             NormalizeAcrossUingLbr(inputData,
                                    outputData,
                                    inputInfo.GetShape(),
+                                   m_Data.m_Parameters.m_DataLayout,
                                    m_Data.m_Parameters.m_NormSize,
                                    m_Data.m_Parameters.m_Alpha,
                                    m_Data.m_Parameters.m_Beta,
@@ -8,14 +8,26 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include <vector>
+
 namespace armnn
 {
 
 class RefNormalizationFloat32Workload : public Float32Workload<NormalizationQueueDescriptor>
 {
 public:
-    using Float32Workload<NormalizationQueueDescriptor>::Float32Workload;
+    explicit RefNormalizationFloat32Workload(const NormalizationQueueDescriptor& descriptor,
+                                             const WorkloadInfo& info);
     virtual void Execute() const override;
+
+private:
+    /// Number of sets of scratch buffers of the normalization within channels, one per thread of the pool the
+    /// workload is created on. Each set is used by a single thread at a time.
+    unsigned int m_NumScratchBuffers;
+
+    /// Sums of the squares along the rows of a plane, and down its columns, for each set.
+    mutable std::vector<double> m_RowSums;
+    mutable std::vector<double> m_ColumnSums;
 };
 
 } //namespace armnn
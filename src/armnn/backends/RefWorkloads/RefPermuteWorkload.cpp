@@ -4,6 +4,7 @@
 //
 
 #include "RefPermuteWorkload.hpp"
+#include "RefThreadPool.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include <Permute.hpp>
@@ -12,6 +13,21 @@
 namespace armnn
 {
 
+namespace
+{
+
+/// Smaller tensors are permuted by the calling thread alone, as the threads would cost more than they save.
+constexpr unsigned int MinParallelPermuteSize = 1 << 15;
+
+} // anonymous namespace
+
+template <armnn::DataType DataType>
+RefPermuteWorkload<DataType>::RefPermuteWorkload(const PermuteQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : TypedWorkload<PermuteQueueDescriptor, DataType>(descriptor, info)
+    , m_Plan(info.m_OutputTensorInfos[0].GetShape(), descriptor.m_Parameters.m_DimMappings)
+{
+}
+
 template <armnn::DataType DataType>
 void RefPermuteWorkload<DataType>::Execute() const
 {
@@ -19,11 +35,19 @@ void RefPermuteWorkload<DataType>::Execute() const
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, GetName() + "_Execute");
 
-    const ITensorHandle*     src      = m_Data.m_Inputs[0];
-    const ITensorHandle*     dst      = m_Data.m_Outputs[0];
-    const PermutationVector& mappings = m_Data.m_Parameters.m_DimMappings;
+    const T* const src = GetConstCpuData<T>(m_Data.m_Inputs[0]);
+    T* const       dst = GetCpuData<T>(m_Data.m_Outputs[0]);
+
+    if (m_Plan.GetNumElements() < MinParallelPermuteSize)
+    {
+        m_Plan.Execute(src, dst);
+        return;
+    }
 
-    armnnUtils::Permute(GetTensorInfo(dst).GetShape(), mappings, GetConstCpuData<T>(src), GetCpuData<T>(dst));
+    ParallelFor(0, m_Plan.GetNumParts(), [&](unsigned int partBegin, unsigned int partEnd)
+    {
+        m_Plan.Execute(src, dst, partBegin, partEnd);
+    });
 }
 
 template class RefPermuteWorkload<DataType::Float32>;
@@ -9,6 +9,8 @@
 
 #include <armnn/TypesUtils.hpp>
 
+#include <Permute.hpp>
+
 namespace armnn
 {
 
@@ -23,8 +25,12 @@ public:
     }
 
     using TypedWorkload<PermuteQueueDescriptor, DataType>::m_Data;
-    using TypedWorkload<PermuteQueueDescriptor, DataType>::TypedWorkload;
+
+    RefPermuteWorkload(const PermuteQueueDescriptor& descriptor, const WorkloadInfo& info);
     void Execute() const override;
+
+private:
+    armnnUtils::PermutePlan m_Plan;
 };
 
 using RefPermuteFloat32Workload = RefPermuteWorkload<DataType::Float32>;
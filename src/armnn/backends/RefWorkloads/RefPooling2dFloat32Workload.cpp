@@ -5,7 +5,6 @@
 
 #include "RefPooling2dFloat32Workload.hpp"
 
-#include "Pooling2d.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
@@ -13,21 +12,18 @@
 namespace armnn
 {
 
+RefPooling2dFloat32Workload::RefPooling2dFloat32Workload(const Pooling2dQueueDescriptor& descriptor,
+                                                         const WorkloadInfo& info)
+    : Float32Workload<Pooling2dQueueDescriptor>(descriptor, info)
+    , m_Pooling(info.m_InputTensorInfos[0], info.m_OutputTensorInfos[0], descriptor.m_Parameters)
+{
+}
+
 void RefPooling2dFloat32Workload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefPooling2dFloat32Workload_Execute");
 
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo0 = GetTensorInfo(m_Data.m_Outputs[0]);
-
-    float*       outputData = GetOutputTensorDataFloat(0, m_Data);
-    const float* inputData  = GetInputTensorDataFloat(0, m_Data);
-
-    Pooling2d(inputData,
-              outputData,
-              inputInfo0,
-              outputInfo0,
-              m_Data.m_Parameters);
+    m_Pooling.Execute(GetInputTensorDataFloat(0, m_Data), GetOutputTensorDataFloat(0, m_Data));
 }
 
 } //namespace armnn
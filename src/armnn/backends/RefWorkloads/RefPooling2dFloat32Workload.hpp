@@ -8,14 +8,19 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include "Pooling2d.hpp"
+
 namespace armnn
 {
 
 class RefPooling2dFloat32Workload : public Float32Workload<Pooling2dQueueDescriptor>
 {
 public:
-    using Float32Workload<Pooling2dQueueDescriptor>::Float32Workload;
+    explicit RefPooling2dFloat32Workload(const Pooling2dQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+
+private:
+    Pooling2d m_Pooling;
 };
 
 } //namespace armnn
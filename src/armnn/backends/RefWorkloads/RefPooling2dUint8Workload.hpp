@@ -8,14 +8,19 @@
 #include "backends/Workload.hpp"
 #include "backends/WorkloadData.hpp"
 
+#include "Pooling2d.hpp"
+
 namespace armnn
 {
 
 class RefPooling2dUint8Workload : public Uint8Workload<Pooling2dQueueDescriptor>
 {
 public:
-    using Uint8Workload<Pooling2dQueueDescriptor>::Uint8Workload;
+    explicit RefPooling2dUint8Workload(const Pooling2dQueueDescriptor& descriptor, const WorkloadInfo& info);
     virtual void Execute() const override;
+
+private:
+    Pooling2d m_Pooling;
 };
 
 } //namespace armnn
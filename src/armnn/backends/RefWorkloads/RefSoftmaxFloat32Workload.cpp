@@ -20,7 +20,8 @@ void RefSoftmaxFloat32Workload::Execute() const
     Softmax(GetInputTensorDataFloat(0, m_Data),
             GetOutputTensorDataFloat(0, m_Data),
             GetTensorInfo(m_Data.m_Inputs[0]),
-            m_Data.m_Parameters.m_Beta);
+            m_Data.m_Parameters.m_Beta,
+            m_Data.m_Parameters.m_Axis);
 }
 
 } //namespace armnn
@@ -10,8 +10,6 @@
 
 #include "Profiling.hpp"
 
-#include <vector>
-
 namespace armnn
 {
 
@@ -19,18 +17,12 @@ void RefSoftmaxUint8Workload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxUint8Workload_Execute");
 
-    const TensorInfo& tensorInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-
-    auto dequant = Dequantize(GetInputTensorDataU8(0, m_Data), tensorInfo);
-
-    std::vector<float> results(tensorInfo.GetNumElements());
-
-    Softmax(dequant.data(),
-            results.data(),
-            tensorInfo,
-            m_Data.m_Parameters.m_Beta);
-
-    Quantize(GetOutputTensorDataU8(0, m_Data), results.data(), GetTensorInfo(m_Data.m_Outputs[0]));
+    Softmax(GetInputTensorDataU8(0, m_Data),
+            GetOutputTensorDataU8(0, m_Data),
+            GetTensorInfo(m_Data.m_Inputs[0]),
+            GetTensorInfo(m_Data.m_Outputs[0]),
+            m_Data.m_Parameters.m_Beta,
+            m_Data.m_Parameters.m_Axis);
 }
 
 } //namespace armnn
@@ -0,0 +1,213 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefThreadPool.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+
+namespace armnn
+{
+
+namespace
+{
+
+thread_local RefThreadPool* t_CurrentThreadPool = nullptr;
+
+} // anonymous namespace
+
+struct RefThreadPool::Loop
+{
+    Loop(unsigned int begin, unsigned int end, unsigned int numChunks, BodyInvoker invoker, void* body)
+        : m_Begin(begin)
+        , m_End(end)
+        , m_NumChunks(numChunks)
+        , m_Invoker(invoker)
+        , m_Body(body)
+        , m_NextChunk(0)
+        , m_NumActiveWorkers(0)
+    {
+    }
+
+    const unsigned int m_Begin;
+    const unsigned int m_End;
+    const unsigned int m_NumChunks;
+    const BodyInvoker m_Invoker;
+    void* const m_Body;
+
+    std::atomic<unsigned int> m_NextChunk;
+
+    /// Number of pool threads which may still access this loop, guarded by m_Mutex.
+    unsigned int m_NumActiveWorkers;
+    std::mutex m_Mutex;
+    std::condition_variable m_WorkersDone;
+
+    /// First exception thrown by a chunk run on a pool thread, guarded by m_Mutex.
+    std::exception_ptr m_Exception;
+};
+
+RefThreadPool::RefThreadPool(unsigned int numThreads)
+    : m_Stopping(false)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // The thread calling ParallelFor() does its share of the work.
+    m_Workers.reserve(numThreads - 1);
+    for (unsigned int i = 1; i < numThreads; ++i)
+    {
+        m_Workers.emplace_back(&RefThreadPool::WorkerLoop, this);
+    }
+}
+
+RefThreadPool::~RefThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        BOOST_ASSERT_MSG(m_Loops.empty(), "RefThreadPool destroyed while running a parallel loop");
+        m_Stopping = true;
+    }
+    m_LoopAvailable.notify_all();
+
+    for (auto&& worker : m_Workers)
+    {
+        worker.join();
+    }
+}
+
+void RefThreadPool::Run(unsigned int begin, unsigned int end, BodyInvoker invoker, void* body)
+{
+    if (begin >= end)
+    {
+        return;
+    }
+
+    const unsigned int numChunks = std::min(end - begin, GetNumThreads());
+    if (numChunks == 1)
+    {
+        invoker(body, begin, end);
+        return;
+    }
+
+    Loop loop(begin, end, numChunks, invoker, body);
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Loops.push_back(&loop);
+    }
+    m_LoopAvailable.notify_all();
+
+    std::exception_ptr exception;
+    try
+    {
+        RunChunks(loop);
+    }
+    catch (...)
+    {
+        exception = std::current_exception();
+    }
+
+    // Once the loop is no longer visible to the pool, waits for the threads still processing its chunks.
+    RemoveLoop(loop);
+    {
+        std::unique_lock<std::mutex> lock(loop.m_Mutex);
+        loop.m_WorkersDone.wait(lock, [&loop]() { return loop.m_NumActiveWorkers == 0; });
+        if (!exception)
+        {
+            exception = loop.m_Exception;
+        }
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void RefThreadPool::RunChunks(Loop& loop)
+{
+    const unsigned int size = loop.m_End - loop.m_Begin;
+    for (unsigned int chunk = loop.m_NextChunk++; chunk < loop.m_NumChunks; chunk = loop.m_NextChunk++)
+    {
+        // Spreads the remainder of the division over the first chunks.
+        const unsigned int chunkBegin = loop.m_Begin + static_cast<unsigned int>(
+            static_cast<unsigned long long>(size) * chunk / loop.m_NumChunks);
+        const unsigned int chunkEnd = loop.m_Begin + static_cast<unsigned int>(
+            static_cast<unsigned long long>(size) * (chunk + 1) / loop.m_NumChunks);
+        loop.m_Invoker(loop.m_Body, chunkBegin, chunkEnd);
+    }
+}
+
+void RefThreadPool::RemoveLoop(Loop& loop)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = std::find(m_Loops.begin(), m_Loops.end(), &loop);
+    if (it != m_Loops.end())
+    {
+        m_Loops.erase(it);
+    }
+}
+
+void RefThreadPool::WorkerLoop()
+{
+    while (true)
+    {
+        Loop* loop = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_LoopAvailable.wait(lock, [this]() { return !m_Loops.empty() || m_Stopping; });
+            if (m_Loops.empty())
+            {
+                return;
+            }
+
+            // The loop cannot end before this thread has declared itself as working on it.
+            loop = m_Loops.front();
+            std::lock_guard<std::mutex> loopLock(loop->m_Mutex);
+            ++loop->m_NumActiveWorkers;
+        }
+
+        std::exception_ptr exception;
+        try
+        {
+            RunChunks(*loop);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+
+        // Every chunk has been handed out, so other threads need not look at this loop anymore.
+        RemoveLoop(*loop);
+
+        std::lock_guard<std::mutex> loopLock(loop->m_Mutex);
+        if (exception && !loop->m_Exception)
+        {
+            loop->m_Exception = exception;
+        }
+        --loop->m_NumActiveWorkers;
+        loop->m_WorkersDone.notify_all();
+    }
+}
+
+ScopedRefThreadPool::ScopedRefThreadPool(RefThreadPool* threadPool)
+    : m_PreviousThreadPool(t_CurrentThreadPool)
+{
+    t_CurrentThreadPool = threadPool;
+}
+
+ScopedRefThreadPool::~ScopedRefThreadPool()
+{
+    t_CurrentThreadPool = m_PreviousThreadPool;
+}
+
+RefThreadPool* ScopedRefThreadPool::GetCurrent()
+{
+    return t_CurrentThreadPool;
+}
+
+} // namespace armnn
@@ -0,0 +1,99 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace armnn
+{
+
+/// Pool of threads sharing the work of the reference kernels.
+/// Several threads may run parallel loops on the same pool at the same time.
+class RefThreadPool
+{
+public:
+    /// @param numThreads - Number of threads working on each parallel loop, including the calling thread.
+    ///                     If 0, one per hardware thread is used.
+    explicit RefThreadPool(unsigned int numThreads);
+    ~RefThreadPool();
+
+    RefThreadPool(const RefThreadPool&) = delete;
+    RefThreadPool& operator=(const RefThreadPool&) = delete;
+
+    unsigned int GetNumThreads() const { return static_cast<unsigned int>(m_Workers.size()) + 1; }
+
+    /// Calls body(chunkBegin, chunkEnd) on disjoint chunks covering [begin, end), from the calling thread and the
+    /// threads of the pool, and returns once all of them have been processed.
+    template <typename Body>
+    void ParallelFor(unsigned int begin, unsigned int end, Body&& body)
+    {
+        Run(begin, end, &InvokeBody<typename std::remove_reference<Body>::type>,
+            const_cast<void*>(static_cast<const void*>(&body)));
+    }
+
+private:
+    using BodyInvoker = void (*)(void* body, unsigned int begin, unsigned int end);
+
+    template <typename Body>
+    static void InvokeBody(void* body, unsigned int begin, unsigned int end)
+    {
+        (*static_cast<Body*>(body))(begin, end);
+    }
+
+    struct Loop;
+
+    void Run(unsigned int begin, unsigned int end, BodyInvoker invoker, void* body);
+    void RunChunks(Loop& loop);
+    void RemoveLoop(Loop& loop);
+    void WorkerLoop();
+
+    std::mutex m_Mutex;
+    std::condition_variable m_LoopAvailable;
+
+    /// Parallel loops which still have chunks to hand out.
+    std::vector<Loop*> m_Loops;
+
+    bool m_Stopping;
+    std::vector<std::thread> m_Workers;
+};
+
+/// Makes the reference kernels run on the current thread share their work with the given pool (which may be
+/// nullptr) during the lifetime of this object.
+class ScopedRefThreadPool
+{
+public:
+    explicit ScopedRefThreadPool(RefThreadPool* threadPool);
+    ~ScopedRefThreadPool();
+
+    /// Gets the pool used by the current thread, or nullptr if there is none.
+    static RefThreadPool* GetCurrent();
+
+private:
+    RefThreadPool* m_PreviousThreadPool;
+};
+
+/// Calls body(chunkBegin, chunkEnd) on disjoint chunks covering [begin, end), in parallel if the current thread
+/// has a thread pool. The chunks must not depend on each other, so that the results do not depend on the number
+/// of threads.
+template <typename Body>
+void ParallelFor(unsigned int begin, unsigned int end, Body&& body)
+{
+    RefThreadPool* const threadPool = ScopedRefThreadPool::GetCurrent();
+    if (threadPool != nullptr)
+    {
+        threadPool->ParallelFor(begin, end, body);
+    }
+    else if (begin < end)
+    {
+        body(begin, end);
+    }
+}
+
+} // namespace armnn
@@ -6,10 +6,12 @@
 #pragma once
 
 #include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
 
 namespace armnn
 {
 
-void ResizeBilinear(const float* in, const TensorInfo& inputInfo, float* out, const TensorInfo& outputInfo);
+void ResizeBilinear(const float* in, const TensorInfo& inputInfo, float* out, const TensorInfo& outputInfo,
+                    DataLayout dataLayout = DataLayout::NCHW);
 
 } //namespace armnn
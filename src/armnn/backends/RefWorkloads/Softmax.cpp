@@ -4,46 +4,342 @@
 //
 
 #include "Softmax.hpp"
+#include "RefThreadPool.hpp"
 
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <array>
 #include <cmath>
-#include <vector>
+#include <cstring>
+#include <limits>
 
 namespace armnn
 {
 
-/// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
-void Softmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta)
+namespace
+{
+
+/// The tensor seen as m_NumRows rows of m_AxisSize elements, m_Stride apart, to take the softmax of.
+/// Consecutive rows are contiguous unless the axis is the last dimension, in which case m_Stride is 1.
+struct SoftmaxLayout
 {
-    unsigned int numChannels = tensorInfo.GetShape()[1];
-    for (unsigned int n = 0; n < tensorInfo.GetShape()[0]; n++)
+    SoftmaxLayout(const TensorShape& shape, int axis)
+        : m_NumOuter(1)
+        , m_AxisSize(1)
+        , m_Stride(1)
     {
-        // Find maximum channel.
-        float max = in[n * numChannels];
-        for (unsigned int c = 1; c < numChannels; c++)
+        const unsigned int numDimensions = shape.GetNumDimensions();
+        const unsigned int axisIndex = axis < 0 ? numDimensions - static_cast<unsigned int>(-axis)
+                                                : static_cast<unsigned int>(axis);
+        BOOST_ASSERT(axisIndex < numDimensions);
+
+        for (unsigned int d = 0; d < axisIndex; ++d)
         {
-            float val = in[n * numChannels + c];
-            if (val > max)
-            {
-                max = val;
-            }
+            m_NumOuter *= shape[d];
+        }
+        m_AxisSize = shape[axisIndex];
+        for (unsigned int d = axisIndex + 1; d < numDimensions; ++d)
+        {
+            m_Stride *= shape[d];
+        }
+    }
+
+    unsigned int m_NumOuter;
+    unsigned int m_AxisSize;
+    unsigned int m_Stride;
+};
+
+/// Number of rows along a non-innermost axis processed together, so the loops over them run over contiguous elements.
+constexpr unsigned int SoftmaxColumnBlock = 64;
+
+/// exp(x) for x <= 0, reduced to 2^n * exp(r) with |r| <= ln(2)/2 and a polynomial for exp(r), in plain arithmetic
+/// which the loops calling it vectorise. Its relative error is a few ulp, and it is clamped to exp(-87) below that.
+inline float ExpNonPositive(float x)
+{
+    // Clamps x to -87 or above with an integer comparison, which unlike a float one is vectorised without fast-math:
+    // the representations of non-positive floats grow with their magnitude, and those of -inf and NaNs are larger.
+    uint32_t bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    bits = std::min(bits, 0xc2ae0000u);
+    std::memcpy(&x, &bits, sizeof(x));
+
+    // Truncating towards zero rounds to nearest, as x is not positive.
+    const int32_t n = static_cast<int32_t>(x * 1.44269504088896341f - 0.5f);
+    const float nf = static_cast<float>(n);
+    const float r = (x - nf * 0.693359375f) + nf * 2.12194440e-4f;
+
+    float p = 1.9875691500e-4f;
+    p = p * r + 1.3981999507e-3f;
+    p = p * r + 8.3334519073e-3f;
+    p = p * r + 4.1665795894e-2f;
+    p = p * r + 1.6666665459e-1f;
+    p = p * r + 5.0000001201e-1f;
+    const float expR = p * r * r + r + 1.0f;
+
+    const int32_t scaleBits = (n + 127) << 23;
+    float scale;
+    std::memcpy(&scale, &scaleBits, sizeof(scale));
+    return expR * scale;
+}
+
+void SoftmaxRow(const float* in, float* out, unsigned int size, float beta)
+{
+    // Running maxima of interleaved elements, which unlike a single one the compiler vectorises.
+    constexpr unsigned int numMaxima = 8;
+    std::array<float, numMaxima> maxima;
+    maxima.fill(-std::numeric_limits<float>::infinity());
+    const unsigned int vectorisedSize = size - size % numMaxima;
+    for (unsigned int i = 0; i < vectorisedSize; i += numMaxima)
+    {
+        for (unsigned int j = 0; j < numMaxima; ++j)
+        {
+            maxima[j] = std::max(maxima[j], in[i + j] * beta);
+        }
+    }
+    float max = *std::max_element(maxima.begin(), maxima.end());
+    for (unsigned int i = vectorisedSize; i < size; ++i)
+    {
+        max = std::max(max, in[i] * beta);
+    }
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        out[i] = ExpNonPositive(in[i] * beta - max);
+    }
+
+    float sum = 0.0f;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        sum += out[i];
+    }
+
+    const float scale = 1.0f / sum;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        out[i] *= scale;
+    }
+}
+
+/// The softmax of the numColumns rows starting at in and out, whose elements are stride apart.
+void SoftmaxColumns(const float* in, float* out, unsigned int axisSize, unsigned int stride, unsigned int numColumns,
+                    float beta)
+{
+    std::array<float, SoftmaxColumnBlock> max;
+    std::array<float, SoftmaxColumnBlock> sum;
+
+    for (unsigned int j = 0; j < numColumns; ++j)
+    {
+        max[j] = in[j] * beta;
+        sum[j] = 0.0f;
+    }
+    for (unsigned int k = 1; k < axisSize; ++k)
+    {
+        const float* inRow = in + k * stride;
+        for (unsigned int j = 0; j < numColumns; ++j)
+        {
+            max[j] = std::max(max[j], inRow[j] * beta);
+        }
+    }
+
+    for (unsigned int k = 0; k < axisSize; ++k)
+    {
+        const float* inRow = in + k * stride;
+        float* outRow = out + k * stride;
+        for (unsigned int j = 0; j < numColumns; ++j)
+        {
+            outRow[j] = ExpNonPositive(inRow[j] * beta - max[j]);
+            sum[j] += outRow[j];
+        }
+    }
+
+    for (unsigned int j = 0; j < numColumns; ++j)
+    {
+        sum[j] = 1.0f / sum[j];
+    }
+    for (unsigned int k = 0; k < axisSize; ++k)
+    {
+        float* outRow = out + k * stride;
+        for (unsigned int j = 0; j < numColumns; ++j)
+        {
+            outRow[j] *= sum[j];
+        }
+    }
+}
+
+/// Quantizes the probabilities of a row, given their exponentials and the reciprocal of their sum.
+class SoftmaxQuantizer
+{
+public:
+    SoftmaxQuantizer(const TensorInfo& outputInfo)
+        : m_Offset(outputInfo.GetQuantizationOffset())
+        , m_InverseScale(1.0f / outputInfo.GetQuantizationScale())
+    {}
+
+    uint8_t operator()(float exponential, float inverseSum) const
+    {
+        const int32_t quantized = static_cast<int32_t>(exponential * inverseSum * m_InverseScale + 0.5f) + m_Offset;
+        return static_cast<uint8_t>(std::min(std::max(quantized, 0), 255));
+    }
+
+private:
+    int32_t m_Offset;
+    float m_InverseScale;
+};
+
+/// The exponentials of the quantized inputs, relative to the largest input of their row, indexed by the difference
+/// of their keys to the largest key. The keys are the inputs themselves, or their complements to 255 when beta is
+/// negative, so that the largest key always has the largest exponential. The offset of the input cancels out.
+class SoftmaxExpTable
+{
+public:
+    SoftmaxExpTable(const TensorInfo& inputInfo, float beta)
+        : m_KeyMask(beta < 0.0f ? 0xff : 0)
+    {
+        const float step = -std::abs(beta) * inputInfo.GetQuantizationScale();
+        for (unsigned int d = 0; d < m_Exponentials.size(); ++d)
+        {
+            m_Exponentials[d] = ExpNonPositive(step * static_cast<float>(d));
         }
+    }
 
-        // Exponentiate all values and sum.
-        std::vector<float> exponentials(numChannels);
-        float              sum = 0.0f;
-        for (unsigned int c = 0; c < numChannels; c++)
+    uint8_t Key(uint8_t value) const { return static_cast<uint8_t>(value ^ m_KeyMask); }
+
+    float Exp(uint8_t maxKey, uint8_t key) const { return m_Exponentials[maxKey - key]; }
+
+private:
+    std::array<float, 256> m_Exponentials;
+    uint8_t m_KeyMask;
+};
+
+void SoftmaxRow(const uint8_t* in, uint8_t* out, unsigned int size, const SoftmaxExpTable& table,
+                const SoftmaxQuantizer& quantize)
+{
+    uint8_t maxKey = 0;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        maxKey = std::max(maxKey, table.Key(in[i]));
+    }
+
+    float sum = 0.0f;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        sum += table.Exp(maxKey, table.Key(in[i]));
+    }
+
+    const float inverseSum = 1.0f / sum;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        out[i] = quantize(table.Exp(maxKey, table.Key(in[i])), inverseSum);
+    }
+}
+
+void SoftmaxColumns(const uint8_t* in, uint8_t* out, unsigned int axisSize, unsigned int stride,
+                    unsigned int numColumns, const SoftmaxExpTable& table, const SoftmaxQuantizer& quantize)
+{
+    std::array<uint8_t, SoftmaxColumnBlock> maxKey;
+    std::array<float, SoftmaxColumnBlock> sum;
+
+    for (unsigned int j = 0; j < numColumns; ++j)
+    {
+        maxKey[j] = 0;
+        sum[j] = 0.0f;
+    }
+    for (unsigned int k = 0; k < axisSize; ++k)
+    {
+        const uint8_t* inRow = in + k * stride;
+        for (unsigned int j = 0; j < numColumns; ++j)
         {
-            float val       = in[n * numChannels + c];
-            exponentials[c] = expf((val - max) * beta);
-            sum += exponentials[c];
+            maxKey[j] = std::max(maxKey[j], table.Key(inRow[j]));
         }
+    }
 
-        // Divide exponentials by sum to give outputs.
-        for (unsigned int c = 0; c < numChannels; c++)
+    for (unsigned int k = 0; k < axisSize; ++k)
+    {
+        const uint8_t* inRow = in + k * stride;
+        for (unsigned int j = 0; j < numColumns; ++j)
         {
-            out[n * numChannels + c] = exponentials[c] / sum;
+            sum[j] += table.Exp(maxKey[j], table.Key(inRow[j]));
         }
     }
+
+    for (unsigned int j = 0; j < numColumns; ++j)
+    {
+        sum[j] = 1.0f / sum[j];
+    }
+    for (unsigned int k = 0; k < axisSize; ++k)
+    {
+        const uint8_t* inRow = in + k * stride;
+        uint8_t* outRow = out + k * stride;
+        for (unsigned int j = 0; j < numColumns; ++j)
+        {
+            outRow[j] = quantize(table.Exp(maxKey[j], table.Key(inRow[j])), sum[j]);
+        }
+    }
+}
+
+/// Calls rowFunc(in, out) for each row along the innermost axis, or columnsFunc(in, out, numColumns) for each block of
+/// up to SoftmaxColumnBlock rows along another axis, in parallel.
+template <typename T, typename RowFunc, typename ColumnsFunc>
+void ForEachSoftmaxBlock(const T* in, T* out, const SoftmaxLayout& layout, RowFunc rowFunc, ColumnsFunc columnsFunc)
+{
+    if (layout.m_Stride == 1)
+    {
+        ParallelFor(0, layout.m_NumOuter, [&](unsigned int rowBegin, unsigned int rowEnd)
+        {
+            for (unsigned int row = rowBegin; row < rowEnd; ++row)
+            {
+                rowFunc(in + row * layout.m_AxisSize, out + row * layout.m_AxisSize);
+            }
+        });
+        return;
+    }
+
+    const unsigned int numBlocks = (layout.m_Stride + SoftmaxColumnBlock - 1) / SoftmaxColumnBlock;
+    ParallelFor(0, layout.m_NumOuter * numBlocks, [&](unsigned int blockBegin, unsigned int blockEnd)
+    {
+        for (unsigned int block = blockBegin; block < blockEnd; ++block)
+        {
+            const unsigned int column = (block % numBlocks) * SoftmaxColumnBlock;
+            const unsigned int offset = (block / numBlocks) * layout.m_AxisSize * layout.m_Stride + column;
+            columnsFunc(in + offset, out + offset, std::min(SoftmaxColumnBlock, layout.m_Stride - column));
+        }
+    });
+}
+
+} // anonymous namespace
+
+void Softmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta, int axis)
+{
+    const SoftmaxLayout layout(tensorInfo.GetShape(), axis);
+
+    ForEachSoftmaxBlock(in, out, layout,
+        [&](const float* rowIn, float* rowOut)
+        {
+            SoftmaxRow(rowIn, rowOut, layout.m_AxisSize, beta);
+        },
+        [&](const float* blockIn, float* blockOut, unsigned int numColumns)
+        {
+            SoftmaxColumns(blockIn, blockOut, layout.m_AxisSize, layout.m_Stride, numColumns, beta);
+        });
+}
+
+void Softmax(const uint8_t* in, uint8_t* out, const TensorInfo& inputInfo, const TensorInfo& outputInfo,
+             float beta, int axis)
+{
+    const SoftmaxLayout layout(inputInfo.GetShape(), axis);
+    const SoftmaxExpTable table(inputInfo, beta);
+    const SoftmaxQuantizer quantize(outputInfo);
+
+    ForEachSoftmaxBlock(in, out, layout,
+        [&](const uint8_t* rowIn, uint8_t* rowOut)
+        {
+            SoftmaxRow(rowIn, rowOut, layout.m_AxisSize, table, quantize);
+        },
+        [&](const uint8_t* blockIn, uint8_t* blockOut, unsigned int numColumns)
+        {
+            SoftmaxColumns(blockIn, blockOut, layout.m_AxisSize, layout.m_Stride, numColumns, table, quantize);
+        });
 }
 
 } //namespace armnn
@@ -7,10 +7,19 @@
 
 #include <armnn/Tensor.hpp>
 
+#include <cstdint>
+
 namespace armnn
 {
 
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
-void Softmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta);
+/// The softmax is taken along axis, counting back from the last dimension if it is negative.
+/// in and out may be the same buffer.
+void Softmax(const float* in, float* out, const TensorInfo& tensorInfo, float beta, int axis = -1);
+
+/// Computes the softmax function on quantized inputs, looking up the exponentials of the differences of the quantized
+/// values to the maximum of their row rather than dequantizing them.
+void Softmax(const uint8_t* in, uint8_t* out, const TensorInfo& inputInfo, const TensorInfo& outputInfo,
+             float beta, int axis = -1);
 
 } //namespace armnn
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "RefWorkloadUtils.hpp"
+#include "TensorViews.hpp"
 
 #include "backends/WorkloadData.hpp"
 
@@ -13,71 +14,37 @@
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
+
 namespace armnn
 {
 
 template <typename DataType>
 void Splitter(const SplitterQueueDescriptor& data)
 {
-    const TensorInfo& inputInfo0 = GetTensorInfo(data.m_Inputs[0]);
+    const TensorShape& inputShape = GetTensorInfo(data.m_Inputs[0]).GetShape();
+    const DataType* inputData = GetInputTensorData<DataType>(0, data);
+    BOOST_ASSERT(inputData);
 
-    for (unsigned int index = 0; index < inputInfo0.GetNumElements(); ++index)
+    for (unsigned int viewIdx = 0; viewIdx < data.m_ViewOrigins.size(); ++viewIdx)
     {
-        unsigned int indices[MaxNumOfTensorDimensions] = { 0 };
-
-        unsigned int indexRemainder = index;
-        unsigned int dimensionStride = inputInfo0.GetNumElements();
+        const std::vector<unsigned int>& origin = data.m_ViewOrigins[viewIdx].m_Origin;
+        DataType* outputData = GetOutputTensorData<DataType>(viewIdx, data);
+        BOOST_ASSERT(outputData);
 
-        for (unsigned int i = 0; i<inputInfo0.GetNumDimensions(); i++)
+        // Outputs which are sub-tensors of the input already hold their elements.
+        if (outputData == inputData + GetViewOffset(inputShape, origin))
         {
-            dimensionStride /= inputInfo0.GetShape()[i];
-            indices[i] = indexRemainder / dimensionStride; // Use integer division to round down.
-            indexRemainder -= indices[i] * dimensionStride;
+            continue;
         }
 
-        for (unsigned int viewIdx = 0; viewIdx < data.m_ViewOrigins.size(); ++viewIdx)
-        {
-            SplitterQueueDescriptor::ViewOrigin const& view = data.m_ViewOrigins[viewIdx];
-
-            //Split view extents are defined by the size of (the corresponding) input tensor.
-            const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[viewIdx]);
-            BOOST_ASSERT(outputInfo.GetNumDimensions() == inputInfo0.GetNumDimensions());
-
-            // Check all dimensions to see if this element is inside the given input view.
-            bool insideView = true;
-            for (unsigned int i = 0; i<outputInfo.GetNumDimensions(); i++)
-            {
-                if (indices[i] < view.m_Origin[i])
-                {
-                    insideView = false;
-                }
-                if (indices[i] >= view.m_Origin[i] + outputInfo.GetShape()[i])
-                {
-                    insideView = false;
-                }
-            }
-
-            if (insideView)
+        //Split view extents are defined by the size of (the corresponding) output tensor.
+        const TensorShape& outputShape = GetTensorInfo(data.m_Outputs[viewIdx]).GetShape();
+        ForEachViewRun(inputShape, origin, outputShape,
+            [&](unsigned int inputOffset, unsigned int outputOffset, unsigned int length)
             {
-                unsigned int outIndex = 0;
-                unsigned int dimensionStride = 1;
-
-                for (unsigned int i = outputInfo.GetNumDimensions(); i-- > 0;)
-                {
-                    outIndex += dimensionStride * (indices[i] - view.m_Origin[i]);
-                    dimensionStride *= outputInfo.GetShape()[i];
-                }
-
-                //We are within the view, to copy input data to the output corresponding to this view.
-                DataType* outputData = GetOutputTensorData<DataType>(viewIdx, data);
-                BOOST_ASSERT(outputData);
-
-                const DataType* inputData = GetInputTensorData<DataType>(0, data);
-                BOOST_ASSERT(inputData);
-
-                outputData[outIndex] = inputData[index];
-            }
-        }
+                std::copy_n(inputData + inputOffset, length, outputData + outputOffset);
+            });
     }
 }
 
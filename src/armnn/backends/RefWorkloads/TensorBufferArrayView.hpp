@@ -3,6 +3,8 @@
 // See LICENSE file in the project root for full license information.
 //
 
+#include "DataLayoutIndexed.hpp"
+
 #include <armnn/Tensor.hpp>
 
 #include <boost/assert.hpp>
@@ -11,32 +13,35 @@ namespace armnn
 {
 
 // Utility class providing access to raw tensor memory based on indices along each dimension.
+// The indices are given in NCHW order whatever the data layout of the tensor.
 template <typename DataType>
 class TensorBufferArrayView
 {
 public:
-    TensorBufferArrayView(const TensorShape& shape, DataType* data)
+    TensorBufferArrayView(const TensorShape& shape, DataType* data, DataLayout dataLayout = DataLayout::NCHW)
         : m_Shape(shape)
         , m_Data(data)
+        , m_DataLayout(dataLayout)
     {
     }
 
     DataType& Get(unsigned int b, unsigned int c, unsigned int h, unsigned int w) const
     {
         BOOST_ASSERT( b < m_Shape[0] || (m_Shape[0] == 0 && b == 0) );
-        BOOST_ASSERT( c < m_Shape[1] || (m_Shape[1] == 0 && c == 0) );
-        BOOST_ASSERT( h < m_Shape[2] || (m_Shape[2] == 0 && h == 0) );
-        BOOST_ASSERT( w < m_Shape[3] || (m_Shape[3] == 0 && w == 0) );
-
-        return m_Data[b * m_Shape[1] * m_Shape[2] * m_Shape[3]
-                    + c * m_Shape[2] * m_Shape[3]
-                    + h * m_Shape[3]
-                    + w];
+        BOOST_ASSERT( c < m_Shape[m_DataLayout.GetChannelsIndex()] ||
+                      (m_Shape[m_DataLayout.GetChannelsIndex()] == 0 && c == 0) );
+        BOOST_ASSERT( h < m_Shape[m_DataLayout.GetHeightIndex()] ||
+                      (m_Shape[m_DataLayout.GetHeightIndex()] == 0 && h == 0) );
+        BOOST_ASSERT( w < m_Shape[m_DataLayout.GetWidthIndex()] ||
+                      (m_Shape[m_DataLayout.GetWidthIndex()] == 0 && w == 0) );
+
+        return m_Data[m_DataLayout.GetIndex(m_Shape, b, c, h, w)];
     }
 
 private:
     const TensorShape m_Shape;
     DataType* m_Data;
+    armnnUtils::DataLayoutIndexed m_DataLayout;
 };
 
 } //namespace armnn
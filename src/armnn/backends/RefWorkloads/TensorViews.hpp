@@ -0,0 +1,81 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <boost/assert.hpp>
+
+#include <array>
+#include <vector>
+
+namespace armnn
+{
+
+/// Gets the offset, in elements, of the first element of a view with the given origin in a tensor of tensorShape.
+inline unsigned int GetViewOffset(const TensorShape& tensorShape, const std::vector<unsigned int>& origin)
+{
+    BOOST_ASSERT(origin.size() == tensorShape.GetNumDimensions());
+
+    unsigned int offset = 0;
+    unsigned int stride = 1;
+    for (unsigned int i = tensorShape.GetNumDimensions(); i-- > 0;)
+    {
+        offset += origin[i] * stride;
+        stride *= tensorShape[i];
+    }
+    return offset;
+}
+
+/// Calls func(tensorOffset, viewOffset, length) for each run of elements of a view which is contiguous in both the
+/// view and the tensor of tensorShape it is a view of, with the offsets and the length counted in elements.
+/// The runs span the innermost dimension in which the view does not cover the tensor, so that a view along the
+/// outermost dimension is a single run.
+template <typename Func>
+void ForEachViewRun(const TensorShape& tensorShape, const std::vector<unsigned int>& origin,
+                    const TensorShape& viewShape, Func func)
+{
+    const unsigned int numDimensions = tensorShape.GetNumDimensions();
+    BOOST_ASSERT(viewShape.GetNumDimensions() == numDimensions);
+
+    unsigned int runDimension = numDimensions - 1;
+    unsigned int runLength = viewShape[runDimension];
+    while (runDimension > 0 && viewShape[runDimension] == tensorShape[runDimension])
+    {
+        --runDimension;
+        runLength *= viewShape[runDimension];
+    }
+
+    std::array<unsigned int, MaxNumOfTensorDimensions> tensorStrides;
+    unsigned int stride = 1;
+    for (unsigned int i = numDimensions; i-- > 0;)
+    {
+        tensorStrides[i] = stride;
+        stride *= tensorShape[i];
+    }
+
+    // Walks the dimensions outside the runs like an odometer.
+    std::array<unsigned int, MaxNumOfTensorDimensions> indices = {};
+    unsigned int tensorOffset = GetViewOffset(tensorShape, origin);
+    const unsigned int viewSize = viewShape.GetNumElements();
+    for (unsigned int viewOffset = 0; viewOffset < viewSize; viewOffset += runLength)
+    {
+        func(tensorOffset, viewOffset, runLength);
+
+        for (unsigned int i = runDimension; i-- > 0;)
+        {
+            tensorOffset += tensorStrides[i];
+            if (++indices[i] < viewShape[i])
+            {
+                break;
+            }
+            tensorOffset -= indices[i] * tensorStrides[i];
+            indices[i] = 0;
+        }
+    }
+}
+
+} //namespace armnn
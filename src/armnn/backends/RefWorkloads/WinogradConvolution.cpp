@@ -0,0 +1,425 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#include "WinogradConvolution.hpp"
+
+#include "Activation.hpp"
+#include "DataLayoutIndexed.hpp"
+#include "Gemm.hpp"
+#include "RefThreadPool.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Maximum number of elements of the transformed input tiles of a block, and of their products. Bigger blocks would
+// no longer fit in the caches and make the memory used by large layers grow with their output size.
+constexpr unsigned int MaxTransformedSize = 256 * 1024;
+
+// Minimum number of tiles of a block, below which the matrix multiplications get too narrow to be efficient.
+constexpr unsigned int MinBlockSize = 32;
+
+// Minimum number of input channels, below which the transforms of the input tiles cost more than the multiplications
+// they save, as in the first layers of networks which read images.
+constexpr unsigned int MinChannelsInput = 8;
+
+// The one dimensional transforms of F(m, 3), applied to the columns and then to the rows of the tiles: the input
+// tiles d are transformed into B^T d B, the filters g into G g G^T and the products M back into A^T M A.
+// Each reads alpha = m + 2 (3 for the filter) elements separated by inStride and writes alpha (m for the output)
+// elements separated by outStride.
+template <unsigned int OutputTileSize>
+struct WinogradTransforms;
+
+template <>
+struct WinogradTransforms<2>
+{
+    static void Input(const float* d, unsigned int inStride, float* v, unsigned int outStride)
+    {
+        const float d0 = d[0], d1 = d[inStride], d2 = d[2 * inStride], d3 = d[3 * inStride];
+        v[0]             = d0 - d2;
+        v[outStride]     = d1 + d2;
+        v[2 * outStride] = d2 - d1;
+        v[3 * outStride] = d1 - d3;
+    }
+
+    static void Filter(const float* g, unsigned int inStride, float* u, unsigned int outStride)
+    {
+        const float g0 = g[0], g1 = g[inStride], g2 = g[2 * inStride];
+        u[0]             = g0;
+        u[outStride]     = 0.5f * (g0 + g1 + g2);
+        u[2 * outStride] = 0.5f * (g0 - g1 + g2);
+        u[3 * outStride] = g2;
+    }
+
+    static void Output(const float* m, unsigned int inStride, float* y, unsigned int outStride)
+    {
+        const float m0 = m[0], m1 = m[inStride], m2 = m[2 * inStride], m3 = m[3 * inStride];
+        y[0]         = m0 + m1 + m2;
+        y[outStride] = m1 - m2 - m3;
+    }
+};
+
+template <>
+struct WinogradTransforms<4>
+{
+    static void Input(const float* d, unsigned int inStride, float* v, unsigned int outStride)
+    {
+        const float d0 = d[0], d1 = d[inStride], d2 = d[2 * inStride];
+        const float d3 = d[3 * inStride], d4 = d[4 * inStride], d5 = d[5 * inStride];
+        v[0]             = 4.0f * d0 - 5.0f * d2 + d4;
+        v[outStride]     = d3 + d4 - 4.0f * (d1 + d2);
+        v[2 * outStride] = d4 - d3 + 4.0f * (d1 - d2);
+        v[3 * outStride] = d4 - d2 + 2.0f * (d3 - d1);
+        v[4 * outStride] = d4 - d2 + 2.0f * (d1 - d3);
+        v[5 * outStride] = 4.0f * d1 - 5.0f * d3 + d5;
+    }
+
+    static void Filter(const float* g, unsigned int inStride, float* u, unsigned int outStride)
+    {
+        const float g0 = g[0], g1 = g[inStride], g2 = g[2 * inStride];
+        u[0]             = g0 / 4.0f;
+        u[outStride]     = -(g0 + g1 + g2) / 6.0f;
+        u[2 * outStride] = -(g0 - g1 + g2) / 6.0f;
+        u[3 * outStride] = g0 / 24.0f + g1 / 12.0f + g2 / 6.0f;
+        u[4 * outStride] = g0 / 24.0f - g1 / 12.0f + g2 / 6.0f;
+        u[5 * outStride] = g2;
+    }
+
+    static void Output(const float* m, unsigned int inStride, float* y, unsigned int outStride)
+    {
+        const float m0 = m[0], m1 = m[inStride], m2 = m[2 * inStride];
+        const float m3 = m[3 * inStride], m4 = m[4 * inStride], m5 = m[5 * inStride];
+        y[0]             = m0 + m1 + m2 + m3 + m4;
+        y[outStride]     = m1 - m2 + 2.0f * (m3 - m4);
+        y[2 * outStride] = m1 + m2 + 4.0f * (m3 + m4);
+        y[3 * outStride] = m1 - m2 + 8.0f * (m3 - m4) + m5;
+    }
+};
+
+// The number of multiplications of the transformed tiles of an output, which are padded to whole tiles.
+unsigned int GetNumProducts(unsigned int outputTileSize, unsigned int heightOutput, unsigned int widthOutput)
+{
+    const unsigned int alpha = outputTileSize + 2;
+    return ((heightOutput + outputTileSize - 1) / outputTileSize) *
+           ((widthOutput + outputTileSize - 1) / outputTileSize) * alpha * alpha;
+}
+
+} // anonymous namespace
+
+bool WinogradConvolution::IsSupported(const TensorInfo& inputInfo,
+                                      const TensorInfo& outputInfo,
+                                      const TensorInfo& filterInfo,
+                                      const Convolution2dDescriptor& descriptor)
+{
+    if (inputInfo.GetDataType() != DataType::Float32 || inputInfo.GetNumDimensions() != 4 ||
+        outputInfo.GetNumDimensions() != 4 || filterInfo.GetNumDimensions() != 4)
+    {
+        return false;
+    }
+
+    const armnnUtils::DataLayoutIndexed dataLayout(descriptor.m_DataLayout);
+    const TensorShape& filterShape = filterInfo.GetShape();
+    return filterShape[dataLayout.GetHeightIndex()] == 3 && filterShape[dataLayout.GetWidthIndex()] == 3 &&
+           filterShape[dataLayout.GetChannelsIndex()] >= MinChannelsInput &&
+           descriptor.m_StrideX == 1 && descriptor.m_StrideY == 1;
+}
+
+WinogradConvolution::WinogradConvolution(const TensorInfo& inputInfo,
+                                         const TensorInfo& outputInfo,
+                                         const TensorInfo& filterInfo,
+                                         const float* filterData,
+                                         const Convolution2dDescriptor& descriptor,
+                                         unsigned int outputTileSize)
+    : m_BatchSize(outputInfo.GetShape()[0])
+    , m_ChannelsOutput(filterInfo.GetShape()[0])
+    , m_Descriptor(descriptor)
+    , m_OutputTileSize(outputTileSize)
+{
+    BOOST_ASSERT(IsSupported(inputInfo, outputInfo, filterInfo, descriptor));
+    BOOST_ASSERT(outputTileSize == 0 || outputTileSize == 2 || outputTileSize == 4);
+
+    // The filter is laid out like the data.
+    const armnnUtils::DataLayoutIndexed dataLayout(descriptor.m_DataLayout);
+    m_ChannelsInput = filterInfo.GetShape()[dataLayout.GetChannelsIndex()];
+    m_HeightInput   = inputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    m_WidthInput    = inputInfo.GetShape()[dataLayout.GetWidthIndex()];
+    m_HeightOutput  = outputInfo.GetShape()[dataLayout.GetHeightIndex()];
+    m_WidthOutput   = outputInfo.GetShape()[dataLayout.GetWidthIndex()];
+
+    // The output is padded to whole tiles. On ties, the smaller tiles are more accurate.
+    if (m_OutputTileSize == 0)
+    {
+        m_OutputTileSize = GetNumProducts(4, m_HeightOutput, m_WidthOutput) <
+                           GetNumProducts(2, m_HeightOutput, m_WidthOutput) ? 4 : 2;
+    }
+
+    m_TilesY = (m_HeightOutput + m_OutputTileSize - 1) / m_OutputTileSize;
+    m_TilesX = (m_WidthOutput + m_OutputTileSize - 1) / m_OutputTileSize;
+
+    const unsigned int alpha = m_OutputTileSize + 2;
+    const unsigned int numTiles = m_BatchSize * m_TilesY * m_TilesX;
+    const unsigned int maxChannels = std::max(m_ChannelsInput, m_ChannelsOutput);
+    m_BlockSize = std::min(numTiles, std::max(MinBlockSize, MaxTransformedSize / (alpha * alpha * maxChannels)));
+
+    m_TransformedInput.resize(alpha * alpha * m_ChannelsInput * m_BlockSize);
+    m_Products.resize(alpha * alpha * m_ChannelsOutput * m_BlockSize);
+
+    if (m_OutputTileSize == 4)
+    {
+        TransformFilter<4>(filterData);
+    }
+    else
+    {
+        TransformFilter<2>(filterData);
+    }
+}
+
+template <unsigned int OutputTileSize>
+void WinogradConvolution::TransformFilter(const float* filterData)
+{
+    using Transforms = WinogradTransforms<OutputTileSize>;
+    constexpr unsigned int Alpha = OutputTileSize + 2;
+
+    // Distances between the weights of consecutive output channels, input channels, rows and columns of the filter.
+    const unsigned int outputChannelStride = m_ChannelsInput * 9;
+    const unsigned int inputChannelStride  = IsNhwc() ? 1 : 9;
+    const unsigned int rowStride           = IsNhwc() ? 3 * m_ChannelsInput : 3;
+    const unsigned int columnStride        = IsNhwc() ? m_ChannelsInput : 1;
+
+    m_TransformedFilter.resize(Alpha * Alpha * m_ChannelsOutput * m_ChannelsInput);
+    const unsigned int positionStride = m_ChannelsOutput * m_ChannelsInput;
+    for (unsigned int cOutput = 0; cOutput < m_ChannelsOutput; ++cOutput)
+    {
+        for (unsigned int cInput = 0; cInput < m_ChannelsInput; ++cInput)
+        {
+            const float* const g = filterData + cOutput * outputChannelStride + cInput * inputChannelStride;
+
+            // G g is Alpha x 3, and (G g) G^T is Alpha x Alpha.
+            float gg[Alpha * 3];
+            for (unsigned int x = 0; x < 3; ++x)
+            {
+                Transforms::Filter(g + x * columnStride, rowStride, gg + x, 3);
+            }
+
+            float u[Alpha * Alpha];
+            for (unsigned int y = 0; y < Alpha; ++y)
+            {
+                Transforms::Filter(gg + y * 3, 1, u + y * Alpha, 1);
+            }
+
+            float* const transformed = m_TransformedFilter.data() + cOutput * m_ChannelsInput + cInput;
+            for (unsigned int position = 0; position < Alpha * Alpha; ++position)
+            {
+                transformed[position * positionStride] = u[position];
+            }
+        }
+    }
+}
+
+template <unsigned int OutputTileSize>
+void WinogradConvolution::TransformInput(const float* inputData, unsigned int blockBegin, unsigned int blockSize) const
+{
+    using Transforms = WinogradTransforms<OutputTileSize>;
+    constexpr unsigned int Alpha = OutputTileSize + 2;
+
+    const int padTop  = static_cast<int>(m_Descriptor.m_PadTop);
+    const int padLeft = static_cast<int>(m_Descriptor.m_PadLeft);
+    const int heightInput = static_cast<int>(m_HeightInput);
+    const int widthInput  = static_cast<int>(m_WidthInput);
+
+    // Distances between the elements of consecutive batches, channels, rows and columns of the input.
+    const unsigned int batchStride   = m_ChannelsInput * m_HeightInput * m_WidthInput;
+    const unsigned int channelStride = IsNhwc() ? 1 : m_HeightInput * m_WidthInput;
+    const unsigned int rowStride     = IsNhwc() ? m_WidthInput * m_ChannelsInput : m_WidthInput;
+    const unsigned int columnStride  = IsNhwc() ? m_ChannelsInput : 1;
+
+    const unsigned int positionStride = m_ChannelsInput * m_BlockSize;
+    ParallelFor(0, m_ChannelsInput, [&](unsigned int channelBegin, unsigned int channelEnd)
+    {
+        for (unsigned int cInput = channelBegin; cInput < channelEnd; ++cInput)
+        {
+            for (unsigned int i = 0; i < blockSize; ++i)
+            {
+                const unsigned int tile = blockBegin + i;
+                const unsigned int batchIdx = tile / (m_TilesY * m_TilesX);
+                const unsigned int tileY = (tile / m_TilesX) % m_TilesY;
+                const unsigned int tileX = tile % m_TilesX;
+                const int yBegin = static_cast<int>(tileY * OutputTileSize) - padTop;
+                const int xBegin = static_cast<int>(tileX * OutputTileSize) - padLeft;
+                const float* const channelData = inputData + batchIdx * batchStride + cInput * channelStride;
+
+                // Tiles which overlap the padding are gathered with zeros, the others are read in place.
+                float d[Alpha * Alpha];
+                const float* tileData;
+                unsigned int tileRowStride;
+                unsigned int tileColumnStride;
+                if (yBegin >= 0 && xBegin >= 0 && yBegin + static_cast<int>(Alpha) <= heightInput &&
+                    xBegin + static_cast<int>(Alpha) <= widthInput)
+                {
+                    tileData = channelData + static_cast<unsigned int>(yBegin) * rowStride +
+                               static_cast<unsigned int>(xBegin) * columnStride;
+                    tileRowStride = rowStride;
+                    tileColumnStride = columnStride;
+                }
+                else
+                {
+                    for (unsigned int y = 0; y < Alpha; ++y)
+                    {
+                        const int yInput = yBegin + static_cast<int>(y);
+                        for (unsigned int x = 0; x < Alpha; ++x)
+                        {
+                            const int xInput = xBegin + static_cast<int>(x);
+                            d[y * Alpha + x] =
+                                (yInput < 0 || yInput >= heightInput || xInput < 0 || xInput >= widthInput) ? 0.0f :
+                                channelData[static_cast<unsigned int>(yInput) * rowStride +
+                                            static_cast<unsigned int>(xInput) * columnStride];
+                        }
+                    }
+                    tileData = d;
+                    tileRowStride = Alpha;
+                    tileColumnStride = 1;
+                }
+
+                // B^T d, then (B^T d) B.
+                float bd[Alpha * Alpha];
+                for (unsigned int x = 0; x < Alpha; ++x)
+                {
+                    Transforms::Input(tileData + x * tileColumnStride, tileRowStride, bd + x, Alpha);
+                }
+
+                float v[Alpha * Alpha];
+                for (unsigned int y = 0; y < Alpha; ++y)
+                {
+                    Transforms::Input(bd + y * Alpha, 1, v + y * Alpha, 1);
+                }
+
+                float* const transformed = m_TransformedInput.data() + cInput * m_BlockSize + i;
+                for (unsigned int position = 0; position < Alpha * Alpha; ++position)
+                {
+                    transformed[position * positionStride] = v[position];
+                }
+            }
+        }
+    });
+}
+
+template <unsigned int OutputTileSize>
+void WinogradConvolution::TransformOutput(const float* biasData, const ActivationDescriptor* activation,
+                                          float* outputData, unsigned int blockBegin, unsigned int blockSize) const
+{
+    using Transforms = WinogradTransforms<OutputTileSize>;
+    constexpr unsigned int Alpha = OutputTileSize + 2;
+
+    // Distances between the elements of consecutive batches, channels, rows and columns of the output.
+    const unsigned int batchStride   = m_ChannelsOutput * m_HeightOutput * m_WidthOutput;
+    const unsigned int channelStride = IsNhwc() ? 1 : m_HeightOutput * m_WidthOutput;
+    const unsigned int rowStride     = IsNhwc() ? m_WidthOutput * m_ChannelsOutput : m_WidthOutput;
+    const unsigned int columnStride  = IsNhwc() ? m_ChannelsOutput : 1;
+
+    const unsigned int positionStride = m_ChannelsOutput * m_BlockSize;
+    ParallelFor(0, m_ChannelsOutput, [&](unsigned int channelBegin, unsigned int channelEnd)
+    {
+        for (unsigned int cOutput = channelBegin; cOutput < channelEnd; ++cOutput)
+        {
+            const float bias = m_Descriptor.m_BiasEnabled ? biasData[cOutput] : 0.0f;
+            for (unsigned int i = 0; i < blockSize; ++i)
+            {
+                const float* const products = m_Products.data() + cOutput * m_BlockSize + i;
+                float m[Alpha * Alpha];
+                for (unsigned int position = 0; position < Alpha * Alpha; ++position)
+                {
+                    m[position] = products[position * positionStride];
+                }
+
+                // A^T m, then (A^T m) A.
+                float am[OutputTileSize * Alpha];
+                for (unsigned int x = 0; x < Alpha; ++x)
+                {
+                    Transforms::Output(m + x, Alpha, am + x, Alpha);
+                }
+
+                float y[OutputTileSize * OutputTileSize];
+                for (unsigned int row = 0; row < OutputTileSize; ++row)
+                {
+                    Transforms::Output(am + row * Alpha, 1, y + row * OutputTileSize, 1);
+                }
+
+                // The tiles on the bottom and right edges may go past the output.
+                const unsigned int tile = blockBegin + i;
+                const unsigned int batchIdx = tile / (m_TilesY * m_TilesX);
+                const unsigned int yBegin = ((tile / m_TilesX) % m_TilesY) * OutputTileSize;
+                const unsigned int xBegin = (tile % m_TilesX) * OutputTileSize;
+                const unsigned int height = std::min(OutputTileSize, m_HeightOutput - yBegin);
+                const unsigned int width  = std::min(OutputTileSize, m_WidthOutput - xBegin);
+
+                float* const outputTile = outputData + batchIdx * batchStride + cOutput * channelStride +
+                                          yBegin * rowStride + xBegin * columnStride;
+                for (unsigned int row = 0; row < height; ++row)
+                {
+                    for (unsigned int column = 0; column < width; ++column)
+                    {
+                        float value = y[row * OutputTileSize + column] + bias;
+                        if (activation != nullptr)
+                        {
+                            value = Activation(value, activation->m_Function, activation->m_A, activation->m_B);
+                        }
+                        outputTile[row * rowStride + column * columnStride] = value;
+                    }
+                }
+            }
+        }
+    });
+}
+
+template <unsigned int OutputTileSize>
+void WinogradConvolution::ExecuteTiles(const float* inputData, const float* biasData, float* outputData,
+                                       const ActivationDescriptor* activation) const
+{
+    constexpr unsigned int Alpha = OutputTileSize + 2;
+
+    const unsigned int numTiles = m_BatchSize * m_TilesY * m_TilesX;
+    for (unsigned int blockBegin = 0; blockBegin < numTiles; blockBegin += m_BlockSize)
+    {
+        const unsigned int blockSize = std::min(m_BlockSize, numTiles - blockBegin);
+
+        TransformInput<OutputTileSize>(inputData, blockBegin, blockSize);
+
+        // Each element of the transformed tiles is the product of the transformed filter at that position by the
+        // transformed input tiles at that position.
+        std::fill(m_Products.begin(), m_Products.end(), 0.0f);
+        for (unsigned int position = 0; position < Alpha * Alpha; ++position)
+        {
+            Gemm(m_ChannelsOutput, blockSize, m_ChannelsInput,
+                 m_TransformedFilter.data() + position * m_ChannelsOutput * m_ChannelsInput, m_ChannelsInput,
+                 m_TransformedInput.data() + position * m_ChannelsInput * m_BlockSize, m_BlockSize,
+                 m_Products.data() + position * m_ChannelsOutput * m_BlockSize, m_BlockSize);
+        }
+
+        TransformOutput<OutputTileSize>(biasData, activation, outputData, blockBegin, blockSize);
+    }
+}
+
+void WinogradConvolution::Execute(const float* inputData, const float* biasData, float* outputData,
+                                  const ActivationDescriptor* activation) const
+{
+    BOOST_ASSERT(!m_Descriptor.m_BiasEnabled || biasData != nullptr);
+
+    if (m_OutputTileSize == 4)
+    {
+        ExecuteTiles<4>(inputData, biasData, outputData, activation);
+    }
+    else
+    {
+        ExecuteTiles<2>(inputData, biasData, outputData, activation);
+    }
+}
+
+} //namespace armnn
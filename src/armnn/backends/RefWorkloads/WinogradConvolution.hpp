@@ -0,0 +1,97 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Float32 3x3 convolution with unit strides computed with the Winograd minimal filtering algorithms F(2x2, 3x3) and
+/// F(4x4, 3x3). The output is split in tiles of 2x2 or 4x4 pixels, each computed from the 4x4 or 6x6 input tile
+/// which covers its windows: the input tiles and the filters are transformed, so that the convolution becomes 16 or
+/// 36 independent matrix multiplications of the transformed filters, [outputChannels, inputChannels], by the
+/// transformed input tiles, [inputChannels, tiles], whose products are transformed back into the output tiles.
+/// This takes 2.25 (F(2x2, 3x3)) or 4 (F(4x4, 3x3)) times fewer multiplications than the direct convolution, at the
+/// cost of rounding errors which grow with the size of the tiles.
+/// The filters are transformed once, when the convolution is created. The tiles of all the batches are transformed
+/// and multiplied a block at a time, to bound the memory used by the transformed tiles.
+class WinogradConvolution
+{
+public:
+    /// Returns whether the given convolution can be run by this class, and has enough input channels to be faster
+    /// than the matrix multiplications of Im2ColConvolution.
+    static bool IsSupported(const TensorInfo& inputInfo,
+                            const TensorInfo& outputInfo,
+                            const TensorInfo& filterInfo,
+                            const Convolution2dDescriptor& descriptor);
+
+    /// Transforms the filter of the given convolution, which must be supported. outputTileSize is 2 or 4 to select
+    /// F(2x2, 3x3) or F(4x4, 3x3), or 0 to select the one which takes the fewest multiplications for the size of the
+    /// output.
+    WinogradConvolution(const TensorInfo& inputInfo,
+                        const TensorInfo& outputInfo,
+                        const TensorInfo& filterInfo,
+                        const float* filterData,
+                        const Convolution2dDescriptor& descriptor,
+                        unsigned int outputTileSize = 0);
+
+    /// Runs the convolution. biasData may be nullptr if the bias is disabled. If activation is not nullptr, it is
+    /// applied to the output tiles as they are transformed.
+    /// Must not be called from several threads at the same time.
+    void Execute(const float* inputData, const float* biasData, float* outputData,
+                 const ActivationDescriptor* activation = nullptr) const;
+
+    unsigned int GetOutputTileSize() const { return m_OutputTileSize; }
+
+private:
+    template <unsigned int OutputTileSize>
+    void TransformFilter(const float* filterData);
+
+    template <unsigned int OutputTileSize>
+    void ExecuteTiles(const float* inputData, const float* biasData, float* outputData,
+                      const ActivationDescriptor* activation) const;
+
+    template <unsigned int OutputTileSize>
+    void TransformInput(const float* inputData, unsigned int blockBegin, unsigned int blockSize) const;
+
+    template <unsigned int OutputTileSize>
+    void TransformOutput(const float* biasData, const ActivationDescriptor* activation, float* outputData,
+                         unsigned int blockBegin, unsigned int blockSize) const;
+
+    bool IsNhwc() const { return m_Descriptor.m_DataLayout == DataLayout::NHWC; }
+
+    unsigned int m_BatchSize;
+    unsigned int m_ChannelsInput;
+    unsigned int m_HeightInput;
+    unsigned int m_WidthInput;
+    unsigned int m_ChannelsOutput;
+    unsigned int m_HeightOutput;
+    unsigned int m_WidthOutput;
+    Convolution2dDescriptor m_Descriptor;
+
+    /// The size of the output tiles, and the number of tiles along the height and the width of each output.
+    unsigned int m_OutputTileSize;
+    unsigned int m_TilesY;
+    unsigned int m_TilesX;
+
+    /// Number of tiles transformed and multiplied at a time.
+    unsigned int m_BlockSize;
+
+    /// The transformed filter, [tilePosition, outputChannels, inputChannels] where tilePosition is the index of an
+    /// element of the transformed tiles.
+    std::vector<float> m_TransformedFilter;
+
+    /// The transformed input tiles of a block, [tilePosition, inputChannels, m_BlockSize], and their products by the
+    /// transformed filter, [tilePosition, outputChannels, m_BlockSize].
+    mutable std::vector<float> m_TransformedInput;
+    mutable std::vector<float> m_Products;
+};
+
+} //namespace armnn
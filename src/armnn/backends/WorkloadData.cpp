@@ -5,6 +5,7 @@
 #include "WorkloadData.hpp"
 
 #include "CpuTensorHandle.hpp"
+#include "DataLayoutIndexed.hpp"
 #include "WorkloadInfo.hpp"
 
 #include <algorithm>
@@ -310,14 +311,20 @@ void SoftmaxQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 {
     ValidateSingleInput(workloadInfo, "SoftmaxQueueDescriptor");
     ValidateSingleOutput(workloadInfo, "SoftmaxQueueDescriptor");
-    ValidateTensorNumDimensions(workloadInfo.m_InputTensorInfos[0], "SoftmaxQueueDescriptor", 2, "input");
-    ValidateTensorNumDimensions(workloadInfo.m_OutputTensorInfos[0], "SoftmaxQueueDescriptor", 2, "output");
 
     ValidateTensorShapesMatch(workloadInfo.m_InputTensorInfos[0],
                               workloadInfo.m_OutputTensorInfos[0],
                               "SoftmaxQueueDescriptor",
                               "input",
                               "output");
+
+    const int numDimensions = boost::numeric_cast<int>(workloadInfo.m_InputTensorInfos[0].GetNumDimensions());
+    if (m_Parameters.m_Axis < -numDimensions || m_Parameters.m_Axis >= numDimensions)
+    {
+        throw InvalidArgumentException("SoftmaxQueueDescriptor: Axis " + to_string(m_Parameters.m_Axis) +
+                                       " is out of range for a tensor with " + to_string(numDimensions) +
+                                       " dimensions.");
+    }
 }
 
 //---------------------------------------------------------------
@@ -581,9 +588,14 @@ void DepthwiseConvolution2dQueueDescriptor::Validate(const WorkloadInfo& workloa
     ValidateTensorNumDimensions(m_Weight->GetTensorInfo(), "DepthwiseConvolution2dQueueDescriptor", 4, "weight");
 
     //inputChannels * channelMultiplier should be equal to outputChannels.
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Parameters.m_DataLayout);
+    const unsigned int channelsIndex = dataLayout.GetChannelsIndex();
     const unsigned int numWeightChannelMultiplier = m_Weight->GetTensorInfo().GetShape()[0];
-    const unsigned int numWeightInputChannels = m_Weight->GetTensorInfo().GetShape()[1];
-    const unsigned int numWeightOutputChannels = workloadInfo.m_OutputTensorInfos[0].GetShape()[1];
+    const unsigned int numWeightInputChannels = m_Weight->GetTensorInfo().GetShape()[channelsIndex];
+    // The output of a depthwise convolution fused with a pointwise one is the input of the pointwise convolution.
+    const unsigned int numWeightOutputChannels = m_PointwiseWeight != nullptr ?
+        m_PointwiseWeight->GetTensorInfo().GetShape()[channelsIndex] :
+        workloadInfo.m_OutputTensorInfos[0].GetShape()[channelsIndex];
     if (numWeightChannelMultiplier * numWeightInputChannels != numWeightOutputChannels)
     {
         throw InvalidArgumentException(
@@ -607,6 +619,21 @@ void DepthwiseConvolution2dQueueDescriptor::Validate(const WorkloadInfo& workloa
 
     ValidateTensorQuantizationMultiplier(workloadInfo.m_InputTensorInfos[0], m_Weight->GetTensorInfo(),
         workloadInfo.m_OutputTensorInfos[0], "DepthwiseConvolution2dQueueDescriptor", "input", "weights", "output");
+
+    if (m_PointwiseWeight != nullptr)
+    {
+        ValidateTensorNumDimensions(m_PointwiseWeight->GetTensorInfo(), "DepthwiseConvolution2dQueueDescriptor", 4,
+                                    "pointwise weight");
+        const unsigned int numPointwiseOutputChannels = m_PointwiseWeight->GetTensorInfo().GetShape()[0];
+        const unsigned int numOutputChannels = workloadInfo.m_OutputTensorInfos[0].GetShape()[channelsIndex];
+        if (numPointwiseOutputChannels != numOutputChannels)
+        {
+            throw InvalidArgumentException(
+                boost::str(boost::format("DepthwiseConvolution2dQueueDescriptor: output_channels (provided %1%) "
+                                         "should be equal to the output channels of the pointwise weights "
+                                         "(provided %2%).") % numOutputChannels % numPointwiseOutputChannels));
+        }
+    }
 }
 
 void PermuteQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
@@ -664,8 +691,9 @@ void ResizeBilinearQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) c
     }
 
     {
-        const unsigned int inputChannelCount = workloadInfo.m_InputTensorInfos[0].GetShape()[1];
-        const unsigned int outputChannelCount = workloadInfo.m_OutputTensorInfos[0].GetShape()[1];
+        const unsigned int channelsIndex = armnnUtils::DataLayoutIndexed(m_Parameters.m_DataLayout).GetChannelsIndex();
+        const unsigned int inputChannelCount = workloadInfo.m_InputTensorInfos[0].GetShape()[channelsIndex];
+        const unsigned int outputChannelCount = workloadInfo.m_OutputTensorInfos[0].GetShape()[channelsIndex];
         if (inputChannelCount != outputChannelCount)
         {
             throw InvalidArgumentException(
@@ -753,6 +781,42 @@ void LstmQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 {
     ValidateTensorNumDimensions(workloadInfo.m_InputTensorInfos[0], "LstmQueueDescriptor", 2, "input");
     ValidateTensorNumDimensions(workloadInfo.m_OutputTensorInfos[0], "LstmQueueDescriptor", 2, "output");
+
+    if (workloadInfo.m_InputTensorInfos.size() != 3 || workloadInfo.m_OutputTensorInfos.size() != 4)
+    {
+        throw InvalidArgumentException("LstmQueueDescriptor: Requires exactly three inputs and four outputs. " +
+                                       to_string(workloadInfo.m_InputTensorInfos.size()) + " inputs and " +
+                                       to_string(workloadInfo.m_OutputTensorInfos.size()) +
+                                       " outputs have been provided.");
+    }
+
+    ValidatePointer(m_InputToForgetWeights, "LstmQueueDescriptor", "input to forget weights");
+    ValidatePointer(m_InputToCellWeights, "LstmQueueDescriptor", "input to cell weights");
+    ValidatePointer(m_InputToOutputWeights, "LstmQueueDescriptor", "input to output weights");
+    ValidatePointer(m_RecurrentToForgetWeights, "LstmQueueDescriptor", "recurrent to forget weights");
+    ValidatePointer(m_RecurrentToCellWeights, "LstmQueueDescriptor", "recurrent to cell weights");
+    ValidatePointer(m_RecurrentToOutputWeights, "LstmQueueDescriptor", "recurrent to output weights");
+    ValidatePointer(m_ForgetGateBias, "LstmQueueDescriptor", "forget gate bias");
+    ValidatePointer(m_CellBias, "LstmQueueDescriptor", "cell bias");
+    ValidatePointer(m_OutputGateBias, "LstmQueueDescriptor", "output gate bias");
+
+    if (!m_Parameters.m_CifgEnabled)
+    {
+        ValidatePointer(m_InputToInputWeights, "LstmQueueDescriptor", "input to input weights");
+        ValidatePointer(m_RecurrentToInputWeights, "LstmQueueDescriptor", "recurrent to input weights");
+        ValidatePointer(m_InputGateBias, "LstmQueueDescriptor", "input gate bias");
+    }
+
+    if (m_Parameters.m_PeepholeEnabled)
+    {
+        ValidatePointer(m_CellToForgetWeights, "LstmQueueDescriptor", "cell to forget weights");
+        ValidatePointer(m_CellToOutputWeights, "LstmQueueDescriptor", "cell to output weights");
+    }
+
+    if (m_Parameters.m_ProjectionEnabled)
+    {
+        ValidatePointer(m_ProjectionWeights, "LstmQueueDescriptor", "projection weights");
+    }
 }
 
 void ConvertFp32ToFp16QueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
@@ -115,11 +115,15 @@ struct FullyConnectedQueueDescriptor : QueueDescriptorWithParameters<FullyConnec
     FullyConnectedQueueDescriptor()
         : m_Weight(nullptr)
         , m_Bias(nullptr)
+        , m_FusedActivation(nullptr)
     {
     }
 
     const ConstCpuTensorHandle* m_Weight;
     const ConstCpuTensorHandle* m_Bias;
+    /// Activation to apply to the output, or nullptr. Only set for CpuRef workloads, by the FuseActivation
+    /// optimizations.
+    const ActivationDescriptor* m_FusedActivation;
 
     void Validate(const WorkloadInfo& workloadInfo) const;
 };
@@ -142,11 +146,15 @@ struct Convolution2dQueueDescriptor : QueueDescriptorWithParameters<Convolution2
     Convolution2dQueueDescriptor()
         : m_Weight(nullptr)
         , m_Bias(nullptr)
+        , m_FusedActivation(nullptr)
     {
     }
 
     const ConstCpuTensorHandle* m_Weight;
     const ConstCpuTensorHandle* m_Bias;
+    /// Activation to apply to the output, or nullptr. Only set for CpuRef workloads, by the FuseActivation
+    /// optimizations.
+    const ActivationDescriptor* m_FusedActivation;
 
     void Validate(const WorkloadInfo& workloadInfo) const;
 };
@@ -157,11 +165,24 @@ struct DepthwiseConvolution2dQueueDescriptor : QueueDescriptorWithParameters<Dep
     DepthwiseConvolution2dQueueDescriptor()
         : m_Weight(nullptr)
         , m_Bias(nullptr)
+        , m_FusedActivation(nullptr)
+        , m_PointwiseWeight(nullptr)
+        , m_PointwiseBias(nullptr)
+        , m_PointwiseActivation(nullptr)
     {
     }
 
     const ConstCpuTensorHandle* m_Weight;
     const ConstCpuTensorHandle* m_Bias;
+    /// Activation to apply to the output of the depthwise convolution, or nullptr. Only set for CpuRef workloads, by
+    /// the FuseActivation optimizations.
+    const ActivationDescriptor* m_FusedActivation;
+    /// Filter, bias (or nullptr) and activation (or nullptr) of a pointwise convolution applied to the output of the
+    /// depthwise one, whose output is then the output of the workload. Only set for CpuRef Float32 workloads, by the
+    /// FusePointwiseIntoDepthwiseConvolution2d optimization.
+    const ConstCpuTensorHandle* m_PointwiseWeight;
+    const ConstCpuTensorHandle* m_PointwiseBias;
+    const ActivationDescriptor* m_PointwiseActivation;
 
     void Validate(const WorkloadInfo& workloadInfo) const;
 };
@@ -8,6 +8,7 @@
 #include "ClWorkloadFactory.hpp"
 
 #include "armnn/Types.hpp"
+#include "armnn/TypesUtils.hpp"
 #include "armnn/LayerSupport.hpp"
 #include "Layer.hpp"
 #include "LayersFwd.hpp"
@@ -51,11 +52,38 @@ namespace
         }
         return boost::none;
     }
+
+    template <typename LayerType>
+    DataLayout GetDataLayout(const Layer& layer)
+    {
+        return boost::polymorphic_downcast<const LayerType*>(&layer)->GetParameters().m_DataLayout;
+    }
+
+    DataLayout GetDataLayout(const Layer& layer)
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Convolution2d:          return GetDataLayout<Convolution2dLayer>(layer);
+            case LayerType::DepthwiseConvolution2d: return GetDataLayout<DepthwiseConvolution2dLayer>(layer);
+            case LayerType::Normalization:          return GetDataLayout<NormalizationLayer>(layer);
+            case LayerType::Pooling2d:              return GetDataLayout<Pooling2dLayer>(layer);
+            case LayerType::ResizeBilinear:         return GetDataLayout<ResizeBilinearLayer>(layer);
+            default:                                return DataLayout::NCHW;
+        }
+    }
 }
 
 bool IWorkloadFactory::IsLayerSupported(Compute compute, const Layer& layer, boost::optional<DataType> dataType,
     std::string& outReasonIfUnsupported)
 {
+    // The Neon and CL workloads run on NCHW tensors only, so NHWC layers are left to the reference workloads.
+    if (compute != Compute::CpuRef && GetDataLayout(layer) == DataLayout::NHWC)
+    {
+        outReasonIfUnsupported = std::string("NHWC data layout is not supported by ") +
+                                 GetComputeDeviceAsCString(compute);
+        return false;
+    }
+
     constexpr size_t reasonCapacity = 1024;
     char reason[reasonCapacity];
     bool result;
@@ -39,6 +39,7 @@ public:
 
     virtual bool SupportsSubTensors() const = 0;
 
+    /// Creates a view of parent, or returns nullptr if the backend cannot represent this one.
     virtual std::unique_ptr<ITensorHandle> CreateSubTensorHandle(ITensorHandle& parent,
                                                                  TensorShape const& subTensorShape,
                                                                  unsigned int const* subTensorOrigin
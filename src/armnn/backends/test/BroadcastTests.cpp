@@ -0,0 +1,93 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "backends/RefWorkloads/Broadcast.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+// Broadcasts the inputs one element at a time, from the coordinates of each element of the output.
+std::vector<float> NaiveBroadcastAdd(const armnn::TensorShape& shape0, const armnn::TensorShape& shape1,
+                                     const armnn::TensorShape& outShape,
+                                     const std::vector<float>& input0, const std::vector<float>& input1)
+{
+    const unsigned int numDims = outShape.GetNumDimensions();
+    std::vector<float> output(outShape.GetNumElements());
+    for (unsigned int outIndex = 0; outIndex < output.size(); ++outIndex)
+    {
+        unsigned int index0 = 0;
+        unsigned int index1 = 0;
+        unsigned int remainder = outIndex;
+        unsigned int stride0 = 1;
+        unsigned int stride1 = 1;
+        for (unsigned int d = numDims; d-- > 0;)
+        {
+            const unsigned int coordinate = remainder % outShape[d];
+            remainder /= outShape[d];
+            index0 += (shape0[d] == 1 ? 0 : coordinate) * stride0;
+            index1 += (shape1[d] == 1 ? 0 : coordinate) * stride1;
+            stride0 *= shape0[d];
+            stride1 *= shape1[d];
+        }
+        output[outIndex] = input0[index0] + input1[index1];
+    }
+    return output;
+}
+
+void CheckBroadcast(const armnn::TensorShape& shape0, const armnn::TensorShape& shape1)
+{
+    unsigned int outDims[armnn::MaxNumOfTensorDimensions];
+    for (unsigned int d = 0; d < shape0.GetNumDimensions(); ++d)
+    {
+        outDims[d] = std::max(shape0[d], shape1[d]);
+    }
+    const armnn::TensorShape outShape(shape0.GetNumDimensions(), outDims);
+
+    std::vector<float> input0(shape0.GetNumElements());
+    std::vector<float> input1(shape1.GetNumElements());
+    for (unsigned int i = 0; i < input0.size(); ++i)
+    {
+        input0[i] = static_cast<float>(i);
+    }
+    for (unsigned int i = 0; i < input1.size(); ++i)
+    {
+        input1[i] = static_cast<float>(i) * 1000.0f;
+    }
+
+    std::vector<float> output(outShape.GetNumElements());
+    armnn::ElementwiseBinaryOperation(shape0, shape1, outShape, input0.data(), input1.data(), output.data(),
+                                      std::plus<float>());
+
+    BOOST_TEST(output == NaiveBroadcastAdd(shape0, shape1, outShape, input0, input1), boost::test_tools::per_element());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefBroadcast)
+
+BOOST_AUTO_TEST_CASE(CollapsedBroadcastMatchesElementwise)
+{
+    using armnn::TensorShape;
+
+    // Same shapes, scalars on either side, per-channel biases in NCHW and NHWC, and inputs broadcast along
+    // different dimensions of the output.
+    CheckBroadcast(TensorShape({ 2, 3, 4, 5 }), TensorShape({ 2, 3, 4, 5 }));
+    CheckBroadcast(TensorShape({ 2, 3, 4, 5 }), TensorShape({ 1, 1, 1, 1 }));
+    CheckBroadcast(TensorShape({ 1, 1, 1, 1 }), TensorShape({ 2, 3, 4, 5 }));
+    CheckBroadcast(TensorShape({ 2, 3, 4, 5 }), TensorShape({ 1, 3, 1, 1 }));
+    CheckBroadcast(TensorShape({ 2, 4, 5, 3 }), TensorShape({ 1, 1, 1, 3 }));
+    CheckBroadcast(TensorShape({ 2, 1, 4, 1 }), TensorShape({ 1, 3, 1, 5 }));
+    CheckBroadcast(TensorShape({ 1, 3, 4, 5 }), TensorShape({ 2, 3, 1, 1 }));
+    CheckBroadcast(TensorShape({ 1, 1, 4, 5 }), TensorShape({ 2, 3, 4, 5 }));
+    CheckBroadcast(TensorShape({ 7, 1 }), TensorShape({ 1, 9 }));
+    CheckBroadcast(TensorShape({ 1 }), TensorShape({ 1 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
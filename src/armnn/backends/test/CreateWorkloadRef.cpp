@@ -276,6 +276,11 @@ static void RefCreateSplitterWorkloadTest()
 
     auto outputHandle2 = boost::polymorphic_downcast<CpuTensorHandle*>(queueDescriptor.m_Outputs[2]);
     BOOST_TEST((outputHandle2->GetTensorInfo() == TensorInfo({ 2, 7, 7 }, DataType)));
+
+    // The views are contiguous in the input, so the outputs are sub-tensors of it.
+    BOOST_TEST((outputHandle0->GetParent() == inputHandle));
+    BOOST_TEST((outputHandle1->GetParent() == inputHandle));
+    BOOST_TEST((outputHandle2->GetParent() == inputHandle));
 }
 
 BOOST_AUTO_TEST_CASE(CreateSplitterFloat32Workload)
@@ -319,6 +324,12 @@ static void RefCreateSplitterMergerWorkloadTest()
     bool validDataPointers = (sOut0 == mIn1) && (sOut1 == mIn0);
 
     BOOST_TEST(validDataPointers);
+
+    //Also make sure that the inputs of the merger are sub tensors of its output.
+    bool validSubTensorParents = (mIn0->GetParent() == wlMerger->GetData().m_Outputs[0])
+                                    && (mIn1->GetParent() == wlMerger->GetData().m_Outputs[0]);
+
+    BOOST_TEST(validSubTensorParents);
 }
 
 BOOST_AUTO_TEST_CASE(CreateSplitterMergerFloat32)
@@ -443,4 +454,18 @@ BOOST_AUTO_TEST_CASE(CreateReshapeUint8Workload)
     RefCreateReshapeWorkloadTest<RefReshapeUint8Workload, armnn::DataType::QuantisedAsymm8>();
 }
 
+BOOST_AUTO_TEST_CASE(CreateLstmFloat32Workload)
+{
+    Graph graph;
+    RefWorkloadFactory factory;
+    auto workload = CreateLstmWorkloadTest<RefLstmFloat32Workload>(factory, graph);
+
+    // Checks that outputs and inputs are as we expect them (see definition of CreateLstmWorkloadTest).
+    auto queueDescriptor = workload->GetData();
+    auto inputHandle  = boost::polymorphic_downcast<ConstCpuTensorHandle*>(queueDescriptor.m_Inputs[0]);
+    auto outputHandle = boost::polymorphic_downcast<CpuTensorHandle*>(queueDescriptor.m_Outputs[3]);
+    BOOST_TEST((inputHandle->GetTensorInfo() == TensorInfo({ 2, 2 }, DataType::Float32)));
+    BOOST_TEST((outputHandle->GetTensorInfo() == TensorInfo({ 2, 4 }, DataType::Float32)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,408 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/RefWorkloads.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/WorkloadInfo.hpp"
+
+#include "Permute.hpp"
+
+#include <armnn/ArmNN.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using namespace armnn;
+
+const PermutationVector NchwToNhwc = { 0, 3, 1, 2 };
+const PermutationVector NhwcToNchw = { 0, 2, 3, 1 };
+
+std::vector<float> MakeRandomData(const TensorInfo& info)
+{
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(info.GetNumElements()));
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    std::vector<float> data(info.GetNumElements());
+    for (auto&& value : data)
+    {
+        value = distribution(generator);
+    }
+    return data;
+}
+
+std::vector<uint8_t> MakeRandomQuantizedData(const TensorInfo& info)
+{
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(info.GetNumElements()));
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::vector<uint8_t> data(info.GetNumElements());
+    for (auto&& value : data)
+    {
+        value = static_cast<uint8_t>(distribution(generator));
+    }
+    return data;
+}
+
+template <typename T>
+std::vector<T> PermuteData(const TensorInfo& info, const std::vector<T>& data, const PermutationVector& mappings)
+{
+    std::vector<T> permuted(data.size());
+    armnnUtils::Permute(armnnUtils::Permuted(info.GetShape(), mappings), mappings, data.data(), permuted.data());
+    return permuted;
+}
+
+template <typename Workload, typename QueueDescriptor, typename T>
+std::vector<T> RunWorkload(QueueDescriptor descriptor,
+                           const TensorInfo& inputInfo,
+                           std::vector<T> input,
+                           const TensorInfo& outputInfo)
+{
+    std::vector<T> output(outputInfo.GetNumElements());
+    PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+    PassthroughCpuTensorHandle outputHandle(outputInfo, output.data());
+
+    WorkloadInfo info;
+    descriptor.m_Inputs = { &inputHandle };
+    descriptor.m_Outputs = { &outputHandle };
+    info.m_InputTensorInfos = { inputInfo };
+    info.m_OutputTensorInfos = { outputInfo };
+
+    Workload workload(descriptor, info);
+    workload.Execute();
+    return output;
+}
+
+/// Runs the workload with the first descriptor on the given NCHW tensors, then with the second one on their NHWC
+/// permutations, and returns the outputs of both runs in NCHW.
+template <typename Workload, typename QueueDescriptor, typename T>
+std::pair<std::vector<T>, std::vector<T>> RunNchwAndNhwc(QueueDescriptor nchwDescriptor,
+                                                         QueueDescriptor nhwcDescriptor,
+                                                         const TensorInfo& inputInfo,
+                                                         const std::vector<T>& input,
+                                                         const TensorInfo& outputInfo)
+{
+    nchwDescriptor.m_Parameters.m_DataLayout = DataLayout::NCHW;
+    std::vector<T> nchwOutput = RunWorkload<Workload>(nchwDescriptor, inputInfo, input, outputInfo);
+
+    const TensorInfo nhwcOutputInfo = armnnUtils::Permuted(outputInfo, NchwToNhwc);
+    nhwcDescriptor.m_Parameters.m_DataLayout = DataLayout::NHWC;
+    std::vector<T> nhwcOutput = RunWorkload<Workload>(nhwcDescriptor,
+                                                      armnnUtils::Permuted(inputInfo, NchwToNhwc),
+                                                      PermuteData(inputInfo, input, NchwToNhwc),
+                                                      nhwcOutputInfo);
+
+    return { nchwOutput, PermuteData(nhwcOutputInfo, nhwcOutput, NhwcToNchw) };
+}
+
+template <typename Workload, typename QueueDescriptor, typename T>
+std::pair<std::vector<T>, std::vector<T>> RunNchwAndNhwc(const QueueDescriptor& descriptor,
+                                                         const TensorInfo& inputInfo,
+                                                         const std::vector<T>& input,
+                                                         const TensorInfo& outputInfo)
+{
+    return RunNchwAndNhwc<Workload>(descriptor, descriptor, inputInfo, input, outputInfo);
+}
+
+/// Same as RunNchwAndNhwc() for convolutions, whose weights are permuted like the data.
+template <typename Workload, typename QueueDescriptor, typename T>
+std::pair<std::vector<T>, std::vector<T>> RunConvolutionNchwAndNhwc(const QueueDescriptor& descriptor,
+                                                                    const TensorInfo& inputInfo,
+                                                                    const std::vector<T>& input,
+                                                                    const TensorInfo& outputInfo,
+                                                                    const TensorInfo& weightInfo,
+                                                                    const std::vector<T>& weights)
+{
+    ScopedCpuTensorHandle nchwWeights(ConstTensor(weightInfo, weights));
+    ScopedCpuTensorHandle nhwcWeights(ConstTensor(armnnUtils::Permuted(weightInfo, NchwToNhwc),
+                                                  PermuteData(weightInfo, weights, NchwToNhwc)));
+
+    QueueDescriptor nchwDescriptor = descriptor;
+    QueueDescriptor nhwcDescriptor = descriptor;
+    nchwDescriptor.m_Weight = &nchwWeights;
+    nhwcDescriptor.m_Weight = &nhwcWeights;
+    return RunNchwAndNhwc<Workload>(nchwDescriptor, nhwcDescriptor, inputInfo, input, outputInfo);
+}
+
+// The NHWC kernels may accumulate in a different order, so float results are only close.
+void CheckClose(const std::pair<std::vector<float>, std::vector<float>>& outputs)
+{
+    const std::vector<float>& expected = outputs.first;
+    const std::vector<float>& actual = outputs.second;
+    BOOST_TEST_REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        BOOST_TEST(std::fabs(actual[i] - expected[i]) <= 1e-4f * (1.0f + std::fabs(expected[i])),
+                   "at index " << i << ": " << actual[i] << " != " << expected[i]);
+    }
+}
+
+void CheckEqual(const std::pair<std::vector<uint8_t>, std::vector<uint8_t>>& outputs)
+{
+    BOOST_TEST(outputs.second == outputs.first, boost::test_tools::per_element());
+}
+
+template <typename Descriptor>
+Descriptor MakeConvolutionDescriptor(unsigned int stride, unsigned int pad, bool biasEnabled)
+{
+    Descriptor descriptor;
+    descriptor.m_StrideX     = stride;
+    descriptor.m_StrideY     = stride;
+    descriptor.m_PadLeft     = pad;
+    descriptor.m_PadRight    = pad;
+    descriptor.m_PadTop      = pad;
+    descriptor.m_PadBottom   = pad;
+    descriptor.m_BiasEnabled = biasEnabled;
+    return descriptor;
+}
+
+void CheckConvolution(const TensorShape& inputShape, const TensorShape& filterShape,
+                      unsigned int stride, unsigned int pad)
+{
+    const unsigned int heightOutput = (inputShape[2] + 2 * pad - filterShape[2]) / stride + 1;
+    const unsigned int widthOutput = (inputShape[3] + 2 * pad - filterShape[3]) / stride + 1;
+
+    const TensorInfo inputInfo(inputShape, DataType::Float32);
+    const TensorInfo outputInfo({ inputShape[0], filterShape[0], heightOutput, widthOutput }, DataType::Float32);
+    const TensorInfo filterInfo(filterShape, DataType::Float32);
+    const TensorInfo biasInfo({ filterShape[0] }, DataType::Float32);
+
+    const std::vector<float> filter = MakeRandomData(filterInfo);
+    ScopedCpuTensorHandle bias(ConstTensor(biasInfo, MakeRandomData(biasInfo)));
+
+    Convolution2dQueueDescriptor descriptor;
+    descriptor.m_Parameters = MakeConvolutionDescriptor<Convolution2dDescriptor>(stride, pad, true);
+    descriptor.m_Bias = &bias;
+    CheckClose(RunConvolutionNchwAndNhwc<RefConvolution2dFloat32Workload>(descriptor, inputInfo,
+                                                                           MakeRandomData(inputInfo), outputInfo,
+                                                                           filterInfo, filter));
+
+    const TensorInfo quantizedInputInfo(inputShape, DataType::QuantisedAsymm8, 0.05f, 100);
+    const TensorInfo quantizedOutputInfo(outputInfo.GetShape(), DataType::QuantisedAsymm8, 0.5f, 120);
+    const TensorInfo quantizedFilterInfo(filterShape, DataType::QuantisedAsymm8, 0.02f, 130);
+    const TensorInfo quantizedBiasInfo({ filterShape[0] }, DataType::Signed32, 0.001f, 0);
+
+    const std::vector<uint8_t> quantizedFilter = MakeRandomQuantizedData(quantizedFilterInfo);
+    std::vector<int32_t> quantizedBiasData(filterShape[0]);
+    for (unsigned int i = 0; i < filterShape[0]; ++i)
+    {
+        quantizedBiasData[i] = static_cast<int32_t>(i * 50) - 100;
+    }
+    ScopedCpuTensorHandle quantizedBias(ConstTensor(quantizedBiasInfo, quantizedBiasData));
+
+    descriptor.m_Bias = &quantizedBias;
+    CheckEqual(RunConvolutionNchwAndNhwc<RefConvolution2dUint8Workload>(descriptor, quantizedInputInfo,
+                                                                         MakeRandomQuantizedData(quantizedInputInfo),
+                                                                         quantizedOutputInfo,
+                                                                         quantizedFilterInfo, quantizedFilter));
+}
+
+void CheckDepthwiseConvolution(const TensorShape& inputShape, unsigned int depthMultiplier,
+                               unsigned int filterSize, unsigned int stride, unsigned int pad)
+{
+    const unsigned int channels = inputShape[1];
+    const unsigned int heightOutput = (inputShape[2] + 2 * pad - filterSize) / stride + 1;
+    const unsigned int widthOutput = (inputShape[3] + 2 * pad - filterSize) / stride + 1;
+
+    const TensorInfo inputInfo(inputShape, DataType::Float32);
+    const TensorInfo outputInfo({ inputShape[0], channels * depthMultiplier, heightOutput, widthOutput },
+                                DataType::Float32);
+    const TensorInfo filterInfo({ depthMultiplier, channels, filterSize, filterSize }, DataType::Float32);
+    const TensorInfo biasInfo({ channels * depthMultiplier }, DataType::Float32);
+
+    const std::vector<float> filter = MakeRandomData(filterInfo);
+    ScopedCpuTensorHandle bias(ConstTensor(biasInfo, MakeRandomData(biasInfo)));
+
+    DepthwiseConvolution2dQueueDescriptor descriptor;
+    descriptor.m_Parameters = MakeConvolutionDescriptor<DepthwiseConvolution2dDescriptor>(stride, pad, true);
+    descriptor.m_Bias = &bias;
+    CheckClose(RunConvolutionNchwAndNhwc<RefDepthwiseConvolution2dFloat32Workload>(descriptor, inputInfo,
+                                                                                    MakeRandomData(inputInfo),
+                                                                                    outputInfo, filterInfo, filter));
+
+    const TensorInfo quantizedInputInfo(inputShape, DataType::QuantisedAsymm8, 0.05f, 100);
+    const TensorInfo quantizedOutputInfo(outputInfo.GetShape(), DataType::QuantisedAsymm8, 0.1f, 120);
+    const TensorInfo quantizedFilterInfo(filterInfo.GetShape(), DataType::QuantisedAsymm8, 0.02f, 130);
+
+    const std::vector<uint8_t> quantizedFilter = MakeRandomQuantizedData(quantizedFilterInfo);
+    descriptor.m_Parameters.m_BiasEnabled = false;
+    descriptor.m_Bias = nullptr;
+    CheckEqual(RunConvolutionNchwAndNhwc<RefDepthwiseConvolution2dUint8Workload>(
+        descriptor, quantizedInputInfo, MakeRandomQuantizedData(quantizedInputInfo), quantizedOutputInfo,
+        quantizedFilterInfo, quantizedFilter));
+}
+
+void CheckPooling(PoolingAlgorithm poolType, unsigned int poolSize, unsigned int stride, unsigned int pad)
+{
+    const TensorShape inputShape({ 2, 5, 9, 8 });
+    const unsigned int heightOutput = (inputShape[2] + 2 * pad - poolSize) / stride + 1;
+    const unsigned int widthOutput = (inputShape[3] + 2 * pad - poolSize) / stride + 1;
+    const TensorShape outputShape({ inputShape[0], inputShape[1], heightOutput, widthOutput });
+
+    Pooling2dQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_PoolType   = poolType;
+    descriptor.m_Parameters.m_PoolWidth  = poolSize;
+    descriptor.m_Parameters.m_PoolHeight = poolSize;
+    descriptor.m_Parameters.m_StrideX    = stride;
+    descriptor.m_Parameters.m_StrideY    = stride;
+    descriptor.m_Parameters.m_PadLeft    = pad;
+    descriptor.m_Parameters.m_PadRight   = pad;
+    descriptor.m_Parameters.m_PadTop     = pad;
+    descriptor.m_Parameters.m_PadBottom  = pad;
+
+    const TensorInfo inputInfo(inputShape, DataType::Float32);
+    CheckClose(RunNchwAndNhwc<RefPooling2dFloat32Workload>(descriptor, inputInfo, MakeRandomData(inputInfo),
+                                                            TensorInfo(outputShape, DataType::Float32)));
+
+    const TensorInfo quantizedInputInfo(inputShape, DataType::QuantisedAsymm8, 0.1f, 128);
+    const TensorInfo quantizedOutputInfo(outputShape, DataType::QuantisedAsymm8, 0.1f, 128);
+    CheckEqual(RunNchwAndNhwc<RefPooling2dUint8Workload>(descriptor, quantizedInputInfo,
+                                                          MakeRandomQuantizedData(quantizedInputInfo),
+                                                          quantizedOutputInfo));
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefDataLayout)
+
+BOOST_AUTO_TEST_CASE(NhwcConvolution2dMatchesNchw)
+{
+    // Run by Im2ColConvolution, including a pointwise convolution which is not lowered with im2col in NHWC.
+    CheckConvolution({ 1, 3, 9, 11 }, { 5, 3, 3, 3 }, 1, 1);
+    CheckConvolution({ 2, 4, 10, 13 }, { 6, 4, 5, 5 }, 2, 0);
+    CheckConvolution({ 2, 16, 7, 9 }, { 9, 16, 1, 1 }, 1, 0);
+    // Enough input channels for the output pixels to be split in several tiles.
+    CheckConvolution({ 1, 128, 31, 30 }, { 10, 128, 3, 3 }, 1, 1);
+}
+
+BOOST_AUTO_TEST_CASE(NhwcDepthwiseConvolution2dMatchesNchw)
+{
+    CheckDepthwiseConvolution({ 1, 3, 9, 11 }, 1, 3, 1, 1);
+    CheckDepthwiseConvolution({ 2, 4, 10, 13 }, 2, 3, 2, 0);
+}
+
+BOOST_AUTO_TEST_CASE(NhwcPooling2dMatchesNchw)
+{
+    CheckPooling(PoolingAlgorithm::Max, 3, 2, 1);
+    CheckPooling(PoolingAlgorithm::Average, 3, 1, 1);
+    CheckPooling(PoolingAlgorithm::L2, 2, 2, 0);
+}
+
+BOOST_AUTO_TEST_CASE(NhwcResizeBilinearMatchesNchw)
+{
+    ResizeBilinearQueueDescriptor descriptor;
+    descriptor.m_Parameters.m_TargetWidth = 11;
+    descriptor.m_Parameters.m_TargetHeight = 5;
+
+    const TensorInfo inputInfo({ 2, 3, 7, 6 }, DataType::Float32);
+    const TensorInfo outputInfo({ 2, 3, 5, 11 }, DataType::Float32);
+    CheckClose(RunNchwAndNhwc<RefResizeBilinearFloat32Workload>(descriptor, inputInfo, MakeRandomData(inputInfo),
+                                                                 outputInfo));
+
+    const TensorInfo quantizedInputInfo(inputInfo.GetShape(), DataType::QuantisedAsymm8, 0.1f, 128);
+    const TensorInfo quantizedOutputInfo(outputInfo.GetShape(), DataType::QuantisedAsymm8, 0.1f, 128);
+    CheckEqual(RunNchwAndNhwc<RefResizeBilinearUint8Workload>(descriptor, quantizedInputInfo,
+                                                               MakeRandomQuantizedData(quantizedInputInfo),
+                                                               quantizedOutputInfo));
+}
+
+BOOST_AUTO_TEST_CASE(NhwcNormalizationMatchesNchw)
+{
+    const TensorInfo info({ 2, 7, 5, 6 }, DataType::Float32);
+
+    for (NormalizationAlgorithmChannel channelType : { NormalizationAlgorithmChannel::Across,
+                                                       NormalizationAlgorithmChannel::Within })
+    {
+        NormalizationQueueDescriptor descriptor;
+        descriptor.m_Parameters.m_NormChannelType = channelType;
+        descriptor.m_Parameters.m_NormSize = 3;
+        descriptor.m_Parameters.m_Alpha = 0.5f;
+        descriptor.m_Parameters.m_Beta = 0.75f;
+        descriptor.m_Parameters.m_K = 1.0f;
+        CheckClose(RunNchwAndNhwc<RefNormalizationFloat32Workload>(descriptor, info, MakeRandomData(info), info));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NhwcNetworkRunsWithoutPermutes)
+{
+    // Input [1, 6, 7, 3] -> 3x3 convolution to 4 channels -> 2x2 max pooling -> output [1, 2, 2, 4].
+    const TensorInfo inputInfo({ 1, 6, 7, 3 }, DataType::Float32);
+    const TensorInfo convolutionInfo({ 1, 4, 5, 4 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 2, 2, 4 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 4, 3, 3, 3 }, DataType::Float32);
+    const std::vector<float> weights = MakeRandomData(weightsInfo);
+
+    Convolution2dDescriptor convolutionDescriptor = MakeConvolutionDescriptor<Convolution2dDescriptor>(1, 0, false);
+    convolutionDescriptor.m_DataLayout = DataLayout::NHWC;
+    Pooling2dDescriptor poolingDescriptor;
+    poolingDescriptor.m_PoolWidth = poolingDescriptor.m_PoolHeight = 2;
+    poolingDescriptor.m_StrideX = poolingDescriptor.m_StrideY = 2;
+    poolingDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    INetworkPtr network = INetwork::Create();
+    IConnectableLayer* input = network->AddInputLayer(0);
+    IConnectableLayer* convolution = network->AddConvolution2dLayer(convolutionDescriptor,
+                                                                    ConstTensor(weightsInfo, weights));
+    IConnectableLayer* pooling = network->AddPooling2dLayer(poolingDescriptor);
+    IConnectableLayer* output = network->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+    convolution->GetOutputSlot(0).Connect(pooling->GetInputSlot(0));
+    pooling->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    convolution->GetOutputSlot(0).SetTensorInfo(convolutionInfo);
+    pooling->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    IRuntimePtr runtime = IRuntime::Create(IRuntime::CreationOptions());
+    IOptimizedNetworkPtr optimized = Optimize(*network, { Compute::CpuRef }, runtime->GetDeviceSpec());
+    BOOST_TEST_REQUIRE(optimized.get() != nullptr);
+    NetworkId networkId;
+    BOOST_TEST_REQUIRE((runtime->LoadNetwork(networkId, std::move(optimized)) == Status::Success));
+
+    std::vector<float> inputData = MakeRandomData(inputInfo);
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    BOOST_TEST_REQUIRE((runtime->EnqueueWorkload(networkId,
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(networkId, 0), inputData.data()) } },
+        { { 0, Tensor(runtime->GetOutputTensorInfo(networkId, 0), outputData.data()) } }) == Status::Success));
+
+    // Computes the same layers directly.
+    std::vector<float> expected(outputInfo.GetNumElements(), std::numeric_limits<float>::lowest());
+    for (unsigned int y = 0; y < 4; ++y)
+    {
+        for (unsigned int x = 0; x < 4; ++x)
+        {
+            for (unsigned int o = 0; o < 4; ++o)
+            {
+                float sum = 0.0f;
+                for (unsigned int ky = 0; ky < 3; ++ky)
+                {
+                    for (unsigned int kx = 0; kx < 3; ++kx)
+                    {
+                        for (unsigned int c = 0; c < 3; ++c)
+                        {
+                            sum += inputData[((y + ky) * 7 + x + kx) * 3 + c] *
+                                   weights[((o * 3 + ky) * 3 + kx) * 3 + c];
+                        }
+                    }
+                }
+                float& pooled = expected[((y / 2) * 2 + x / 2) * 4 + o];
+                pooled = std::max(pooled, sum);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        BOOST_TEST(std::fabs(outputData[i] - expected[i]) <= 1e-4f, "at index " << i);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
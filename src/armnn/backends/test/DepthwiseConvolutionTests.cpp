@@ -0,0 +1,285 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/Activation.hpp"
+#include "backends/RefWorkloads/ConvImpl.hpp"
+#include "backends/RefWorkloads/DepthwiseConvolution.hpp"
+#include "backends/RefWorkloads/RefThreadPool.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<float> MakeRandomData(size_t size)
+{
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(size));
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    std::vector<float> data(size);
+    for (auto&& value : data)
+    {
+        value = distribution(generator);
+    }
+    return data;
+}
+
+void CheckClose(const std::vector<float>& actual, const std::vector<float>& expected)
+{
+    BOOST_TEST_REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        BOOST_TEST(std::fabs(actual[i] - expected[i]) <= 1e-4f * (1.0f + std::fabs(expected[i])),
+                   "at index " << i << ": " << actual[i] << " != " << expected[i]);
+    }
+}
+
+armnn::TensorShape MakeShape(armnn::DataLayout dataLayout, unsigned int batches, unsigned int channels,
+                             unsigned int height, unsigned int width)
+{
+    return dataLayout == armnn::DataLayout::NHWC ? armnn::TensorShape({ batches, height, width, channels })
+                                                 : armnn::TensorShape({ batches, channels, height, width });
+}
+
+void ApplyActivation(std::vector<float>& data, const armnn::ActivationDescriptor& activation)
+{
+    for (auto&& value : data)
+    {
+        value = armnn::Activation(value, activation.m_Function, activation.m_A, activation.m_B);
+    }
+}
+
+// Checks that DepthwiseConvolution gives the same results as ConvImpl, with the activation applied afterwards, and
+// when pointwiseChannelsOutput is not 0, followed by a pointwise ConvImpl with a bounded ReLu.
+void CheckConvolution(armnn::DataLayout dataLayout, unsigned int batchSize,
+                      unsigned int channelsInput, unsigned int heightInput, unsigned int widthInput,
+                      unsigned int depthMultiplier, unsigned int heightFilter, unsigned int widthFilter,
+                      const armnn::DepthwiseConvolution2dDescriptor& descriptor,
+                      const armnn::ActivationDescriptor* activation = nullptr,
+                      unsigned int pointwiseChannelsOutput = 0)
+{
+    using namespace armnn;
+
+    const unsigned int channelsOutput = channelsInput * depthMultiplier;
+    const unsigned int heightOutput = (heightInput + descriptor.m_PadTop + descriptor.m_PadBottom - heightFilter)
+                                      / descriptor.m_StrideY + 1;
+    const unsigned int widthOutput = (widthInput + descriptor.m_PadLeft + descriptor.m_PadRight - widthFilter)
+                                     / descriptor.m_StrideX + 1;
+
+    const TensorInfo inputInfo(MakeShape(dataLayout, batchSize, channelsInput, heightInput, widthInput),
+                               DataType::Float32);
+    const TensorInfo outputInfo(MakeShape(dataLayout, batchSize, channelsOutput, heightOutput, widthOutput),
+                                DataType::Float32);
+    const TensorInfo filterInfo(MakeShape(dataLayout, depthMultiplier, channelsInput, heightFilter, widthFilter),
+                                DataType::Float32);
+
+    std::vector<float> input  = MakeRandomData(inputInfo.GetNumElements());
+    std::vector<float> filter = MakeRandomData(filterInfo.GetNumElements());
+    std::vector<float> bias   = MakeRandomData(channelsOutput);
+    std::vector<float> expectedOutput(outputInfo.GetNumElements());
+
+    PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+    PassthroughCpuTensorHandle outputHandle(outputInfo, expectedOutput.data());
+    DepthwiseConvolution2dQueueDescriptor queueDescriptor;
+    queueDescriptor.m_Parameters = descriptor;
+    queueDescriptor.m_Inputs.push_back(&inputHandle);
+    queueDescriptor.m_Outputs.push_back(&outputHandle);
+
+    const float* biasData = descriptor.m_BiasEnabled ? bias.data() : nullptr;
+    ConvImpl<DepthwiseConvolution2dQueueDescriptor, float, float, float>(queueDescriptor, input.data(), 0.0f, 0,
+        filter.data(), 0.0f, 0, biasData, expectedOutput.data(), 0.0f, 0, filterInfo, true);
+    if (activation)
+    {
+        ApplyActivation(expectedOutput, *activation);
+    }
+
+    if (pointwiseChannelsOutput == 0)
+    {
+        std::vector<float> actualOutput(outputInfo.GetNumElements());
+        DepthwiseConvolution convolution(inputInfo, filterInfo, filter.data(), descriptor);
+        convolution.Execute(input.data(), biasData, actualOutput.data(), activation);
+
+        CheckClose(actualOutput, expectedOutput);
+        return;
+    }
+
+    Convolution2dDescriptor pointwiseDescriptor;
+    pointwiseDescriptor.m_StrideX     = 1;
+    pointwiseDescriptor.m_StrideY     = 1;
+    pointwiseDescriptor.m_BiasEnabled = true;
+    pointwiseDescriptor.m_DataLayout  = dataLayout;
+
+    ActivationDescriptor pointwiseActivation;
+    pointwiseActivation.m_Function = ActivationFunction::BoundedReLu;
+    pointwiseActivation.m_A        = 0.5f;
+    pointwiseActivation.m_B        = -0.5f;
+
+    const TensorInfo pointwiseOutputInfo(
+        MakeShape(dataLayout, batchSize, pointwiseChannelsOutput, heightOutput, widthOutput), DataType::Float32);
+    const TensorInfo pointwiseFilterInfo(MakeShape(dataLayout, pointwiseChannelsOutput, channelsOutput, 1, 1),
+                                         DataType::Float32);
+    BOOST_TEST_REQUIRE(DepthwiseConvolution::IsPointwiseSupported(outputInfo, pointwiseFilterInfo,
+                                                                  pointwiseDescriptor, dataLayout));
+
+    std::vector<float> pointwiseFilter = MakeRandomData(pointwiseFilterInfo.GetNumElements());
+    std::vector<float> pointwiseBias   = MakeRandomData(pointwiseChannelsOutput);
+    std::vector<float> expectedPointwiseOutput(pointwiseOutputInfo.GetNumElements());
+    std::vector<float> actualPointwiseOutput(pointwiseOutputInfo.GetNumElements());
+
+    PassthroughCpuTensorHandle pointwiseInputHandle(outputInfo, expectedOutput.data());
+    PassthroughCpuTensorHandle pointwiseOutputHandle(pointwiseOutputInfo, expectedPointwiseOutput.data());
+    Convolution2dQueueDescriptor pointwiseQueueDescriptor;
+    pointwiseQueueDescriptor.m_Parameters = pointwiseDescriptor;
+    pointwiseQueueDescriptor.m_Inputs.push_back(&pointwiseInputHandle);
+    pointwiseQueueDescriptor.m_Outputs.push_back(&pointwiseOutputHandle);
+
+    ConvImpl<Convolution2dQueueDescriptor, float, float, float>(pointwiseQueueDescriptor, expectedOutput.data(),
+        0.0f, 0, pointwiseFilter.data(), 0.0f, 0, pointwiseBias.data(), expectedPointwiseOutput.data(), 0.0f, 0,
+        pointwiseFilterInfo);
+    ApplyActivation(expectedPointwiseOutput, pointwiseActivation);
+
+    DepthwiseConvolution convolution(inputInfo, filterInfo, filter.data(), descriptor,
+                                     &pointwiseFilterInfo, pointwiseFilter.data());
+    convolution.Execute(input.data(), biasData, actualPointwiseOutput.data(), activation,
+                        pointwiseBias.data(), &pointwiseActivation);
+
+    CheckClose(actualPointwiseOutput, expectedPointwiseOutput);
+}
+
+armnn::DepthwiseConvolution2dDescriptor MakeDescriptor(unsigned int strideX, unsigned int strideY,
+                                                       unsigned int padLeft, unsigned int padRight,
+                                                       unsigned int padTop, unsigned int padBottom,
+                                                       bool biasEnabled)
+{
+    armnn::DepthwiseConvolution2dDescriptor descriptor;
+    descriptor.m_StrideX     = strideX;
+    descriptor.m_StrideY     = strideY;
+    descriptor.m_PadLeft     = padLeft;
+    descriptor.m_PadRight    = padRight;
+    descriptor.m_PadTop      = padTop;
+    descriptor.m_PadBottom   = padBottom;
+    descriptor.m_BiasEnabled = biasEnabled;
+    return descriptor;
+}
+
+// Checks the shapes of MobileNet-style convolutions, and a few others, in the given data layout.
+void CheckConvolutions(armnn::DataLayout dataLayout)
+{
+    auto makeDescriptor = [dataLayout](unsigned int strideX, unsigned int strideY,
+                                       unsigned int padLeft, unsigned int padRight,
+                                       unsigned int padTop, unsigned int padBottom, bool biasEnabled)
+    {
+        armnn::DepthwiseConvolution2dDescriptor descriptor =
+            MakeDescriptor(strideX, strideY, padLeft, padRight, padTop, padBottom, biasEnabled);
+        descriptor.m_DataLayout = dataLayout;
+        return descriptor;
+    };
+
+    // 3x3 with strides 1 and 2, which are unrolled.
+    CheckConvolution(dataLayout, 1, 5, 9, 11, 1, 3, 3, makeDescriptor(1, 1, 1, 1, 1, 1, true));
+    CheckConvolution(dataLayout, 1, 5, 9, 11, 1, 3, 3, makeDescriptor(2, 2, 1, 1, 1, 1, true));
+    // TensorFlow's SAME padding with stride 2 only pads after.
+    CheckConvolution(dataLayout, 1, 4, 10, 12, 1, 3, 3, makeDescriptor(2, 2, 0, 1, 0, 1, true));
+    // Other filters, strides and asymmetric padding, with a depth multiplier, batches and no bias.
+    CheckConvolution(dataLayout, 2, 3, 12, 13, 2, 5, 5, makeDescriptor(1, 1, 2, 2, 2, 2, false));
+    CheckConvolution(dataLayout, 2, 3, 10, 13, 3, 3, 5, makeDescriptor(2, 3, 2, 0, 0, 1, true));
+    // Inputs too small to have an interior.
+    CheckConvolution(dataLayout, 1, 2, 2, 3, 1, 3, 3, makeDescriptor(1, 1, 1, 1, 1, 1, true));
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(RefDepthwiseConvolution)
+
+BOOST_AUTO_TEST_CASE(DepthwiseConvolutionMatchesConvImplNchw)
+{
+    CheckConvolutions(armnn::DataLayout::NCHW);
+}
+
+BOOST_AUTO_TEST_CASE(DepthwiseConvolutionMatchesConvImplNhwc)
+{
+    CheckConvolutions(armnn::DataLayout::NHWC);
+}
+
+BOOST_AUTO_TEST_CASE(DepthwiseConvolutionWithActivation)
+{
+    armnn::ActivationDescriptor activation;
+    activation.m_Function = armnn::ActivationFunction::BoundedReLu;
+    activation.m_A        = 6.0f;
+    activation.m_B        = 0.0f;
+
+    CheckConvolution(armnn::DataLayout::NCHW, 1, 5, 9, 11, 1, 3, 3, MakeDescriptor(1, 1, 1, 1, 1, 1, true),
+                     &activation);
+
+    armnn::DepthwiseConvolution2dDescriptor descriptor = MakeDescriptor(2, 2, 1, 1, 1, 1, true);
+    descriptor.m_DataLayout = armnn::DataLayout::NHWC;
+    CheckConvolution(armnn::DataLayout::NHWC, 1, 5, 9, 11, 1, 3, 3, descriptor, &activation);
+}
+
+BOOST_AUTO_TEST_CASE(FusedPointwiseConvolutionMatchesConvImpl)
+{
+    armnn::ActivationDescriptor activation;
+    activation.m_Function = armnn::ActivationFunction::ReLu;
+
+    for (armnn::DataLayout dataLayout : { armnn::DataLayout::NCHW, armnn::DataLayout::NHWC })
+    {
+        armnn::DepthwiseConvolution2dDescriptor descriptor = MakeDescriptor(1, 1, 1, 1, 1, 1, true);
+        descriptor.m_DataLayout = dataLayout;
+        CheckConvolution(dataLayout, 2, 20, 41, 43, 2, 3, 3, descriptor, &activation, 7);
+
+        // The last tile is partial.
+        descriptor = MakeDescriptor(2, 2, 0, 1, 0, 1, false);
+        descriptor.m_DataLayout = dataLayout;
+        CheckConvolution(dataLayout, 1, 64, 81, 81, 1, 3, 3, descriptor, nullptr, 24);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(DepthwiseConvolutionWithThreadPool)
+{
+    armnn::RefThreadPool threadPool(3);
+    armnn::ScopedRefThreadPool scopedThreadPool(&threadPool);
+
+    for (armnn::DataLayout dataLayout : { armnn::DataLayout::NCHW, armnn::DataLayout::NHWC })
+    {
+        armnn::DepthwiseConvolution2dDescriptor descriptor = MakeDescriptor(1, 1, 1, 1, 1, 1, true);
+        descriptor.m_DataLayout = dataLayout;
+        CheckConvolution(dataLayout, 2, 16, 20, 21, 1, 3, 3, descriptor);
+        CheckConvolution(dataLayout, 1, 64, 81, 81, 1, 3, 3, descriptor, nullptr, 24);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(StridedPointwiseConvolutionsAreNotFused)
+{
+    const armnn::TensorInfo outputInfo({ 1, 64, 40, 40 }, armnn::DataType::Float32);
+    const armnn::TensorInfo filterInfo({ 16, 64, 1, 1 }, armnn::DataType::Float32);
+
+    armnn::Convolution2dDescriptor descriptor;
+    descriptor.m_StrideX = 1;
+    descriptor.m_StrideY = 1;
+    BOOST_TEST(armnn::DepthwiseConvolution::IsPointwiseSupported(outputInfo, filterInfo, descriptor,
+                                                                 armnn::DataLayout::NCHW));
+    descriptor.m_StrideX = 2;
+    BOOST_TEST(!armnn::DepthwiseConvolution::IsPointwiseSupported(outputInfo, filterInfo, descriptor,
+                                                                  armnn::DataLayout::NCHW));
+}
+
+BOOST_AUTO_TEST_CASE(OutputsFittingInATileAreNotFused)
+{
+    const armnn::TensorInfo outputInfo({ 1, 64, 10, 10 }, armnn::DataType::Float32);
+    const armnn::TensorInfo filterInfo({ 16, 64, 1, 1 }, armnn::DataType::Float32);
+
+    armnn::Convolution2dDescriptor descriptor;
+    descriptor.m_StrideX = 1;
+    descriptor.m_StrideY = 1;
+    BOOST_TEST(!armnn::DepthwiseConvolution::IsPointwiseSupported(outputInfo, filterInfo, descriptor,
+                                                                  armnn::DataLayout::NCHW));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
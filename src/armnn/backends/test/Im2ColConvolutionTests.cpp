@@ -0,0 +1,345 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/ConvImpl.hpp"
+#include "backends/RefWorkloads/Gemm.hpp"
+#include "backends/RefWorkloads/Im2ColConvolution.hpp"
+#include "backends/RefWorkloads/RefThreadPool.hpp"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<float> MakeRandomData(size_t size)
+{
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(size));
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    std::vector<float> data(size);
+    for (auto&& value : data)
+    {
+        value = distribution(generator);
+    }
+    return data;
+}
+
+void CheckClose(const std::vector<float>& actual, const std::vector<float>& expected)
+{
+    BOOST_TEST_REQUIRE(actual.size() == expected.size());
+    for (size_t i = 0; i < actual.size(); ++i)
+    {
+        BOOST_TEST(std::fabs(actual[i] - expected[i]) <= 1e-4f * (1.0f + std::fabs(expected[i])),
+                   "at index " << i << ": " << actual[i] << " != " << expected[i]);
+    }
+}
+
+// Checks that Gemm() gives the same results as a naive multiplication of strided matrices.
+void CheckGemm(unsigned int M, unsigned int N, unsigned int K)
+{
+    const unsigned int lda = K + 3, ldb = N + 5, ldc = N + 1;
+
+    std::vector<float> A = MakeRandomData(M * lda);
+    std::vector<float> B = MakeRandomData(K * ldb);
+    std::vector<float> C = MakeRandomData(M * ldc);
+
+    std::vector<float> expected = C;
+    for (unsigned int m = 0; m < M; ++m)
+    {
+        for (unsigned int n = 0; n < N; ++n)
+        {
+            for (unsigned int k = 0; k < K; ++k)
+            {
+                expected[m * ldc + n] += A[m * lda + k] * B[k * ldb + n];
+            }
+        }
+    }
+
+    armnn::Gemm(M, N, K, A.data(), lda, B.data(), ldb, C.data(), ldc);
+    CheckClose(C, expected);
+}
+
+// Checks that GemmTransposedB() gives the same results as a naive multiplication by the transpose of a strided
+// N x K matrix.
+void CheckGemmTransposedB(unsigned int M, unsigned int N, unsigned int K)
+{
+    const unsigned int lda = K + 3, ldb = K + 5, ldc = N + 1;
+
+    std::vector<float> A = MakeRandomData(M * lda);
+    std::vector<float> B = MakeRandomData(N * ldb);
+    std::vector<float> C = MakeRandomData(M * ldc);
+
+    std::vector<float> expected = C;
+    for (unsigned int m = 0; m < M; ++m)
+    {
+        for (unsigned int n = 0; n < N; ++n)
+        {
+            for (unsigned int k = 0; k < K; ++k)
+            {
+                expected[m * ldc + n] += A[m * lda + k] * B[n * ldb + k];
+            }
+        }
+    }
+
+    armnn::GemmTransposedB(M, N, K, A.data(), lda, B.data(), ldb, C.data(), ldc);
+    CheckClose(C, expected);
+}
+
+// Checks that the uint8 Gemm(), or GemmTransposedB() for an N x K matrix B, gives exactly the same results as a naive
+// multiplication of strided matrices.
+void CheckQuantizedGemm(unsigned int M, unsigned int N, unsigned int K, bool transposedB)
+{
+    const unsigned int lda = K + 3, ldb = (transposedB ? K : N) + 5, ldc = N + 1;
+
+    std::mt19937 generator(M * N * K);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    auto makeRandomData = [&](size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        for (auto&& value : data)
+        {
+            value = static_cast<uint8_t>(distribution(generator));
+        }
+        return data;
+    };
+
+    std::vector<uint8_t> A = makeRandomData(M * lda);
+    std::vector<uint8_t> B = makeRandomData((transposedB ? N : K) * ldb);
+    std::vector<int32_t> C(M * ldc, -7);
+
+    std::vector<int32_t> expected = C;
+    for (unsigned int m = 0; m < M; ++m)
+    {
+        for (unsigned int n = 0; n < N; ++n)
+        {
+            for (unsigned int k = 0; k < K; ++k)
+            {
+                expected[m * ldc + n] += A[m * lda + k] * (transposedB ? B[n * ldb + k] : B[k * ldb + n]);
+            }
+        }
+    }
+
+    if (transposedB)
+    {
+        armnn::GemmTransposedB(M, N, K, A.data(), lda, B.data(), ldb, C.data(), ldc);
+    }
+    else
+    {
+        armnn::Gemm(M, N, K, A.data(), lda, B.data(), ldb, C.data(), ldc);
+    }
+    BOOST_TEST(C == expected, boost::test_tools::per_element());
+}
+
+// Checks that Im2ColConvolution gives the same results as ConvImpl.
+void CheckConvolution(unsigned int batchSize,
+                      unsigned int channelsInput, unsigned int heightInput, unsigned int widthInput,
+                      unsigned int channelsOutput, unsigned int heightFilter, unsigned int widthFilter,
+                      const armnn::Convolution2dDescriptor& descriptor)
+{
+    using namespace armnn;
+
+    const unsigned int heightOutput = (heightInput + descriptor.m_PadTop + descriptor.m_PadBottom - heightFilter)
+                                      / descriptor.m_StrideY + 1;
+    const unsigned int widthOutput = (widthInput + descriptor.m_PadLeft + descriptor.m_PadRight - widthFilter)
+                                     / descriptor.m_StrideX + 1;
+
+    const TensorInfo inputInfo({ batchSize, channelsInput, heightInput, widthInput }, DataType::Float32);
+    const TensorInfo outputInfo({ batchSize, channelsOutput, heightOutput, widthOutput }, DataType::Float32);
+    const TensorInfo filterInfo({ channelsOutput, channelsInput, heightFilter, widthFilter }, DataType::Float32);
+
+    std::vector<float> input  = MakeRandomData(inputInfo.GetNumElements());
+    std::vector<float> filter = MakeRandomData(filterInfo.GetNumElements());
+    std::vector<float> bias   = MakeRandomData(channelsOutput);
+    std::vector<float> expectedOutput(outputInfo.GetNumElements());
+    std::vector<float> actualOutput(outputInfo.GetNumElements());
+
+    PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+    PassthroughCpuTensorHandle outputHandle(outputInfo, expectedOutput.data());
+    Convolution2dQueueDescriptor queueDescriptor;
+    queueDescriptor.m_Parameters = descriptor;
+    queueDescriptor.m_Inputs.push_back(&inputHandle);
+    queueDescriptor.m_Outputs.push_back(&outputHandle);
+
+    const float* biasData = descriptor.m_BiasEnabled ? bias.data() : nullptr;
+    ConvImpl<Convolution2dQueueDescriptor, float, float, float>(queueDescriptor, input.data(), 0.0f, 0,
+        filter.data(), 0.0f, 0, biasData, expectedOutput.data(), 0.0f, 0, filterInfo);
+
+    BOOST_TEST_REQUIRE(Im2ColConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor));
+    Im2ColConvolution im2ColConvolution(inputInfo, outputInfo, filterInfo, descriptor);
+    im2ColConvolution.Execute(input.data(), filter.data(), biasData, actualOutput.data());
+
+    CheckClose(actualOutput, expectedOutput);
+}
+
+// Checks that the quantized Im2ColConvolution gives exactly the same results as ConvImpl.
+void CheckQuantizedConvolution(unsigned int batchSize,
+                               unsigned int channelsInput, unsigned int heightInput, unsigned int widthInput,
+                               unsigned int channelsOutput, unsigned int heightFilter, unsigned int widthFilter,
+                               const armnn::Convolution2dDescriptor& descriptor)
+{
+    using namespace armnn;
+
+    const unsigned int heightOutput = (heightInput + descriptor.m_PadTop + descriptor.m_PadBottom - heightFilter)
+                                      / descriptor.m_StrideY + 1;
+    const unsigned int widthOutput = (widthInput + descriptor.m_PadLeft + descriptor.m_PadRight - widthFilter)
+                                     / descriptor.m_StrideX + 1;
+
+    const TensorInfo inputInfo({ batchSize, channelsInput, heightInput, widthInput },
+                               DataType::QuantisedAsymm8, 0.05f, 100);
+    const TensorInfo outputInfo({ batchSize, channelsOutput, heightOutput, widthOutput },
+                                DataType::QuantisedAsymm8, 0.5f, 120);
+    const TensorInfo filterInfo({ channelsOutput, channelsInput, heightFilter, widthFilter },
+                                DataType::QuantisedAsymm8, 0.02f, 130);
+
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(inputInfo.GetNumElements()));
+    std::uniform_int_distribution<int> distribution(0, 255);
+    auto makeRandomData = [&](size_t size)
+    {
+        std::vector<uint8_t> data(size);
+        for (auto&& value : data)
+        {
+            value = static_cast<uint8_t>(distribution(generator));
+        }
+        return data;
+    };
+
+    std::vector<uint8_t> input  = makeRandomData(inputInfo.GetNumElements());
+    std::vector<uint8_t> filter = makeRandomData(filterInfo.GetNumElements());
+    std::vector<int32_t> bias(channelsOutput);
+    for (unsigned int i = 0; i < channelsOutput; ++i)
+    {
+        bias[i] = static_cast<int32_t>(i * 50) - 100;
+    }
+    std::vector<uint8_t> expectedOutput(outputInfo.GetNumElements());
+    std::vector<uint8_t> actualOutput(outputInfo.GetNumElements());
+
+    PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+    PassthroughCpuTensorHandle outputHandle(outputInfo, expectedOutput.data());
+    Convolution2dQueueDescriptor queueDescriptor;
+    queueDescriptor.m_Parameters = descriptor;
+    queueDescriptor.m_Inputs.push_back(&inputHandle);
+    queueDescriptor.m_Outputs.push_back(&outputHandle);
+
+    const int32_t* biasData = descriptor.m_BiasEnabled ? bias.data() : nullptr;
+    ConvImpl<Convolution2dQueueDescriptor, uint8_t, int32_t, int32_t>(queueDescriptor,
+        input.data(), inputInfo.GetQuantizationScale(), inputInfo.GetQuantizationOffset(),
+        filter.data(), filterInfo.GetQuantizationScale(), filterInfo.GetQuantizationOffset(),
+        biasData,
+        expectedOutput.data(), outputInfo.GetQuantizationScale(), outputInfo.GetQuantizationOffset(), filterInfo);
+
+    const unsigned int patchSize = channelsInput * heightFilter * widthFilter;
+    std::vector<int32_t> filterSums(channelsOutput);
+    SumRows(channelsOutput, patchSize, filter.data(), patchSize, filterSums.data());
+
+    BOOST_TEST_REQUIRE(Im2ColConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor));
+    Im2ColConvolution im2ColConvolution(inputInfo, outputInfo, filterInfo, descriptor);
+    im2ColConvolution.Execute(input.data(), filter.data(), filterSums.data(), biasData, actualOutput.data());
+
+    BOOST_TEST(actualOutput == expectedOutput, boost::test_tools::per_element());
+}
+
+armnn::Convolution2dDescriptor MakeDescriptor(unsigned int strideX, unsigned int strideY,
+                                              unsigned int padLeft, unsigned int padRight,
+                                              unsigned int padTop, unsigned int padBottom,
+                                              bool biasEnabled)
+{
+    armnn::Convolution2dDescriptor descriptor;
+    descriptor.m_StrideX     = strideX;
+    descriptor.m_StrideY     = strideY;
+    descriptor.m_PadLeft     = padLeft;
+    descriptor.m_PadRight    = padRight;
+    descriptor.m_PadTop      = padTop;
+    descriptor.m_PadBottom   = padBottom;
+    descriptor.m_BiasEnabled = biasEnabled;
+    return descriptor;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(RefIm2ColConvolution)
+
+BOOST_AUTO_TEST_CASE(GemmMatchesNaiveMultiplication)
+{
+    // Sizes which are not multiples of the block sizes, and a single column as in the output layers of regressions,
+    // with strided matrices.
+    CheckGemm(7, 70, 300);
+    CheckGemm(9, 1, 300);
+
+    // Threads computing parts of several columns of blocks.
+    armnn::RefThreadPool threadPool(3);
+    armnn::ScopedRefThreadPool scopedThreadPool(&threadPool);
+    CheckGemm(7, 70, 300);
+    CheckGemm(30, 200, 20);
+}
+
+BOOST_AUTO_TEST_CASE(GemmTransposedBMatchesNaiveMultiplication)
+{
+    // Depths and numbers of columns which are not multiples of the ones computed together, with strided matrices.
+    CheckGemmTransposedB(7, 70, 300);
+    CheckGemmTransposedB(1, 3, 13);
+
+    armnn::RefThreadPool threadPool(3);
+    armnn::ScopedRefThreadPool scopedThreadPool(&threadPool);
+    CheckGemmTransposedB(5, 41, 100);
+}
+
+BOOST_AUTO_TEST_CASE(QuantizedGemmMatchesNaiveMultiplication)
+{
+    CheckQuantizedGemm(7, 70, 300, false);
+    CheckQuantizedGemm(1, 3, 13, false);
+    CheckQuantizedGemm(7, 70, 300, true);
+    CheckQuantizedGemm(1, 3, 13, true);
+}
+
+BOOST_AUTO_TEST_CASE(Im2ColConvolutionMatchesConvImpl)
+{
+    // 3x3 with padding.
+    CheckConvolution(1, 3, 9, 11, 5, 3, 3, MakeDescriptor(1, 1, 1, 1, 1, 1, true));
+    // Different strides and asymmetric padding, batches, no bias.
+    CheckConvolution(2, 4, 10, 13, 6, 3, 5, MakeDescriptor(2, 3, 2, 0, 0, 1, false));
+    // Pointwise convolution, which does not need im2col.
+    CheckConvolution(2, 16, 7, 9, 9, 1, 1, MakeDescriptor(1, 1, 0, 0, 0, 0, true));
+    // Strided 1x1 convolution, which needs im2col.
+    CheckConvolution(1, 8, 8, 8, 4, 1, 1, MakeDescriptor(2, 2, 0, 0, 0, 0, true));
+    // Enough input channels for the output pixels to be split in several tiles.
+    CheckConvolution(1, 128, 31, 30, 10, 3, 3, MakeDescriptor(1, 1, 1, 1, 1, 1, true));
+}
+
+BOOST_AUTO_TEST_CASE(Im2ColConvolutionWithThreadPool)
+{
+    armnn::RefThreadPool threadPool(3);
+    armnn::ScopedRefThreadPool scopedThreadPool(&threadPool);
+
+    CheckConvolution(2, 4, 10, 13, 6, 3, 5, MakeDescriptor(2, 3, 2, 0, 0, 1, true));
+    CheckConvolution(1, 128, 31, 30, 10, 3, 3, MakeDescriptor(1, 1, 1, 1, 1, 1, true));
+}
+
+BOOST_AUTO_TEST_CASE(QuantizedIm2ColConvolutionMatchesConvImpl)
+{
+    // The padding must read as the zero point of the input.
+    CheckQuantizedConvolution(1, 3, 9, 11, 5, 3, 3, MakeDescriptor(1, 1, 1, 1, 1, 1, true));
+    CheckQuantizedConvolution(2, 4, 10, 13, 6, 3, 5, MakeDescriptor(2, 3, 2, 0, 0, 1, false));
+    CheckQuantizedConvolution(2, 16, 7, 9, 9, 1, 1, MakeDescriptor(1, 1, 0, 0, 0, 0, true));
+    CheckQuantizedConvolution(1, 128, 31, 30, 10, 3, 3, MakeDescriptor(1, 1, 1, 1, 1, 1, true));
+    // Quantized pointwise convolutions with many output channels are split in several tiles as well.
+    CheckQuantizedConvolution(1, 4, 40, 40, 300, 1, 1, MakeDescriptor(1, 1, 0, 0, 0, 0, true));
+}
+
+BOOST_AUTO_TEST_CASE(HugeFiltersAreNotSupported)
+{
+    const armnn::TensorInfo inputInfo({ 1, 4096, 3, 3 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 1, 1, 1 }, armnn::DataType::Float32);
+    const armnn::TensorInfo filterInfo({ 1, 4096, 3, 3 }, armnn::DataType::Float32);
+
+    BOOST_TEST(!armnn::Im2ColConvolution::IsSupported(inputInfo, outputInfo, filterInfo,
+                                                      MakeDescriptor(1, 1, 0, 0, 0, 0, false)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -520,6 +520,14 @@ LayerTestResult<float,4> SimpleNormalizationWithinTest(armnn::IWorkloadFactory&
     return SimpleNormalizationTestImpl(workloadFactory, normChannel, normMethod);
 }
 
+LayerTestResult<float,4> LocalBrightnessNormalizationTest(armnn::IWorkloadFactory& workloadFactory,
+                                                          armnn::NormalizationAlgorithmChannel normChannel,
+                                                          uint32_t normSize,
+                                                          float beta)
+{
+    return LocalBrightnessNormalizationTestImpl(workloadFactory, normChannel, normSize, beta);
+}
+
 LayerTestResult<float,2> SimpleSoftmaxTest(armnn::IWorkloadFactory& workloadFactory, float beta)
 {
     return SimpleSoftmaxTestImpl<float>(workloadFactory, beta);
@@ -530,6 +538,16 @@ LayerTestResult<uint8_t,2> SimpleSoftmaxUint8Test(armnn::IWorkloadFactory& workl
     return SimpleSoftmaxTestImpl<uint8_t>(workloadFactory, beta);
 }
 
+LayerTestResult<float,4> SoftmaxAxisTest(armnn::IWorkloadFactory& workloadFactory, int axis)
+{
+    return SoftmaxAxisTestImpl<float>(workloadFactory, axis);
+}
+
+LayerTestResult<uint8_t,4> SoftmaxAxisUint8Test(armnn::IWorkloadFactory& workloadFactory, int axis)
+{
+    return SoftmaxAxisTestImpl<uint8_t>(workloadFactory, axis);
+}
+
 LayerTestResult<float,4> CompareNormalizationTest(armnn::IWorkloadFactory& workloadFactory,
                                                   armnn::IWorkloadFactory& refWorkloadFactory,
                                                   armnn::NormalizationAlgorithmChannel normChannel,
@@ -1656,7 +1674,13 @@ void Concatenate(armnn::IWorkloadFactory& workloadFactory,
         std::unique_ptr<armnn::ITensorHandle> inputHandle = subTensorsSupported ?
             workloadFactory.CreateSubTensorHandle(*outputHandle, inputTensorInfo.GetShape(),
                 queueDescriptor.m_ViewOrigins[i].m_Origin.data())
-            : workloadFactory.CreateTensorHandle(inputTensorInfo);
+            : nullptr;
+
+        // The factory may not be able to make a sub-tensor of every view.
+        if (!inputHandle)
+        {
+            inputHandle = workloadFactory.CreateTensorHandle(inputTensorInfo);
+        }
 
         inputHandles.emplace_back(std::move(inputHandle));
     }
@@ -131,9 +131,15 @@ LayerTestResult<float, 4> ConstantLinearActivationTest(armnn::IWorkloadFactory&
 
 LayerTestResult<float, 4> SimpleNormalizationAcrossTest(armnn::IWorkloadFactory& workloadFactory);
 LayerTestResult<float, 4> SimpleNormalizationWithinTest(armnn::IWorkloadFactory& workloadFactory);
+LayerTestResult<float, 4> LocalBrightnessNormalizationTest(armnn::IWorkloadFactory& workloadFactory,
+                                                           armnn::NormalizationAlgorithmChannel normChannel,
+                                                           uint32_t normSize,
+                                                           float beta);
 
 LayerTestResult<float, 2> SimpleSoftmaxTest(armnn::IWorkloadFactory& workloadFactory, float beta);
 LayerTestResult<uint8_t, 2> SimpleSoftmaxUint8Test(armnn::IWorkloadFactory& workloadFactory, float beta);
+LayerTestResult<float, 4> SoftmaxAxisTest(armnn::IWorkloadFactory& workloadFactory, int axis);
+LayerTestResult<uint8_t, 4> SoftmaxAxisUint8Test(armnn::IWorkloadFactory& workloadFactory, int axis);
 
 LayerTestResult<float, 4> SimpleSigmoidTest(armnn::IWorkloadFactory& workloadFactory);
 
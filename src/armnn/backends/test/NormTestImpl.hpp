@@ -239,3 +239,89 @@ LayerTestResult<float,4> CompareNormalizationTestImpl(armnn::IWorkloadFactory& w
     return ret;
 }
 
+LayerTestResult<float,4> LocalBrightnessNormalizationTestImpl(armnn::IWorkloadFactory& workloadFactory,
+                                                              armnn::NormalizationAlgorithmChannel normChannel,
+                                                              uint32_t normSize,
+                                                              float beta)
+{
+    constexpr unsigned int inputNum = 2;
+    constexpr unsigned int inputChannels = 7;
+    constexpr unsigned int inputHeight = 6;
+    constexpr unsigned int inputWidth = 5;
+
+    unsigned int shape[] = { inputNum, inputChannels, inputHeight, inputWidth };
+    const armnn::TensorInfo tensorInfo(4, shape, armnn::DataType::Float32);
+
+    LayerTestResult<float,4> ret(tensorInfo);
+
+    auto input = MakeRandomTensor<float, 4>(tensorInfo, 4567);
+
+    constexpr float alpha = 0.5f;
+    constexpr float kappa = 2.f;
+
+    std::unique_ptr<armnn::ITensorHandle> inputHandle = workloadFactory.CreateTensorHandle(tensorInfo);
+    std::unique_ptr<armnn::ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(tensorInfo);
+
+    armnn::NormalizationQueueDescriptor data;
+    armnn::WorkloadInfo info;
+    AddInputToWorkload(data, info, tensorInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, tensorInfo, outputHandle.get());
+    data.m_Parameters.m_NormChannelType = normChannel;
+    data.m_Parameters.m_NormMethodType  = armnn::NormalizationAlgorithmMethod::LocalBrightness;
+    data.m_Parameters.m_NormSize        = normSize;
+    data.m_Parameters.m_Alpha           = alpha;
+    data.m_Parameters.m_Beta            = beta;
+    data.m_Parameters.m_K               = kappa;
+
+    std::unique_ptr<armnn::IWorkload> workload = workloadFactory.CreateNormalization(data, info);
+
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+
+    CopyDataToITensorHandle(inputHandle.get(), &input[0][0][0][0]);
+
+    workloadFactory.Finalize();
+    workload->Execute();
+
+    CopyDataFromITensorHandle(&ret.output[0][0][0][0], outputHandle.get());
+
+    // Sums the squares of the window of every element directly, clipped to the channels or the plane.
+    const int radius = boost::numeric_cast<int>(normSize / 2);
+    const bool across = normChannel == armnn::NormalizationAlgorithmChannel::Across;
+    for (int n = 0; n < boost::numeric_cast<int>(inputNum); ++n)
+    {
+        for (int c = 0; c < boost::numeric_cast<int>(inputChannels); ++c)
+        {
+            for (int h = 0; h < boost::numeric_cast<int>(inputHeight); ++h)
+            {
+                for (int w = 0; w < boost::numeric_cast<int>(inputWidth); ++w)
+                {
+                    float accumulatedScale = 0.f;
+                    for (int z = -radius; z <= radius; ++z)
+                    {
+                        for (int y = across ? 0 : -radius; y <= (across ? 0 : radius); ++y)
+                        {
+                            for (int x = across ? 0 : -radius; x <= (across ? 0 : radius); ++x)
+                            {
+                                const int k = across ? c + z : c;
+                                if (k < 0 || k >= boost::numeric_cast<int>(inputChannels) ||
+                                    h + y < 0 || h + y >= boost::numeric_cast<int>(inputHeight) ||
+                                    w + x < 0 || w + x >= boost::numeric_cast<int>(inputWidth) ||
+                                    (!across && z != 0))
+                                {
+                                    continue;
+                                }
+                                const float value = input[n][k][h + y][w + x];
+                                accumulatedScale += value * value;
+                            }
+                        }
+                    }
+                    ret.outputExpected[n][c][h][w] =
+                        input[n][c][h][w] * powf(kappa + accumulatedScale * alpha, -beta);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
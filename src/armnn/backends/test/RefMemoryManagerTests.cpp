@@ -0,0 +1,117 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "backends/RefWorkloadFactory.hpp"
+#include "backends/CpuTensorHandle.hpp"
+#include "Graph.hpp"
+
+#include "test/CreateWorkload.hpp"
+
+namespace
+{
+
+bool Overlaps(const CpuTensorHandle& a, const CpuTensorHandle& b)
+{
+    const uint8_t* beginA = static_cast<const uint8_t*>(a.GetTensor<void>());
+    const uint8_t* beginB = static_cast<const uint8_t*>(b.GetTensor<void>());
+    return beginA < beginB + b.GetTensorInfo().GetNumBytes() && beginB < beginA + a.GetTensorInfo().GetNumBytes();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(RefMemoryManagement)
+
+BOOST_AUTO_TEST_CASE(UnmanagedHandleOwnsItsMemory)
+{
+    RefWorkloadFactory factory;
+    TensorInfo info({ 2, 3 }, DataType::Float32);
+
+    auto handle = factory.CreateTensorHandle(info);
+    handle->Allocate();
+
+    auto cpuHandle = boost::polymorphic_downcast<CpuTensorHandle*>(handle.get());
+    BOOST_TEST(cpuHandle->GetTensor<float>() != nullptr);
+    BOOST_CHECK_THROW(handle->Allocate(), InvalidArgumentException);
+
+    factory.Finalize();
+    BOOST_TEST(factory.GetMemoryManager().GetPlannedBytes() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(NonOverlappingLifetimesShareMemory)
+{
+    RefWorkloadFactory factory;
+    TensorInfo info({ 64, 64 }, DataType::Float32);
+
+    auto a = factory.CreateTensorHandle(info);
+    auto b = factory.CreateTensorHandle(info);
+    auto c = factory.CreateTensorHandle(info);
+
+    // Simulates a chain a -> b -> c, where a is no longer needed once b has been computed.
+    a->Manage();
+    b->Manage();
+    a->Allocate();
+    c->Manage();
+    b->Allocate();
+    c->Allocate();
+
+    factory.Finalize();
+
+    auto& cpuA = *boost::polymorphic_downcast<CpuTensorHandle*>(a.get());
+    auto& cpuB = *boost::polymorphic_downcast<CpuTensorHandle*>(b.get());
+    auto& cpuC = *boost::polymorphic_downcast<CpuTensorHandle*>(c.get());
+
+    BOOST_TEST(cpuA.GetTensor<float>() != nullptr);
+    BOOST_TEST(!Overlaps(cpuA, cpuB));
+    BOOST_TEST(!Overlaps(cpuB, cpuC));
+    BOOST_TEST(cpuA.GetTensor<float>() == cpuC.GetTensor<float>());
+
+    const RefMemoryManager& memoryManager = factory.GetMemoryManager();
+    BOOST_TEST(memoryManager.GetNaiveBytes() == 3 * info.GetNumBytes());
+    BOOST_TEST(memoryManager.GetPlannedBytes() == 2 * info.GetNumBytes());
+}
+
+BOOST_AUTO_TEST_CASE(GraphActivationChainReusesBuffers)
+{
+    Graph graph;
+    RefWorkloadFactory factory;
+
+    TensorInfo info({ 1, 16, 8, 8 }, DataType::Float32);
+    ActivationDescriptor desc;
+
+    Layer* prev = graph.AddLayer<InputLayer>(0, "input");
+    const unsigned int numActivations = 6;
+    for (unsigned int i = 0; i < numActivations; ++i)
+    {
+        Layer* const activation = graph.AddLayer<ActivationLayer>(desc, "activation");
+        Connect(prev, activation, info);
+        prev = activation;
+    }
+    Layer* const output = graph.AddLayer<OutputLayer>(0, "output");
+    Connect(prev, output, info);
+
+    CreateTensorHandles(graph, factory);
+    graph.AllocateDynamicBuffers();
+    factory.Finalize();
+
+    const RefMemoryManager& memoryManager = factory.GetMemoryManager();
+    BOOST_TEST(memoryManager.GetNaiveBytes() == (numActivations + 1) * info.GetNumBytes());
+    BOOST_TEST(memoryManager.GetPlannedBytes() == 2 * info.GetNumBytes());
+
+    // Every layer must read and write distinct memory.
+    for (auto&& layer : graph)
+    {
+        if (layer->GetType() != LayerType::Activation)
+        {
+            continue;
+        }
+        auto& in = *boost::polymorphic_downcast<CpuTensorHandle*>(
+            layer->GetInputSlot(0).GetConnectedOutputSlot()->GetOutputHandler().GetData());
+        auto& out = *boost::polymorphic_downcast<CpuTensorHandle*>(layer->GetOutputHandler().GetData());
+        BOOST_TEST(!Overlaps(in, out));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,148 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "LayerTests.hpp"
+#include "backends/RefWorkloadFactory.hpp"
+#include "backends/RefWorkloads/RefThreadPool.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// Runs the given layer test once on the calling thread only and once sharing the work with a pool, and checks
+// that both runs give exactly the same results.
+template <typename TestFunc, typename... Args>
+void CheckSameResultsWithThreadPool(TestFunc testFunc, Args... args)
+{
+    armnn::RefWorkloadFactory workloadFactory;
+    auto serialResult = testFunc(workloadFactory, args...);
+
+    armnn::RefThreadPool threadPool(4);
+    armnn::ScopedRefThreadPool scopedThreadPool(&threadPool);
+    auto parallelResult = testFunc(workloadFactory, args...);
+
+    BOOST_TEST(serialResult.output == parallelResult.output);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(RefThreading)
+
+BOOST_AUTO_TEST_CASE(ParallelForVisitsEveryIndexOnce)
+{
+    armnn::RefThreadPool threadPool(4);
+    BOOST_TEST(threadPool.GetNumThreads() == 4);
+
+    for (unsigned int size : { 0u, 1u, 3u, 4u, 5u, 1000u })
+    {
+        std::vector<std::atomic<unsigned int>> visits(size + 2);
+        for (auto&& visit : visits)
+        {
+            visit = 0;
+        }
+
+        threadPool.ParallelFor(1, size + 1, [&](unsigned int begin, unsigned int end)
+            {
+                for (unsigned int i = begin; i < end; ++i)
+                {
+                    ++visits[i];
+                }
+            });
+
+        BOOST_TEST(visits.front() == 0);
+        BOOST_TEST(visits.back() == 0);
+        for (unsigned int i = 1; i <= size; ++i)
+        {
+            BOOST_TEST(visits[i] == 1);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForRethrowsExceptions)
+{
+    armnn::RefThreadPool threadPool(4);
+    BOOST_CHECK_THROW(threadPool.ParallelFor(0, 100, [](unsigned int begin, unsigned int end)
+        {
+            if (begin <= 50 && 50 < end)
+            {
+                throw std::runtime_error("failure");
+            }
+        }), std::runtime_error);
+
+    // The pool must remain usable after a failed loop.
+    std::atomic<unsigned int> count(0);
+    threadPool.ParallelFor(0, 100, [&](unsigned int begin, unsigned int end) { count += end - begin; });
+    BOOST_TEST(count == 100);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentLoopsShareThePool)
+{
+    armnn::RefThreadPool threadPool(3);
+
+    const unsigned int numCallers = 4;
+    std::vector<unsigned int> sums(numCallers, 0);
+    std::vector<std::thread> callers;
+    for (unsigned int caller = 0; caller < numCallers; ++caller)
+    {
+        callers.emplace_back([&, caller]()
+            {
+                for (unsigned int iteration = 0; iteration < 50; ++iteration)
+                {
+                    std::atomic<unsigned int> sum(0);
+                    threadPool.ParallelFor(0, 64, [&](unsigned int begin, unsigned int end)
+                        {
+                            for (unsigned int i = begin; i < end; ++i)
+                            {
+                                sum += i;
+                            }
+                        });
+                    sums[caller] += sum;
+                }
+            });
+    }
+    for (auto&& caller : callers)
+    {
+        caller.join();
+    }
+
+    for (unsigned int sum : sums)
+    {
+        BOOST_TEST(sum == 50 * (63 * 64 / 2));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FreeParallelForRunsSeriallyWithoutPool)
+{
+    BOOST_TEST(armnn::ScopedRefThreadPool::GetCurrent() == nullptr);
+
+    const std::thread::id callerId = std::this_thread::get_id();
+    unsigned int numChunks = 0;
+    armnn::ParallelFor(0, 10, [&](unsigned int begin, unsigned int end)
+        {
+            BOOST_TEST((std::this_thread::get_id() == callerId));
+            BOOST_TEST(begin == 0);
+            BOOST_TEST(end == 10);
+            ++numChunks;
+        });
+    BOOST_TEST(numChunks == 1);
+}
+
+BOOST_AUTO_TEST_CASE(KernelsGiveSameResultsWithThreadPool)
+{
+    CheckSameResultsWithThreadPool(SimpleConvolution2d3x5Test, true);
+    CheckSameResultsWithThreadPool(DepthwiseConvolution2dTest, true);
+    CheckSameResultsWithThreadPool(FullyConnectedLargeTest, false);
+    CheckSameResultsWithThreadPool(SimpleMaxPooling2dSize3x3Stride2x4Test, true);
+    CheckSameResultsWithThreadPool(L2Pooling2dSize3Stride1Test);
+    CheckSameResultsWithThreadPool(SimpleNormalizationAcrossTest);
+    CheckSameResultsWithThreadPool(SimpleNormalizationWithinTest);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "backends/RefWorkloads/Addition.hpp"
+#include "backends/RefWorkloads/Multiplication.hpp"
+
+#include <armnn/TypesUtils.hpp>
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<uint8_t> MakeRandomData(size_t size, std::mt19937::result_type seed)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::vector<uint8_t> data(size);
+    for (auto&& value : data)
+    {
+        value = static_cast<uint8_t>(distribution(generator));
+    }
+    return data;
+}
+
+// Checks that the integer kernel gives the same results as computing in float, give or take one quantization step.
+template <typename IntegerKernel, typename FloatOperation>
+void CheckAgainstFloat(const armnn::TensorInfo& inputInfo0,
+                       const armnn::TensorInfo& inputInfo1,
+                       const armnn::TensorInfo& outputInfo,
+                       IntegerKernel integerKernel,
+                       FloatOperation floatOperation)
+{
+    using namespace armnn;
+
+    const std::vector<uint8_t> input0 = MakeRandomData(inputInfo0.GetNumElements(), 0);
+    const std::vector<uint8_t> input1 = MakeRandomData(inputInfo1.GetNumElements(), 1);
+    std::vector<uint8_t> output(outputInfo.GetNumElements());
+
+    integerKernel(inputInfo0, inputInfo1, outputInfo, input0.data(), input1.data(), output.data());
+
+    // The second input is a single element, broadcast to the shape of the first one.
+    BOOST_TEST_REQUIRE(inputInfo1.GetNumElements() == 1);
+    const float value1 = Dequantize(input1[0], inputInfo1.GetQuantizationScale(),
+                                    inputInfo1.GetQuantizationOffset());
+    for (unsigned int i = 0; i < output.size(); ++i)
+    {
+        const float value0 = Dequantize(input0[i], inputInfo0.GetQuantizationScale(),
+                                        inputInfo0.GetQuantizationOffset());
+        const uint8_t expected = Quantize<uint8_t>(floatOperation(value0, value1),
+                                                   outputInfo.GetQuantizationScale(),
+                                                   outputInfo.GetQuantizationOffset());
+        BOOST_TEST(std::abs(static_cast<int>(output[i]) - static_cast<int>(expected)) <= 1,
+                   "at index " << i << ": " << int(output[i]) << " != " << int(expected));
+    }
+}
+
+armnn::TensorInfo MakeInfo(const armnn::TensorShape& shape, float scale, int32_t offset)
+{
+    return armnn::TensorInfo(shape, armnn::DataType::QuantisedAsymm8, scale, offset);
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(RefUint8Kernels)
+
+BOOST_AUTO_TEST_CASE(IntegerAdditionMatchesFloat)
+{
+    const armnn::TensorShape shape({ 2, 3, 4, 5 });
+    const armnn::TensorShape scalar({ 1, 1, 1, 1 });
+
+    CheckAgainstFloat(MakeInfo(shape, 0.1f, 128), MakeInfo(scalar, 0.03f, 10), MakeInfo(shape, 0.15f, 100),
+        [](auto&&... args) { armnn::Addition(args...); },
+        [](float a, float b) { return a + b; });
+
+    CheckAgainstFloat(MakeInfo(shape, 1.0f, 0), MakeInfo(scalar, 7.0f, 200), MakeInfo(shape, 11.0f, 50),
+        [](auto&&... args) { armnn::Addition(args...); },
+        [](float a, float b) { return a + b; });
+}
+
+BOOST_AUTO_TEST_CASE(IntegerMultiplicationMatchesFloat)
+{
+    const armnn::TensorShape shape({ 2, 3, 4, 5 });
+    const armnn::TensorShape scalar({ 1, 1, 1, 1 });
+
+    CheckAgainstFloat(MakeInfo(shape, 0.1f, 128), MakeInfo(scalar, 0.03f, 10), MakeInfo(shape, 0.05f, 100),
+        [](auto&&... args) { armnn::Multiplication(args...); },
+        [](float a, float b) { return a * b; });
+
+    // The output scale is too small for the integer rescaling, which falls back to float.
+    CheckAgainstFloat(MakeInfo(shape, 2.0f, 128), MakeInfo(scalar, 3.0f, 10), MakeInfo(shape, 0.5f, 100),
+        [](auto&&... args) { armnn::Multiplication(args...); },
+        [](float a, float b) { return a * b; });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
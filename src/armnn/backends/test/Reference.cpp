@@ -102,11 +102,25 @@ ARMNN_AUTO_TEST_CASE(ConstantLinearActivationUint8, ConstantLinearActivationUint
 
 ARMNN_AUTO_TEST_CASE(SimpleNormalizationAcross, SimpleNormalizationAcrossTest)
 ARMNN_AUTO_TEST_CASE(SimpleNormalizationWithin, SimpleNormalizationWithinTest)
+ARMNN_AUTO_TEST_CASE(NormalizationAcrossSize5, LocalBrightnessNormalizationTest,
+                     armnn::NormalizationAlgorithmChannel::Across, 5u, 0.75f)
+ARMNN_AUTO_TEST_CASE(NormalizationAcrossSize3, LocalBrightnessNormalizationTest,
+                     armnn::NormalizationAlgorithmChannel::Across, 3u, 1.0f)
+ARMNN_AUTO_TEST_CASE(NormalizationWithinSize3, LocalBrightnessNormalizationTest,
+                     armnn::NormalizationAlgorithmChannel::Within, 3u, 0.75f)
+ARMNN_AUTO_TEST_CASE(NormalizationWithinSize5, LocalBrightnessNormalizationTest,
+                     armnn::NormalizationAlgorithmChannel::Within, 5u, 1.0f)
 
 ARMNN_AUTO_TEST_CASE(SimpleSoftmaxBeta1, SimpleSoftmaxTest, 1.0f)
 ARMNN_AUTO_TEST_CASE(SimpleSoftmaxBeta2, SimpleSoftmaxTest, 2.0f)
 ARMNN_AUTO_TEST_CASE(SimpleSoftmaxBeta1Uint8, SimpleSoftmaxUint8Test, 1.0f)
 ARMNN_AUTO_TEST_CASE(SimpleSoftmaxBeta2Uint8, SimpleSoftmaxUint8Test, 2.0f)
+ARMNN_AUTO_TEST_CASE(SoftmaxAxis0, SoftmaxAxisTest, 0)
+ARMNN_AUTO_TEST_CASE(SoftmaxAxis1, SoftmaxAxisTest, 1)
+ARMNN_AUTO_TEST_CASE(SoftmaxAxisLast, SoftmaxAxisTest, -1)
+ARMNN_AUTO_TEST_CASE(SoftmaxAxis0Uint8, SoftmaxAxisUint8Test, 0)
+ARMNN_AUTO_TEST_CASE(SoftmaxAxis1Uint8, SoftmaxAxisUint8Test, 1)
+ARMNN_AUTO_TEST_CASE(SoftmaxAxisLastUint8, SoftmaxAxisUint8Test, -1)
 
 ARMNN_AUTO_TEST_CASE(SimpleSigmoid, SimpleSigmoidTest)
 ARMNN_AUTO_TEST_CASE(SimpleSigmoidUint8, SimpleSigmoidUint8Test)
@@ -230,4 +244,12 @@ ARMNN_AUTO_TEST_CASE(SimpleConvertFp16ToFp32, SimpleConvertFp16ToFp32Test)
 // Convert from Float32 to Float16
 ARMNN_AUTO_TEST_CASE(SimpleConvertFp32ToFp16, SimpleConvertFp32ToFp16Test)
 
+// Lstm
+ARMNN_AUTO_TEST_CASE(LstmLayerFloat32WithCifgWithPeepholeNoProjection,
+                     LstmLayerFloat32WithCifgWithPeepholeNoProjectionTest)
+ARMNN_AUTO_TEST_CASE(LstmLayerFloat32NoCifgNoPeepholeNoProjection,
+                     LstmLayerFloat32NoCifgNoPeepholeNoProjectionTest)
+ARMNN_AUTO_TEST_CASE(LstmLayerFloat32NoCifgWithPeepholeWithProjection,
+                     LstmLayerFloat32NoCifgWithPeepholeWithProjectionTest)
+
 BOOST_AUTO_TEST_SUITE_END()
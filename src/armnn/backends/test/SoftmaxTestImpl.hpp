@@ -16,6 +16,7 @@
 #include "backends/WorkloadFactory.hpp"
 
 #include <algorithm>
+#include <cmath>
 
 template<typename T>
 LayerTestResult<T, 2> SimpleSoftmaxTestImpl(armnn::IWorkloadFactory& workloadFactory, float beta)
@@ -151,3 +152,77 @@ LayerTestResult<T, 2> CompareSoftmaxTestImpl(armnn::IWorkloadFactory& workloadFa
 
     return ret;
 }
+
+template<typename T>
+LayerTestResult<T, 4> SoftmaxAxisTestImpl(armnn::IWorkloadFactory& workloadFactory, int axis)
+{
+    const float beta = 1.5f;
+    const unsigned int shape[] = { 2, 3, 4, 5 };
+
+    armnn::TensorInfo inputTensorInfo(4, shape, armnn::GetDataType<T>());
+    inputTensorInfo.SetQuantizationScale(1.f / 16.f);
+    inputTensorInfo.SetQuantizationOffset(128);
+
+    armnn::TensorInfo outputTensorInfo(4, shape, armnn::GetDataType<T>());
+    outputTensorInfo.SetQuantizationScale(1.f / 256.f);
+    outputTensorInfo.SetQuantizationOffset(0);
+
+    LayerTestResult<T, 4> ret(outputTensorInfo);
+    auto input = MakeRandomTensor<T, 4>(inputTensorInfo, 0xF00D, -4.0f, 4.0f);
+
+    std::unique_ptr<armnn::ITensorHandle> inputHandle = workloadFactory.CreateTensorHandle(inputTensorInfo);
+    std::unique_ptr<armnn::ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputTensorInfo);
+
+    armnn::SoftmaxQueueDescriptor data;
+    data.m_Parameters.m_Beta = beta;
+    data.m_Parameters.m_Axis = axis;
+
+    armnn::WorkloadInfo info;
+    AddInputToWorkload(data, info, inputTensorInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputTensorInfo, outputHandle.get());
+
+    std::unique_ptr<armnn::IWorkload> workload = workloadFactory.CreateSoftmax(data, info);
+
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+    CopyDataToITensorHandle(inputHandle.get(), &input[0][0][0][0]);
+
+    workloadFactory.Finalize();
+    workload->Execute();
+
+    CopyDataFromITensorHandle(&ret.output[0][0][0][0], outputHandle.get());
+
+    // The softmax of every element, as the reciprocal of the sum of the exponentials of the differences of the other
+    // elements along the axis to it.
+    const unsigned int axisIndex = axis < 0 ? 4 - static_cast<unsigned int>(-axis) : static_cast<unsigned int>(axis);
+    const unsigned int axisSize = shape[axisIndex];
+    unsigned int stride = 1;
+    for (unsigned int d = axisIndex + 1; d < 4; ++d)
+    {
+        stride *= shape[d];
+    }
+
+    const T* inputData = input.data();
+    std::vector<float> expected(inputTensorInfo.GetNumElements());
+    for (unsigned int i = 0; i < expected.size(); ++i)
+    {
+        const unsigned int first = i - ((i / stride) % axisSize) * stride;
+        const float value = SelectiveDequantize(inputData[i], inputTensorInfo.GetQuantizationScale(),
+                                                inputTensorInfo.GetQuantizationOffset());
+        float sum = 0.0f;
+        for (unsigned int k = 0; k < axisSize; ++k)
+        {
+            const float other = SelectiveDequantize(inputData[first + k * stride],
+                                                    inputTensorInfo.GetQuantizationScale(),
+                                                    inputTensorInfo.GetQuantizationOffset());
+            sum += std::exp((other - value) * beta);
+        }
+        expected[i] = 1.0f / sum;
+    }
+
+    ret.outputExpected = MakeTensor<T, 4>(outputTensorInfo,
+        QuantizedVector<T>(outputTensorInfo.GetQuantizationScale(), outputTensorInfo.GetQuantizationOffset(),
+                           expected));
+
+    return ret;
+}
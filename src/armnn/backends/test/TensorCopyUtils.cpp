@@ -30,7 +30,7 @@ void CopyDataToITensorHandle(armnn::ITensorHandle* tensorHandle, const void* mem
     {
         case armnn::ITensorHandle::Cpu:
         {
-            auto handle = boost::polymorphic_downcast<armnn::ScopedCpuTensorHandle*>(tensorHandle);
+            auto handle = boost::polymorphic_downcast<armnn::CpuTensorHandle*>(tensorHandle);
             memcpy(handle->GetTensor<void>(), mem, handle->GetTensorInfo().GetNumBytes());
             break;
         }
@@ -94,7 +94,7 @@ void CopyDataFromITensorHandle(void* mem, const armnn::ITensorHandle* tensorHand
     {
         case armnn::ITensorHandle::Cpu:
         {
-            auto handle = boost::polymorphic_downcast<const armnn::ScopedCpuTensorHandle*>(tensorHandle);
+            auto handle = boost::polymorphic_downcast<const armnn::CpuTensorHandle*>(tensorHandle);
             memcpy(mem, handle->GetTensor<void>(), handle->GetTensorInfo().GetNumBytes());
             break;
         }
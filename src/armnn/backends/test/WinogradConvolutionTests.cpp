@@ -0,0 +1,212 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/Activation.hpp"
+#include "backends/RefWorkloads/ConvImpl.hpp"
+#include "backends/RefWorkloads/RefThreadPool.hpp"
+#include "backends/RefWorkloads/WinogradConvolution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+std::vector<float> MakeRandomData(size_t size)
+{
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(size));
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    std::vector<float> data(size);
+    for (auto&& value : data)
+    {
+        value = distribution(generator);
+    }
+    return data;
+}
+
+armnn::TensorShape MakeShape(armnn::DataLayout dataLayout, unsigned int batches, unsigned int channels,
+                             unsigned int height, unsigned int width)
+{
+    return dataLayout == armnn::DataLayout::NHWC ? armnn::TensorShape({ batches, height, width, channels })
+                                                 : armnn::TensorShape({ batches, channels, height, width });
+}
+
+// The largest error allowed for each size of output tiles, relative to the largest magnitude of the output, which
+// also covers the rounding errors of ConvImpl() for up to 576 products per output. The rounding errors of the
+// transforms of F(4x4, 3x3), whose coefficients range from 1/24 to 8, are an order of magnitude larger than those of
+// F(2x2, 3x3): up to about 1e-5 and 1e-6 of the output in these tests.
+float GetTolerance(unsigned int outputTileSize)
+{
+    return outputTileSize == 4 ? 5e-5f : 5e-6f;
+}
+
+// Checks that WinogradConvolution, with the given size of output tiles, gives the same results as ConvImpl within
+// the tolerance, with the ReLu activation applied afterwards when withActivation is true.
+void CheckConvolution(unsigned int outputTileSize, armnn::DataLayout dataLayout, unsigned int batchSize,
+                      unsigned int channelsInput, unsigned int heightInput, unsigned int widthInput,
+                      unsigned int channelsOutput, unsigned int padBefore, unsigned int padAfter,
+                      bool biasEnabled, bool withActivation = false)
+{
+    using namespace armnn;
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_PadLeft     = padBefore;
+    descriptor.m_PadRight    = padAfter;
+    descriptor.m_PadTop      = padBefore;
+    descriptor.m_PadBottom   = padAfter;
+    descriptor.m_StrideX     = 1;
+    descriptor.m_StrideY     = 1;
+    descriptor.m_BiasEnabled = biasEnabled;
+    descriptor.m_DataLayout  = dataLayout;
+
+    const unsigned int heightOutput = heightInput + padBefore + padAfter - 2;
+    const unsigned int widthOutput  = widthInput + padBefore + padAfter - 2;
+
+    const TensorInfo inputInfo(MakeShape(dataLayout, batchSize, channelsInput, heightInput, widthInput),
+                               DataType::Float32);
+    const TensorInfo outputInfo(MakeShape(dataLayout, batchSize, channelsOutput, heightOutput, widthOutput),
+                                DataType::Float32);
+    const TensorInfo filterInfo(MakeShape(dataLayout, channelsOutput, channelsInput, 3, 3), DataType::Float32);
+
+    std::vector<float> input  = MakeRandomData(inputInfo.GetNumElements());
+    std::vector<float> filter = MakeRandomData(filterInfo.GetNumElements());
+    std::vector<float> bias   = MakeRandomData(channelsOutput);
+    std::vector<float> expectedOutput(outputInfo.GetNumElements());
+    std::vector<float> actualOutput(outputInfo.GetNumElements());
+
+    PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+    PassthroughCpuTensorHandle outputHandle(outputInfo, expectedOutput.data());
+    Convolution2dQueueDescriptor queueDescriptor;
+    queueDescriptor.m_Parameters = descriptor;
+    queueDescriptor.m_Inputs.push_back(&inputHandle);
+    queueDescriptor.m_Outputs.push_back(&outputHandle);
+
+    const float* biasData = biasEnabled ? bias.data() : nullptr;
+    ConvImpl<Convolution2dQueueDescriptor, float, float, float>(queueDescriptor, input.data(), 0.0f, 0,
+        filter.data(), 0.0f, 0, biasData, expectedOutput.data(), 0.0f, 0, filterInfo);
+
+    ActivationDescriptor activation;
+    activation.m_Function = ActivationFunction::ReLu;
+    if (withActivation)
+    {
+        for (auto&& value : expectedOutput)
+        {
+            value = std::max(value, 0.0f);
+        }
+    }
+
+    BOOST_TEST_REQUIRE(WinogradConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor));
+    WinogradConvolution convolution(inputInfo, outputInfo, filterInfo, filter.data(), descriptor, outputTileSize);
+    BOOST_TEST(convolution.GetOutputTileSize() == outputTileSize);
+    convolution.Execute(input.data(), biasData, actualOutput.data(), withActivation ? &activation : nullptr);
+
+    float maxMagnitude = 0.0f;
+    float maxError = 0.0f;
+    for (size_t i = 0; i < expectedOutput.size(); ++i)
+    {
+        maxMagnitude = std::max(maxMagnitude, std::fabs(expectedOutput[i]));
+        maxError = std::max(maxError, std::fabs(actualOutput[i] - expectedOutput[i]));
+    }
+    BOOST_TEST(maxError <= GetTolerance(outputTileSize) * maxMagnitude,
+               "F(" << outputTileSize << "x" << outputTileSize << ", 3x3): error " << maxError
+               << " for outputs up to " << maxMagnitude);
+}
+
+// Checks convolutions with both sizes of output tiles in the given data layout.
+void CheckConvolutions(armnn::DataLayout dataLayout)
+{
+    for (unsigned int outputTileSize : { 2u, 4u })
+    {
+        // Padded as in VGG, with outputs which are not multiples of the tiles.
+        CheckConvolution(outputTileSize, dataLayout, 1, 8, 9, 11, 5, 1, 1, true);
+        // Unpadded, with batches, more channels and no bias.
+        CheckConvolution(outputTileSize, dataLayout, 2, 32, 14, 13, 16, 0, 0, false);
+        // Asymmetric padding, and enough tiles and channels for several blocks.
+        CheckConvolution(outputTileSize, dataLayout, 1, 64, 40, 41, 64, 0, 1, true);
+        // Outputs smaller than a tile.
+        CheckConvolution(outputTileSize, dataLayout, 1, 8, 3, 4, 4, 0, 0, true);
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefWinogradConvolution)
+
+BOOST_AUTO_TEST_CASE(WinogradConvolutionMatchesConvImplNchw)
+{
+    CheckConvolutions(armnn::DataLayout::NCHW);
+}
+
+BOOST_AUTO_TEST_CASE(WinogradConvolutionMatchesConvImplNhwc)
+{
+    CheckConvolutions(armnn::DataLayout::NHWC);
+}
+
+BOOST_AUTO_TEST_CASE(WinogradConvolutionWithActivation)
+{
+    CheckConvolution(2, armnn::DataLayout::NCHW, 1, 16, 12, 12, 8, 1, 1, true, true);
+    CheckConvolution(4, armnn::DataLayout::NHWC, 1, 16, 12, 12, 8, 1, 1, true, true);
+}
+
+BOOST_AUTO_TEST_CASE(WinogradConvolutionWithThreadPool)
+{
+    armnn::RefThreadPool threadPool(3);
+    armnn::ScopedRefThreadPool scopedThreadPool(&threadPool);
+
+    CheckConvolution(4, armnn::DataLayout::NCHW, 2, 64, 40, 41, 64, 0, 1, true);
+    CheckConvolution(2, armnn::DataLayout::NHWC, 2, 64, 40, 41, 64, 0, 1, true);
+}
+
+BOOST_AUTO_TEST_CASE(OutputTileSizeIsChosenFromTheOutputSize)
+{
+    armnn::Convolution2dDescriptor descriptor;
+    descriptor.m_StrideX = 1;
+    descriptor.m_StrideY = 1;
+    const armnn::TensorInfo filterInfo({ 8, 8, 3, 3 }, armnn::DataType::Float32);
+    const std::vector<float> filter(filterInfo.GetNumElements(), 1.0f);
+
+    // 56x56 outputs are covered by 4x4 tiles with no waste, 2x2 outputs by a single 2x2 tile.
+    const armnn::TensorInfo largeInputInfo({ 1, 8, 58, 58 }, armnn::DataType::Float32);
+    const armnn::TensorInfo largeOutputInfo({ 1, 8, 56, 56 }, armnn::DataType::Float32);
+    BOOST_TEST(armnn::WinogradConvolution(largeInputInfo, largeOutputInfo, filterInfo, filter.data(),
+                                          descriptor).GetOutputTileSize() == 4);
+
+    const armnn::TensorInfo smallInputInfo({ 1, 8, 4, 4 }, armnn::DataType::Float32);
+    const armnn::TensorInfo smallOutputInfo({ 1, 8, 2, 2 }, armnn::DataType::Float32);
+    BOOST_TEST(armnn::WinogradConvolution(smallInputInfo, smallOutputInfo, filterInfo, filter.data(),
+                                          descriptor).GetOutputTileSize() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(StridedConvolutionsAreNotSupported)
+{
+    const armnn::TensorInfo inputInfo({ 1, 8, 9, 9 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 8, 4, 4 }, armnn::DataType::Float32);
+    const armnn::TensorInfo filterInfo({ 8, 8, 3, 3 }, armnn::DataType::Float32);
+
+    armnn::Convolution2dDescriptor descriptor;
+    descriptor.m_StrideX = 2;
+    descriptor.m_StrideY = 2;
+    BOOST_TEST(!armnn::WinogradConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor));
+}
+
+BOOST_AUTO_TEST_CASE(ConvolutionsOfImagesAreNotSupported)
+{
+    const armnn::TensorInfo inputInfo({ 1, 3, 9, 9 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 16, 7, 7 }, armnn::DataType::Float32);
+    const armnn::TensorInfo filterInfo({ 16, 3, 3, 3 }, armnn::DataType::Float32);
+
+    armnn::Convolution2dDescriptor descriptor;
+    descriptor.m_StrideX = 1;
+    descriptor.m_StrideY = 1;
+    BOOST_TEST(!armnn::WinogradConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,6 +5,7 @@
 #include "Convolution2dLayer.hpp"
 
 #include "LayerCloneBase.hpp"
+#include "DataLayoutIndexed.hpp"
 
 #include <armnn/TypesUtils.hpp>
 #include <backends/CpuTensorHandle.hpp>
@@ -31,6 +32,7 @@ std::unique_ptr<IWorkload> Convolution2dLayer::CreateWorkload(const Graph& graph
         BOOST_ASSERT_MSG(m_Bias != nullptr, "Convolution2dLayer: Bias data should not be null.");
         descriptor.m_Bias = m_Bias.get();
     }
+    descriptor.m_FusedActivation = m_FusedActivation.get();
     return factory.CreateConvolution2d(descriptor, PrepInfoAndDesc(descriptor, graph));
 }
 
@@ -44,6 +46,7 @@ Convolution2dLayer* Convolution2dLayer::Clone(Graph& graph) const
     {
         layer->m_Bias = m_Bias ? std::make_unique<ScopedCpuTensorHandle>(*m_Bias) : nullptr;
     }
+    layer->m_FusedActivation = m_FusedActivation ? std::make_unique<ActivationDescriptor>(*m_FusedActivation) : nullptr;
 
     return std::move(layer);
 }
@@ -57,22 +60,25 @@ std::vector<TensorShape> Convolution2dLayer::InferOutputShapes(const std::vector
     // If we support multiple batch dimensions in the future, then this assert will need to change.
     BOOST_ASSERT_MSG(inputShape.GetNumDimensions() == 4, "Convolutions will always have 4D input.");
 
-    unsigned int inWidth = inputShape[3];
-    unsigned int inHeight = inputShape[2];
+    // The filter is laid out like the data, with the output channels first.
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+
+    unsigned int inWidth = inputShape[dataLayout.GetWidthIndex()];
+    unsigned int inHeight = inputShape[dataLayout.GetHeightIndex()];
     unsigned int inBatchSize = inputShape[0];
 
-    unsigned int filterWidth = filterShape[3];
+    unsigned int filterWidth = filterShape[dataLayout.GetWidthIndex()];
     unsigned int readWidth = (inWidth + m_Param.m_PadLeft + m_Param.m_PadRight) - (filterWidth);
     unsigned int outWidth =  1+(readWidth / m_Param.m_StrideX);
 
-    unsigned int filterHeight = filterShape[2];
+    unsigned int filterHeight = filterShape[dataLayout.GetHeightIndex()];
     unsigned int readHeight = (inHeight + m_Param.m_PadTop + m_Param.m_PadBottom) - (filterHeight);
     unsigned int outHeight = 1+(readHeight / m_Param.m_StrideY);
 
     unsigned int outChannels = filterShape[0];
     unsigned int outBatchSize = inBatchSize;
 
-    return std::vector<TensorShape>({ TensorShape({outBatchSize, outChannels, outHeight, outWidth})});
+    return std::vector<TensorShape>({ dataLayout.GetShape(outBatchSize, outChannels, outHeight, outWidth) });
 }
 
 void Convolution2dLayer::ValidateTensorShapesFromInputs()
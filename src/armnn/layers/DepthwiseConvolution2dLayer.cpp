@@ -5,6 +5,7 @@
 #include "DepthwiseConvolution2dLayer.hpp"
 
 #include "LayerCloneBase.hpp"
+#include "DataLayoutIndexed.hpp"
 
 #include <armnn/TypesUtils.hpp>
 #include <backends/CpuTensorHandle.hpp>
@@ -33,6 +34,10 @@ std::unique_ptr<IWorkload> DepthwiseConvolution2dLayer::CreateWorkload(const Gra
         BOOST_ASSERT_MSG(m_Bias != nullptr, "DepthwiseConvolution2dLayer: Bias data should not be null.");
         descriptor.m_Bias = m_Bias.get();
     }
+    descriptor.m_FusedActivation = m_FusedActivation.get();
+    descriptor.m_PointwiseWeight = m_PointwiseWeight.get();
+    descriptor.m_PointwiseBias = m_PointwiseBias.get();
+    descriptor.m_PointwiseActivation = m_PointwiseActivation.get();
     return factory.CreateDepthwiseConvolution2d(descriptor, PrepInfoAndDesc(descriptor, graph));
 }
 
@@ -45,6 +50,12 @@ DepthwiseConvolution2dLayer* DepthwiseConvolution2dLayer::Clone(Graph& graph) co
     {
         layer->m_Bias = m_Bias ? std::make_unique<ScopedCpuTensorHandle>(*m_Bias) : nullptr;
     }
+    layer->m_FusedActivation = m_FusedActivation ? std::make_unique<ActivationDescriptor>(*m_FusedActivation) : nullptr;
+    layer->m_PointwiseWeight =
+        m_PointwiseWeight ? std::make_unique<ScopedCpuTensorHandle>(*m_PointwiseWeight) : nullptr;
+    layer->m_PointwiseBias = m_PointwiseBias ? std::make_unique<ScopedCpuTensorHandle>(*m_PointwiseBias) : nullptr;
+    layer->m_PointwiseActivation =
+        m_PointwiseActivation ? std::make_unique<ActivationDescriptor>(*m_PointwiseActivation) : nullptr;
 
     return std::move(layer);
 }
@@ -58,23 +69,28 @@ DepthwiseConvolution2dLayer::InferOutputShapes(const std::vector<TensorShape>& i
 
     BOOST_ASSERT_MSG(inputShape.GetNumDimensions() == 4, "Convolutions will always have 4D input.");
 
-    unsigned int inWidth = inputShape[3];
-    unsigned int inHeight = inputShape[2];
+    // The filter is laid out like the data, with the depth multiplier first.
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+
+    unsigned int inWidth = inputShape[dataLayout.GetWidthIndex()];
+    unsigned int inHeight = inputShape[dataLayout.GetHeightIndex()];
     unsigned int inBatchSize = inputShape[0];
 
-    unsigned int filterWidth = filterShape[3];
+    unsigned int filterWidth = filterShape[dataLayout.GetWidthIndex()];
     unsigned int readWidth = (inWidth + m_Param.m_PadLeft + m_Param.m_PadRight) - (filterWidth);
     unsigned int outWidth =  1+(readWidth / m_Param.m_StrideX);
 
-    unsigned int filterHeight = filterShape[2];
+    unsigned int filterHeight = filterShape[dataLayout.GetHeightIndex()];
     unsigned int readHeight = (inHeight + m_Param.m_PadTop + m_Param.m_PadBottom) - (filterHeight);
     unsigned int outHeight = 1+(readHeight / m_Param.m_StrideY);
     unsigned int depthMultiplier = filterShape[0];
 
-    unsigned int outChannels = filterShape[1]*depthMultiplier;
+    // A fused pointwise convolution outputs as many channels as it has filters.
+    unsigned int outChannels = m_PointwiseWeight ? m_PointwiseWeight->GetTensorInfo().GetShape()[0]
+                                                 : filterShape[dataLayout.GetChannelsIndex()]*depthMultiplier;
     unsigned int outBatchSize = inBatchSize;
 
-    return std::vector<TensorShape>({ TensorShape({outBatchSize, outChannels, outHeight, outWidth})});
+    return std::vector<TensorShape>({ dataLayout.GetShape(outBatchSize, outChannels, outHeight, outWidth) });
 }
 
 void DepthwiseConvolution2dLayer::ValidateTensorShapesFromInputs()
@@ -99,7 +115,7 @@ void DepthwiseConvolution2dLayer::ValidateTensorShapesFromInputs()
 
 Layer::ConstantTensors DepthwiseConvolution2dLayer::GetConstantTensorsByRef()
 {
-    return {m_Weight, m_Bias};
+    return {m_Weight, m_Bias, m_PointwiseWeight, m_PointwiseBias};
 }
 
 } // namespace armnn
@@ -16,6 +16,14 @@ class DepthwiseConvolution2dLayer : public LayerWithParameters<DepthwiseConvolut
 public:
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    /// Activation applied to the output by the workload, set by the FuseActivation optimizations.
+    std::unique_ptr<ActivationDescriptor> m_FusedActivation;
+    /// Filter, bias and activation of a pointwise convolution applied to the output by the workload, set by the
+    /// FusePointwiseIntoDepthwiseConvolution2d optimization. The layer then outputs the result of the pointwise
+    /// convolution.
+    std::unique_ptr<ScopedCpuTensorHandle> m_PointwiseWeight;
+    std::unique_ptr<ScopedCpuTensorHandle> m_PointwiseBias;
+    std::unique_ptr<ActivationDescriptor> m_PointwiseActivation;
 
     virtual std::unique_ptr<IWorkload> CreateWorkload(const Graph& graph,
                                                       const IWorkloadFactory& factory) const override;
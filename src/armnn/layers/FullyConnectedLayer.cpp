@@ -33,6 +33,7 @@ std::unique_ptr<IWorkload> FullyConnectedLayer::CreateWorkload(const Graph& grap
         BOOST_ASSERT_MSG(m_Bias != nullptr, "FullyConnectedLayer: Bias data should not be null.");
         descriptor.m_Bias = m_Bias.get();
     }
+    descriptor.m_FusedActivation = m_FusedActivation.get();
     return factory.CreateFullyConnected(descriptor, PrepInfoAndDesc(descriptor, graph));
 }
 
@@ -45,6 +46,7 @@ FullyConnectedLayer* FullyConnectedLayer::Clone(Graph& graph) const
     {
         layer->m_Bias = m_Bias ? std::make_unique<ScopedCpuTensorHandle>(*m_Bias) : nullptr;
     }
+    layer->m_FusedActivation = m_FusedActivation ? std::make_unique<ActivationDescriptor>(*m_FusedActivation) : nullptr;
 
     return std::move(layer);
 }
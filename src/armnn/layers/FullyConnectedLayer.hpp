@@ -16,6 +16,8 @@ class FullyConnectedLayer : public LayerWithParameters<FullyConnectedDescriptor>
 public:
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
+    /// Activation applied to the output by the workload, set by the FuseActivation optimizations.
+    std::unique_ptr<ActivationDescriptor> m_FusedActivation;
 
     virtual std::unique_ptr<IWorkload> CreateWorkload(const Graph&            graph,
                                                       const IWorkloadFactory& factory) const override;
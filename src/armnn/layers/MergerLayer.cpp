@@ -57,9 +57,17 @@ void MergerLayer::CreateTensorHandles(Graph& graph, const IWorkloadFactory& fact
             {
                 OutputSlot* slot = currentLayer->GetInputSlot(i).GetConnectedOutputSlot();
                 OutputHandler& outputHandler = slot->GetOutputHandler();
-                outputHandler.SetData(factory.CreateSubTensorHandle(*parentTensor,
-                                                                    outputHandler.GetTensorInfo().GetShape(),
-                                                                    currentLayer->m_Param.GetViewOrigin(i)));
+                std::unique_ptr<ITensorHandle> subTensor =
+                    factory.CreateSubTensorHandle(*parentTensor,
+                                                  outputHandler.GetTensorInfo().GetShape(),
+                                                  currentLayer->m_Param.GetViewOrigin(i));
+
+                //Inputs the factory cannot make views of keep their own tensors, which the workload copies from.
+                if (!subTensor)
+                {
+                    continue;
+                }
+                outputHandler.SetData(std::move(subTensor));
 
                 Layer& inputLayer = slot->GetOwningLayer();
                 if (inputLayer.GetType() == LayerType::Merger)
@@ -5,6 +5,7 @@
 #include "Pooling2dLayer.hpp"
 
 #include "LayerCloneBase.hpp"
+#include "DataLayoutIndexed.hpp"
 
 #include <armnn/TypesUtils.hpp>
 #include <backends/WorkloadData.hpp>
@@ -38,9 +39,11 @@ std::vector<TensorShape> Pooling2dLayer::InferOutputShapes(const std::vector<Ten
     BOOST_ASSERT_MSG(inputShape.GetNumDimensions() == 4, "Pooling2dLayer will always have 4D input.");
 
 
-    unsigned int inWidth = inputShape[3];
-    unsigned int inHeight = inputShape[2];
-    unsigned int inChannels = inputShape[1];
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+
+    unsigned int inWidth = inputShape[dataLayout.GetWidthIndex()];
+    unsigned int inHeight = inputShape[dataLayout.GetHeightIndex()];
+    unsigned int inChannels = inputShape[dataLayout.GetChannelsIndex()];
     unsigned int inBatchSize = inputShape[0];
 
     bool isGlobalPooling = (m_Param.m_StrideX==0 && m_Param.m_StrideY==0);
@@ -88,7 +91,7 @@ std::vector<TensorShape> Pooling2dLayer::InferOutputShapes(const std::vector<Ten
     unsigned int outChannels = inChannels;
     unsigned int outBatchSize = inBatchSize;
 
-    return std::vector<TensorShape>({ TensorShape({outBatchSize, outChannels, outHeight, outWidth}) });
+    return std::vector<TensorShape>({ dataLayout.GetShape(outBatchSize, outChannels, outHeight, outWidth) });
 }
 
 void Pooling2dLayer::ValidateTensorShapesFromInputs()
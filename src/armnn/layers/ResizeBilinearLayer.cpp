@@ -5,6 +5,7 @@
 #include "ResizeBilinearLayer.hpp"
 
 #include "LayerCloneBase.hpp"
+#include "DataLayoutIndexed.hpp"
 
 #include <armnn/TypesUtils.hpp>
 #include <backends/WorkloadData.hpp>
@@ -35,12 +36,14 @@ std::vector<TensorShape> ResizeBilinearLayer::InferOutputShapes(const std::vecto
     BOOST_ASSERT(inputShapes.size() == 1);
     const TensorShape& inputShape = inputShapes[0];
 
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Param.m_DataLayout);
+
     unsigned int outWidth = m_Param.m_TargetWidth;
     unsigned int outHeight = m_Param.m_TargetHeight;
-    unsigned int outChannels = inputShape[1];
+    unsigned int outChannels = inputShape[dataLayout.GetChannelsIndex()];
     unsigned int outBatch = inputShape[0];
 
-    return std::vector<TensorShape>({ TensorShape({outBatch, outChannels, outHeight, outWidth}) });
+    return std::vector<TensorShape>({ dataLayout.GetShape(outBatch, outChannels, outHeight, outWidth) });
 }
 
 void ResizeBilinearLayer::ValidateTensorShapesFromInputs()
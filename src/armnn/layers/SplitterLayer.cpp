@@ -44,9 +44,20 @@ void SplitterLayer::CreateTensorHandles(Graph& graph, const IWorkloadFactory& fa
         //Creates the outputs as subtensors of the input.
         for (unsigned int i = 0; i < m_Param.GetNumViews(); ++i)
         {
-            m_OutputHandlers[i].SetData(factory.CreateSubTensorHandle(*inputData,
-                                                                      m_OutputHandlers[i].GetTensorInfo().GetShape(),
-                                                                      m_Param.GetViewOrigin(i)));
+            std::unique_ptr<ITensorHandle> subTensor =
+                factory.CreateSubTensorHandle(*inputData,
+                                              m_OutputHandlers[i].GetTensorInfo().GetShape(),
+                                              m_Param.GetViewOrigin(i));
+
+            //Views the factory cannot represent get their own tensors, which the workload copies into.
+            if (subTensor)
+            {
+                m_OutputHandlers[i].SetData(std::move(subTensor));
+            }
+            else
+            {
+                m_OutputHandlers[i].CreateTensorHandles(factory);
+            }
         }
     }
     else
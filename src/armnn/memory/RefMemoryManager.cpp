@@ -0,0 +1,172 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefMemoryManager.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+
+#include <boost/assert.hpp>
+#include <boost/log/trivial.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace armnn
+{
+
+namespace
+{
+
+size_t AlignUp(size_t numBytes, size_t alignment)
+{
+    return (numBytes + alignment - 1) / alignment * alignment;
+}
+
+} // anonymous namespace
+
+RefMemoryManager::RefMemoryManager()
+    : m_Clock(0)
+    , m_Slab(nullptr)
+    , m_SlabSize(0)
+    , m_Planned(false)
+{
+}
+
+RefMemoryManager::~RefMemoryManager()
+{
+    ReleaseSlab();
+}
+
+void RefMemoryManager::StartLifetime(ManagedCpuTensorHandle* handle, size_t numBytes)
+{
+    BOOST_ASSERT(handle);
+    BOOST_ASSERT_MSG(m_ElementIndices.find(handle) == m_ElementIndices.end(),
+                     "Lifetime of tensor handle has already been started");
+
+    m_ElementIndices[handle] = m_Elements.size();
+    m_Elements.push_back({ handle, numBytes, m_Clock++, std::numeric_limits<unsigned int>::max(), 0 });
+    m_Planned = false;
+}
+
+void RefMemoryManager::EndLifetime(ManagedCpuTensorHandle* handle)
+{
+    auto it = m_ElementIndices.find(handle);
+    BOOST_ASSERT_MSG(it != m_ElementIndices.end(), "Lifetime of tensor handle has not been started");
+
+    m_Elements[it->second].m_End = m_Clock++;
+}
+
+void RefMemoryManager::Forget(ManagedCpuTensorHandle* handle)
+{
+    auto it = m_ElementIndices.find(handle);
+    if (it == m_ElementIndices.end())
+    {
+        return;
+    }
+
+    // Swaps the element to remove with the last one, so the indices of the other elements stay valid.
+    const size_t index = it->second;
+    m_ElementIndices.erase(it);
+    if (index != m_Elements.size() - 1)
+    {
+        m_Elements[index] = m_Elements.back();
+        m_ElementIndices[m_Elements[index].m_Handle] = index;
+    }
+    m_Elements.pop_back();
+}
+
+size_t RefMemoryManager::GetNaiveBytes() const
+{
+    return std::accumulate(m_Elements.begin(), m_Elements.end(), static_cast<size_t>(0),
+        [](size_t sum, const Element& element)
+        {
+            return sum + AlignUp(element.m_NumBytes, ms_Alignment);
+        });
+}
+
+void RefMemoryManager::Finalize()
+{
+    if (m_Planned)
+    {
+        return;
+    }
+
+    // Places the biggest tensors first: each one goes at the lowest offset that does not collide with any
+    // already placed tensor whose lifetime overlaps with its own.
+    std::vector<Element*> order;
+    order.reserve(m_Elements.size());
+    for (auto&& element : m_Elements)
+    {
+        order.push_back(&element);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const Element* a, const Element* b)
+        {
+            return a->m_NumBytes > b->m_NumBytes;
+        });
+
+    size_t slabSize = 0;
+    std::vector<const Element*> placed;
+    std::vector<const Element*> conflicts;
+    placed.reserve(order.size());
+    for (Element* element : order)
+    {
+        conflicts.clear();
+        for (const Element* other : placed)
+        {
+            if (element->m_Start <= other->m_End && other->m_Start <= element->m_End)
+            {
+                conflicts.push_back(other);
+            }
+        }
+        std::sort(conflicts.begin(), conflicts.end(), [](const Element* a, const Element* b)
+            {
+                return a->m_Offset < b->m_Offset;
+            });
+
+        const size_t alignedSize = AlignUp(element->m_NumBytes, ms_Alignment);
+        size_t offset = 0;
+        for (const Element* other : conflicts)
+        {
+            if (offset + alignedSize <= other->m_Offset)
+            {
+                break;
+            }
+            offset = std::max(offset, other->m_Offset + AlignUp(other->m_NumBytes, ms_Alignment));
+        }
+
+        element->m_Offset = offset;
+        slabSize = std::max(slabSize, offset + alignedSize);
+        placed.push_back(element);
+    }
+
+    if (slabSize != m_SlabSize)
+    {
+        ReleaseSlab();
+        if (slabSize > 0)
+        {
+            m_Slab = ::operator new(slabSize);
+        }
+        m_SlabSize = slabSize;
+    }
+
+    for (auto&& element : m_Elements)
+    {
+        element.m_Handle->SetManagedMemory(static_cast<uint8_t*>(m_Slab) + element.m_Offset);
+    }
+
+    m_Planned = true;
+
+    BOOST_LOG_TRIVIAL(debug) << "RefMemoryManager: " << m_Elements.size() << " tensors planned into "
+                             << m_SlabSize << " bytes (" << GetNaiveBytes() << " bytes without reuse)";
+}
+
+void RefMemoryManager::ReleaseSlab()
+{
+    ::operator delete(m_Slab);
+    m_Slab = nullptr;
+    m_SlabSize = 0;
+}
+
+} // namespace armnn
@@ -0,0 +1,73 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+class ManagedCpuTensorHandle;
+
+/// Lifetime-aware memory manager for the reference backend.
+/// Tensor handles report the start (Manage) and end (Allocate) of their lifetimes while the graph is walked in
+/// topological order. On Finalize the handles are packed into a single memory slab so that tensors whose lifetimes
+/// do not overlap share the same bytes.
+class RefMemoryManager
+{
+public:
+    RefMemoryManager();
+    ~RefMemoryManager();
+
+    RefMemoryManager(const RefMemoryManager&) = delete;
+    RefMemoryManager& operator=(const RefMemoryManager&) = delete;
+
+    /// Starts tracking the lifetime of the given tensor handle.
+    void StartLifetime(ManagedCpuTensorHandle* handle, size_t numBytes);
+
+    /// Ends the lifetime of a tensor handle previously passed to StartLifetime().
+    void EndLifetime(ManagedCpuTensorHandle* handle);
+
+    /// Stops tracking a tensor handle, e.g. because it is being destroyed.
+    void Forget(ManagedCpuTensorHandle* handle);
+
+    /// Plans the offsets of all tracked tensor handles, allocates the slab and binds each handle to its region.
+    void Finalize();
+
+    /// Returns the size in bytes of the planned slab, i.e. the peak memory needed for the tracked tensors.
+    size_t GetPlannedBytes() const { return m_SlabSize; }
+
+    /// Returns the memory the tracked tensors would need if each of them had its own allocation.
+    size_t GetNaiveBytes() const;
+
+private:
+    struct Element
+    {
+        ManagedCpuTensorHandle* m_Handle;
+        size_t m_NumBytes;
+        unsigned int m_Start;
+        unsigned int m_End;
+        size_t m_Offset;
+    };
+
+    void ReleaseSlab();
+
+    /// Alignment of every tensor within the slab.
+    static constexpr size_t ms_Alignment = 64;
+
+    std::vector<Element> m_Elements;
+    std::unordered_map<const ManagedCpuTensorHandle*, size_t> m_ElementIndices;
+
+    /// Monotonic counter used to timestamp lifetime events.
+    unsigned int m_Clock;
+
+    void* m_Slab;
+    size_t m_SlabSize;
+    bool m_Planned;
+};
+
+} // namespace armnn
@@ -12,3 +12,7 @@
 #include "MovePermuteUp.hpp"
 #include "OptimizeInverseConversions.hpp"
 #include "ConvertFp32NetworkToFp16.hpp"
+#include "FoldBatchNormalization.hpp"
+#include "FuseActivation.hpp"
+#include "FusePointwiseConvolution.hpp"
+#include "FoldConstants.hpp"
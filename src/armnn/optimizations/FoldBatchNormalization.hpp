@@ -0,0 +1,199 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+template <typename LayerType>
+class FoldBatchNormalizationImpl
+{
+public:
+    /// Run for every connection between a base Convolution2dLayer, DepthwiseConvolution2dLayer or
+    /// FullyConnectedLayer and a child BatchNormalizationLayer. Inserts an equivalent layer of the base type, whose
+    /// weights are scaled and whose bias is shifted by the normalization, that bypasses both for that connection.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        auto& base  = *boost::polymorphic_downcast<LayerType*>(&connection.GetConnectedOutputSlot()->GetOwningLayer());
+        auto& child = *boost::polymorphic_downcast<BatchNormalizationLayer*>(&connection.GetOwningLayer());
+
+        if (!CanFold(base, child))
+        {
+            return;
+        }
+
+        // The normalization of each output channel is a multiplication followed by an addition.
+        const unsigned int numChannels = child.m_Mean->GetTensorInfo().GetNumElements();
+        const float* const mean     = child.m_Mean->template GetConstTensor<float>();
+        const float* const variance = child.m_Variance->template GetConstTensor<float>();
+        const float* const beta     = child.m_Beta->template GetConstTensor<float>();
+        const float* const gamma    = child.m_Gamma->template GetConstTensor<float>();
+
+        std::vector<float> scale(numChannels);
+        std::vector<float> bias(numChannels);
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            scale[c] = gamma[c] / sqrtf(variance[c] + child.GetParameters().m_Eps);
+            bias[c] = beta[c] - mean[c] * scale[c];
+        }
+
+        const TensorInfo& weightInfo = base.m_Weight->GetTensorInfo();
+        const float* const weightData = base.m_Weight->template GetConstTensor<float>();
+        std::vector<float> weights(weightData, weightData + weightInfo.GetNumElements());
+        for (unsigned int i = 0; i < weights.size(); ++i)
+        {
+            weights[i] *= scale[GetOutputChannel(base, i)];
+        }
+
+        if (base.GetParameters().m_BiasEnabled)
+        {
+            const float* const biasData = base.m_Bias->template GetConstTensor<float>();
+            for (unsigned int c = 0; c < numChannels; ++c)
+            {
+                bias[c] += biasData[c] * scale[c];
+            }
+        }
+
+        typename LayerType::DescriptorType descriptor = base.GetParameters();
+        descriptor.m_BiasEnabled = true;
+
+        const std::string name = std::string("merged-") + base.GetName() + std::string("-with-") + child.GetName();
+        auto& folded = *graph.AddLayer<LayerType>(descriptor, name.c_str());
+        folded.m_Weight = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(weightInfo, weights));
+        folded.m_Bias = std::make_unique<ScopedCpuTensorHandle>(
+            ConstTensor(TensorInfo({ numChannels }, DataType::Float32), bias));
+        folded.GetOutputHandler().SetTensorInfo(child.GetOutputHandler().GetTensorInfo());
+
+        // Connects the new layer to the input of the base layer.
+        base.GetInputSlot(0).GetConnectedOutputSlot()->Connect(folded.GetInputSlot(0));
+
+        // Moves connections in child output to the new layer.
+        // Child layer will be removed as it's left unconnected.
+        // Base layer will be removed if left unconnected.
+        child.GetOutputSlot().MoveAllConnections(folded.GetOutputSlot());
+    }
+
+protected:
+    FoldBatchNormalizationImpl() = default;
+    ~FoldBatchNormalizationImpl() = default;
+
+private:
+    static bool IsFloat32(const std::unique_ptr<ScopedCpuTensorHandle>& tensor)
+    {
+        return tensor != nullptr && tensor->GetTensorInfo().GetDataType() == DataType::Float32;
+    }
+
+    static bool CanFold(const LayerType& base, const BatchNormalizationLayer& child)
+    {
+        // The unnormalized output of the base layer must not be used by any other layer.
+        if (base.GetOutputSlot(0).GetNumConnections() != 1)
+        {
+            return false;
+        }
+
+        // BatchNormalizationLayer normalizes dimension 1 of its input, which only holds the channels of the output
+        // of the base layer in the NCHW layout.
+        if (GetDataLayout(base) != DataLayout::NCHW)
+        {
+            return false;
+        }
+
+        if (!IsFloat32(base.m_Weight) || (base.GetParameters().m_BiasEnabled && !IsFloat32(base.m_Bias)) ||
+            !IsFloat32(child.m_Mean) || !IsFloat32(child.m_Variance) ||
+            !IsFloat32(child.m_Beta) || !IsFloat32(child.m_Gamma))
+        {
+            return false;
+        }
+
+        const unsigned int numChannels = GetNumOutputChannels(base);
+        return child.m_Mean->GetTensorInfo().GetNumElements() == numChannels &&
+               child.m_Variance->GetTensorInfo().GetNumElements() == numChannels &&
+               child.m_Beta->GetTensorInfo().GetNumElements() == numChannels &&
+               child.m_Gamma->GetTensorInfo().GetNumElements() == numChannels;
+    }
+
+    static DataLayout GetDataLayout(const Convolution2dLayer& layer)
+    {
+        return layer.GetParameters().m_DataLayout;
+    }
+
+    static DataLayout GetDataLayout(const DepthwiseConvolution2dLayer& layer)
+    {
+        return layer.GetParameters().m_DataLayout;
+    }
+
+    // The output of a fully connected layer is [batches, outputs], with its channels in dimension 1 as in NCHW.
+    static DataLayout GetDataLayout(const FullyConnectedLayer&)
+    {
+        return DataLayout::NCHW;
+    }
+
+    // The weights of a convolution are [outputChannels, inputChannels, height, width].
+    static unsigned int GetNumOutputChannels(const Convolution2dLayer& layer)
+    {
+        return layer.m_Weight->GetTensorInfo().GetShape()[0];
+    }
+
+    static unsigned int GetOutputChannel(const Convolution2dLayer& layer, unsigned int weightIndex)
+    {
+        const TensorInfo& weightInfo = layer.m_Weight->GetTensorInfo();
+        return weightIndex / (weightInfo.GetNumElements() / weightInfo.GetShape()[0]);
+    }
+
+    // The weights of an NCHW depthwise convolution are [depthMultiplier, inputChannels, height, width], and output
+    // channel c * depthMultiplier + m is the convolution of input channel c by filter m.
+    static unsigned int GetNumOutputChannels(const DepthwiseConvolution2dLayer& layer)
+    {
+        const TensorShape& weightShape = layer.m_Weight->GetTensorInfo().GetShape();
+        return weightShape[0] * weightShape[1];
+    }
+
+    static unsigned int GetOutputChannel(const DepthwiseConvolution2dLayer& layer, unsigned int weightIndex)
+    {
+        const TensorShape& weightShape = layer.m_Weight->GetTensorInfo().GetShape();
+        const unsigned int depthMultiplier = weightShape[0];
+        const unsigned int channelsInput = weightShape[1];
+        const unsigned int filterSize = weightShape[2] * weightShape[3];
+        const unsigned int m = weightIndex / (channelsInput * filterSize);
+        const unsigned int c = (weightIndex / filterSize) % channelsInput;
+        return c * depthMultiplier + m;
+    }
+
+    // The weights of a fully connected layer are [inputs, outputs], or [outputs, inputs] when transposed.
+    static unsigned int GetNumOutputChannels(const FullyConnectedLayer& layer)
+    {
+        const TensorShape& weightShape = layer.m_Weight->GetTensorInfo().GetShape();
+        return layer.GetParameters().m_TransposeWeightMatrix ? weightShape[0] : weightShape[1];
+    }
+
+    static unsigned int GetOutputChannel(const FullyConnectedLayer& layer, unsigned int weightIndex)
+    {
+        const TensorShape& weightShape = layer.m_Weight->GetTensorInfo().GetShape();
+        return layer.GetParameters().m_TransposeWeightMatrix ? weightIndex / weightShape[1]
+                                                             : weightIndex % weightShape[1];
+    }
+};
+
+using FoldBatchNormalizationIntoConvolution2d =
+    OptimizeForConnection<Convolution2dLayer, BatchNormalizationLayer, FoldBatchNormalizationImpl<Convolution2dLayer>>;
+using FoldBatchNormalizationIntoDepthwiseConvolution2d =
+    OptimizeForConnection<DepthwiseConvolution2dLayer, BatchNormalizationLayer,
+                          FoldBatchNormalizationImpl<DepthwiseConvolution2dLayer>>;
+using FoldBatchNormalizationIntoFullyConnected =
+    OptimizeForConnection<FullyConnectedLayer, BatchNormalizationLayer,
+                          FoldBatchNormalizationImpl<FullyConnectedLayer>>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,207 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadFactory.hpp"
+
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/polymorphic_cast.hpp>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// The work removed from every inference by FoldConstants.
+struct FoldConstantsStatistics
+{
+    /// Number of layers which were computed at optimization time.
+    unsigned int m_NumFoldedLayers = 0;
+    /// Number of bytes those layers would otherwise have written on every inference.
+    unsigned int m_NumFoldedBytes = 0;
+};
+
+class FoldConstantsImpl
+{
+public:
+    /// The layers are computed by the workloads of factory, which must read and write CPU tensor handles.
+    explicit FoldConstantsImpl(const IWorkloadFactory& factory, FoldConstantsStatistics* statistics = nullptr)
+        : m_Factory(factory)
+        , m_Statistics(statistics)
+    {
+    }
+
+    /// Replaces a layer whose inputs only depend on ConstantLayers with a ConstantLayer holding its output, which is
+    /// computed once here. The layers it depended on are removed if left unconnected.
+    /// The optimizer visits the layers of the graph backwards, so each constant subgraph is evaluated in one go
+    /// from its outermost layers.
+    void Run(Graph& graph, Layer& layer) const
+    {
+        // Layers left unconnected by folding the layers they fed are about to be removed.
+        if (layer.IsOutputUnconnected() || !IsFoldable(layer))
+        {
+            return;
+        }
+
+        std::vector<const ScopedCpuTensorHandle*> evaluated;
+        std::unique_ptr<ScopedCpuTensorHandle> value = Evaluate(graph, layer, evaluated);
+        if (!value)
+        {
+            return;
+        }
+
+        if (m_Statistics != nullptr)
+        {
+            m_Statistics->m_NumFoldedLayers += boost::numeric_cast<unsigned int>(evaluated.size()) + 1;
+            m_Statistics->m_NumFoldedBytes += value->GetTensorInfo().GetNumBytes();
+            for (const ScopedCpuTensorHandle* tensor : evaluated)
+            {
+                m_Statistics->m_NumFoldedBytes += tensor->GetTensorInfo().GetNumBytes();
+            }
+        }
+
+        auto& constant = *graph.AddLayer<ConstantLayer>(layer.GetName());
+        constant.GetOutputHandler().SetTensorInfo(layer.GetOutputSlot(0).GetTensorInfo());
+        constant.m_LayerOutput = std::move(value);
+
+        // The folded layer will be removed as it's left unconnected.
+        layer.GetOutputSlot(0).MoveAllConnections(constant.GetOutputSlot(0));
+    }
+
+protected:
+    ~FoldConstantsImpl() = default;
+
+private:
+    bool IsFoldable(const Layer& layer) const
+    {
+        switch (layer.GetType())
+        {
+            case LayerType::Constant:
+            case LayerType::Input:
+            case LayerType::MemCopy:
+            case LayerType::Output:
+                return false;
+            default:
+                break;
+        }
+
+        // Folding a layer does not change whether the layers which remain are foldable, as it only replaces
+        // foldable layers with ConstantLayers.
+        auto it = m_IsFoldable.find(layer.GetGuid());
+        if (it == m_IsFoldable.end())
+        {
+            it = m_IsFoldable.emplace(layer.GetGuid(), IsFoldableUncached(layer)).first;
+        }
+        return it->second;
+    }
+
+    bool IsFoldableUncached(const Layer& layer) const
+    {
+        if (layer.GetNumInputSlots() == 0 || layer.GetNumOutputSlots() != 1 ||
+            !layer.GetOutputHandler().IsTensorInfoSet())
+        {
+            return false;
+        }
+
+        for (auto&& input : layer.GetInputSlots())
+        {
+            const OutputSlot* source = input.GetConnectedOutputSlot();
+            if (source == nullptr)
+            {
+                return false;
+            }
+
+            const Layer& producer = source->GetOwningLayer();
+            const bool isConstant = producer.GetType() == LayerType::Constant &&
+                boost::polymorphic_downcast<const ConstantLayer*>(&producer)->m_LayerOutput != nullptr;
+            if (!isConstant && !IsFoldable(producer))
+            {
+                return false;
+            }
+        }
+
+        std::string reasonIfUnsupported;
+        return IWorkloadFactory::IsLayerSupported(m_Factory.GetCompute(), layer, layer.GetDataType(),
+                                                  reasonIfUnsupported);
+    }
+
+    /// Computes the output of a foldable layer. The outputs of the foldable layers it depends on are kept in
+    /// m_Values, so that those shared with the layers folded later in the pass are only computed once, and the ones
+    /// computed by this call are added to evaluated.
+    /// Returns nullptr if the workload factory has no workload for one of the layers.
+    std::unique_ptr<ScopedCpuTensorHandle> Evaluate(const Graph& graph, Layer& layer,
+                                                    std::vector<const ScopedCpuTensorHandle*>& evaluated) const
+    {
+        // The workloads read their inputs from the output handlers of the layers which produce them.
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            Layer& producer = layer.GetInputSlot(i).GetConnectedOutputSlot()->GetOwningLayer();
+
+            const ScopedCpuTensorHandle* value = nullptr;
+            if (producer.GetType() == LayerType::Constant)
+            {
+                value = boost::polymorphic_downcast<ConstantLayer*>(&producer)->m_LayerOutput.get();
+            }
+            else
+            {
+                auto it = m_Values.find(producer.GetGuid());
+                if (it == m_Values.end())
+                {
+                    std::unique_ptr<ScopedCpuTensorHandle> producerValue = Evaluate(graph, producer, evaluated);
+                    if (!producerValue)
+                    {
+                        return nullptr;
+                    }
+                    it = m_Values.emplace(producer.GetGuid(), std::move(producerValue)).first;
+                    evaluated.push_back(it->second.get());
+                }
+                value = it->second.get();
+            }
+
+            producer.GetOutputHandler().SetData(std::make_unique<ConstPassthroughCpuTensorHandle>(
+                value->GetTensorInfo(), value->GetConstTensor<void>()));
+        }
+
+        auto output = std::make_unique<ScopedCpuTensorHandle>(layer.GetOutputSlot(0).GetTensorInfo());
+        output->Allocate();
+        layer.GetOutputHandler().SetData(std::make_unique<PassthroughCpuTensorHandle>(
+            output->GetTensorInfo(), output->GetTensor<void>()));
+
+        std::unique_ptr<IWorkload> workload = layer.CreateWorkload(graph, m_Factory);
+        if (workload)
+        {
+            workload->Execute();
+        }
+
+        // Leaves the graph without tensor handles, as the workload factory of the loaded network creates them.
+        layer.GetOutputHandler().ReleaseData();
+        for (unsigned int i = 0; i < layer.GetNumInputSlots(); ++i)
+        {
+            layer.GetInputSlot(i).GetConnectedOutputSlot()->GetOwningLayer().GetOutputHandler().ReleaseData();
+        }
+
+        return workload ? std::move(output) : nullptr;
+    }
+
+    const IWorkloadFactory& m_Factory;
+    FoldConstantsStatistics* m_Statistics;
+
+    // The results for the layers visited during the pass. They are keyed by guid, as the layers erased during the
+    // pass can leave their addresses to the layers added to it.
+    mutable std::map<LayerGuid, bool> m_IsFoldable;
+    mutable std::map<LayerGuid, std::shared_ptr<ScopedCpuTensorHandle>> m_Values;
+};
+
+using FoldConstants = OptimizeForType<Layer, FoldConstantsImpl>;
+
+} // namespace optimizations
+} // namespace armnn
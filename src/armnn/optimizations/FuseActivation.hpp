@@ -0,0 +1,75 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+
+#include <string>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+template <typename LayerType>
+class FuseActivationImpl
+{
+public:
+    /// Run for every connection between a base Convolution2dLayer, DepthwiseConvolution2dLayer or
+    /// FullyConnectedLayer and a child ActivationLayer. Inserts an equivalent layer of the base type, which applies
+    /// the activation while writing its output, that bypasses both for that connection.
+    /// Only the CpuRef Float32 workloads support fused activations, so this must run after the compute devices
+    /// have been assigned.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        auto& base  = *boost::polymorphic_downcast<LayerType*>(&connection.GetConnectedOutputSlot()->GetOwningLayer());
+        auto& child = *boost::polymorphic_downcast<ActivationLayer*>(&connection.GetOwningLayer());
+
+        // The output of the base layer must not be used without the activation by any other layer.
+        if (base.GetOutputSlot(0).GetNumConnections() != 1 ||
+            base.m_FusedActivation != nullptr ||
+            base.GetComputeDevice() != Compute::CpuRef ||
+            child.GetComputeDevice() != Compute::CpuRef ||
+            base.GetOutputHandler().GetTensorInfo().GetDataType() != DataType::Float32)
+        {
+            return;
+        }
+
+        const std::string name = std::string("merged-") + base.GetName() + std::string("-with-") + child.GetName();
+        auto& fused = *graph.AddLayer<LayerType>(base.GetParameters(), name.c_str());
+
+        // The base layer is left unconnected, and removed, so its constant tensors are moved rather than copied.
+        fused.m_Weight = std::move(base.m_Weight);
+        fused.m_Bias = std::move(base.m_Bias);
+        fused.m_FusedActivation = std::make_unique<ActivationDescriptor>(child.GetParameters());
+        fused.SetComputeDevice(Compute::CpuRef);
+        fused.GetOutputHandler().SetTensorInfo(child.GetOutputHandler().GetTensorInfo());
+
+        // Connects the new layer to the input of the base layer.
+        base.GetInputSlot(0).GetConnectedOutputSlot()->Connect(fused.GetInputSlot(0));
+
+        // Moves connections in child output to the new layer.
+        // Child layer will be removed as it's left unconnected.
+        // Base layer will be removed if left unconnected.
+        child.GetOutputSlot().MoveAllConnections(fused.GetOutputSlot());
+    }
+
+protected:
+    FuseActivationImpl() = default;
+    ~FuseActivationImpl() = default;
+};
+
+using FuseActivationIntoConvolution2d =
+    OptimizeForConnection<Convolution2dLayer, ActivationLayer, FuseActivationImpl<Convolution2dLayer>>;
+using FuseActivationIntoDepthwiseConvolution2d =
+    OptimizeForConnection<DepthwiseConvolution2dLayer, ActivationLayer,
+                          FuseActivationImpl<DepthwiseConvolution2dLayer>>;
+using FuseActivationIntoFullyConnected =
+    OptimizeForConnection<FullyConnectedLayer, ActivationLayer, FuseActivationImpl<FullyConnectedLayer>>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,81 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include "Optimization.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/RefWorkloads/DepthwiseConvolution.hpp"
+
+#include <string>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+class FusePointwiseIntoDepthwiseConvolution2dImpl
+{
+public:
+    /// Run for every connection between a base DepthwiseConvolution2dLayer and a child pointwise (1x1, unit stride,
+    /// unpadded) Convolution2dLayer, as in depthwise separable convolutions. Inserts a DepthwiseConvolution2dLayer
+    /// which also computes the pointwise convolution, one tile of its input at a time, that bypasses both for that
+    /// connection.
+    /// Only the CpuRef Float32 workload supports fused pointwise convolutions, so this must run after the compute
+    /// devices have been assigned, and after the activations have been fused so that those of both convolutions are
+    /// carried over.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        auto& base  = *boost::polymorphic_downcast<DepthwiseConvolution2dLayer*>(
+            &connection.GetConnectedOutputSlot()->GetOwningLayer());
+        auto& child = *boost::polymorphic_downcast<Convolution2dLayer*>(&connection.GetOwningLayer());
+
+        // The output of the depthwise convolution must not be used by any other layer.
+        if (base.GetOutputSlot(0).GetNumConnections() != 1 ||
+            base.m_PointwiseWeight != nullptr ||
+            base.GetComputeDevice() != Compute::CpuRef ||
+            child.GetComputeDevice() != Compute::CpuRef ||
+            child.m_Weight == nullptr ||
+            !DepthwiseConvolution::IsPointwiseSupported(base.GetOutputHandler().GetTensorInfo(),
+                                                        child.m_Weight->GetTensorInfo(),
+                                                        child.GetParameters(),
+                                                        base.GetParameters().m_DataLayout))
+        {
+            return;
+        }
+
+        const std::string name = std::string("merged-") + base.GetName() + std::string("-with-") + child.GetName();
+        auto& fused = *graph.AddLayer<DepthwiseConvolution2dLayer>(base.GetParameters(), name.c_str());
+
+        // Both layers are left unconnected, and removed, so their constant tensors are moved rather than copied.
+        fused.m_Weight = std::move(base.m_Weight);
+        fused.m_Bias = std::move(base.m_Bias);
+        fused.m_FusedActivation = std::move(base.m_FusedActivation);
+        fused.m_PointwiseWeight = std::move(child.m_Weight);
+        fused.m_PointwiseBias = child.GetParameters().m_BiasEnabled ? std::move(child.m_Bias) : nullptr;
+        fused.m_PointwiseActivation = std::move(child.m_FusedActivation);
+        fused.SetComputeDevice(Compute::CpuRef);
+        fused.GetOutputHandler().SetTensorInfo(child.GetOutputHandler().GetTensorInfo());
+
+        // Connects the new layer to the input of the base layer.
+        base.GetInputSlot(0).GetConnectedOutputSlot()->Connect(fused.GetInputSlot(0));
+
+        // Moves connections in child output to the new layer.
+        // Child layer will be removed as it's left unconnected.
+        // Base layer will be removed if left unconnected.
+        child.GetOutputSlot().MoveAllConnections(fused.GetOutputSlot());
+    }
+
+protected:
+    FusePointwiseIntoDepthwiseConvolution2dImpl() = default;
+    ~FusePointwiseIntoDepthwiseConvolution2dImpl() = default;
+};
+
+using FusePointwiseIntoDepthwiseConvolution2d =
+    OptimizeForConnection<DepthwiseConvolution2dLayer, Convolution2dLayer,
+                          FusePointwiseIntoDepthwiseConvolution2dImpl>;
+
+} // namespace optimizations
+} // namespace armnn
@@ -0,0 +1,87 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+
+thread_local std::size_t g_NumAllocations = 0;
+
+// Memory can be freed by another thread than the one which allocated it, so the bytes are counted globally.
+std::atomic<std::size_t> g_NumBytes(0);
+std::atomic<std::size_t> g_PeakNumBytes(0);
+
+// Each allocation starts with its size, padded to keep the memory returned to the caller suitably aligned.
+constexpr std::size_t g_HeaderSize = alignof(std::max_align_t);
+
+void AddBytes(std::size_t size)
+{
+    const std::size_t numBytes = g_NumBytes.fetch_add(size) + size;
+    std::size_t peakNumBytes = g_PeakNumBytes.load();
+    while (numBytes > peakNumBytes && !g_PeakNumBytes.compare_exchange_weak(peakNumBytes, numBytes))
+    {
+    }
+}
+
+} // anonymous namespace
+
+void* operator new(std::size_t size)
+{
+    ++g_NumAllocations;
+
+    while (true)
+    {
+        if (void* ptr = std::malloc(size + g_HeaderSize))
+        {
+            *static_cast<std::size_t*>(ptr) = size;
+            AddBytes(size);
+            return static_cast<char*>(ptr) + g_HeaderSize;
+        }
+
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr != nullptr)
+    {
+        void* const block = static_cast<char*>(ptr) - g_HeaderSize;
+        g_NumBytes -= *static_cast<std::size_t*>(block);
+        std::free(block);
+    }
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+ScopedAllocationCounter::ScopedAllocationCounter()
+    : m_InitialNumAllocations(g_NumAllocations)
+    , m_InitialNumBytes(g_NumBytes)
+{
+    g_PeakNumBytes = m_InitialNumBytes;
+}
+
+std::size_t ScopedAllocationCounter::GetNumAllocations() const
+{
+    return g_NumAllocations - m_InitialNumAllocations;
+}
+
+std::size_t ScopedAllocationCounter::GetPeakNumBytes() const
+{
+    const std::size_t peakNumBytes = g_PeakNumBytes;
+    return peakNumBytes > m_InitialNumBytes ? peakNumBytes - m_InitialNumBytes : 0;
+}
@@ -0,0 +1,27 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include <cstddef>
+
+/// Counts the calls to the global operator new made by the current thread during the lifetime of an instance, and
+/// the peak number of bytes allocated through it by all threads.
+/// The unit test executable replaces the global operator new to keep track of them (see AllocationCounter.cpp).
+class ScopedAllocationCounter
+{
+public:
+    ScopedAllocationCounter();
+
+    /// Returns the number of allocations made by the current thread since this counter was created.
+    std::size_t GetNumAllocations() const;
+
+    /// Returns the largest number of bytes in use at any time since this counter was created, on top of those which
+    /// were in use when it was created. Creating another counter restarts the measurement of this one.
+    std::size_t GetPeakNumBytes() const;
+
+private:
+    std::size_t m_InitialNumAllocations;
+    std::size_t m_InitialNumBytes;
+};
@@ -12,6 +12,7 @@
 #include <boost/core/ignore_unused.hpp>
 
 #include <set>
+#include <thread>
 
 BOOST_AUTO_TEST_SUITE(EndToEnd)
 
@@ -201,6 +202,109 @@ BOOST_AUTO_TEST_CASE(ConstantUsage_Ref_Float32)
     ConstantUsageFloat32Test(backends);
 }
 
+BOOST_AUTO_TEST_CASE(ConcurrentExecutionWithWorkingMemHandles)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // Builds up a network computing ReLu(2 * x + 1), so that every thread reads the same constant tensors.
+    INetworkPtr net(INetwork::Create());
+
+    const unsigned int numElements = 4;
+    std::vector<float> weightsData(numElements * numElements, 0.f);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        weightsData[i * numElements + i] = 2.f;
+    }
+    std::vector<float> biasesData(numElements, 1.f);
+    ConstTensor weights(TensorInfo({ numElements, numElements }, DataType::Float32), weightsData);
+    ConstTensor biases(TensorInfo({ numElements }, DataType::Float32), biasesData);
+
+    FullyConnectedDescriptor fullyConnectedDescriptor;
+    fullyConnectedDescriptor.m_BiasEnabled = true;
+
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(fullyConnectedDescriptor, weights, biases);
+    IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    TensorInfo tensorInfo(TensorShape({ 1, numElements }), DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<Compute> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // Each thread runs the network repeatedly on its own working memory, with inputs specific to the thread.
+    const unsigned int numThreads = 4;
+    const unsigned int numIterations = 50;
+    std::vector<IWorkingMemHandlePtr> workingMemHandles;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        workingMemHandles.push_back(runtime->CreateWorkingMemHandle(netId));
+        BOOST_TEST(workingMemHandles.back()->GetNetworkId() == netId);
+    }
+
+    std::vector<unsigned int> numMismatches(numThreads, 0);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&, t]()
+            {
+                for (unsigned int iteration = 0; iteration < numIterations; ++iteration)
+                {
+                    const float value = static_cast<float>(t * numIterations + iteration) - 10.f;
+                    const std::vector<float> inputData(numElements, value);
+                    std::vector<float> outputData(numElements);
+
+                    InputTensors inputTensors
+                    {
+                        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) }
+                    };
+                    OutputTensors outputTensors
+                    {
+                        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+                    };
+
+                    const Status status = runtime->Execute(*workingMemHandles[t], inputTensors, outputTensors);
+                    const float expected = std::max(2.f * value + 1.f, 0.f);
+                    if (status != Status::Success || outputData != std::vector<float>(numElements, expected))
+                    {
+                        ++numMismatches[t];
+                    }
+                }
+            });
+    }
+
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+
+    BOOST_TEST(numMismatches == std::vector<unsigned int>(numThreads, 0), boost::test_tools::per_element());
+
+    // The network can still be run through the shared workload queue.
+    const std::vector<float> inputData{ -1.f, 0.f, 1.f, 2.f };
+    std::vector<float> outputData(numElements);
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == std::vector<float>({ 0.f, 1.f, 3.f, 5.f }), boost::test_tools::per_element());
+}
+
 #if ARMCOMPUTENEON_ENABLED
 BOOST_AUTO_TEST_CASE(ConstantUsage_Neon_Float32)
 {
@@ -383,6 +487,129 @@ BOOST_AUTO_TEST_CASE(MultipleOutputs)
     BOOST_TEST(output3Data == std::vector<float>({ 3.f, 5.f, 2.f, 3.f, 5.f, 2.f, 2.f, 2.f, 3.f, 3.f })); // [2, 5]
 }
 
+BOOST_AUTO_TEST_CASE(SplitterAndMergerViews)
+{
+    using namespace armnn;
+
+    // Create runtime in which test will run
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Builds up the structure of the network. The input is split into its rows, which CpuRef can make sub-tensors
+    // of, and into its columns, which it cannot. Each view is scaled by 10, and the views are merged back in
+    // another order, again along the dimension of size 1 and the dimension of size 2 of the views.
+    INetworkPtr net(INetwork::Create());
+
+    ActivationDescriptor scaleDescriptor;
+    scaleDescriptor.m_Function = ActivationFunction::Linear;
+    scaleDescriptor.m_A = 10.f;
+    scaleDescriptor.m_B = 0.f;
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+
+    ViewsDescriptor rowsDescriptor(2, 2);
+    for (unsigned int view = 0; view < 2; ++view)
+    {
+        rowsDescriptor.SetViewOriginCoord(view, 0, view);
+        rowsDescriptor.SetViewOriginCoord(view, 1, 0);
+        rowsDescriptor.SetViewSize(view, 0, 1);
+        rowsDescriptor.SetViewSize(view, 1, 3);
+    }
+    IConnectableLayer* rowsSplitter = net->AddSplitterLayer(rowsDescriptor);
+
+    ViewsDescriptor columnsDescriptor(2, 2);
+    columnsDescriptor.SetViewOriginCoord(0, 0, 0);
+    columnsDescriptor.SetViewOriginCoord(0, 1, 0);
+    columnsDescriptor.SetViewSize(0, 0, 2);
+    columnsDescriptor.SetViewSize(0, 1, 1);
+    columnsDescriptor.SetViewOriginCoord(1, 0, 0);
+    columnsDescriptor.SetViewOriginCoord(1, 1, 1);
+    columnsDescriptor.SetViewSize(1, 0, 2);
+    columnsDescriptor.SetViewSize(1, 1, 2);
+    IConnectableLayer* columnsSplitter = net->AddSplitterLayer(columnsDescriptor);
+
+    // The second row first, then the first one.
+    OriginsDescriptor rowsMergerDescriptor(2, 2);
+    rowsMergerDescriptor.SetViewOriginCoord(0, 0, 0);
+    rowsMergerDescriptor.SetViewOriginCoord(0, 1, 3);
+    rowsMergerDescriptor.SetViewOriginCoord(1, 0, 0);
+    rowsMergerDescriptor.SetViewOriginCoord(1, 1, 0);
+    IConnectableLayer* rowsMerger = net->AddMergerLayer(rowsMergerDescriptor);
+
+    // The last two columns first, then the first one.
+    OriginsDescriptor columnsMergerDescriptor(2, 2);
+    columnsMergerDescriptor.SetViewOriginCoord(0, 0, 0);
+    columnsMergerDescriptor.SetViewOriginCoord(0, 1, 2);
+    columnsMergerDescriptor.SetViewOriginCoord(1, 0, 0);
+    columnsMergerDescriptor.SetViewOriginCoord(1, 1, 0);
+    IConnectableLayer* columnsMerger = net->AddMergerLayer(columnsMergerDescriptor);
+
+    IConnectableLayer* output1 = net->AddOutputLayer(0);
+    IConnectableLayer* output2 = net->AddOutputLayer(1);
+
+    const TensorInfo inputInfo(TensorShape({ 2, 3 }), DataType::Float32);
+    const TensorInfo rowInfo(TensorShape({ 1, 3 }), DataType::Float32);
+    const TensorInfo firstColumnInfo(TensorShape({ 2, 1 }), DataType::Float32);
+    const TensorInfo lastColumnsInfo(TensorShape({ 2, 2 }), DataType::Float32);
+
+    input->GetOutputSlot(0).Connect(rowsSplitter->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(columnsSplitter->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        IConnectableLayer* scale = net->AddActivationLayer(scaleDescriptor);
+        rowsSplitter->GetOutputSlot(i).Connect(scale->GetInputSlot(0));
+        rowsSplitter->GetOutputSlot(i).SetTensorInfo(rowInfo);
+        scale->GetOutputSlot(0).Connect(rowsMerger->GetInputSlot(i));
+        scale->GetOutputSlot(0).SetTensorInfo(rowInfo);
+    }
+
+    const TensorInfo columnInfos[] = { firstColumnInfo, lastColumnsInfo };
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        IConnectableLayer* scale = net->AddActivationLayer(scaleDescriptor);
+        columnsSplitter->GetOutputSlot(i).Connect(scale->GetInputSlot(0));
+        columnsSplitter->GetOutputSlot(i).SetTensorInfo(columnInfos[i]);
+        scale->GetOutputSlot(0).Connect(columnsMerger->GetInputSlot(i));
+        scale->GetOutputSlot(0).SetTensorInfo(columnInfos[i]);
+    }
+
+    rowsMerger->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+    rowsMerger->GetOutputSlot(0).SetTensorInfo(TensorInfo(TensorShape({ 1, 6 }), DataType::Float32));
+    columnsMerger->GetOutputSlot(0).Connect(output2->GetInputSlot(0));
+    columnsMerger->GetOutputSlot(0).SetTensorInfo(inputInfo);
+
+    // optimize the network
+    std::vector<armnn::Compute> backends = {armnn::Compute::CpuRef};
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    // Loads it into the runtime.
+    NetworkId netId;
+    runtime->LoadNetwork(netId, std::move(optNet));
+
+    const std::vector<float> inputData{ 1.f, 2.f, 3.f, 4.f, 5.f, 6.f };
+    std::vector<float> output1Data(6);
+    std::vector<float> output2Data(6);
+
+    InputTensors inputTensors
+    {
+        {0,armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data())}
+    };
+    OutputTensors outputTensors
+    {
+        {0,armnn::Tensor(runtime->GetOutputTensorInfo(netId, 0), output1Data.data())},
+        {1,armnn::Tensor(runtime->GetOutputTensorInfo(netId, 1), output2Data.data())}
+    };
+
+    // Does the inference.
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    // Checks the results.
+    BOOST_TEST(output1Data == std::vector<float>({ 40.f, 50.f, 60.f, 10.f, 20.f, 30.f }));
+    BOOST_TEST(output2Data == std::vector<float>({ 20.f, 30.f, 10.f, 50.f, 60.f, 40.f }));
+}
+
 #if ARMCOMPUTENEON_ENABLED
 BOOST_AUTO_TEST_CASE(FallbackToCpuRef)
 {
@@ -579,4 +579,29 @@ BOOST_AUTO_TEST_CASE(DuplicateLayerNames)
     BOOST_TEST(((*std::next(it))->GetType() == armnn::LayerType::Output));
 }
 
+BOOST_AUTO_TEST_CASE(CopiedGraphSharesConstantTensors)
+{
+    armnn::Graph graph;
+
+    armnn::Convolution2dDescriptor convDesc;
+    convDesc.m_BiasEnabled = false;
+    armnn::Convolution2dLayer* convLayer = graph.AddLayer<armnn::Convolution2dLayer>(convDesc, "conv");
+
+    std::vector<float> weights(8 * 3 * 3 * 3, 1.0f);
+    convLayer->m_Weight = std::make_unique<armnn::ScopedCpuTensorHandle>(
+        armnn::ConstTensor(armnn::TensorInfo({ 8, 3, 3, 3 }, armnn::DataType::Float32), weights));
+    BOOST_TEST(convLayer->m_Weight->GetConstTensor<float>() != weights.data());
+    BOOST_TEST(!convLayer->m_Weight->IsShared());
+
+    const armnn::Graph copy(graph);
+    const auto& copiedLayer = *boost::polymorphic_downcast<const armnn::Convolution2dLayer*>(*copy.begin());
+    BOOST_TEST(copiedLayer.m_Weight->GetConstTensor<float>() == convLayer->m_Weight->GetConstTensor<float>());
+    BOOST_TEST(convLayer->m_Weight->IsShared());
+
+    // The weights stay alive as long as one of the graphs references them.
+    graph.EraseLayer(convLayer);
+    BOOST_TEST(!copiedLayer.m_Weight->IsShared());
+    BOOST_TEST(copiedLayer.m_Weight->GetConstTensor<float>()[0] == 1.0f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,7 @@
 #include "armnn/ArmNN.hpp"
 #include "Network.hpp"
 #include "Graph.hpp"
+#include "backends/CpuTensorHandle.hpp"
 #include "backends/RefWorkloadFactory.hpp"
 #include "backends/ClWorkloadFactory.hpp"
 #include "backends/NeonWorkloadFactory.hpp"
@@ -116,6 +117,32 @@ BOOST_AUTO_TEST_CASE(LayerNamesAreOptionalForNetwork)
     net.AddOutputLayer(0);
 }
 
+BOOST_AUTO_TEST_CASE(NetworkSharesConstTensorsWhichShareTheirMemory)
+{
+    const armnn::TensorInfo weightsInfo({ 4, 8 }, armnn::DataType::Float32);
+    std::shared_ptr<const void> weights(new float[weightsInfo.GetNumElements()](), std::default_delete<float[]>());
+    std::vector<float> biases(8, 1.0f);
+
+    armnn::Network net;
+    armnn::FullyConnectedDescriptor descriptor;
+    descriptor.m_BiasEnabled = true;
+    net.AddFullyConnectedLayer(descriptor,
+                               armnn::ConstTensor(weightsInfo, weights),
+                               armnn::ConstTensor(armnn::TensorInfo({ 8 }, armnn::DataType::Float32), biases),
+                               "fullyConnected");
+
+    const auto& layer = *boost::polymorphic_downcast<const armnn::FullyConnectedLayer*>(
+        *net.GetGraph().begin());
+    BOOST_TEST(layer.m_Weight->GetConstTensor<void>() == weights.get());
+    BOOST_TEST(weights.use_count() == 2);
+    BOOST_TEST(layer.m_Bias->GetConstTensor<void>() != static_cast<const void*>(biases.data()));
+
+    // The network keeps the weights alive.
+    const void* const weightsData = weights.get();
+    weights.reset();
+    BOOST_TEST(layer.m_Weight->GetConstTensor<void>() == weightsData);
+}
+
 BOOST_AUTO_TEST_CASE(NetworkModification)
 {
     armnn::Network net;
@@ -906,6 +933,65 @@ BOOST_AUTO_TEST_CASE(FP16TurboModeTestOnCpuRef)
     BOOST_TEST(ss.str() == expected.str());
 }
 
+BOOST_AUTO_TEST_CASE(OptimizeFusesPointwiseConvolutionsOnlyWhenSelected)
+{
+    armnn::Network net;
+
+    // A depthwise output large enough to be split in several tiles, which could be fused.
+    const armnn::TensorInfo inputInfo({ 1, 64, 40, 40 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 8, 40, 40 }, armnn::DataType::Float32);
+    std::vector<float> depthwiseWeights(64 * 9, 1.0f);
+    std::vector<float> pointwiseWeights(8 * 64, 1.0f);
+
+    armnn::DepthwiseConvolution2dDescriptor depthwiseDescriptor;
+    depthwiseDescriptor.m_PadLeft   = 1;
+    depthwiseDescriptor.m_PadRight  = 1;
+    depthwiseDescriptor.m_PadTop    = 1;
+    depthwiseDescriptor.m_PadBottom = 1;
+    depthwiseDescriptor.m_StrideX   = 1;
+    depthwiseDescriptor.m_StrideY   = 1;
+
+    armnn::Convolution2dDescriptor pointwiseDescriptor;
+    pointwiseDescriptor.m_StrideX = 1;
+    pointwiseDescriptor.m_StrideY = 1;
+
+    auto input = net.AddInputLayer(0);
+    auto depthwise = net.AddDepthwiseConvolution2dLayer(depthwiseDescriptor,
+        armnn::ConstTensor(armnn::TensorInfo({ 1, 64, 3, 3 }, armnn::DataType::Float32), depthwiseWeights));
+    auto pointwise = net.AddConvolution2dLayer(pointwiseDescriptor,
+        armnn::ConstTensor(armnn::TensorInfo({ 8, 64, 1, 1 }, armnn::DataType::Float32), pointwiseWeights));
+    auto output = net.AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(depthwise->GetInputSlot(0));
+    depthwise->GetOutputSlot(0).Connect(pointwise->GetInputSlot(0));
+    pointwise->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    depthwise->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    pointwise->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::Compute> backends = { armnn::Compute::CpuRef };
+
+    // The fusion is not done by default.
+    armnn::IOptimizedNetworkPtr optNet = armnn::Optimize(net, backends, runtime->GetDeviceSpec());
+    const armnn::Graph& graph = static_cast<armnn::OptimizedNetwork*>(optNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(std::any_of(graph.cbegin(), graph.cend(),
+        [](const armnn::Layer* layer) { return layer->GetType() == armnn::LayerType::Convolution2d; }));
+
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_FusePointwiseConvolutions = true;
+    armnn::IOptimizedNetworkPtr fusedNet = armnn::Optimize(net, backends, runtime->GetDeviceSpec(),
+                                                           optimizerOptions);
+    const armnn::Graph& fusedGraph = static_cast<armnn::OptimizedNetwork*>(fusedNet.get())->GetGraph();
+    BOOST_TEST(fusedGraph.GetNumLayers() == 3);
+    BOOST_TEST(std::none_of(fusedGraph.cbegin(), fusedGraph.cend(),
+        [](const armnn::Layer* layer) { return layer->GetType() == armnn::LayerType::Convolution2d; }));
+}
+
 #if ARMCOMPUTECL_ENABLED
 BOOST_AUTO_TEST_CASE(FP16TurboModeTestOnGpuAcc)
 {
@@ -8,6 +8,7 @@
 #include "Graph.hpp"
 #include "Optimizer.hpp"
 #include "backends/CpuTensorHandle.hpp"
+#include "backends/RefWorkloadFactory.hpp"
 #include "FloatingPointConverter.hpp"
 
 namespace
@@ -771,4 +772,415 @@ BOOST_AUTO_TEST_CASE(Fp32NetworkToFp16OptimizationTest)
                              &IsLayerOfType<armnn::OutputLayer>));
 }
 
+BOOST_AUTO_TEST_CASE(FoldBatchNormalizationIntoConvolution2dTest)
+{
+    armnn::Graph graph;
+
+    const armnn::TensorInfo inputInfo({ 1, 1, 2, 2 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 2, 2, 2 }, armnn::DataType::Float32);
+    const armnn::TensorInfo channelsInfo({ 2 }, armnn::DataType::Float32);
+
+    // A 1x1 convolution without bias, with one input and two output channels.
+    std::vector<float> weights{ 2.0f, 3.0f };
+    armnn::Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_StrideX = 1;
+    convolutionDescriptor.m_StrideY = 1;
+    convolutionDescriptor.m_BiasEnabled = false;
+
+    auto input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    auto conv = graph.AddLayer<armnn::Convolution2dLayer>(convolutionDescriptor, "conv");
+    conv->m_Weight = std::make_unique<armnn::ScopedCpuTensorHandle>(
+        armnn::ConstTensor(armnn::TensorInfo({ 2, 1, 1, 1 }, armnn::DataType::Float32), weights));
+    conv->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    std::vector<float> mean{ 1.0f, -1.0f };
+    std::vector<float> variance{ 4.0f, 0.25f };
+    std::vector<float> beta{ 0.5f, 0.0f };
+    std::vector<float> gamma{ 1.0f, 2.0f };
+    armnn::BatchNormalizationDescriptor batchNormDescriptor;
+    batchNormDescriptor.m_Eps = 0.0f;
+
+    auto batchNorm = graph.AddLayer<armnn::BatchNormalizationLayer>(batchNormDescriptor, "batchNorm");
+    batchNorm->m_Mean     = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(channelsInfo, mean));
+    batchNorm->m_Variance = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(channelsInfo, variance));
+    batchNorm->m_Beta     = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(channelsInfo, beta));
+    batchNorm->m_Gamma    = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(channelsInfo, gamma));
+    batchNorm->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot().Connect(batchNorm->GetInputSlot(0));
+    batchNorm->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FoldBatchNormalizationIntoConvolution2d()));
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<armnn::InputLayer>,
+                             &IsLayerOfType<armnn::Convolution2dLayer>,
+                             &IsLayerOfType<armnn::OutputLayer>));
+
+    std::list<std::string> testRelatedLayers = { "batchNorm", "conv" };
+    BOOST_TEST(CheckRelatedLayers<armnn::Convolution2dLayer>(graph, testRelatedLayers));
+
+    // The normalization scales are gamma / sqrt(variance), 0.5 and 4.
+    auto& folded = *boost::polymorphic_downcast<armnn::Convolution2dLayer*>(
+        &output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer());
+    BOOST_TEST(folded.GetParameters().m_BiasEnabled);
+
+    const float* foldedWeights = folded.m_Weight->GetConstTensor<float>();
+    BOOST_TEST(foldedWeights[0] == 1.0f);
+    BOOST_TEST(foldedWeights[1] == 12.0f);
+
+    const float* foldedBias = folded.m_Bias->GetConstTensor<float>();
+    BOOST_TEST(foldedBias[0] == 0.0f);
+    BOOST_TEST(foldedBias[1] == 4.0f);
+}
+
+BOOST_AUTO_TEST_CASE(FoldBatchNormalizationIntoNhwcConvolution2dTest)
+{
+    armnn::Graph graph;
+
+    // The batch normalization normalizes dimension 1, which is the height of the NHWC output of the convolution.
+    const armnn::TensorInfo inputInfo({ 1, 2, 2, 1 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 2, 2, 2 }, armnn::DataType::Float32);
+    const armnn::TensorInfo channelsInfo({ 2 }, armnn::DataType::Float32);
+
+    std::vector<float> weights{ 2.0f, 3.0f };
+    armnn::Convolution2dDescriptor convolutionDescriptor;
+    convolutionDescriptor.m_StrideX = 1;
+    convolutionDescriptor.m_StrideY = 1;
+    convolutionDescriptor.m_DataLayout = armnn::DataLayout::NHWC;
+
+    auto input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    auto conv = graph.AddLayer<armnn::Convolution2dLayer>(convolutionDescriptor, "conv");
+    conv->m_Weight = std::make_unique<armnn::ScopedCpuTensorHandle>(
+        armnn::ConstTensor(armnn::TensorInfo({ 2, 1, 1, 1 }, armnn::DataType::Float32), weights));
+    conv->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    std::vector<float> mean{ 1.0f, -1.0f };
+    std::vector<float> variance{ 4.0f, 0.25f };
+    std::vector<float> beta{ 0.5f, 0.0f };
+    std::vector<float> gamma{ 1.0f, 2.0f };
+    auto batchNorm = graph.AddLayer<armnn::BatchNormalizationLayer>(armnn::BatchNormalizationDescriptor(),
+                                                                    "batchNorm");
+    batchNorm->m_Mean     = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(channelsInfo, mean));
+    batchNorm->m_Variance = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(channelsInfo, variance));
+    batchNorm->m_Beta     = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(channelsInfo, beta));
+    batchNorm->m_Gamma    = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(channelsInfo, gamma));
+    batchNorm->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    input->GetOutputSlot().Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot().Connect(batchNorm->GetInputSlot(0));
+    batchNorm->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FoldBatchNormalizationIntoConvolution2d()));
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+                             graph.cend(),
+                             &IsLayerOfType<armnn::InputLayer>,
+                             &IsLayerOfType<armnn::Convolution2dLayer>,
+                             &IsLayerOfType<armnn::BatchNormalizationLayer>,
+                             &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseActivationIntoFullyConnectedTest)
+{
+    const armnn::TensorInfo inputInfo({ 1, 3 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 2 }, armnn::DataType::Float32);
+    std::vector<float> weights(6, 1.0f);
+
+    armnn::ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = armnn::ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 6.0f;
+
+    for (armnn::Compute compute : { armnn::Compute::CpuRef, armnn::Compute::CpuAcc })
+    {
+        armnn::Graph graph;
+
+        auto input = graph.AddLayer<armnn::InputLayer>(0, "input");
+        input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+        auto fc = graph.AddLayer<armnn::FullyConnectedLayer>(armnn::FullyConnectedDescriptor(), "fc");
+        fc->m_Weight = std::make_unique<armnn::ScopedCpuTensorHandle>(
+            armnn::ConstTensor(armnn::TensorInfo({ 3, 2 }, armnn::DataType::Float32), weights));
+        fc->GetOutputSlot().SetTensorInfo(outputInfo);
+
+        auto activation = graph.AddLayer<armnn::ActivationLayer>(activationDescriptor, "activation");
+        activation->GetOutputSlot().SetTensorInfo(outputInfo);
+
+        auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+        input->GetOutputSlot().Connect(fc->GetInputSlot(0));
+        fc->GetOutputSlot().Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+        for (auto&& layer : graph)
+        {
+            layer->SetComputeDevice(compute);
+        }
+
+        armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseActivationIntoFullyConnected()));
+
+        if (compute == armnn::Compute::CpuRef)
+        {
+            BOOST_TEST(CheckSequence(graph.cbegin(),
+                                     graph.cend(),
+                                     &IsLayerOfType<armnn::InputLayer>,
+                                     &IsLayerOfType<armnn::FullyConnectedLayer>,
+                                     &IsLayerOfType<armnn::OutputLayer>));
+
+            auto& fused = *boost::polymorphic_downcast<armnn::FullyConnectedLayer*>(
+                &output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer());
+            BOOST_TEST_REQUIRE((fused.m_FusedActivation != nullptr));
+            BOOST_TEST((fused.m_FusedActivation->m_Function == armnn::ActivationFunction::BoundedReLu));
+            BOOST_TEST(fused.m_FusedActivation->m_A == 6.0f);
+            BOOST_TEST((fused.m_Weight != nullptr));
+            BOOST_TEST((fused.GetComputeDevice() == armnn::Compute::CpuRef));
+        }
+        else
+        {
+            // Only the CpuRef workloads apply fused activations.
+            BOOST_TEST(CheckSequence(graph.cbegin(),
+                                     graph.cend(),
+                                     &IsLayerOfType<armnn::InputLayer>,
+                                     &IsLayerOfType<armnn::FullyConnectedLayer>,
+                                     &IsLayerOfType<armnn::ActivationLayer>,
+                                     &IsLayerOfType<armnn::OutputLayer>));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FusePointwiseIntoDepthwiseConvolution2dTest)
+{
+    // The depthwise output is large enough to be split in several tiles.
+    const armnn::TensorInfo inputInfo({ 1, 64, 40, 40 }, armnn::DataType::Float32);
+    const armnn::TensorInfo depthwiseOutputInfo({ 1, 64, 40, 40 }, armnn::DataType::Float32);
+    const armnn::TensorInfo outputInfo({ 1, 3, 40, 40 }, armnn::DataType::Float32);
+    std::vector<float> depthwiseWeights(64 * 9, 1.0f);
+    std::vector<float> pointwiseWeights(3 * 64, 1.0f);
+    std::vector<float> pointwiseBias(3, 0.5f);
+
+    armnn::DepthwiseConvolution2dDescriptor depthwiseDescriptor;
+    depthwiseDescriptor.m_PadLeft   = 1;
+    depthwiseDescriptor.m_PadRight  = 1;
+    depthwiseDescriptor.m_PadTop    = 1;
+    depthwiseDescriptor.m_PadBottom = 1;
+    depthwiseDescriptor.m_StrideX   = 1;
+    depthwiseDescriptor.m_StrideY   = 1;
+
+    armnn::Convolution2dDescriptor pointwiseDescriptor;
+    pointwiseDescriptor.m_StrideX     = 1;
+    pointwiseDescriptor.m_StrideY     = 1;
+    pointwiseDescriptor.m_BiasEnabled = true;
+
+    // The depthwise convolution cannot be fused when its output is also used by another layer.
+    for (bool isOutputShared : { false, true })
+    {
+        armnn::Graph graph;
+
+        auto input = graph.AddLayer<armnn::InputLayer>(0, "input");
+        input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+        auto depthwise = graph.AddLayer<armnn::DepthwiseConvolution2dLayer>(depthwiseDescriptor, "depthwise");
+        depthwise->m_Weight = std::make_unique<armnn::ScopedCpuTensorHandle>(
+            armnn::ConstTensor(armnn::TensorInfo({ 1, 64, 3, 3 }, armnn::DataType::Float32), depthwiseWeights));
+        depthwise->GetOutputSlot().SetTensorInfo(depthwiseOutputInfo);
+
+        auto pointwise = graph.AddLayer<armnn::Convolution2dLayer>(pointwiseDescriptor, "pointwise");
+        pointwise->m_Weight = std::make_unique<armnn::ScopedCpuTensorHandle>(
+            armnn::ConstTensor(armnn::TensorInfo({ 3, 64, 1, 1 }, armnn::DataType::Float32), pointwiseWeights));
+        pointwise->m_Bias = std::make_unique<armnn::ScopedCpuTensorHandle>(
+            armnn::ConstTensor(armnn::TensorInfo({ 3 }, armnn::DataType::Float32), pointwiseBias));
+        pointwise->GetOutputSlot().SetTensorInfo(outputInfo);
+
+        auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+        input->GetOutputSlot().Connect(depthwise->GetInputSlot(0));
+        depthwise->GetOutputSlot().Connect(pointwise->GetInputSlot(0));
+        pointwise->GetOutputSlot().Connect(output->GetInputSlot(0));
+        if (isOutputShared)
+        {
+            depthwise->GetOutputSlot().Connect(graph.AddLayer<armnn::OutputLayer>(1, "output1")->GetInputSlot(0));
+        }
+
+        for (auto&& layer : graph)
+        {
+            layer->SetComputeDevice(armnn::Compute::CpuRef);
+        }
+
+        armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FusePointwiseIntoDepthwiseConvolution2d()));
+
+        if (isOutputShared)
+        {
+            BOOST_TEST(graph.GetNumLayers() == 5);
+            BOOST_TEST((pointwise->m_Weight != nullptr));
+            continue;
+        }
+
+        BOOST_TEST(CheckSequence(graph.cbegin(),
+                                 graph.cend(),
+                                 &IsLayerOfType<armnn::InputLayer>,
+                                 &IsLayerOfType<armnn::DepthwiseConvolution2dLayer>,
+                                 &IsLayerOfType<armnn::OutputLayer>));
+
+        auto& fused = *boost::polymorphic_downcast<armnn::DepthwiseConvolution2dLayer*>(
+            &output->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer());
+        BOOST_TEST((fused.m_Weight != nullptr));
+        BOOST_TEST_REQUIRE((fused.m_PointwiseWeight != nullptr));
+        BOOST_TEST((fused.m_PointwiseWeight->GetTensorInfo().GetShape() == armnn::TensorShape({ 3, 64, 1, 1 })));
+        BOOST_TEST((fused.m_PointwiseBias != nullptr));
+        BOOST_TEST((fused.GetOutputSlot().GetTensorInfo() == outputInfo));
+        BOOST_TEST((fused.InferOutputShapes({ inputInfo.GetShape(), fused.m_Weight->GetTensorInfo().GetShape() })[0] ==
+                    outputInfo.GetShape()));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(FoldConstantsTest)
+{
+    armnn::Graph graph;
+
+    const armnn::TensorInfo constantInfo({ 2, 3 }, armnn::DataType::Float32);
+    const armnn::TensorInfo info({ 3, 2 }, armnn::DataType::Float32);
+
+    // The permute and the first addition only depend on constants, unlike the second addition.
+    std::vector<float> weights{ 1.0f, 2.0f, 3.0f,
+                                4.0f, 5.0f, 6.0f };
+    std::vector<float> bias{ 10.0f, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f };
+
+    auto input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    auto weightsLayer = graph.AddLayer<armnn::ConstantLayer>("weights");
+    weightsLayer->m_LayerOutput = std::make_unique<armnn::ScopedCpuTensorHandle>(
+        armnn::ConstTensor(constantInfo, weights));
+    weightsLayer->GetOutputSlot().SetTensorInfo(constantInfo);
+
+    auto biasLayer = graph.AddLayer<armnn::ConstantLayer>("bias");
+    biasLayer->m_LayerOutput = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(info, bias));
+    biasLayer->GetOutputSlot().SetTensorInfo(info);
+
+    auto permute = graph.AddLayer<armnn::PermuteLayer>(armnn::PermuteDescriptor({ 1, 0 }), "permuted");
+    permute->GetOutputSlot().SetTensorInfo(info);
+
+    auto constantAddition = graph.AddLayer<armnn::AdditionLayer>("constantAddition");
+    constantAddition->GetOutputSlot().SetTensorInfo(info);
+
+    auto addition = graph.AddLayer<armnn::AdditionLayer>("addition");
+    addition->GetOutputSlot().SetTensorInfo(info);
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    weightsLayer->GetOutputSlot().Connect(permute->GetInputSlot(0));
+    permute->GetOutputSlot().Connect(constantAddition->GetInputSlot(0));
+    biasLayer->GetOutputSlot().Connect(constantAddition->GetInputSlot(1));
+    constantAddition->GetOutputSlot().Connect(addition->GetInputSlot(0));
+    input->GetOutputSlot().Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::RefWorkloadFactory factory;
+    armnn::optimizations::FoldConstantsStatistics statistics;
+    armnn::Optimizer::Pass(graph,
+                           armnn::MakeOptimizations(armnn::optimizations::FoldConstants(factory, &statistics)));
+
+    // Input, folded constant, addition and output.
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(statistics.m_NumFoldedLayers == 2);
+    BOOST_TEST(statistics.m_NumFoldedBytes == 2 * info.GetNumBytes());
+
+    armnn::Layer& folded = addition->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+    BOOST_TEST_REQUIRE((folded.GetType() == armnn::LayerType::Constant));
+    BOOST_TEST(folded.GetOutputHandler().GetData() == nullptr);
+
+    const armnn::ScopedCpuTensorHandle& value =
+        *boost::polymorphic_downcast<armnn::ConstantLayer*>(&folded)->m_LayerOutput;
+    BOOST_TEST(value.GetTensorInfo().GetShape() == info.GetShape());
+
+    const std::vector<float> expected{ 11.0f, 24.0f, 32.0f, 45.0f, 53.0f, 66.0f };
+    const float* const values = value.GetConstTensor<float>();
+    BOOST_TEST(std::vector<float>(values, values + expected.size()) == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(FoldConstantsSharedSubgraphTest)
+{
+    armnn::Graph graph;
+
+    const armnn::TensorInfo constantInfo({ 2, 3 }, armnn::DataType::Float32);
+    const armnn::TensorInfo info({ 3, 2 }, armnn::DataType::Float32);
+
+    // The permute feeds two constant additions, which are folded separately as they feed different layers.
+    std::vector<float> weights{ 1.0f, 2.0f, 3.0f,
+                                4.0f, 5.0f, 6.0f };
+    std::vector<float> bias{ 10.0f, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f };
+
+    auto input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(info);
+
+    auto weightsLayer = graph.AddLayer<armnn::ConstantLayer>("weights");
+    weightsLayer->m_LayerOutput = std::make_unique<armnn::ScopedCpuTensorHandle>(
+        armnn::ConstTensor(constantInfo, weights));
+    weightsLayer->GetOutputSlot().SetTensorInfo(constantInfo);
+
+    auto biasLayer = graph.AddLayer<armnn::ConstantLayer>("bias");
+    biasLayer->m_LayerOutput = std::make_unique<armnn::ScopedCpuTensorHandle>(armnn::ConstTensor(info, bias));
+    biasLayer->GetOutputSlot().SetTensorInfo(info);
+
+    auto permute = graph.AddLayer<armnn::PermuteLayer>(armnn::PermuteDescriptor({ 1, 0 }), "permuted");
+    permute->GetOutputSlot().SetTensorInfo(info);
+
+    auto biasAddition = graph.AddLayer<armnn::AdditionLayer>("biasAddition");
+    biasAddition->GetOutputSlot().SetTensorInfo(info);
+
+    auto doubling = graph.AddLayer<armnn::AdditionLayer>("doubling");
+    doubling->GetOutputSlot().SetTensorInfo(info);
+
+    auto addition = graph.AddLayer<armnn::AdditionLayer>("addition");
+    addition->GetOutputSlot().SetTensorInfo(info);
+
+    auto secondAddition = graph.AddLayer<armnn::AdditionLayer>("secondAddition");
+    secondAddition->GetOutputSlot().SetTensorInfo(info);
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(0, "output");
+
+    weightsLayer->GetOutputSlot().Connect(permute->GetInputSlot(0));
+    permute->GetOutputSlot().Connect(biasAddition->GetInputSlot(0));
+    biasLayer->GetOutputSlot().Connect(biasAddition->GetInputSlot(1));
+    permute->GetOutputSlot().Connect(doubling->GetInputSlot(0));
+    permute->GetOutputSlot().Connect(doubling->GetInputSlot(1));
+    biasAddition->GetOutputSlot().Connect(addition->GetInputSlot(0));
+    input->GetOutputSlot().Connect(addition->GetInputSlot(1));
+    doubling->GetOutputSlot().Connect(secondAddition->GetInputSlot(0));
+    addition->GetOutputSlot().Connect(secondAddition->GetInputSlot(1));
+    secondAddition->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::RefWorkloadFactory factory;
+    armnn::optimizations::FoldConstantsStatistics statistics;
+    armnn::Optimizer::Pass(graph,
+                           armnn::MakeOptimizations(armnn::optimizations::FoldConstants(factory, &statistics)));
+
+    // Input, two folded constants, two additions and output. The permute is only computed once.
+    BOOST_TEST(graph.GetNumLayers() == 6);
+    BOOST_TEST(statistics.m_NumFoldedLayers == 3);
+    BOOST_TEST(statistics.m_NumFoldedBytes == 3 * info.GetNumBytes());
+
+    auto checkFolded = [](const armnn::InputSlot& slot, const std::vector<float>& expected)
+    {
+        armnn::Layer& folded = slot.GetConnectedOutputSlot()->GetOwningLayer();
+        BOOST_TEST_REQUIRE((folded.GetType() == armnn::LayerType::Constant));
+
+        const float* const values =
+            boost::polymorphic_downcast<armnn::ConstantLayer*>(&folded)->m_LayerOutput->GetConstTensor<float>();
+        BOOST_TEST(std::vector<float>(values, values + expected.size()) == expected, boost::test_tools::per_element());
+    };
+    checkFolded(addition->GetInputSlot(0), { 11.0f, 24.0f, 32.0f, 45.0f, 53.0f, 66.0f });
+    checkFolded(secondAddition->GetInputSlot(0), { 2.0f, 8.0f, 4.0f, 10.0f, 6.0f, 12.0f });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,7 @@
 #include "Runtime.hpp"
 #include "HeapProfiling.hpp"
 #include "LeakChecking.hpp"
+#include "AllocationCounter.hpp"
 
 #ifdef WITH_VALGRIND
 #include "valgrind/memcheck.h"
@@ -450,6 +451,60 @@ BOOST_AUTO_TEST_CASE(RuntimeCpuRef)
     BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeLoadNetworkDoesNotCopyConstantTensors)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // 8 MiB of weights, which the network copies from the caller's buffer.
+    const unsigned int inputSize = 1024;
+    const unsigned int outputSize = 2048;
+    const TensorInfo weightsInfo({ inputSize, outputSize }, DataType::Float32);
+    INetworkPtr net(INetwork::Create());
+    {
+        std::vector<float> weights(weightsInfo.GetNumElements(), 0.5f);
+
+        FullyConnectedDescriptor descriptor;
+        descriptor.m_BiasEnabled = false;
+        IConnectableLayer* input = net->AddInputLayer(0);
+        IConnectableLayer* fullyConnected =
+            net->AddFullyConnectedLayer(descriptor, ConstTensor(weightsInfo, weights), "fullyConnected");
+        IConnectableLayer* output = net->AddOutputLayer(0);
+
+        input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+        fullyConnected->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+        input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, inputSize }, DataType::Float32));
+        fullyConnected->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, outputSize }, DataType::Float32));
+    }
+
+    // The optimized network and the workloads reference the weights of the network rather than copying them, so
+    // loading it only needs memory for the intermediate tensors and the bookkeeping.
+    armnn::NetworkId netId;
+    std::size_t peakNumBytes = 0;
+    {
+        ScopedAllocationCounter allocationCounter;
+        std::vector<armnn::Compute> backends = { armnn::Compute::CpuRef };
+        IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+        BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+        peakNumBytes = allocationCounter.GetPeakNumBytes();
+    }
+    BOOST_TEST(peakNumBytes < weightsInfo.GetNumBytes() / 4);
+
+    // The network can be released once loaded.
+    net.reset();
+
+    std::vector<float> inputData(inputSize, 1.0f);
+    std::vector<float> outputData(outputSize);
+    BOOST_TEST(runtime->EnqueueWorkload(netId,
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } },
+        { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } }) == Status::Success);
+    BOOST_TEST(outputData[0] == 0.5f * inputSize);
+    BOOST_TEST(outputData[outputSize - 1] == 0.5f * inputSize);
+}
+
 BOOST_AUTO_TEST_CASE(RuntimeFallbackToCpuRef)
 {
     using namespace armnn;
@@ -485,4 +540,517 @@ BOOST_AUTO_TEST_CASE(RuntimeFallbackToCpuRef)
     BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeBoundTensorsExecuteWithoutAllocating)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // build up a network computing ReLu(2 * x + 1)
+    INetworkPtr net(INetwork::Create());
+
+    std::vector<float> weightsData{ 2.f, 0.f, 0.f, 2.f };
+    std::vector<float> biasesData{ 1.f, 1.f };
+    ConstTensor weights(TensorInfo({ 2, 2 }, DataType::Float32), weightsData);
+    ConstTensor biases(TensorInfo({ 2 }, DataType::Float32), biasesData);
+
+    FullyConnectedDescriptor fullyConnectedDescriptor;
+    fullyConnectedDescriptor.m_BiasEnabled = true;
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(fullyConnectedDescriptor, weights, biases);
+    IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    TensorInfo tensorInfo({ 1, 2 }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<armnn::Compute> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    armnn::NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // Binds the caller-owned buffers once.
+    std::vector<float> inputData(2);
+    std::vector<float> outputData(2);
+    IWorkingMemHandlePtr workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    BOOST_TEST(runtime->BindTensors(*workingMemHandle,
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } },
+        { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } }) == Status::Success);
+
+    // Subsequent inferences only update the content of the buffers, and must not allocate anything.
+    const unsigned int numInferences = 10;
+    std::vector<float> results;
+    results.reserve(2 * numInferences);
+    std::size_t numAllocations = 0;
+    bool allSucceeded = true;
+    {
+        ScopedAllocationCounter allocationCounter;
+        for (unsigned int i = 0; i < numInferences; ++i)
+        {
+            inputData[0] = static_cast<float>(i);
+            inputData[1] = -static_cast<float>(i);
+            allSucceeded &= runtime->Execute(*workingMemHandle) == Status::Success;
+            results.insert(results.end(), outputData.begin(), outputData.end());
+        }
+        numAllocations = allocationCounter.GetNumAllocations();
+    }
+
+    BOOST_TEST(allSucceeded);
+    BOOST_TEST(numAllocations == 0);
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        BOOST_TEST(results[2 * i] == 2.f * static_cast<float>(i) + 1.f);
+        BOOST_TEST(results[2 * i + 1] == (i == 0 ? 1.f : 0.f));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeExecuteWithoutBoundTensorsThrows)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* activation = net->AddActivationLayer(ActivationDescriptor());
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 4 }, DataType::Float32));
+    activation->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 4 }, DataType::Float32));
+
+    std::vector<armnn::Compute> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    armnn::NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    IWorkingMemHandlePtr workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    BOOST_CHECK_THROW(runtime->Execute(*workingMemHandle), armnn::InvalidArgumentException);
+}
+
+namespace
+{
+
+// Loads a network computing ReLu(x + bias) on CpuRef, where bias is a constant made of the given value, for batches
+// of the given size.
+armnn::NetworkId LoadBiasedReLuNetwork(armnn::IRuntime& runtime, float biasValue, unsigned int batchSize = 1)
+{
+    using namespace armnn;
+
+    INetworkPtr net(INetwork::Create());
+
+    std::vector<float> weightsData{ 1.f, 0.f, 0.f, 1.f };
+    std::vector<float> biasesData{ biasValue, biasValue };
+    ConstTensor weights(TensorInfo({ 2, 2 }, DataType::Float32), weightsData);
+    ConstTensor biases(TensorInfo({ 2 }, DataType::Float32), biasesData);
+
+    FullyConnectedDescriptor fullyConnectedDescriptor;
+    fullyConnectedDescriptor.m_BiasEnabled = true;
+    ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = ActivationFunction::ReLu;
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(fullyConnectedDescriptor, weights, biases);
+    IConnectableLayer* activation = net->AddActivationLayer(activationDescriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    TensorInfo tensorInfo({ batchSize, 2 }, DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    std::vector<armnn::Compute> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime.GetDeviceSpec());
+
+    armnn::NetworkId netId;
+    BOOST_TEST(runtime.LoadNetwork(netId, std::move(optNet)) == Status::Success);
+    return netId;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(RuntimeEnqueueWorkloadAsync)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_NumWorkerThreads = 3;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // Two models sharing the worker pool of the runtime.
+    const std::vector<armnn::NetworkId> netIds{ LoadBiasedReLuNetwork(*runtime, 1.f),
+                                                LoadBiasedReLuNetwork(*runtime, 100.f) };
+    const std::vector<float> biases{ 1.f, 100.f };
+
+    const unsigned int numInferences = 32;
+    std::vector<std::vector<float>> inputs(numInferences);
+    std::vector<std::vector<float>> outputs(numInferences, std::vector<float>(2));
+    std::vector<std::future<Status>> futures;
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        const armnn::NetworkId netId = netIds[i % 2];
+        inputs[i] = { static_cast<float>(i), -1000.f };
+        futures.push_back(runtime->EnqueueWorkloadAsync(netId,
+            { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputs[i].data()) } },
+            { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputs[i].data()) } }));
+    }
+
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        BOOST_TEST(futures[i].get() == Status::Success);
+        BOOST_TEST(outputs[i][0] == static_cast<float>(i) + biases[i % 2]);
+        BOOST_TEST(outputs[i][1] == 0.f);
+    }
+
+    // Unloading waits for the inferences in flight.
+    std::vector<float> input{ 1.f, 2.f };
+    std::vector<float> output(2);
+    std::promise<Status> lastStatus;
+    runtime->EnqueueWorkloadAsync(netIds[0],
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(netIds[0], 0), input.data()) } },
+        { { 0, Tensor(runtime->GetOutputTensorInfo(netIds[0], 0), output.data()) } },
+        [&lastStatus](Status status) { lastStatus.set_value(status); });
+    BOOST_TEST(runtime->UnloadNetwork(netIds[0]) == Status::Success);
+    BOOST_TEST(lastStatus.get_future().get() == Status::Success);
+    BOOST_TEST(output == std::vector<float>({ 2.f, 3.f }), boost::test_tools::per_element());
+
+    // Inferences of networks which are not loaded are reported as failures, as the samples are.
+    std::future<Status> rejected = runtime->EnqueueWorkloadAsync(netIds[0],
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(netIds[1], 0), input.data()) } },
+        { { 0, Tensor(runtime->GetOutputTensorInfo(netIds[1], 0), output.data()) } });
+    BOOST_TEST((rejected.wait_for(std::chrono::seconds(0)) == std::future_status::ready));
+    BOOST_TEST(rejected.get() == Status::Failure);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeEnqueueWorkloadAsyncPriority)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_NumWorkerThreads = 1;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    const armnn::NetworkId lowNetId = LoadBiasedReLuNetwork(*runtime, 1.f);
+    const armnn::NetworkId highNetId = LoadBiasedReLuNetwork(*runtime, 2.f);
+    BOOST_TEST(runtime->SetNetworkPriority(lowNetId, QosExecPriority::Low) == Status::Success);
+    BOOST_TEST(runtime->SetNetworkPriority(highNetId, QosExecPriority::High) == Status::Success);
+    BOOST_TEST(runtime->SetNetworkPriority(highNetId + 1, QosExecPriority::High) == Status::Failure);
+
+    std::vector<float> input{ 1.f, 2.f };
+    std::vector<std::vector<float>> outputs(3, std::vector<float>(2));
+    auto enqueue = [&](armnn::NetworkId netId, unsigned int outputIndex, InferenceCompleteCallback callback)
+        {
+            runtime->EnqueueWorkloadAsync(netId,
+                { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), input.data()) } },
+                { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputs[outputIndex].data()) } },
+                callback);
+        };
+
+    // Keeps the only worker thread busy while the other inferences get enqueued.
+    std::promise<void> blockerStarted;
+    std::promise<void> releaseBlocker;
+    std::shared_future<void> released = releaseBlocker.get_future().share();
+    enqueue(lowNetId, 0, [&blockerStarted, released](Status)
+        {
+            blockerStarted.set_value();
+            released.wait();
+        });
+    blockerStarted.get_future().wait();
+
+    std::mutex completionMutex;
+    std::vector<armnn::NetworkId> completionOrder;
+    auto recordCompletion = [&](armnn::NetworkId netId)
+        {
+            return [&completionMutex, &completionOrder, netId](Status)
+                {
+                    std::lock_guard<std::mutex> lock(completionMutex);
+                    completionOrder.push_back(netId);
+                };
+        };
+    enqueue(lowNetId, 1, recordCompletion(lowNetId));
+    enqueue(highNetId, 2, recordCompletion(highNetId));
+    releaseBlocker.set_value();
+
+    BOOST_TEST(runtime->UnloadNetwork(lowNetId) == Status::Success);
+    BOOST_TEST(runtime->UnloadNetwork(highNetId) == Status::Success);
+
+    // The high priority inference was enqueued last, but ran first.
+    BOOST_TEST(completionOrder == std::vector<armnn::NetworkId>({ highNetId, lowNetId }),
+               boost::test_tools::per_element());
+    BOOST_TEST(outputs[1] == std::vector<float>({ 2.f, 3.f }), boost::test_tools::per_element());
+    BOOST_TEST(outputs[2] == std::vector<float>({ 3.f, 4.f }), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeInferenceCallbacksCannotUnloadNetworks)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_NumWorkerThreads = 1;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    const armnn::NetworkId netId = LoadBiasedReLuNetwork(*runtime, 1.f);
+
+    std::vector<float> input{ 1.f, 2.f };
+    std::vector<float> output(2);
+
+    // A callback throwing something other than an std::exception does not stop the worker thread.
+    runtime->EnqueueWorkloadAsync(netId,
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), input.data()) } },
+        { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), output.data()) } },
+        [](Status) { throw 42; });
+
+    std::promise<Status> unloadStatus;
+    runtime->EnqueueWorkloadAsync(netId,
+        { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), input.data()) } },
+        { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), output.data()) } },
+        [&runtime, &unloadStatus, netId](Status)
+        {
+            unloadStatus.set_value(runtime->UnloadNetwork(netId));
+        });
+    BOOST_TEST(unloadStatus.get_future().get() == Status::Failure);
+
+    BOOST_TEST(runtime->UnloadNetwork(netId) == Status::Success);
+    BOOST_TEST(output == std::vector<float>({ 2.f, 3.f }), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeRunsIndependentLayersConcurrently)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    options.m_NumInterOpThreads = 4;
+    options.m_NumCpuRefThreads = 2;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    // An inception-like block: four branches of activations computed from the input and merged along the channels.
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+
+    const TensorInfo branchInfo({ 1, 4 }, DataType::Float32);
+    const std::vector<TensorShape> branchShapes(4, branchInfo.GetShape());
+    IConnectableLayer* merger = net->AddMergerLayer(
+        CreateMergerDescriptorForConcatenation(branchShapes.begin(), branchShapes.end(), 1));
+
+    auto addActivation = [&net](ActivationFunction function, float a, float b)
+        {
+            ActivationDescriptor descriptor;
+            descriptor.m_Function = function;
+            descriptor.m_A = a;
+            descriptor.m_B = b;
+            return net->AddActivationLayer(descriptor);
+        };
+    const std::vector<std::vector<IConnectableLayer*>> branches
+    {
+        { addActivation(ActivationFunction::ReLu, 0.f, 0.f) },
+        { addActivation(ActivationFunction::Linear, 2.f, 1.f),
+          addActivation(ActivationFunction::BoundedReLu, 6.f, 0.f) },
+        { addActivation(ActivationFunction::Linear, -1.f, 0.f), addActivation(ActivationFunction::ReLu, 0.f, 0.f) },
+        { addActivation(ActivationFunction::Linear, 10.f, 0.f) },
+    };
+
+    input->GetOutputSlot(0).SetTensorInfo(branchInfo);
+    for (unsigned int i = 0; i < branches.size(); ++i)
+    {
+        IOutputSlot* previous = &input->GetOutputSlot(0);
+        for (IConnectableLayer* layer : branches[i])
+        {
+            previous->Connect(layer->GetInputSlot(0));
+            layer->GetOutputSlot(0).SetTensorInfo(branchInfo);
+            previous = &layer->GetOutputSlot(0);
+        }
+        previous->Connect(merger->GetInputSlot(i));
+    }
+    merger->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    merger->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 16 }, DataType::Float32));
+
+    std::vector<armnn::Compute> backends = { armnn::Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+    armnn::NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        const float offset = static_cast<float>(i);
+        const std::vector<float> inputData{ -2.f - offset, -1.f, 1.f, 3.f + offset };
+        std::vector<float> outputData(16);
+        BOOST_TEST(runtime->EnqueueWorkload(netId,
+            { { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } },
+            { { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } }) == Status::Success);
+
+        const std::vector<float> expectedOutput
+        {
+            0.f, 0.f, 1.f, 3.f + offset,
+            0.f, 0.f, 3.f, 6.f,
+            2.f + offset, 1.f, 0.f, 0.f,
+            -20.f - 10.f * offset, -10.f, 10.f, 30.f + 10.f * offset,
+        };
+        BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeBatchesSamples)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    const armnn::NetworkId netId = LoadBiasedReLuNetwork(*runtime, 1.f, 4);
+    BatchingOptions batchingOptions;
+    batchingOptions.m_Timeout = std::chrono::milliseconds(100);
+    BOOST_TEST(runtime->EnableBatching(netId, batchingOptions) == Status::Success);
+    BOOST_TEST(runtime->EnableBatching(netId, batchingOptions) == Status::Failure);
+    BOOST_TEST(runtime->EnableBatching(netId + 1, batchingOptions) == Status::Failure);
+
+    const TensorInfo sampleInfo({ 1, 2 }, DataType::Float32);
+
+    // Eight samples fill two batches, which are evaluated without waiting for the timeout.
+    const unsigned int numSamples = 8;
+    std::vector<std::vector<float>> inputs(numSamples);
+    std::vector<std::vector<float>> outputs(numSamples, std::vector<float>(2));
+    std::vector<std::future<SampleResult>> futures;
+    for (unsigned int i = 0; i < numSamples; ++i)
+    {
+        inputs[i] = { static_cast<float>(i), -10.f };
+        futures.push_back(runtime->EnqueueSample(netId,
+            { { 0, ConstTensor(sampleInfo, inputs[i].data()) } },
+            { { 0, Tensor(sampleInfo, outputs[i].data()) } }));
+    }
+
+    unsigned int numSamplesInFullBatches = 0;
+    for (unsigned int i = 0; i < numSamples; ++i)
+    {
+        const SampleResult result = futures[i].get();
+        BOOST_TEST(result.m_Status == Status::Success);
+        BOOST_TEST(result.m_BatchSize >= 1);
+        BOOST_TEST(result.m_BatchSize <= 4);
+        numSamplesInFullBatches += result.m_BatchSize == 4 ? 1 : 0;
+        BOOST_TEST(outputs[i] == std::vector<float>({ static_cast<float>(i) + 1.f, 0.f }),
+                   boost::test_tools::per_element());
+    }
+    BOOST_TEST(numSamplesInFullBatches > 0);
+
+    // A single sample is evaluated once it has waited for the timeout.
+    std::vector<float> input{ 5.f, 6.f };
+    std::vector<float> output(2);
+    const SampleResult result = runtime->EnqueueSample(netId,
+        { { 0, ConstTensor(sampleInfo, input.data()) } },
+        { { 0, Tensor(sampleInfo, output.data()) } }).get();
+    BOOST_TEST(result.m_Status == Status::Success);
+    BOOST_TEST(result.m_BatchSize == 1);
+    BOOST_TEST((result.m_QueueWaitTime >= batchingOptions.m_Timeout));
+    BOOST_TEST(output == std::vector<float>({ 6.f, 7.f }), boost::test_tools::per_element());
+
+    // Samples of the wrong size are rejected straight away.
+    const TensorInfo batchInfo({ 4, 2 }, DataType::Float32);
+    std::vector<float> batchData(8);
+    std::future<SampleResult> rejected = runtime->EnqueueSample(netId,
+        { { 0, ConstTensor(batchInfo, batchData.data()) } },
+        { { 0, Tensor(sampleInfo, output.data()) } });
+    BOOST_TEST((rejected.wait_for(std::chrono::seconds(0)) == std::future_status::ready));
+    BOOST_TEST(rejected.get().m_Status == Status::Failure);
+
+    // Unloading evaluates the samples still pending.
+    std::promise<SampleResult> lastResult;
+    runtime->EnqueueSample(netId,
+        { { 0, ConstTensor(sampleInfo, input.data()) } },
+        { { 0, Tensor(sampleInfo, output.data()) } },
+        [&lastResult](const SampleResult& sampleResult) { lastResult.set_value(sampleResult); });
+    BOOST_TEST(runtime->UnloadNetwork(netId) == Status::Success);
+    BOOST_TEST(lastResult.get_future().get().m_Status == Status::Success);
+    const SampleResult unloadedResult = runtime->EnqueueSample(netId,
+        { { 0, ConstTensor(sampleInfo, input.data()) } },
+        { { 0, Tensor(sampleInfo, output.data()) } }).get();
+    BOOST_TEST(unloadedResult.m_Status == Status::Failure);
+    BOOST_TEST(unloadedResult.m_BatchSize == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeBatchingRequiresTheBatchSizeOfTheNetwork)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    const armnn::NetworkId netId = LoadBiasedReLuNetwork(*runtime, 1.f, 2);
+    BatchingOptions batchingOptions;
+    batchingOptions.m_MaxBatchSize = 3;
+    BOOST_TEST(runtime->EnableBatching(netId, batchingOptions) == Status::Failure);
+
+    // Batches smaller than the network are padded.
+    batchingOptions.m_MaxBatchSize = 1;
+    batchingOptions.m_Timeout = std::chrono::seconds(10);
+    BOOST_TEST(runtime->EnableBatching(netId, batchingOptions) == Status::Success);
+
+    const TensorInfo sampleInfo({ 1, 2 }, DataType::Float32);
+    std::vector<float> input{ -5.f, 2.f };
+    std::vector<float> output(2);
+    const SampleResult result = runtime->EnqueueSample(netId,
+        { { 0, ConstTensor(sampleInfo, input.data()) } },
+        { { 0, Tensor(sampleInfo, output.data()) } }).get();
+    BOOST_TEST(result.m_Status == Status::Success);
+    BOOST_TEST(result.m_BatchSize == 1);
+    BOOST_TEST(output == std::vector<float>({ 0.f, 3.f }), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeSampleCallbacksCannotUnloadTheirNetwork)
+{
+    using namespace armnn;
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    const armnn::NetworkId netId = LoadBiasedReLuNetwork(*runtime, 1.f, 2);
+    BatchingOptions batchingOptions;
+    batchingOptions.m_Timeout = std::chrono::milliseconds(1);
+    BOOST_TEST(runtime->EnableBatching(netId, batchingOptions) == Status::Success);
+
+    const TensorInfo sampleInfo({ 1, 2 }, DataType::Float32);
+    std::vector<float> input{ 1.f, 2.f };
+    std::vector<std::vector<float>> outputs(2, std::vector<float>(2));
+
+    // A throwing callback does not stop the batching of the network.
+    runtime->EnqueueSample(netId,
+        { { 0, ConstTensor(sampleInfo, input.data()) } },
+        { { 0, Tensor(sampleInfo, outputs[0].data()) } },
+        [](const SampleResult&) { throw armnn::Exception("callback failed"); });
+    runtime->EnqueueSample(netId,
+        { { 0, ConstTensor(sampleInfo, input.data()) } },
+        { { 0, Tensor(sampleInfo, outputs[0].data()) } },
+        [](const SampleResult&) { throw 42; });
+
+    std::promise<Status> unloadStatus;
+    runtime->EnqueueSample(netId,
+        { { 0, ConstTensor(sampleInfo, input.data()) } },
+        { { 0, Tensor(sampleInfo, outputs[1].data()) } },
+        [&runtime, &unloadStatus, netId](const SampleResult&)
+        {
+            unloadStatus.set_value(runtime->UnloadNetwork(netId));
+        });
+    BOOST_TEST(unloadStatus.get_future().get() == Status::Failure);
+
+    BOOST_TEST(runtime->UnloadNetwork(netId) == Status::Success);
+    BOOST_TEST(outputs[0] == std::vector<float>({ 2.f, 3.f }), boost::test_tools::per_element());
+    BOOST_TEST(outputs[1] == std::vector<float>({ 2.f, 3.f }), boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
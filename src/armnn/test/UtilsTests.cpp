@@ -11,8 +11,81 @@
 #include <armnn/Descriptors.hpp>
 #include <GraphTopologicalSort.hpp>
 #include <Graph.hpp>
+#include <Permute.hpp>
 #include "TypeUtils.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+// Permutes a tensor one element at a time, following the definition of the mappings.
+template <typename T>
+std::vector<T> NaivePermute(const armnn::TensorShape& srcShape, const armnn::PermutationVector& mappings,
+                            const std::vector<T>& src)
+{
+    const armnn::TensorShape dstShape = armnnUtils::Permuted(srcShape, mappings);
+    const unsigned int numDims = srcShape.GetNumDimensions();
+    std::vector<T> dst(src.size());
+    for (unsigned int srcIndex = 0; srcIndex < src.size(); ++srcIndex)
+    {
+        unsigned int coordinates[armnn::MaxNumOfTensorDimensions];
+        unsigned int remainder = srcIndex;
+        for (unsigned int i = numDims; i-- > 0;)
+        {
+            coordinates[i] = remainder % srcShape[i];
+            remainder /= srcShape[i];
+        }
+
+        unsigned int dstIndex = 0;
+        for (unsigned int d = 0; d < numDims; ++d)
+        {
+            const unsigned int srcDim = static_cast<unsigned int>(
+                std::find(mappings.begin(), mappings.end(), d) - mappings.begin());
+            dstIndex = dstIndex * dstShape[d] + coordinates[srcDim];
+        }
+        dst[dstIndex] = src[srcIndex];
+    }
+    return dst;
+}
+
+// Checks every permutation of the dimensions of the shape, both at once and split into uneven ranges of parts.
+template <typename T>
+void CheckAllPermutations(const armnn::TensorShape& shape)
+{
+    std::vector<T> src(shape.GetNumElements());
+    for (unsigned int i = 0; i < src.size(); ++i)
+    {
+        src[i] = static_cast<T>(i % 251);
+    }
+
+    std::vector<unsigned int> order(shape.GetNumDimensions());
+    std::iota(order.begin(), order.end(), 0U);
+    do
+    {
+        const armnn::PermutationVector mappings(order.data(), shape.GetNumDimensions());
+        const armnn::TensorShape dstShape = armnnUtils::Permuted(shape, mappings);
+        const std::vector<T> expected = NaivePermute(shape, mappings, src);
+
+        std::vector<T> dst(src.size());
+        armnnUtils::Permute(dstShape, mappings, src.data(), dst.data());
+        BOOST_TEST(dst == expected);
+
+        const armnnUtils::PermutePlan plan(dstShape, mappings);
+        std::vector<T> dstInParts(src.size());
+        for (unsigned int part = 0; part < plan.GetNumParts(); part += 3)
+        {
+            plan.Execute(src.data(), dstInParts.data(), part, std::min(part + 3, plan.GetNumParts()));
+        }
+        BOOST_TEST(dstInParts == expected);
+    }
+    while (std::next_permutation(order.begin(), order.end()));
+}
+
+} // anonymous namespace
+
 BOOST_AUTO_TEST_SUITE(Utils)
 
 BOOST_AUTO_TEST_CASE(DataTypeSize)
@@ -59,6 +132,17 @@ BOOST_AUTO_TEST_CASE(PermuteDescriptorWithDuplicatedMappings)
     BOOST_CHECK_THROW(armnn::PermuteDescriptor({ 1u, 1u, 0u }), armnn::InvalidArgumentException);
 }
 
+BOOST_AUTO_TEST_CASE(PermuteMatchesElementwiseReference)
+{
+    // Sizes which aren't multiples of the tiles and blocks of the transposes, and dimensions of size 1.
+    CheckAllPermutations<float>(armnn::TensorShape({ 2, 3, 70, 67 }));
+    CheckAllPermutations<uint8_t>(armnn::TensorShape({ 2, 3, 70, 67 }));
+    CheckAllPermutations<int32_t>(armnn::TensorShape({ 1, 130, 1, 9 }));
+    CheckAllPermutations<float>(armnn::TensorShape({ 5, 129, 17 }));
+    CheckAllPermutations<uint8_t>(armnn::TensorShape({ 200, 33 }));
+    CheckAllPermutations<float>(armnn::TensorShape({ 40000 }));
+}
+
 BOOST_AUTO_TEST_CASE(HalfType)
 {
     using namespace half_float::literal;
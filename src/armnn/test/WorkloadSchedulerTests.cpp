@@ -0,0 +1,199 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include <boost/test/unit_test.hpp>
+
+#include "WorkloadScheduler.hpp"
+#include "backends/RefWorkloads/RefThreadPool.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+// Workload calling the given function.
+class FunctionWorkload : public armnn::IWorkload
+{
+public:
+    explicit FunctionWorkload(std::function<void()> function)
+        : m_Function(std::move(function))
+    {
+    }
+
+    virtual void Execute() const override { m_Function(); }
+
+private:
+    std::function<void()> m_Function;
+};
+
+// Records the order in which workloads start and finish.
+class ExecutionLog
+{
+public:
+    explicit ExecutionLog(unsigned int numWorkloads)
+        : m_Clock(0)
+        , m_StartTimes(numWorkloads)
+        , m_FinishTimes(numWorkloads)
+    {
+    }
+
+    std::unique_ptr<armnn::IWorkload> MakeWorkload(unsigned int workload)
+    {
+        return std::make_unique<FunctionWorkload>([this, workload]()
+            {
+                m_StartTimes[workload] = ++m_Clock;
+                std::this_thread::yield();
+                m_FinishTimes[workload] = ++m_Clock;
+            });
+    }
+
+    bool HasStarted(unsigned int workload) const { return m_StartTimes[workload] != 0; }
+    bool IsBefore(unsigned int first, unsigned int second) const
+    {
+        return m_FinishTimes[first] < m_StartTimes[second];
+    }
+
+private:
+    std::atomic<unsigned int> m_Clock;
+    std::vector<unsigned int> m_StartTimes;
+    std::vector<unsigned int> m_FinishTimes;
+};
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(WorkloadScheduler)
+
+BOOST_AUTO_TEST_CASE(WorkloadsRunAfterTheirPredecessors)
+{
+    // Blocks of four independent branches of two workloads, joined by a workload which the next block depends on.
+    const unsigned int numBlocks = 16;
+    const unsigned int workloadsPerBlock = 9;
+    const unsigned int numWorkloads = numBlocks * workloadsPerBlock + 1;
+
+    armnn::WorkloadDependencies dependencies(numWorkloads);
+    for (unsigned int block = 0; block < numBlocks; ++block)
+    {
+        const unsigned int blockInput = block * workloadsPerBlock;
+        const unsigned int blockOutput = blockInput + workloadsPerBlock;
+        for (unsigned int branch = 0; branch < 4; ++branch)
+        {
+            const unsigned int first = blockInput + 1 + 2 * branch;
+            dependencies.AddDependency(blockInput, first);
+            dependencies.AddDependency(first, first + 1);
+            dependencies.AddDependency(first + 1, blockOutput);
+        }
+    }
+
+    armnn::WorkloadScheduler scheduler(4);
+    BOOST_TEST(scheduler.GetNumThreads() == 4);
+
+    for (unsigned int run = 0; run < 8; ++run)
+    {
+        ExecutionLog log(numWorkloads);
+        armnn::WorkloadScheduler::WorkloadQueue workloads;
+        for (unsigned int i = 0; i < numWorkloads; ++i)
+        {
+            workloads.push_back(log.MakeWorkload(i));
+        }
+
+        scheduler.Run(workloads, dependencies);
+
+        for (unsigned int i = 0; i < numWorkloads; ++i)
+        {
+            BOOST_TEST(log.HasStarted(i));
+            for (unsigned int successor : dependencies.GetSuccessors(i))
+            {
+                BOOST_TEST(log.IsBefore(i, successor), "workload " << successor << " started before " << i);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(IndependentWorkloadsRunConcurrently)
+{
+    // Each workload waits for the other to have started, which only happens if they run at the same time.
+    std::mutex mutex;
+    std::condition_variable started;
+    unsigned int numStarted = 0;
+    std::atomic<unsigned int> numMet(0);
+
+    auto meet = [&]()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            ++numStarted;
+            started.notify_all();
+            if (started.wait_for(lock, std::chrono::seconds(10), [&numStarted]() { return numStarted == 2; }))
+            {
+                ++numMet;
+            }
+        };
+
+    armnn::WorkloadScheduler::WorkloadQueue workloads;
+    workloads.push_back(std::make_unique<FunctionWorkload>(meet));
+    workloads.push_back(std::make_unique<FunctionWorkload>(meet));
+
+    armnn::WorkloadScheduler scheduler(2);
+    scheduler.Run(workloads, armnn::WorkloadDependencies(2));
+    BOOST_TEST(numMet == 2);
+}
+
+BOOST_AUTO_TEST_CASE(WorkloadsShareTheThreadPoolOfTheCallingThread)
+{
+    armnn::RefThreadPool threadPool(2);
+    armnn::ScopedRefThreadPool scopedThreadPool(&threadPool);
+
+    std::atomic<unsigned int> numWithThreadPool(0);
+    armnn::WorkloadScheduler::WorkloadQueue workloads;
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        workloads.push_back(std::make_unique<FunctionWorkload>([&]()
+            {
+                if (armnn::ScopedRefThreadPool::GetCurrent() == &threadPool)
+                {
+                    ++numWithThreadPool;
+                }
+            }));
+    }
+
+    armnn::WorkloadScheduler scheduler(3);
+    scheduler.Run(workloads, armnn::WorkloadDependencies(8));
+    BOOST_TEST(numWithThreadPool == 8);
+}
+
+BOOST_AUTO_TEST_CASE(ExceptionSkipsTheWorkloadsNotStartedYet)
+{
+    // A chain of workloads, the second of which throws.
+    const unsigned int numWorkloads = 4;
+    armnn::WorkloadDependencies dependencies(numWorkloads);
+    for (unsigned int i = 1; i < numWorkloads; ++i)
+    {
+        dependencies.AddDependency(i - 1, i);
+    }
+
+    ExecutionLog log(numWorkloads);
+    armnn::WorkloadScheduler::WorkloadQueue workloads;
+    workloads.push_back(log.MakeWorkload(0));
+    workloads.push_back(std::make_unique<FunctionWorkload>([]() { throw std::runtime_error("failed"); }));
+    workloads.push_back(log.MakeWorkload(2));
+    workloads.push_back(log.MakeWorkload(3));
+
+    armnn::WorkloadScheduler scheduler(2);
+    BOOST_CHECK_THROW(scheduler.Run(workloads, dependencies), std::runtime_error);
+    BOOST_TEST(log.HasStarted(0));
+    BOOST_TEST(!log.HasStarted(2));
+    BOOST_TEST(!log.HasStarted(3));
+
+    // The scheduler can still be used afterwards.
+    workloads[1] = log.MakeWorkload(1);
+    scheduler.Run(workloads, dependencies);
+    BOOST_TEST(log.IsBefore(2, 3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
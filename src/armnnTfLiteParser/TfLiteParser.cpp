@@ -25,6 +25,14 @@
 #include <algorithm>
 #include <limits>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
 using namespace armnn;
 using armnn::CheckLocation;
 namespace armnnTfLiteParser
@@ -197,24 +205,24 @@ void CheckBuffer(const TfLiteParser::ModelPtr & model,
 #define CHECK_BUFFER(MODEL, BUFFER_INDEX) \
     CheckBuffer(MODEL, BUFFER_INDEX, CHECK_LOCATION())
 
-void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
+void CheckBufferSize(const std::pair<const uint8_t*, size_t> & bufferData,
                      const armnn::TensorInfo & tensorInfo,
                      uint32_t bufferId,
                      const CheckLocation & location)
 {
-    if (bufferPtr == nullptr)
+    if (bufferData.first == nullptr)
     {
         throw ParseException(
             boost::str(
-                boost::format("BufferPtr is null for buffer:%1%. %2%") %
+                boost::format("Data is null for buffer:%1%. %2%") %
                               bufferId %
                               location.AsString()));
     }
-    else if(tensorInfo.GetNumElements() > bufferPtr->data.size() ||
-            tensorInfo.GetNumBytes() > bufferPtr->data.size())
+    else if(tensorInfo.GetNumElements() > bufferData.second ||
+            tensorInfo.GetNumBytes() > bufferData.second)
     {
         std::stringstream ss;
-        ss << "Buffer #" << bufferId << " has " << bufferPtr->data.size() << " bytes. "
+        ss << "Buffer #" << bufferId << " has " << bufferData.second << " bytes. "
            << "For tensor: " << tensorInfo.GetShape()
            << " expecting: " << tensorInfo.GetNumBytes() << " bytes and "
            << tensorInfo.GetNumElements() << " elements. " << location.AsString();
@@ -222,8 +230,8 @@ void CheckBufferSize(TfLiteParser::BufferRawPtr bufferPtr,
     }
 }
 
-#define CHECK_BUFFER_SIZE(BUFFER_PTR, TENSOR_INFO, BUFFER_ID) \
-    CheckBufferSize(BUFFER_PTR, TENSOR_INFO, BUFFER_ID, CHECK_LOCATION())
+#define CHECK_BUFFER_SIZE(BUFFER_DATA, TENSOR_INFO, BUFFER_ID) \
+    CheckBufferSize(BUFFER_DATA, TENSOR_INFO, BUFFER_ID, CHECK_LOCATION())
 
 bool IsActivationSupported(tflite::ActivationFunctionType activationType)
 {
@@ -356,32 +364,72 @@ armnn::TensorInfo ToTensorInfo(TfLiteParser::TensorRawPtr tensorPtr)
 }
 
 template<typename T>
-std::pair<armnn::ConstTensor, std::unique_ptr<T[]>>
-CreateConstTensorImpl(TfLiteParser::BufferRawPtr bufferPtr,
-                      TfLiteParser::TensorRawPtr tensorPtr,
+armnn::ConstTensor
+CreateConstTensorImpl(const uint8_t * bufferData,
+                      const std::shared_ptr<const uint8_t> & mappedModelFile,
                       armnn::TensorInfo & tensorInfo,
                       bool convertFromTfToArmnnFormat)
 {
-    BOOST_ASSERT_MSG(tensorPtr != nullptr, "tensorPtr is null");
-    BOOST_ASSERT_MSG(bufferPtr != nullptr,
-        boost::str(
-            boost::format("Buffer for buffer:%1% is null") % tensorPtr->buffer).c_str());
+    BOOST_ASSERT_MSG(bufferData != nullptr, "bufferData is null");
+
+    // the data of the mapped model file is referenced rather than copied, unless it needs to be rearranged
+    if (mappedModelFile && !convertFromTfToArmnnFormat &&
+        reinterpret_cast<uintptr_t>(bufferData) % alignof(T) == 0)
+    {
+        return ConstTensor(tensorInfo, std::shared_ptr<const void>(mappedModelFile, bufferData));
+    }
 
-    std::unique_ptr<T[]> data(new T[tensorInfo.GetNumElements()]);
+    std::shared_ptr<T> data(new T[tensorInfo.GetNumElements()], std::default_delete<T[]>());
 
     if (convertFromTfToArmnnFormat)
     {
         tensorInfo = armnnUtils::Permuted(tensorInfo, NHWCToArmNN);
         armnnUtils::Permute(tensorInfo.GetShape(),
                             NHWCToArmNN,
-                            reinterpret_cast<const T *>(bufferPtr->data.data()),
+                            reinterpret_cast<const T *>(bufferData),
                             data.get());
     }
     else
     {
-        ::memcpy(data.get(), bufferPtr->data.data(), tensorInfo.GetNumBytes());
+        ::memcpy(data.get(), bufferData, tensorInfo.GetNumBytes());
+    }
+    return ConstTensor(tensorInfo, std::shared_ptr<const void>(std::move(data)));
+}
+
+void CheckModelBinary(const uint8_t * binaryContent, size_t len)
+{
+    if (binaryContent == nullptr)
+    {
+        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) binary content %1%") %
+                                       CHECK_LOCATION().AsString()));
+    }
+    flatbuffers::Verifier verifier(binaryContent, len);
+    if (verifier.VerifyBuffer<tflite::Model>() == false)
+    {
+        throw ParseException(
+            boost::str(boost::format("Buffer doesn't conform to the expected Tensorflow Lite "
+                                     "flatbuffers format. size:%1% %2%") %
+                       len %
+                       CHECK_LOCATION().AsString()));
+    }
+}
+
+void CheckModelFile(const char * fileName)
+{
+    if (fileName == nullptr)
+    {
+        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) file name %1%") %
+                                       CHECK_LOCATION().AsString()));
+    }
+    boost::system::error_code errorCode;
+    boost::filesystem::path pathToFile(fileName);
+    if (!boost::filesystem::exists(pathToFile, errorCode))
+    {
+        throw FileNotFoundException(boost::str(boost::format("Cannot find the file (%1%) errorCode: %2% %3%") %
+                                    fileName %
+                                    errorCode %
+                                    CHECK_LOCATION().AsString()));
     }
-    return std::make_pair(ConstTensor(tensorInfo, data.get()), std::move(data));
 }
 
 IConnectableLayer* SwizzleIn(INetwork& network,
@@ -436,6 +484,22 @@ std::pair<IConnectableLayer*, IConnectableLayer*> SwizzleInDeswizzleOut(INetwork
     return std::make_pair(swizzleLayer, deswizzleLayer);
 }
 
+/// Sets up the output of a layer standing for an NHWC operator. A layer working on NCHW tensors gets permute layers
+/// to swizzle its input and deswizzle its output, which then stand for the input and output of the operator.
+std::pair<IConnectableLayer*, IConnectableLayer*> SwizzleInDeswizzleOutIfNchw(INetwork& network,
+                                                                              IConnectableLayer* layer,
+                                                                              DataLayout dataLayout,
+                                                                              const TensorInfo & inputInfo,
+                                                                              const TensorInfo & outputInfo)
+{
+    if (dataLayout == DataLayout::NHWC)
+    {
+        layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
+        return std::make_pair(layer, layer);
+    }
+    return SwizzleInDeswizzleOut(network, layer, 0, inputInfo, 0, outputInfo);
+}
+
 armnn::LayerBindingId GenerateLayerBindingId(size_t subgraphIndex, size_t tensorIndex)
 {
     // generate the binding id by shifting the tensor id by 8 bit
@@ -445,8 +509,9 @@ armnn::LayerBindingId GenerateLayerBindingId(size_t subgraphIndex, size_t tensor
 
 } // <anonymous>
 
-TfLiteParser::TfLiteParser()
-: m_Network(nullptr, nullptr)
+TfLiteParser::TfLiteParser(const ITfLiteParser::CreationOptions& options)
+: m_Options(options)
+, m_Network(nullptr, nullptr)
 , m_ParserFunctions(tflite::BuiltinOperator_MAX+1, &TfLiteParser::ParseUnsupportedOperator)
 {
     // register supported operators
@@ -461,6 +526,7 @@ void TfLiteParser::ResetParser()
 {
     m_Network = armnn::INetworkPtr(nullptr, nullptr);
     m_Model = nullptr;
+    m_MappedModelFile = nullptr;
     m_SubgraphConnections.clear();
 }
 
@@ -471,6 +537,15 @@ INetworkPtr TfLiteParser::CreateNetworkFromBinaryFile(const char* graphFile)
     return CreateNetworkFromModel();
 }
 
+INetworkPtr TfLiteParser::CreateNetworkFromMappedBinaryFile(const char* graphFile)
+{
+    ResetParser();
+    size_t len = 0;
+    m_MappedModelFile = MapFile(graphFile, len);
+    m_Model = LoadModelFromBinaryWithoutBufferData(m_MappedModelFile.get(), len);
+    return CreateNetworkFromModel();
+}
+
 INetworkPtr TfLiteParser::CreateNetworkFromBinary(const std::vector<uint8_t> & binaryContent)
 {
     ResetParser();
@@ -659,6 +734,7 @@ void TfLiteParser::ParseAveragePool2D(size_t subgraphIndex, size_t operatorIndex
     desc.m_PoolHeight = CHECKED_NON_NEGATIVE(options->filter_height);
     desc.m_PaddingMethod = PaddingMethod::Exclude;
     desc.m_OutputShapeRounding = OutputShapeRounding::Floor;
+    desc.m_DataLayout = m_Options.m_UseNhwcLayers ? DataLayout::NHWC : DataLayout::NCHW;
 
     auto inputs = GetInputs(m_Model, subgraphIndex, operatorIndex);
     CHECK_VALID_SIZE(inputs.size(), 1);
@@ -680,19 +756,18 @@ void TfLiteParser::ParseAveragePool2D(size_t subgraphIndex, size_t operatorIndex
 
     BOOST_ASSERT(layer != nullptr);
 
-    // add permute layers to swizzle the input and deswizzle the output
-    std::pair<IConnectableLayer*, IConnectableLayer*> permuteLayers =
-            SwizzleInDeswizzleOut(*m_Network, layer, 0, inputTensorInfo, 0, outputTensorInfo);
+    std::pair<IConnectableLayer*, IConnectableLayer*> inOutLayers =
+        SwizzleInDeswizzleOutIfNchw(*m_Network, layer, desc.m_DataLayout, inputTensorInfo, outputTensorInfo);
 
     // register the input connection slots for the layer, connections are made after all layers have been created
     // only the tensors for the inputs are relevant, exclude the const tensors
     auto inputTensorIndexes = AsUnsignedVector(GetInputTensorIds(m_Model, subgraphIndex, operatorIndex));
-    RegisterInputSlots(subgraphIndex, operatorIndex, permuteLayers.first, {inputTensorIndexes[0]});
+    RegisterInputSlots(subgraphIndex, operatorIndex, inOutLayers.first, {inputTensorIndexes[0]});
 
     // we need to add the activation layer and fortunately we don't need to care about the data layout
     // beause the activation function is element-wise, so it is OK to have the activation after the trailing
     // swizzle layer
-    layer = AddActivationLayer(permuteLayers.second, 0, options->fused_activation_function);
+    layer = AddActivationLayer(inOutLayers.second, 0, options->fused_activation_function);
     // register the output connection slots for the layer, connections are made after all layers have been created
     auto outputTensorIndexes = AsUnsignedVector(GetOutputTensorIds(m_Model, subgraphIndex, operatorIndex));
     RegisterOutputSlots(subgraphIndex, operatorIndex, layer, {outputTensorIndexes[0]});
@@ -711,6 +786,7 @@ void TfLiteParser::ParseConv2D(size_t subgraphIndex, size_t operatorIndex)
     desc.m_BiasEnabled = false;
     desc.m_StrideX = CHECKED_NON_NEGATIVE(options->stride_w);
     desc.m_StrideY = CHECKED_NON_NEGATIVE(options->stride_h);
+    desc.m_DataLayout = m_Options.m_UseNhwcLayers ? DataLayout::NHWC : DataLayout::NCHW;
 
     auto inputs = GetInputs(m_Model, subgraphIndex, operatorIndex);
     CHECK_VALID_SIZE(inputs.size(), 2, 3);
@@ -725,15 +801,15 @@ void TfLiteParser::ParseConv2D(size_t subgraphIndex, size_t operatorIndex)
     unsigned int inputHeight = inputTensorInfo.GetShape()[1];
     unsigned int inputWidth  = inputTensorInfo.GetShape()[2];
 
-    // assuming the filter is OHWI : Output, H, W, Input
-    // which is essentially the same as NHWC
+    // the filter is OHWI : Output, H, W, Input, which is the layout of the weights of an NHWC convolution and
+    // is rearranged to OIHW for an NCHW one
     unsigned int filterHeight = filterTensorInfo.GetShape()[1];
     unsigned int filterWidth  = filterTensorInfo.GetShape()[2];
 
     CalcPadding(inputHeight, filterHeight, desc.m_StrideY, desc.m_PadTop, desc.m_PadBottom, options->padding);
     CalcPadding(inputWidth, filterWidth, desc.m_StrideX, desc.m_PadLeft, desc.m_PadRight, options->padding);
 
-    auto filterTensorAndData = CreateConstTensor(inputs[1], filterTensorInfo, true);
+    armnn::ConstTensor filterTensor = CreateConstTensor(inputs[1], filterTensorInfo, !m_Options.m_UseNhwcLayers);
     armnn::IConnectableLayer* layer;
 
     auto layerName = boost::str(boost::format("Conv2D:%1%:%2%") % subgraphIndex % operatorIndex);
@@ -742,35 +818,34 @@ void TfLiteParser::ParseConv2D(size_t subgraphIndex, size_t operatorIndex)
     {
         desc.m_BiasEnabled = true;
         armnn::TensorInfo biasTensorInfo = ToTensorInfo(inputs[2]);
-        auto biasTensorAndData = CreateConstTensor(inputs[2], biasTensorInfo, false);
+        armnn::ConstTensor biasTensor = CreateConstTensor(inputs[2], biasTensorInfo, false);
         layer = m_Network->AddConvolution2dLayer(desc,
-                                                 filterTensorAndData.first,
-                                                 biasTensorAndData.first,
+                                                 filterTensor,
+                                                 biasTensor,
                                                  layerName.c_str());
     }
     else
     {
         layer = m_Network->AddConvolution2dLayer(desc,
-                                                 filterTensorAndData.first,
+                                                 filterTensor,
                                                  layerName.c_str());
     }
 
     BOOST_ASSERT(layer != nullptr);
 
-    // add permute layers to swizzle the input and deswizzle the output
     armnn::TensorInfo outputTensorInfo = ToTensorInfo(outputs[0]);
-    std::pair<IConnectableLayer*, IConnectableLayer*> permuteLayers =
-        SwizzleInDeswizzleOut(*m_Network, layer, 0, inputTensorInfo, 0, outputTensorInfo);
+    std::pair<IConnectableLayer*, IConnectableLayer*> inOutLayers =
+        SwizzleInDeswizzleOutIfNchw(*m_Network, layer, desc.m_DataLayout, inputTensorInfo, outputTensorInfo);
 
     // register the input connection slots for the layer, connections are made after all layers have been created
     // only the tensors for the inputs are relevant, exclude the const tensors
     auto inputTensorIndexes = AsUnsignedVector(GetInputTensorIds(m_Model, subgraphIndex, operatorIndex));
-    RegisterInputSlots(subgraphIndex, operatorIndex, permuteLayers.first, {inputTensorIndexes[0]});
+    RegisterInputSlots(subgraphIndex, operatorIndex, inOutLayers.first, {inputTensorIndexes[0]});
 
     // we need to add the activation layer and fortunately we don't need to care about the data layout
     // beause the activation function is element-wise, so it is OK to have the activation after the trailing
     // swizzle layer
-    layer = AddActivationLayer(permuteLayers.second, 0, options->fused_activation_function);
+    layer = AddActivationLayer(inOutLayers.second, 0, options->fused_activation_function);
     // register the output connection slots for the layer, connections are made after all layers have been created
     auto outputTensorIndexes = AsUnsignedVector(GetOutputTensorIds(m_Model, subgraphIndex, operatorIndex));
     RegisterOutputSlots(subgraphIndex, operatorIndex, layer, {outputTensorIndexes[0]});
@@ -789,6 +864,7 @@ void TfLiteParser::ParseDepthwiseConv2D(size_t subgraphIndex, size_t operatorInd
     desc.m_BiasEnabled = false;
     desc.m_StrideX = CHECKED_NON_NEGATIVE(options->stride_w);
     desc.m_StrideY = CHECKED_NON_NEGATIVE(options->stride_h);
+    desc.m_DataLayout = m_Options.m_UseNhwcLayers ? DataLayout::NHWC : DataLayout::NCHW;
     // ACL only supports a depth (channel) multiplier of 1, it is not currently stored in the descriptor
     CHECK_VALID_SIZE(CHECKED_NON_NEGATIVE(options->depth_multiplier), 1);
 
@@ -803,14 +879,15 @@ void TfLiteParser::ParseDepthwiseConv2D(size_t subgraphIndex, size_t operatorInd
     // assuming input is NHWC
     unsigned int inputHeight = inputTensorInfo.GetShape()[1];
     unsigned int inputWidth  = inputTensorInfo.GetShape()[2];
-    // assuming the filter is OHWI : Output, H, W, Input
+    // the filter is [1, H, W, C], which is the [M, H, W, C] layout of the weights of an NHWC depthwise convolution
+    // and is rearranged to [M, C, H, W] for an NCHW one
     unsigned int filterHeight = filterTensorInfo.GetShape()[1];
     unsigned int filterWidth  = filterTensorInfo.GetShape()[2];
 
     CalcPadding(inputHeight, filterHeight, desc.m_StrideY, desc.m_PadTop, desc.m_PadBottom, options->padding);
     CalcPadding(inputWidth, filterWidth, desc.m_StrideX, desc.m_PadLeft, desc.m_PadRight, options->padding);
 
-    auto filterTensorAndData = CreateConstTensor(inputs[1], filterTensorInfo, true);
+    armnn::ConstTensor filterTensor = CreateConstTensor(inputs[1], filterTensorInfo, !m_Options.m_UseNhwcLayers);
     armnn::IConnectableLayer* layer;
     auto layerName = boost::str(boost::format("DepthwiseConv2D:%1%:%2%") % subgraphIndex % operatorIndex);
 
@@ -818,34 +895,33 @@ void TfLiteParser::ParseDepthwiseConv2D(size_t subgraphIndex, size_t operatorInd
     {
         desc.m_BiasEnabled = true;
         TensorInfo biasTensorInfo = ToTensorInfo(inputs[2]);
-        auto biasTensorAndData = CreateConstTensor(inputs[2], biasTensorInfo, false);
+        armnn::ConstTensor biasTensor = CreateConstTensor(inputs[2], biasTensorInfo, false);
         layer = m_Network->AddDepthwiseConvolution2dLayer(desc,
-                                                          filterTensorAndData.first,
-                                                          biasTensorAndData.first,
+                                                          filterTensor,
+                                                          biasTensor,
                                                           layerName.c_str());
     }
     else
     {
         layer = m_Network->AddDepthwiseConvolution2dLayer(desc,
-                                                          filterTensorAndData.first,
+                                                          filterTensor,
                                                           layerName.c_str());
     }
     BOOST_ASSERT(layer != nullptr);
 
-    // add permute layers to swizzle the input and deswizzle the output
     armnn::TensorInfo outputTensorInfo = ToTensorInfo(outputs[0]);
-    std::pair<IConnectableLayer*, IConnectableLayer*> permuteLayers =
-        SwizzleInDeswizzleOut(*m_Network, layer, 0, inputTensorInfo, 0, outputTensorInfo);
+    std::pair<IConnectableLayer*, IConnectableLayer*> inOutLayers =
+        SwizzleInDeswizzleOutIfNchw(*m_Network, layer, desc.m_DataLayout, inputTensorInfo, outputTensorInfo);
 
     // register the input connection slots for the layer, connections are made after all layers have been created
     // only the tensors for the inputs are relevant, exclude the const tensors
     auto inputTensorIndexes = AsUnsignedVector(GetInputTensorIds(m_Model, subgraphIndex, operatorIndex));
-    RegisterInputSlots(subgraphIndex, operatorIndex, permuteLayers.first, {inputTensorIndexes[0]});
+    RegisterInputSlots(subgraphIndex, operatorIndex, inOutLayers.first, {inputTensorIndexes[0]});
 
     // we need to add the activation layer and fortunately we don't need to care about the data layout
     // beause the activation function is element-wise, so it is OK to have the activation after the trailing
     // swizzle layer
-    layer = AddActivationLayer(permuteLayers.second, 0, options->fused_activation_function);
+    layer = AddActivationLayer(inOutLayers.second, 0, options->fused_activation_function);
     // register the output connection slots for the layer, connections are made after all layers have been created
     auto outputTensorIndexes = AsUnsignedVector(GetOutputTensorIds(m_Model, subgraphIndex, operatorIndex));
     RegisterOutputSlots(subgraphIndex, operatorIndex, layer, {outputTensorIndexes[0]});
@@ -1029,20 +1105,7 @@ armnn::IConnectableLayer* TfLiteParser::AddActivationLayer(armnn::IConnectableLa
 
 TfLiteParser::ModelPtr TfLiteParser::LoadModelFromFile(const char * fileName)
 {
-    if (fileName == nullptr)
-    {
-        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) file name %1%") %
-                                       CHECK_LOCATION().AsString()));
-    }
-    boost::system::error_code errorCode;
-    boost::filesystem::path pathToFile(fileName);
-    if (!boost::filesystem::exists(pathToFile, errorCode))
-    {
-        throw FileNotFoundException(boost::str(boost::format("Cannot find the file (%1%) errorCode: %2% %3%") %
-                                    fileName %
-                                    errorCode %
-                                    CHECK_LOCATION().AsString()));
-    }
+    CheckModelFile(fileName);
     std::ifstream file(fileName, std::ios::binary);
     std::string fileContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
     return LoadModelFromBinary(reinterpret_cast<const uint8_t *>(fileContent.c_str()),
@@ -1051,21 +1114,90 @@ TfLiteParser::ModelPtr TfLiteParser::LoadModelFromFile(const char * fileName)
 
 TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinary(const uint8_t * binaryContent, size_t len)
 {
-    if (binaryContent == nullptr)
-     {
-        throw InvalidArgumentException(boost::str(boost::format("Invalid (null) binary content %1%") %
-                                       CHECK_LOCATION().AsString()));
-     }
-    flatbuffers::Verifier verifier(binaryContent, len);
-    if (verifier.VerifyBuffer<tflite::Model>() == false)
+    CheckModelBinary(binaryContent, len);
+    return tflite::UnPackModel(binaryContent);
+}
+
+TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinaryWithoutBufferData(const uint8_t * binaryContent, size_t len)
+{
+    CheckModelBinary(binaryContent, len);
+
+    // unpacks the model table by table, as tflite::UnPackModel would also copy the data of the buffers
+    const tflite::Model * model = tflite::GetModel(binaryContent);
+    ModelPtr result = std::make_unique<tflite::ModelT>();
+    result->version = model->version();
+    if (model->operator_codes() != nullptr)
     {
-        throw ParseException(
-            boost::str(boost::format("Buffer doesn't conform to the expected Tensorflow Lite "
-                                     "flatbuffers format. size:%1% %2%") %
-                       len %
-                       CHECK_LOCATION().AsString()));
+        for (const tflite::OperatorCode * operatorCode : *model->operator_codes())
+        {
+            result->operator_codes.emplace_back(operatorCode->UnPack());
+        }
     }
-    return tflite::UnPackModel(binaryContent);
+    if (model->subgraphs() != nullptr)
+    {
+        for (const tflite::SubGraph * subgraph : *model->subgraphs())
+        {
+            result->subgraphs.emplace_back(subgraph->UnPack());
+        }
+    }
+    if (model->description() != nullptr)
+    {
+        result->description = model->description()->str();
+    }
+    if (model->buffers() != nullptr)
+    {
+        // the buffers are left empty, GetBufferData finds their data in the binary
+        for (size_t i = 0; i < model->buffers()->size(); ++i)
+        {
+            result->buffers.emplace_back(std::make_unique<tflite::BufferT>());
+        }
+    }
+    return result;
+}
+
+std::shared_ptr<const uint8_t> TfLiteParser::MapFile(const char * fileName, size_t & len)
+{
+    CheckModelFile(fileName);
+
+    const int fileDescriptor = open(fileName, O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw FileNotFoundException(boost::str(boost::format("Cannot open the file (%1%): %2% %3%") %
+                                    fileName %
+                                    std::strerror(errno) %
+                                    CHECK_LOCATION().AsString()));
+    }
+
+    struct stat fileStatus;
+    void * mapping = MAP_FAILED;
+    int mapError = EINVAL;
+    if (fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        mapError = errno;
+    }
+    else if (fileStatus.st_size > 0)
+    {
+        len = static_cast<size_t>(fileStatus.st_size);
+        mapping = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        mapError = errno;
+    }
+    // the mapping stays valid after the file is closed
+    close(fileDescriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw ParseException(boost::str(boost::format("Cannot map the file (%1%) into memory: %2% %3%") %
+                             fileName %
+                             std::strerror(mapError) %
+                             CHECK_LOCATION().AsString()));
+    }
+
+    const size_t mappingSize = len;
+    return std::shared_ptr<const uint8_t>(static_cast<const uint8_t *>(mapping),
+                                          [mappingSize](const uint8_t * data)
+                                          {
+                                              munmap(const_cast<uint8_t *>(data), mappingSize);
+                                          });
 }
 
 TfLiteParser::TensorRawPtrVector TfLiteParser::GetInputs(const ModelPtr & model,
@@ -1260,43 +1392,54 @@ TfLiteParser::BufferRawPtr TfLiteParser::GetBuffer(const ModelPtr& model, size_t
     return model->buffers[bufferIndex].get();
 }
 
-std::pair<armnn::ConstTensor, TfLiteParser::SupportedDataStorage>
-TfLiteParser::CreateConstTensor(TensorRawPtr tensorPtr,
-                                armnn::TensorInfo & tensorInfo,
-                                bool convertFromTfToArmnnFormat)
+std::pair<const uint8_t*, size_t> TfLiteParser::GetBufferData(size_t bufferIndex) const
+{
+    BufferRawPtr bufferPtr = GetBuffer(m_Model, bufferIndex);
+    if (!bufferPtr->data.empty() || !m_MappedModelFile)
+    {
+        return std::make_pair(bufferPtr->data.data(), bufferPtr->data.size());
+    }
+
+    const tflite::Model * model = tflite::GetModel(m_MappedModelFile.get());
+    const flatbuffers::Vector<uint8_t> * data =
+        model->buffers()->Get(static_cast<flatbuffers::uoffset_t>(bufferIndex))->data();
+    if (data == nullptr)
+    {
+        return std::make_pair(static_cast<const uint8_t*>(nullptr), size_t(0));
+    }
+    return std::make_pair(data->data(), static_cast<size_t>(data->size()));
+}
+
+armnn::ConstTensor TfLiteParser::CreateConstTensor(TensorRawPtr tensorPtr,
+                                                   armnn::TensorInfo & tensorInfo,
+                                                   bool convertFromTfToArmnnFormat)
 {
     CHECK_TENSOR_PTR(tensorPtr);
-    auto bufferPtr = GetBuffer(m_Model, tensorPtr->buffer);
-    CHECK_BUFFER_SIZE(bufferPtr, tensorInfo, tensorPtr->buffer);
+    auto bufferData = GetBufferData(tensorPtr->buffer);
+    CHECK_BUFFER_SIZE(bufferData, tensorInfo, tensorPtr->buffer);
 
     switch (tensorInfo.GetDataType())
     {
         case armnn::DataType::Float32:
         {
-            auto constData = CreateConstTensorImpl<float>(bufferPtr,
-                                                          tensorPtr,
-                                                          tensorInfo,
-                                                          convertFromTfToArmnnFormat);
-            SupportedDataStorage storage(std::move(constData.second));
-            return std::make_pair(constData.first, std::move(storage));
+            return CreateConstTensorImpl<float>(bufferData.first,
+                                                m_MappedModelFile,
+                                                tensorInfo,
+                                                convertFromTfToArmnnFormat);
         }
         case armnn::DataType::QuantisedAsymm8:
         {
-            auto constData = CreateConstTensorImpl<uint8_t>(bufferPtr,
-                                                            tensorPtr,
-                                                            tensorInfo,
-                                                            convertFromTfToArmnnFormat);
-            SupportedDataStorage storage(std::move(constData.second));
-            return std::make_pair(constData.first, std::move(storage));
+            return CreateConstTensorImpl<uint8_t>(bufferData.first,
+                                                  m_MappedModelFile,
+                                                  tensorInfo,
+                                                  convertFromTfToArmnnFormat);
         }
         case armnn::DataType::Signed32:
         {
-            auto constData = CreateConstTensorImpl<int32_t>(bufferPtr,
-                                                            tensorPtr,
-                                                            tensorInfo,
-                                                            convertFromTfToArmnnFormat);
-            SupportedDataStorage storage(std::move(constData.second));
-            return std::make_pair(constData.first, std::move(storage));
+            return CreateConstTensorImpl<int32_t>(bufferData.first,
+                                                  m_MappedModelFile,
+                                                  tensorInfo,
+                                                  convertFromTfToArmnnFormat);
         }
         default:
         {
@@ -1401,40 +1544,18 @@ std::vector<std::string> TfLiteParser::GetSubgraphOutputTensorNames(size_t subgr
     return result;
 }
 
-ITfLiteParser* ITfLiteParser::CreateRaw()
+ITfLiteParser* ITfLiteParser::CreateRaw(const CreationOptions& options)
 {
-    return new TfLiteParser();
+    return new TfLiteParser(options);
 }
 
-ITfLiteParserPtr ITfLiteParser::Create()
+ITfLiteParserPtr ITfLiteParser::Create(const CreationOptions& options)
 {
-    return ITfLiteParserPtr(CreateRaw(), &ITfLiteParser::Destroy);
+    return ITfLiteParserPtr(CreateRaw(options), &ITfLiteParser::Destroy);
 }
 
 void ITfLiteParser::Destroy(ITfLiteParser* parser)
 {
     delete parser;
 }
-
-TfLiteParser::SupportedDataStorage::SupportedDataStorage(std::unique_ptr<float[]> && data)
-: m_FloatData(std::move(data))
-, m_Uint8Data(nullptr)
-, m_Int32Data(nullptr)
-{
-}
-
-TfLiteParser::SupportedDataStorage::SupportedDataStorage(std::unique_ptr<uint8_t[]> && data)
-: m_FloatData(nullptr)
-, m_Uint8Data(std::move(data))
-, m_Int32Data(nullptr)
-{
-}
-
-TfLiteParser::SupportedDataStorage::SupportedDataStorage(std::unique_ptr<int32_t[]> && data)
-: m_FloatData(nullptr)
-, m_Uint8Data(nullptr)
-, m_Int32Data(std::move(data))
-{
-}
-
 } // armnnTfLiteParser
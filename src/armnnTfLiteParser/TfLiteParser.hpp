@@ -9,6 +9,7 @@
 
 #include <schema_generated.h>
 #include <functional>
+#include <memory>
 #include <vector>
 
 namespace armnnTfLiteParser
@@ -34,6 +35,9 @@ public:
     /// Create the network from a flatbuffers binary file on disk
     virtual armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) override;
 
+    /// Create the network from a flatbuffers binary file on disk, mapped into memory
+    virtual armnn::INetworkPtr CreateNetworkFromMappedBinaryFile(const char* graphFile) override;
+
     /// Create the network from a flatbuffers binary
     virtual armnn::INetworkPtr CreateNetworkFromBinary(const std::vector<uint8_t> & binaryContent) override;
 
@@ -57,13 +61,17 @@ public:
     /// Return the output tensor names for a given subgraph
     virtual std::vector<std::string> GetSubgraphOutputTensorNames(size_t subgraphId) const override;
 
-    TfLiteParser();
+    TfLiteParser(const ITfLiteParser::CreationOptions& options = ITfLiteParser::CreationOptions());
     virtual ~TfLiteParser() {}
 
 public:
     // testable helpers
     static ModelPtr LoadModelFromFile(const char * fileName);
     static ModelPtr LoadModelFromBinary(const uint8_t * binaryContent, size_t len);
+    /// Load the model without copying the data of its buffers, which stays in the binary (see GetBufferData)
+    static ModelPtr LoadModelFromBinaryWithoutBufferData(const uint8_t * binaryContent, size_t len);
+    /// Map a file read-only into memory. The mapping is released with the last reference to it.
+    static std::shared_ptr<const uint8_t> MapFile(const char * fileName, size_t & len);
     static TensorRawPtrVector GetInputs(const ModelPtr & model, size_t subgraphIndex, size_t operatorIndex);
     static TensorRawPtrVector GetOutputs(const ModelPtr & model, size_t subgraphIndex, size_t operatorIndex);
     static TensorIdRawPtrVector GetSubgraphInputs(const ModelPtr & model, size_t subgraphIndex);
@@ -115,27 +123,24 @@ private:
                                                  unsigned int outputSlot,
                                                  tflite::ActivationFunctionType activationType);
 
-    // SupportedDataStorage's purpose is to hold data till we pass over to the network.
-    // We don't care about the content, and we want a single datatype to simplify the code.
-    struct SupportedDataStorage
-    {
-        std::unique_ptr<float[]>    m_FloatData;
-        std::unique_ptr<uint8_t[]>  m_Uint8Data;
-        std::unique_ptr<int32_t[]>  m_Int32Data;
+    /// Return the data of a buffer, which is in the mapped model file if its content was not unpacked
+    std::pair<const uint8_t*, size_t> GetBufferData(size_t bufferIndex) const;
 
-        SupportedDataStorage(std::unique_ptr<float[]> && data);
-        SupportedDataStorage(std::unique_ptr<uint8_t[]> && data);
-        SupportedDataStorage(std::unique_ptr<int32_t[]> && data);
-    };
+    /// The returned tensor shares the ownership of its data with the network, which then doesn't copy it
+    /// The data is rearranged from the OHWI layout of TfLite filters to the OIHW layout of NCHW layers if requested,
+    /// in which case it is copied and tensorInfo is permuted accordingly
+    armnn::ConstTensor CreateConstTensor(TensorRawPtr tensorPtr,
+                                         armnn::TensorInfo & tensorInfo,
+                                         bool convertFromTfToArmnnFormat);
 
-    std::pair<armnn::ConstTensor, SupportedDataStorage> CreateConstTensor(TensorRawPtr tensorPtr,
-                                                                          armnn::TensorInfo & tensorInfo,
-                                                                          bool convertFromTfToArmnnFormat);
+    const ITfLiteParser::CreationOptions  m_Options;
 
     /// The network we're building. Gets cleared after it is passed to the user
     armnn::INetworkPtr                    m_Network;
     std::vector<OperatorParsingFunction>  m_ParserFunctions;
     ModelPtr                              m_Model;
+    /// The model file mapped by CreateNetworkFromMappedBinaryFile, which holds the data of the buffers of m_Model
+    std::shared_ptr<const uint8_t>        m_MappedModelFile;
 
     /// A mapping of an output slot to each of the input slots it should be connected to
     /// The outputSlot is from the layer that creates this tensor as one of its ouputs
@@ -234,6 +234,46 @@ BOOST_FIXTURE_TEST_CASE( ParseConv2DWithBias, SimpleConv2DWithBiasesFixture )
         });
 }
 
+// The filter is rearranged to OIHW for the NCHW layer while parsing, whereas the bias is used straight from the
+// mapped file.
+BOOST_FIXTURE_TEST_CASE( ParseConv2DWithBiasFromMappedFile, SimpleConv2DWithBiasesFixture )
+{
+    SetupFromMappedFile();
+    RunTest<4, uint8_t>(
+        0,
+        {
+            1, 2,
+            3, 4,
+        },
+        {
+            (1*2 + 2*1 + 3*0 + 4*6 + 10)/2,
+            (2*2 + 0*1 + 4*0 + 0*6 + 10)/2,
+            (3*2 + 4*1 + 0*0 + 0*6 + 10)/2,
+            (4*2 + 0*1 + 0*0 + 0*6 + 10)/2
+        });
+}
+
+// An NHWC layer uses the OHWI filter as it is, so both the filter and the bias are used straight from the mapped file.
+BOOST_FIXTURE_TEST_CASE( ParseConv2DWithBiasFromMappedFileWithNhwcLayers, SimpleConv2DWithBiasesFixture )
+{
+    ITfLiteParser::CreationOptions options;
+    options.m_UseNhwcLayers = true;
+    SetParserOptions(options);
+    SetupFromMappedFile();
+    RunTest<4, uint8_t>(
+        0,
+        {
+            1, 2,
+            3, 4,
+        },
+        {
+            (1*2 + 2*1 + 3*0 + 4*6 + 10)/2,
+            (2*2 + 0*1 + 4*0 + 0*6 + 10)/2,
+            (3*2 + 4*1 + 0*0 + 0*6 + 10)/2,
+            (4*2 + 0*1 + 0*0 + 0*6 + 10)/2
+        });
+}
+
 struct Conv2DShapeTestFixture : Conv2DWithBiasesFixture
 {
     static std::string GenerateInts(unsigned int n)
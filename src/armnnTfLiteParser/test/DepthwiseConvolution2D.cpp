@@ -196,4 +196,21 @@ BOOST_FIXTURE_TEST_CASE(ParseDepthwiseConv2DSameBias, DepthwiseConvolution2dSame
           (110+10)/2, (197+10)/2, (158+10)/2 });
 }
 
+BOOST_FIXTURE_TEST_CASE(ParseDepthwiseConv2DSameBiasWithNhwcLayers, DepthwiseConvolution2dSameBiasFixture)
+{
+    ITfLiteParser::CreationOptions options;
+    options.m_UseNhwcLayers = true;
+    SetParserOptions(options);
+    Setup();
+    RunTest<4, uint8_t>(
+        0,
+        { 0, 1, 2,
+          3, 4, 5,
+          6, 7, 8 },
+        // divide the expected values by the output scale, as it is not 1.0
+        { ( 14+10)/2, ( 35+10)/2, ( 38+10)/2,
+          ( 57+10)/2, (120+10)/2, (111+10)/2,
+          (110+10)/2, (197+10)/2, (158+10)/2 });
+}
+
 BOOST_AUTO_TEST_SUITE_END()
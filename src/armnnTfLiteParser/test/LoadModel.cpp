@@ -6,6 +6,7 @@
 #include "ParserFlatbuffersFixture.hpp"
 #include "../TfLiteParser.hpp"
 
+#include <algorithm>
 #include <unistd.h>
 
 using armnnTfLiteParser::TfLiteParser;
@@ -216,6 +217,42 @@ BOOST_FIXTURE_TEST_CASE(LoadModelFromFile, LoadModelFixture)
     remove(fname.c_str());
 }
 
+BOOST_FIXTURE_TEST_CASE(LoadModelFromMappedFile, LoadModelFixture)
+{
+    std::string fname = boost::filesystem::temp_directory_path().string() + "/testtflite-mapped.tflite";
+    bool saved = flatbuffers::SaveFile(fname.c_str(),
+                                       reinterpret_cast<char *>(m_GraphBinary.data()),
+                                       m_GraphBinary.size(), true);
+    BOOST_CHECK_MESSAGE(saved, "Cannot save test file");
+
+    size_t len = 0;
+    std::shared_ptr<const uint8_t> mapping = TfLiteParser::MapFile(fname.c_str(), len);
+    remove(fname.c_str());
+    BOOST_CHECK_EQUAL(len, m_GraphBinary.size());
+    BOOST_CHECK(std::equal(m_GraphBinary.begin(), m_GraphBinary.end(), mapping.get()));
+
+    TfLiteParser::ModelPtr model = TfLiteParser::LoadModelFromBinaryWithoutBufferData(mapping.get(), len);
+    CheckModel(model, 3, 2, { tflite::BuiltinOperator_AVERAGE_POOL_2D, tflite::BuiltinOperator_CONV_2D },
+               2, "Test loading a model", 2);
+    CheckSubgraph(model->subgraphs[0], 2, { 1 }, { 0 }, 1, "");
+    CheckSubgraph(model->subgraphs[1], 3, { 0 }, { 1 }, 1, "");
+    CheckOperator(model->subgraphs[0]->operators[0], 0, { 1 }, { 0 }, tflite::BuiltinOptions_Pool2DOptions,
+                  tflite::CustomOptionsFormat_FLEXBUFFERS);
+    CheckOperator(model->subgraphs[1]->operators[0], 1, { 0, 2 }, { 1 }, tflite::BuiltinOptions_Conv2DOptions,
+                  tflite::CustomOptionsFormat_FLEXBUFFERS);
+    // the data of the buffers stays in the mapping
+    for (auto const & buffer : model->buffers)
+    {
+        BOOST_CHECK(buffer->data.empty());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MapFileNotFound)
+{
+    size_t len = 0;
+    BOOST_CHECK_THROW(TfLiteParser::MapFile("invalidfile.tflite", len), armnn::FileNotFoundException);
+}
+
 BOOST_AUTO_TEST_CASE(LoadNullBinary)
 {
     BOOST_CHECK_THROW(TfLiteParser::LoadModelFromBinary(nullptr, 0), armnn::InvalidArgumentException);
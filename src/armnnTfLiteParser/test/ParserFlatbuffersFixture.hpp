@@ -61,33 +61,62 @@ struct ParserFlatbuffersFixture
 
         for (auto&& runtime : m_Runtimes)
         {
-            armnn::INetworkPtr network =
-                    m_Parser->CreateNetworkFromBinary(m_GraphBinary);
-
-            if (!network) {
-                throw armnn::Exception("The parser failed to create an ArmNN network");
-            }
-
-            auto optimized = Optimize(*network,
-                                      { runtime.second, armnn::Compute::CpuRef },
-                                      runtime.first->GetDeviceSpec());
-            std::string errorMessage;
-
-            armnn::Status ret = runtime.first->LoadNetwork(m_NetworkIdentifier,
-                                                     move(optimized),
-                                                     errorMessage);
-
-            if (ret != armnn::Status::Success)
-            {
-                throw armnn::Exception(
-                    boost::str(
-                        boost::format("The runtime failed to load the network. "
-                                      "Error was: %1%. in %2% [%3%:%4%]") %
-                        errorMessage %
-                        __func__ %
-                        __FILE__ %
-                        __LINE__));
-            }
+            LoadNetwork(runtime, m_Parser->CreateNetworkFromBinary(m_GraphBinary));
+        }
+    }
+
+    /// Replaces the parser with one created with the given options, used by the following calls to Setup().
+    void SetParserOptions(const ITfLiteParser::CreationOptions& options)
+    {
+        m_Parser = ITfLiteParser::Create(options);
+    }
+
+    /// Loads the network again, parsed from a mapped file holding the binary rather than from the binary itself.
+    void SetupFromMappedFile()
+    {
+        const std::string fileName = (boost::filesystem::temp_directory_path() /
+                                      boost::filesystem::unique_path("%%%%-%%%%-%%%%.tflite")).string();
+        bool saved = flatbuffers::SaveFile(fileName.c_str(),
+                                           reinterpret_cast<char *>(m_GraphBinary.data()),
+                                           m_GraphBinary.size(), true);
+        if (!saved) {
+            throw armnn::Exception("Cannot save the binary to " + fileName);
+        }
+
+        for (auto&& runtime : m_Runtimes)
+        {
+            LoadNetwork(runtime, m_Parser->CreateNetworkFromMappedBinaryFile(fileName.c_str()));
+        }
+
+        // the networks keep the mapping of the file alive
+        remove(fileName.c_str());
+    }
+
+    void LoadNetwork(std::pair<armnn::IRuntimePtr, armnn::Compute>& runtime, armnn::INetworkPtr network)
+    {
+        if (!network) {
+            throw armnn::Exception("The parser failed to create an ArmNN network");
+        }
+
+        auto optimized = Optimize(*network,
+                                  { runtime.second, armnn::Compute::CpuRef },
+                                  runtime.first->GetDeviceSpec());
+        std::string errorMessage;
+
+        armnn::Status ret = runtime.first->LoadNetwork(m_NetworkIdentifier,
+                                                 move(optimized),
+                                                 errorMessage);
+
+        if (ret != armnn::Status::Success)
+        {
+            throw armnn::Exception(
+                boost::str(
+                    boost::format("The runtime failed to load the network. "
+                                  "Error was: %1%. in %2% [%3%:%4%]") %
+                    errorMessage %
+                    __func__ %
+                    __FILE__ %
+                    __LINE__));
         }
     }
 
@@ -10,6 +10,7 @@
 #include <armnn/Exceptions.hpp>
 #include <armnn/Descriptors.hpp>
 
+#include <DataLayoutIndexed.hpp>
 #include <GraphTopologicalSort.hpp>
 #include <Permute.hpp>
 #include <VerificationHelpers.hpp>
@@ -369,14 +370,14 @@ const std::map<std::string, TfParser::OperationParsingFunction> TfParser::ms_Ope
     { "Maximum",               &TfParser::ParseMaximum },
 };
 
-ITfParser* ITfParser::CreateRaw()
+ITfParser* ITfParser::CreateRaw(const CreationOptions& options)
 {
-    return new TfParser();
+    return new TfParser(options);
 }
 
-ITfParserPtr ITfParser::Create()
+ITfParserPtr ITfParser::Create(const CreationOptions& options)
 {
-    return ITfParserPtr(CreateRaw(), &ITfParser::Destroy);
+    return ITfParserPtr(CreateRaw(options), &ITfParser::Destroy);
 }
 
 void ITfParser::Destroy(ITfParser* parser)
@@ -494,8 +495,9 @@ private:
 };
 
 
-TfParser::TfParser()
-    : m_Network(nullptr, nullptr)
+TfParser::TfParser(const ITfParser::CreationOptions& options)
+    : m_Options(options)
+    , m_Network(nullptr, nullptr)
 {
 }
 
@@ -709,15 +711,18 @@ public:
         m_Layer->GetOutputSlot(0).SetTensorInfo(m_TensorInfo);
     }
 
-    ConstTensor GetConstTensor(bool swizzleForConvolutionWeights, std::vector<T>& outputTensorData) const
+    ConstTensor GetConstTensor(bool swizzleForConvolutionWeights, std::vector<T>& outputTensorData,
+                               DataLayout dataLayout = DataLayout::NCHW) const
     {
         // Mappings from TensorFlow filter tensors to the ArmNN filter tensors.
         // Tensorflow weights are [H, W, In, Out].
-        // ArmNN weights are [Out, In, H, W].
+        // ArmNN weights are [Out, In, H, W] for NCHW layers and [Out, H, W, In] for NHWC layers.
         static const PermutationVector HWIOToOIHW = {2, 3, 1, 0};
+        static const PermutationVector HWIOToOHWI = {1, 2, 3, 0};
+        const PermutationVector& mapping = dataLayout == DataLayout::NHWC ? HWIOToOHWI : HWIOToOIHW;
 
         const TensorInfo outInfo = swizzleForConvolutionWeights
-                                   ? armnnUtils::Permuted(m_TensorInfo, HWIOToOIHW)
+                                   ? armnnUtils::Permuted(m_TensorInfo, mapping)
                                    : m_TensorInfo;
 
         outputTensorData.resize(m_TensorInfo.GetNumElements());
@@ -725,7 +730,7 @@ public:
         // Copies or swizzles from the permanent storage into the storage the caller provided.
         if (swizzleForConvolutionWeights)
         {
-            armnnUtils::Permute(outInfo.GetShape(), HWIOToOIHW, m_Storage.data(), outputTensorData.data());
+            armnnUtils::Permute(outInfo.GetShape(), mapping, m_Storage.data(), outputTensorData.data());
         }
         else
         {
@@ -1041,28 +1046,31 @@ ParsedTfOperationPtr TfParser::ParseConv2D(const tensorflow::NodeDef& nodeDef,
 
     CHECK_DATA_FORMAT(nodeDef, dataFormat, "Conv2D");
 
-    if (dataFormat == "NHWC")
-    {
-        desc.m_StrideX = strides[2];
-        desc.m_StrideY = strides[1];
-        // Swizzles input to supported memory layout.
-        inputTensorInfo = armnnUtils::Permuted(inputSlot.GetTensorInfo(), NHWCToArmNN);
-    }
-    else if (dataFormat == "NCHW")
+    // The strides are in the data format of the node.
+    const armnnUtils::DataLayoutIndexed nodeDataLayout(dataFormat == "NHWC" ? DataLayout::NHWC : DataLayout::NCHW);
+    desc.m_StrideX = strides[nodeDataLayout.GetWidthIndex()];
+    desc.m_StrideY = strides[nodeDataLayout.GetHeightIndex()];
+
+    // The layer works directly on the data format of the node if NHWC layers are enabled. Otherwise an NHWC input
+    // is swizzled to NCHW and the output is deswizzled back.
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Options.m_UseNhwcLayers ? nodeDataLayout.GetDataLayout()
+                                                                             : DataLayout::NCHW);
+    desc.m_DataLayout = dataLayout.GetDataLayout();
+    const bool swizzle = nodeDataLayout.GetDataLayout() != dataLayout.GetDataLayout();
+    if (swizzle)
     {
-        desc.m_StrideX = strides[3];
-        desc.m_StrideY = strides[2];
+        inputTensorInfo = armnnUtils::Permuted(inputTensorInfo, NHWCToArmNN);
     }
 
-    uint32_t inputHeight = inputTensorInfo.GetShape()[2];
-    uint32_t inputWidth = inputTensorInfo.GetShape()[3];
+    uint32_t inputHeight = inputTensorInfo.GetShape()[dataLayout.GetHeightIndex()];
+    uint32_t inputWidth = inputTensorInfo.GetShape()[dataLayout.GetWidthIndex()];
 
     std::vector<float> outputTensorData;
 
-    ConstTensor weightTensor = weightNode->GetConstTensor(true, outputTensorData);
+    ConstTensor weightTensor = weightNode->GetConstTensor(true, outputTensorData, desc.m_DataLayout);
 
-    uint32_t weightHeight = weightTensor.GetShape()[2];
-    uint32_t weightWidth = weightTensor.GetShape()[3];
+    uint32_t weightHeight = weightTensor.GetShape()[dataLayout.GetHeightIndex()];
+    uint32_t weightWidth = weightTensor.GetShape()[dataLayout.GetWidthIndex()];
 
     bool padding = false;
     TensorInfo outputInfo;
@@ -1072,28 +1080,28 @@ ParsedTfOperationPtr TfParser::ParseConv2D(const tensorflow::NodeDef& nodeDef,
     if (paddingString == "SAME")
     {
         padding = true;
-        outputInfo = TensorInfo({ inputTensorInfo.GetShape()[0],
-                                  weightTensor.GetShape()[0],
-                                  static_cast<uint32_t>(ceil(
-                                      static_cast<float>(inputHeight) /
-                                      static_cast<float>(desc.m_StrideY))),
-                                  static_cast<uint32_t>(ceil(
-                                      static_cast<float>(inputWidth) /
-                                      static_cast<float>(desc.m_StrideX)))
-                                }, DataType::Float32);
+        outputInfo = TensorInfo(dataLayout.GetShape(inputTensorInfo.GetShape()[0],
+                                                    weightTensor.GetShape()[0],
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputHeight) /
+                                                        static_cast<float>(desc.m_StrideY))),
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputWidth) /
+                                                        static_cast<float>(desc.m_StrideX)))),
+                                DataType::Float32);
     }
     else if (paddingString == "VALID")
     {
         padding = false;
-        outputInfo = TensorInfo({ inputTensorInfo.GetShape()[0],
-                                  weightTensor.GetShape()[0],
-                                  static_cast<uint32_t>(ceil(
-                                      static_cast<float>(inputHeight - weightHeight + 1) /
-                                      static_cast<float>(desc.m_StrideY))),
-                                  static_cast<uint32_t>(ceil(
-                                      static_cast<float>(inputWidth - weightWidth + 1) /
-                                      static_cast<float>(desc.m_StrideX)))
-                                }, DataType::Float32);
+        outputInfo = TensorInfo(dataLayout.GetShape(inputTensorInfo.GetShape()[0],
+                                                    weightTensor.GetShape()[0],
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputHeight - weightHeight + 1) /
+                                                        static_cast<float>(desc.m_StrideY))),
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputWidth - weightWidth + 1) /
+                                                        static_cast<float>(desc.m_StrideX)))),
+                                DataType::Float32);
     }
 
     CalcPadding(inputHeight, weightHeight, desc.m_StrideY, desc.m_PadTop, desc.m_PadBottom, padding);
@@ -1102,7 +1110,7 @@ ParsedTfOperationPtr TfParser::ParseConv2D(const tensorflow::NodeDef& nodeDef,
     IConnectableLayer* layer = m_Network->AddConvolution2dLayer(desc, weightTensor, nodeDef.name().c_str());
     layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
 
-    if (dataFormat == "NHWC")
+    if (swizzle)
     {
         layer = SwizzleInDeswizzleOut(*m_Network, inputSlot, *layer, nodeDef.name());
     }
@@ -1145,28 +1153,34 @@ ParsedTfOperationPtr TfParser::ParseDepthwiseConv2D(const tensorflow::NodeDef& n
 
     CHECK_DATA_FORMAT(nodeDef, dataFormat, "DepthwiseConv2dNative");
 
-    if (dataFormat == "NHWC")
-    {
-        desc.m_StrideX = strides[2];
-        desc.m_StrideY = strides[1];
-        // Swizzles input to supported memory layout.
-        inputTensorInfo = armnnUtils::Permuted(inputSlot.GetTensorInfo(), NHWCToArmNN);
-    }
-    else if (dataFormat == "NCHW")
+    // The strides are in the data format of the node.
+    const armnnUtils::DataLayoutIndexed nodeDataLayout(dataFormat == "NHWC" ? DataLayout::NHWC : DataLayout::NCHW);
+    desc.m_StrideX = strides[nodeDataLayout.GetWidthIndex()];
+    desc.m_StrideY = strides[nodeDataLayout.GetHeightIndex()];
+
+    // The layer works directly on the data format of the node if NHWC layers are enabled. Otherwise an NHWC input
+    // is swizzled to NCHW and the output is deswizzled back.
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Options.m_UseNhwcLayers ? nodeDataLayout.GetDataLayout()
+                                                                             : DataLayout::NCHW);
+    desc.m_DataLayout = dataLayout.GetDataLayout();
+    const bool swizzle = nodeDataLayout.GetDataLayout() != dataLayout.GetDataLayout();
+    if (swizzle)
     {
-        desc.m_StrideX = strides[3];
-        desc.m_StrideY = strides[2];
+        inputTensorInfo = armnnUtils::Permuted(inputTensorInfo, NHWCToArmNN);
     }
 
-    uint32_t inputHeight = inputTensorInfo.GetShape()[2];
-    uint32_t inputWidth = inputTensorInfo.GetShape()[3];
+    uint32_t inputHeight = inputTensorInfo.GetShape()[dataLayout.GetHeightIndex()];
+    uint32_t inputWidth = inputTensorInfo.GetShape()[dataLayout.GetWidthIndex()];
 
     std::vector<float> outputTensorData;
 
-    ConstTensor weightTensor = weightNode->GetConstTensor(true, outputTensorData);
+    ConstTensor weightTensor = weightNode->GetConstTensor(true, outputTensorData, desc.m_DataLayout);
 
-    uint32_t weightHeight = weightTensor.GetShape()[2];
-    uint32_t weightWidth = weightTensor.GetShape()[3];
+    uint32_t weightHeight = weightTensor.GetShape()[dataLayout.GetHeightIndex()];
+    uint32_t weightWidth = weightTensor.GetShape()[dataLayout.GetWidthIndex()];
+
+    // The weights are [multiplier, inputChannels, H, W] or [multiplier, H, W, inputChannels].
+    const uint32_t outputChannels = weightTensor.GetShape()[0] * weightTensor.GetShape()[dataLayout.GetChannelsIndex()];
 
     bool padding = false;
     TensorInfo outputInfo;
@@ -1176,28 +1190,28 @@ ParsedTfOperationPtr TfParser::ParseDepthwiseConv2D(const tensorflow::NodeDef& n
     if (paddingString == "SAME")
     {
         padding = true;
-        outputInfo = TensorInfo({ inputTensorInfo.GetShape()[0],
-                                weightTensor.GetShape()[0] * weightTensor.GetShape()[1],
-                                static_cast<uint32_t>(ceil(
-                                    static_cast<float>(inputHeight) /
-                                    static_cast<float>(desc.m_StrideY))),
-                                static_cast<uint32_t>(ceil(
-                                    static_cast<float>(inputWidth) /
-                                    static_cast<float>(desc.m_StrideX)))
-                                }, DataType::Float32);
+        outputInfo = TensorInfo(dataLayout.GetShape(inputTensorInfo.GetShape()[0],
+                                                    outputChannels,
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputHeight) /
+                                                        static_cast<float>(desc.m_StrideY))),
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputWidth) /
+                                                        static_cast<float>(desc.m_StrideX)))),
+                                DataType::Float32);
     }
     else if (paddingString == "VALID")
     {
         padding = false;
-        outputInfo = TensorInfo({ inputTensorInfo.GetShape()[0],
-                                weightTensor.GetShape()[0] * weightTensor.GetShape()[1],
-                                static_cast<uint32_t>(ceil(
-                                    static_cast<float>(inputHeight - weightHeight + 1) /
-                                    static_cast<float>(desc.m_StrideY))),
-                                static_cast<uint32_t>(ceil(
-                                    static_cast<float>(inputWidth - weightWidth + 1) /
-                                    static_cast<float>(desc.m_StrideX)))
-                                }, DataType::Float32);
+        outputInfo = TensorInfo(dataLayout.GetShape(inputTensorInfo.GetShape()[0],
+                                                    outputChannels,
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputHeight - weightHeight + 1) /
+                                                        static_cast<float>(desc.m_StrideY))),
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputWidth - weightWidth + 1) /
+                                                        static_cast<float>(desc.m_StrideX)))),
+                                DataType::Float32);
     }
 
     CalcPadding(inputHeight, weightHeight, desc.m_StrideY, desc.m_PadTop, desc.m_PadBottom, padding);
@@ -1206,7 +1220,7 @@ ParsedTfOperationPtr TfParser::ParseDepthwiseConv2D(const tensorflow::NodeDef& n
     IConnectableLayer* layer = m_Network->AddDepthwiseConvolution2dLayer(desc, weightTensor, nodeDef.name().c_str());
     layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
 
-    if (dataFormat == "NHWC")
+    if (swizzle)
     {
         layer = SwizzleInDeswizzleOut(*m_Network, inputSlot, *layer, nodeDef.name());
     }
@@ -1664,24 +1678,33 @@ ParsedTfOperationPtr TfParser::ParseResizeBilinear(const tensorflow::NodeDef& no
     ResizeBilinearDescriptor desc;
     desc.m_TargetHeight = static_cast<uint32_t> (sizeTensorData[0]);
     desc.m_TargetWidth = static_cast<uint32_t> (sizeTensorData[1]);
+    // TensorFlow ResizeBilinear input is always in BHWC format, which the layer works on directly if NHWC layers are
+    // enabled. Otherwise it is swizzled to NCHW and the output is deswizzled back.
+    desc.m_DataLayout = m_Options.m_UseNhwcLayers ? DataLayout::NHWC : DataLayout::NCHW;
+    const armnnUtils::DataLayoutIndexed dataLayout(desc.m_DataLayout);
 
     IConnectableLayer* layer = m_Network->AddResizeBilinearLayer(desc, nodeDef.name().c_str());
 
     IOutputSlot& inputSlot = inputs[0].m_IndexedValue->ResolveArmnnOutputSlot(inputs[0].m_Index);
     TensorInfo inputTensorInfo = inputSlot.GetTensorInfo();
-    // The input shape is always in BHWC format, this will be swizzled below; for now,
-    // get the batch and channels to make up the ArmNN output shape with the target size.
+    // Gets the batch and channels to make up the output shape with the target size.
     unsigned int outBatch = inputTensorInfo.GetShape()[0];
     unsigned int outChannels = inputTensorInfo.GetShape()[3];
     unsigned int outHeight = desc.m_TargetHeight;
     unsigned int outWidth = desc.m_TargetWidth;
-    TensorShape outShape({outBatch, outChannels, outHeight, outWidth});
+    TensorShape outShape = dataLayout.GetShape(outBatch, outChannels, outHeight, outWidth);
     // The output DataType is always Float32, regardless of the input DataType.
     const TensorInfo outputTensorInfo(outShape, armnn::DataType::Float32);
     layer->GetOutputSlot(0).SetTensorInfo(outputTensorInfo);
 
-    // TensorFlow ResizeBilinear input is always in BHWC format, so add swizzle and deswizzle layers.
-    layer = SwizzleInDeswizzleOut(*m_Network, inputSlot, *layer, nodeDef.name());
+    if (desc.m_DataLayout == DataLayout::NHWC)
+    {
+        inputSlot.Connect(layer->GetInputSlot(0));
+    }
+    else
+    {
+        layer = SwizzleInDeswizzleOut(*m_Network, inputSlot, *layer, nodeDef.name());
+    }
 
     return std::make_unique<SingleLayerParsedTfOperation>(this, nodeDef, layer);
 }
@@ -1796,16 +1819,27 @@ ParsedTfOperationPtr TfParser::ParseLrn(const tensorflow::NodeDef& nodeDef, cons
 
     // The window size must be an odd value. For a window size of (2 * n + 1), TensorFlow defines depth_radius = n.
     normalizationDescriptor.m_NormSize = normalizationDescriptor.m_NormSize * 2 + 1;
+    // TensorFlow LRN input is always in BHWC format, which the layer works on directly if NHWC layers are enabled.
+    // Otherwise it is swizzled to NCHW and the output is deswizzled back.
+    normalizationDescriptor.m_DataLayout = m_Options.m_UseNhwcLayers ? DataLayout::NHWC : DataLayout::NCHW;
 
     IOutputSlot& prevLayerOutputSlot = inputs[0].m_IndexedValue->ResolveArmnnOutputSlot(inputs[0].m_Index);
 
     IConnectableLayer* layer = m_Network->AddNormalizationLayer(normalizationDescriptor,
         nodeDef.name().c_str());
 
-    const TensorInfo permutedInfo = armnnUtils::Permuted(prevLayerOutputSlot.GetTensorInfo(), NHWCToArmNN);
-    layer->GetOutputSlot(0).SetTensorInfo(permutedInfo);
+    if (normalizationDescriptor.m_DataLayout == DataLayout::NHWC)
+    {
+        layer->GetOutputSlot(0).SetTensorInfo(prevLayerOutputSlot.GetTensorInfo());
+        prevLayerOutputSlot.Connect(layer->GetInputSlot(0));
+    }
+    else
+    {
+        const TensorInfo permutedInfo = armnnUtils::Permuted(prevLayerOutputSlot.GetTensorInfo(), NHWCToArmNN);
+        layer->GetOutputSlot(0).SetTensorInfo(permutedInfo);
 
-    layer = SwizzleInDeswizzleOut(*m_Network, prevLayerOutputSlot, *layer, nodeDef.name());
+        layer = SwizzleInDeswizzleOut(*m_Network, prevLayerOutputSlot, *layer, nodeDef.name());
+    }
 
     return std::make_unique<SingleLayerParsedTfOperation>(this, nodeDef, layer);
 }
@@ -2022,25 +2056,27 @@ ParsedTfOperationPtr TfParser::ParsePooling2d(const tensorflow::NodeDef& nodeDef
 
     CHECK_DATA_FORMAT(nodeDef, dataFormat, "Pooling2D");
 
-    if (dataFormat == "NHWC")
-    {
-        pooling2dDescriptor.m_StrideX    = strides[2];
-        pooling2dDescriptor.m_StrideY    = strides[1];
-        pooling2dDescriptor.m_PoolWidth  = ksize[2];
-        pooling2dDescriptor.m_PoolHeight = ksize[1];
-        // Swizzles input to supported memory layout.
-        inputTensorInfo = armnnUtils::Permuted(inputSlot.GetTensorInfo(), NHWCToArmNN);
-    }
-    else if (dataFormat == "NCHW")
+    // The strides and the size of the pool windows are in the data format of the node.
+    const armnnUtils::DataLayoutIndexed nodeDataLayout(dataFormat == "NHWC" ? DataLayout::NHWC : DataLayout::NCHW);
+    pooling2dDescriptor.m_StrideX    = strides[nodeDataLayout.GetWidthIndex()];
+    pooling2dDescriptor.m_StrideY    = strides[nodeDataLayout.GetHeightIndex()];
+    pooling2dDescriptor.m_PoolWidth  = ksize[nodeDataLayout.GetWidthIndex()];
+    pooling2dDescriptor.m_PoolHeight = ksize[nodeDataLayout.GetHeightIndex()];
+
+    // The layer works directly on the data format of the node if NHWC layers are enabled. Otherwise an NHWC input
+    // is swizzled to NCHW and the output is deswizzled back.
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Options.m_UseNhwcLayers ? nodeDataLayout.GetDataLayout()
+                                                                             : DataLayout::NCHW);
+    pooling2dDescriptor.m_DataLayout = dataLayout.GetDataLayout();
+    const bool swizzle = nodeDataLayout.GetDataLayout() != dataLayout.GetDataLayout();
+    if (swizzle)
     {
-        pooling2dDescriptor.m_StrideX    = strides[3];
-        pooling2dDescriptor.m_StrideY    = strides[2];
-        pooling2dDescriptor.m_PoolWidth  = ksize[3];
-        pooling2dDescriptor.m_PoolHeight = ksize[2];
+        inputTensorInfo = armnnUtils::Permuted(inputTensorInfo, NHWCToArmNN);
     }
 
-    uint32_t inputHeight = inputTensorInfo.GetShape()[2];
-    uint32_t inputWidth = inputTensorInfo.GetShape()[3];
+    uint32_t inputHeight = inputTensorInfo.GetShape()[dataLayout.GetHeightIndex()];
+    uint32_t inputWidth = inputTensorInfo.GetShape()[dataLayout.GetWidthIndex()];
+    uint32_t inputChannels = inputTensorInfo.GetShape()[dataLayout.GetChannelsIndex()];
 
     bool padding = false;
     TensorInfo outputInfo;
@@ -2050,28 +2086,30 @@ ParsedTfOperationPtr TfParser::ParsePooling2d(const tensorflow::NodeDef& nodeDef
     if (paddingString == "SAME")
     {
         padding = true;
-        outputInfo = TensorInfo({ inputTensorInfo.GetShape()[0],
-                                  inputTensorInfo.GetShape()[1],
-                                  static_cast<uint32_t>(ceil(
-                                      static_cast<float>(inputHeight) /
-                                      static_cast<float>(pooling2dDescriptor.m_StrideY))),
-                                  static_cast<uint32_t>(ceil(
-                                      static_cast<float>(inputWidth) /
-                                      static_cast<float>(pooling2dDescriptor.m_StrideX)))
-                                }, DataType::Float32);
+        outputInfo = TensorInfo(dataLayout.GetShape(inputTensorInfo.GetShape()[0],
+                                                    inputChannels,
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputHeight) /
+                                                        static_cast<float>(pooling2dDescriptor.m_StrideY))),
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(inputWidth) /
+                                                        static_cast<float>(pooling2dDescriptor.m_StrideX)))),
+                                DataType::Float32);
     }
     else if (paddingString == "VALID")
     {
         padding = false;
-        outputInfo = TensorInfo({ inputTensorInfo.GetShape()[0],
-                                  inputTensorInfo.GetShape()[1],
-                                  static_cast<uint32_t>(ceil(
-                                      static_cast<float>(inputHeight - pooling2dDescriptor.m_PoolHeight + 1) /
-                                      static_cast<float>(pooling2dDescriptor.m_StrideY))),
-                                  static_cast<uint32_t>(ceil(
-                                      static_cast<float>(inputWidth - pooling2dDescriptor.m_PoolWidth + 1) /
-                                      static_cast<float>(pooling2dDescriptor.m_StrideX)))
-                                }, DataType::Float32);
+        outputInfo = TensorInfo(dataLayout.GetShape(inputTensorInfo.GetShape()[0],
+                                                    inputChannels,
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(
+                                                            inputHeight - pooling2dDescriptor.m_PoolHeight + 1) /
+                                                        static_cast<float>(pooling2dDescriptor.m_StrideY))),
+                                                    static_cast<uint32_t>(ceil(
+                                                        static_cast<float>(
+                                                            inputWidth - pooling2dDescriptor.m_PoolWidth + 1) /
+                                                        static_cast<float>(pooling2dDescriptor.m_StrideX)))),
+                                DataType::Float32);
     }
 
     CalcPadding(inputWidth, pooling2dDescriptor.m_PoolWidth, pooling2dDescriptor.m_StrideX,
@@ -2093,7 +2131,7 @@ ParsedTfOperationPtr TfParser::ParsePooling2d(const tensorflow::NodeDef& nodeDef
 
     layer->GetOutputSlot(0).SetTensorInfo(outputInfo);
 
-    if (dataFormat == "NHWC")
+    if (swizzle)
     {
         layer = SwizzleInDeswizzleOut(*m_Network, inputSlot, *layer, nodeDef.name());
     }
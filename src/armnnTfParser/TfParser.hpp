@@ -89,7 +89,7 @@ public:
     virtual BindingPointInfo GetNetworkOutputBindingInfo(const std::string& name) const override;
 
 public:
-    TfParser();
+    TfParser(const ITfParser::CreationOptions& options = ITfParser::CreationOptions());
 
 private:
     template <typename T>
@@ -185,6 +185,8 @@ private:
 
     void Cleanup();
 
+    const ITfParser::CreationOptions m_Options;
+
     /// The network we're building. Gets cleared after it is passed to the user.
     armnn::INetworkPtr m_Network;
 
@@ -179,6 +179,15 @@ BOOST_FIXTURE_TEST_CASE(ParseConv2DStride2Same, Convolution2dStride2SameFixture)
     RunTest<4>({1, 2, 3, 4, 5, 6, 7, 8, 9}, {2, 4, 6.5, 8.5, 11, 13});
 }
 
+BOOST_FIXTURE_TEST_CASE(ParseConv2DStride2SameWithNhwcLayers, Convolution2dStride2SameFixture)
+{
+    armnnTfParser::ITfParser::CreationOptions options;
+    options.m_UseNhwcLayers = true;
+    SetParserOptions(options);
+    SetupSingleInputSingleOutput({ 1, 3, 3, 1 }, "graphInput", "potato");
+    RunTest<4>({1, 2, 3, 4, 5, 6, 7, 8, 9}, {2, 4, 6.5, 8.5, 11, 13});
+}
+
 
 struct Convolution2dStride2ValidFixture : Convolution2dFixture
 {
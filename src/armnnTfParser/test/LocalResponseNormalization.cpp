@@ -114,6 +114,21 @@ BOOST_FIXTURE_TEST_CASE(ParseLocalResponseNormalization, LocalResponseNormalizat
                 0.071038246f, 0.07650273f, 0.062240668f, 0.066390045f, 0.055374593f, 0.05863192f});
 }
 
+BOOST_FIXTURE_TEST_CASE(ParseLocalResponseNormalizationWithNhwcLayers, LocalResponseNormalizationFixture)
+{
+    armnnTfParser::ITfParser::CreationOptions options;
+    options.m_UseNhwcLayers = true;
+    SetParserOptions(options);
+    SetupSingleInputSingleOutput({1, 3, 3, 2}, "Placeholder", "LRN");
+    RunTest<4>({ 1.0f,  2.0f,  3.0f,  4.0f,  5.0f,  6.0f,
+                 7.0f,  8.0f,  9.0f, 10.0f, 11.0f, 12.0f,
+                13.0f, 14.0f, 15.0f, 16.0f, 17.0f, 18.0f},
+
+               {0.333333340f, 0.66666670f, 0.230769250f, 0.307692320f, 0.161290320f, 0.19354838f,
+                0.122807020f, 0.14035088f, 0.098901100f, 0.109890110f, 0.082706770f, 0.09022556f,
+                0.071038246f, 0.07650273f, 0.062240668f, 0.066390045f, 0.055374593f, 0.05863192f});
+}
+
 
 
 
@@ -0,0 +1,59 @@
+﻿//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+namespace armnnUtils
+{
+
+/// Provides the positions of the channels, height and width dimensions of the 4D tensors of a data layout.
+class DataLayoutIndexed
+{
+public:
+    DataLayoutIndexed(armnn::DataLayout dataLayout)
+        : m_DataLayout(dataLayout)
+        , m_ChannelsIndex(dataLayout == armnn::DataLayout::NHWC ? 3u : 1u)
+        , m_HeightIndex(dataLayout == armnn::DataLayout::NHWC ? 1u : 2u)
+        , m_WidthIndex(dataLayout == armnn::DataLayout::NHWC ? 2u : 3u)
+    {
+    }
+
+    armnn::DataLayout GetDataLayout() const { return m_DataLayout; }
+    unsigned int GetChannelsIndex() const { return m_ChannelsIndex; }
+    unsigned int GetHeightIndex() const { return m_HeightIndex; }
+    unsigned int GetWidthIndex() const { return m_WidthIndex; }
+
+    /// Returns the shape of a tensor of this data layout with the given dimensions.
+    armnn::TensorShape GetShape(unsigned int batches, unsigned int channels,
+                                unsigned int height, unsigned int width) const
+    {
+        if (m_DataLayout == armnn::DataLayout::NHWC)
+        {
+            return armnn::TensorShape({ batches, height, width, channels });
+        }
+        return armnn::TensorShape({ batches, channels, height, width });
+    }
+
+    /// Returns the offset of element (batch, channel, y, x) in the data of a tensor of the given shape.
+    unsigned int GetIndex(const armnn::TensorShape& shape,
+                          unsigned int batch, unsigned int channel, unsigned int y, unsigned int x) const
+    {
+        if (m_DataLayout == armnn::DataLayout::NHWC)
+        {
+            return ((batch * shape[1] + y) * shape[2] + x) * shape[3] + channel;
+        }
+        return ((batch * shape[1] + channel) * shape[2] + y) * shape[3] + x;
+    }
+
+private:
+    armnn::DataLayout m_DataLayout;
+    unsigned int m_ChannelsIndex;
+    unsigned int m_HeightIndex;
+    unsigned int m_WidthIndex;
+};
+
+} // namespace armnnUtils
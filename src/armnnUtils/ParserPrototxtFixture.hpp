@@ -46,6 +46,13 @@ struct ParserPrototxtFixture
     void Setup();
     /// @}
 
+    /// Replaces the parser with one created with the given options, used by the following calls to Setup().
+    template <typename TOptions>
+    void SetParserOptions(const TOptions& options)
+    {
+        m_Parser = TParser::Create(options);
+    }
+
     /// Executes the network with the given input tensor and checks the result against the given output tensor.
     /// This overload assumes that the network has a single input and a single output.
     template <std::size_t NumOutputDimensions>
@@ -7,71 +7,90 @@
 
 #include <armnn/Tensor.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 namespace
 {
 
-class PermuteLoop
-{
-public:
-    using size_type = unsigned int;
-
-    PermuteLoop(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings)
-        : m_DstShape(dstShape)
-    {
-        assert(dstShape.GetNumDimensions() == mappings.GetSize());
+/// Number of elements copied by each part of a plain copy.
+constexpr unsigned int CopyPartSize = 16384;
 
-        const size_type numDims = dstShape.GetNumDimensions();
+/// Size of the blocks of rows and columns transposed by each part of a transpose.
+constexpr unsigned int BlockSize = 64;
 
-        size_type srcStride = 1U;
-        size_type dstStride = 1U;
+/// Tiles of 64 bytes wide are transposed at once, so that the cache lines they read and write are used in full.
+template <typename T>
+constexpr unsigned int GetTileSize()
+{
+    return 64 / sizeof(T) < 8 ? 8 : static_cast<unsigned int>(64 / sizeof(T));
+}
 
-        for (size_type i = numDims - 1U, k = 0U; k < numDims; ++k, --i)
+/// Transposes rows x columns elements, which are contiguous along the rows in the source and along the columns in
+/// the destination.
+template <typename T>
+inline void TransposeTile(const T* src, T* dst, unsigned int rows, unsigned int columns,
+                          unsigned int srcColumnStride, unsigned int dstRowStride)
+{
+    for (unsigned int row = 0; row < rows; ++row)
+    {
+        for (unsigned int column = 0; column < columns; ++column)
         {
-            m_SrcStrides[mappings[i]] = srcStride;
-            m_DstStrides[i] = dstStride;
-
-            srcStride *= dstShape[mappings[i]];
-            dstStride *= dstShape[i];
+            dst[row * dstRowStride + column] = src[row + column * srcColumnStride];
         }
     }
+}
 
-    template <typename T>
-    void Unroll(const T* srcData, T* dstData)
+/// Transposes a block whose rows or columns are few, such as the channels of an image, with the small size known
+/// at compile time so that the loop over it is unrolled.
+template <typename T, unsigned int NumColumns>
+inline void TransposeNarrowColumns(const T* src, T* dst, unsigned int rows,
+                                   unsigned int srcColumnStride, unsigned int dstRowStride)
+{
+    for (unsigned int row = 0; row < rows; ++row)
     {
-        const T* const srcEnd = srcData + m_DstShape.GetNumElements();
-        T* const       dstEnd = dstData + m_DstShape.GetNumElements();
-        Unroll(0, srcData, dstData, srcEnd, dstEnd);
+        for (unsigned int column = 0; column < NumColumns; ++column)
+        {
+            dst[row * dstRowStride + column] = src[row + column * srcColumnStride];
+        }
     }
+}
 
-private:
-    template <typename T>
-    void Unroll(size_type dimension, const T* srcData, T* dstData, const T* srcEnd, T* dstEnd)
+template <typename T, unsigned int NumRows>
+inline void TransposeNarrowRows(const T* src, T* dst, unsigned int columns,
+                                unsigned int srcColumnStride, unsigned int dstRowStride)
+{
+    for (unsigned int column = 0; column < columns; ++column)
     {
-        assert(srcData < srcEnd);
-        assert(dstData < dstEnd);
-
-        if (dimension >= m_DstShape.GetNumDimensions())
+        for (unsigned int row = 0; row < NumRows; ++row)
         {
-            *dstData = *srcData;
-        }
-        else
-        {
-            for (size_type i = 0; i < m_DstShape[dimension]; i++)
-            {
-                Unroll(dimension + 1, srcData, dstData, srcEnd, dstEnd);
-
-                srcData += m_SrcStrides[dimension];
-                dstData += m_DstStrides[dimension];
-            }
+            dst[row * dstRowStride + column] = src[row + column * srcColumnStride];
         }
     }
+}
 
-    armnn::TensorShape m_DstShape;
-    std::array<size_type, armnn::MaxNumOfTensorDimensions> m_SrcStrides;
-    std::array<size_type, armnn::MaxNumOfTensorDimensions> m_DstStrides;
-};
+/// Transposes a block of rows x columns elements with one of the kernels above, returning false if neither size is
+/// small enough.
+template <typename T>
+bool TransposeNarrowBlock(const T* src, T* dst, unsigned int rows, unsigned int columns,
+                          unsigned int srcColumnStride, unsigned int dstRowStride)
+{
+    switch (columns)
+    {
+        case 2: TransposeNarrowColumns<T, 2>(src, dst, rows, srcColumnStride, dstRowStride); return true;
+        case 3: TransposeNarrowColumns<T, 3>(src, dst, rows, srcColumnStride, dstRowStride); return true;
+        case 4: TransposeNarrowColumns<T, 4>(src, dst, rows, srcColumnStride, dstRowStride); return true;
+        default: break;
+    }
+    switch (rows)
+    {
+        case 2: TransposeNarrowRows<T, 2>(src, dst, columns, srcColumnStride, dstRowStride); return true;
+        case 3: TransposeNarrowRows<T, 3>(src, dst, columns, srcColumnStride, dstRowStride); return true;
+        case 4: TransposeNarrowRows<T, 4>(src, dst, columns, srcColumnStride, dstRowStride); return true;
+        default: return false;
+    }
+}
 
 } // namespace
 
@@ -104,7 +123,201 @@ armnn::TensorInfo Permuted(const armnn::TensorInfo& info, const armnn::Permutati
 template <typename T>
 void Permute(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings, const T* src, T* dst)
 {
-    PermuteLoop(dstShape, mappings).Unroll(src, dst);
+    PermutePlan(dstShape, mappings).Execute(src, dst);
+}
+
+PermutePlan::PermutePlan(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings)
+    : m_Method(Method::Copy)
+    , m_NumElements(dstShape.GetNumElements())
+    , m_NumParts(0)
+    , m_NumDimensions(0)
+    , m_NumOuterDimensions(0)
+    , m_TransposedDimension(0)
+    , m_NumRowBlocks(0)
+    , m_NumColumnBlocks(0)
+{
+    assert(dstShape.GetNumDimensions() == mappings.GetSize());
+
+    const unsigned int numDims = dstShape.GetNumDimensions();
+
+    // Gets the stride in the source of the elements of each dimension of the destination.
+    Dimensions srcStrides;
+    unsigned int srcStride = 1U;
+    for (unsigned int i = numDims; i-- > 0U;)
+    {
+        srcStrides[mappings[i]] = srcStride;
+        srcStride *= dstShape[mappings[i]];
+    }
+
+    // Merges each dimension with the previous one when they are also next to each other, in the same order, in the
+    // source. Dimensions of size 1 don't move any element, so they are left out.
+    for (unsigned int i = 0U; i < numDims; ++i)
+    {
+        if (dstShape[i] == 1U)
+        {
+            continue;
+        }
+
+        if (m_NumDimensions > 0U && m_SrcStrides[m_NumDimensions - 1] == srcStrides[i] * dstShape[i])
+        {
+            m_Sizes[m_NumDimensions - 1] *= dstShape[i];
+            m_SrcStrides[m_NumDimensions - 1] = srcStrides[i];
+        }
+        else
+        {
+            m_Sizes[m_NumDimensions] = dstShape[i];
+            m_SrcStrides[m_NumDimensions] = srcStrides[i];
+            ++m_NumDimensions;
+        }
+    }
+
+    unsigned int dstStride = 1U;
+    for (unsigned int i = m_NumDimensions; i-- > 0U;)
+    {
+        m_DstStrides[i] = dstStride;
+        dstStride *= m_Sizes[i];
+    }
+
+    if (m_NumDimensions <= 1U)
+    {
+        // The elements stay in the same order.
+        m_Method = Method::Copy;
+        m_NumParts = (m_NumElements + CopyPartSize - 1) / CopyPartSize;
+        return;
+    }
+
+    const unsigned int innermost = m_NumDimensions - 1;
+    if (m_SrcStrides[innermost] == 1U)
+    {
+        m_Method = Method::CopyRows;
+    }
+    else
+    {
+        m_Method = Method::Transpose;
+        m_TransposedDimension = static_cast<unsigned int>(
+            std::find(m_SrcStrides.begin(), m_SrcStrides.begin() + m_NumDimensions, 1U) - m_SrcStrides.begin());
+        assert(m_TransposedDimension < innermost);
+    }
+
+    unsigned int numOuter = 1U;
+    for (unsigned int i = 0U; i < innermost; ++i)
+    {
+        if (m_Method == Method::CopyRows || i != m_TransposedDimension)
+        {
+            m_OuterDimensions[m_NumOuterDimensions++] = i;
+            numOuter *= m_Sizes[i];
+        }
+    }
+
+    if (m_Method == Method::CopyRows)
+    {
+        m_NumParts = numOuter;
+    }
+    else
+    {
+        m_NumRowBlocks = (m_Sizes[m_TransposedDimension] + BlockSize - 1) / BlockSize;
+        m_NumColumnBlocks = (m_Sizes[innermost] + BlockSize - 1) / BlockSize;
+        m_NumParts = numOuter * m_NumRowBlocks * m_NumColumnBlocks;
+    }
+}
+
+void PermutePlan::GetOuterOffsets(unsigned int outerIndex, unsigned int& srcOffset, unsigned int& dstOffset) const
+{
+    srcOffset = 0U;
+    dstOffset = 0U;
+    for (unsigned int i = m_NumOuterDimensions; i-- > 0U;)
+    {
+        const unsigned int dimension = m_OuterDimensions[i];
+        const unsigned int index = outerIndex % m_Sizes[dimension];
+        outerIndex /= m_Sizes[dimension];
+        srcOffset += index * m_SrcStrides[dimension];
+        dstOffset += index * m_DstStrides[dimension];
+    }
+}
+
+template <typename T>
+void PermutePlan::Execute(const T* src, T* dst, unsigned int partBegin, unsigned int partEnd) const
+{
+    assert(partBegin <= partEnd && partEnd <= m_NumParts);
+
+    switch (m_Method)
+    {
+        case Method::Copy:
+        {
+            const unsigned int begin = partBegin * CopyPartSize;
+            const unsigned int end = std::min(partEnd * CopyPartSize, m_NumElements);
+            if (begin < end)
+            {
+                std::memcpy(dst + begin, src + begin, (end - begin) * sizeof(T));
+            }
+            break;
+        }
+        case Method::CopyRows:
+        {
+            const unsigned int rowSize = m_Sizes[m_NumDimensions - 1];
+            for (unsigned int part = partBegin; part < partEnd; ++part)
+            {
+                unsigned int srcOffset;
+                unsigned int dstOffset;
+                GetOuterOffsets(part, srcOffset, dstOffset);
+                std::memcpy(dst + dstOffset, src + srcOffset, rowSize * sizeof(T));
+            }
+            break;
+        }
+        case Method::Transpose:
+        {
+            // The rows are along the dimension which is contiguous in the source and the columns along the
+            // innermost dimension, which is contiguous in the destination.
+            constexpr unsigned int tileSize = GetTileSize<T>();
+            const unsigned int numRows = m_Sizes[m_TransposedDimension];
+            const unsigned int numColumns = m_Sizes[m_NumDimensions - 1];
+            const unsigned int srcColumnStride = m_SrcStrides[m_NumDimensions - 1];
+            const unsigned int dstRowStride = m_DstStrides[m_TransposedDimension];
+
+            for (unsigned int part = partBegin; part < partEnd; ++part)
+            {
+                const unsigned int columnBlock = part % m_NumColumnBlocks;
+                const unsigned int rowBlock = (part / m_NumColumnBlocks) % m_NumRowBlocks;
+                unsigned int srcOffset;
+                unsigned int dstOffset;
+                GetOuterOffsets(part / (m_NumColumnBlocks * m_NumRowBlocks), srcOffset, dstOffset);
+
+                const unsigned int firstRow = rowBlock * BlockSize;
+                const unsigned int firstColumn = columnBlock * BlockSize;
+                const unsigned int rows = std::min(BlockSize, numRows - firstRow);
+                const unsigned int columns = std::min(BlockSize, numColumns - firstColumn);
+                const T* const blockSrc = src + srcOffset + firstRow + firstColumn * srcColumnStride;
+                T* const blockDst = dst + dstOffset + firstRow * dstRowStride + firstColumn;
+
+                if (TransposeNarrowBlock(blockSrc, blockDst, rows, columns, srcColumnStride, dstRowStride))
+                {
+                    continue;
+                }
+
+                for (unsigned int row = 0; row < rows; row += tileSize)
+                {
+                    const unsigned int tileRows = std::min(tileSize, rows - row);
+                    for (unsigned int column = 0; column < columns; column += tileSize)
+                    {
+                        const unsigned int tileColumns = std::min(tileSize, columns - column);
+                        const T* const tileSrc = blockSrc + row + column * srcColumnStride;
+                        T* const tileDst = blockDst + row * dstRowStride + column;
+
+                        // Full tiles have a constant size, which lets the compiler unroll and vectorise them.
+                        if (tileRows == tileSize && tileColumns == tileSize)
+                        {
+                            TransposeTile(tileSrc, tileDst, tileSize, tileSize, srcColumnStride, dstRowStride);
+                        }
+                        else
+                        {
+                            TransposeTile(tileSrc, tileDst, tileRows, tileColumns, srcColumnStride, dstRowStride);
+                        }
+                    }
+                }
+            }
+            break;
+        }
+    }
 }
 
 // Instantiates for types.
@@ -115,4 +328,10 @@ template void Permute(const armnn::TensorShape& dstShape, const armnn::Permutati
 template void Permute(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings,
                       const int32_t* src, int32_t* dst);
 
+template void PermutePlan::Execute(const float* src, float* dst, unsigned int partBegin, unsigned int partEnd) const;
+template void PermutePlan::Execute(const uint8_t* src, uint8_t* dst,
+                                   unsigned int partBegin, unsigned int partEnd) const;
+template void PermutePlan::Execute(const int32_t* src, int32_t* dst,
+                                   unsigned int partBegin, unsigned int partEnd) const;
+
 } // namespace armnnUtils
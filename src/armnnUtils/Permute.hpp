@@ -7,6 +7,8 @@
 #include <armnn/TensorFwd.hpp>
 #include <armnn/Types.hpp>
 
+#include <array>
+
 namespace armnnUtils
 {
 
@@ -17,4 +19,62 @@ armnn::TensorInfo Permuted(const armnn::TensorInfo& info, const armnn::Permutati
 template <typename T>
 void Permute(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings, const T* src, T* dst);
 
-} // namespace armnnUtils
\ No newline at end of file
+/// Plans the permutation of the elements of a tensor. Dimensions of size 1, and dimensions which stay next to each
+/// other, are merged first. What is left is then either a single copy, copies of contiguous rows (when the
+/// innermost dimension is kept), or cache-blocked transposes of 2D tiles (as for NCHW <-> NHWC).
+/// The work is split into independent parts, so that several threads can share it.
+class PermutePlan
+{
+public:
+    PermutePlan(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings);
+
+    unsigned int GetNumElements() const { return m_NumElements; }
+
+    /// Number of independent parts of the work, each writing its own elements of the destination.
+    unsigned int GetNumParts() const { return m_NumParts; }
+
+    /// Permutes the elements of the parts in [partBegin, partEnd).
+    template <typename T>
+    void Execute(const T* src, T* dst, unsigned int partBegin, unsigned int partEnd) const;
+
+    template <typename T>
+    void Execute(const T* src, T* dst) const
+    {
+        Execute(src, dst, 0, m_NumParts);
+    }
+
+private:
+    enum class Method
+    {
+        Copy,
+        CopyRows,
+        Transpose
+    };
+
+    using Dimensions = std::array<unsigned int, armnn::MaxNumOfTensorDimensions>;
+
+    /// Gets the offsets in the source and the destination of the given index of the outer dimensions.
+    void GetOuterOffsets(unsigned int outerIndex, unsigned int& srcOffset, unsigned int& dstOffset) const;
+
+    Method m_Method;
+    unsigned int m_NumElements;
+    unsigned int m_NumParts;
+
+    /// The merged dimensions of the destination, and the strides of their elements in the source and the destination.
+    unsigned int m_NumDimensions;
+    Dimensions m_Sizes;
+    Dimensions m_SrcStrides;
+    Dimensions m_DstStrides;
+
+    /// The dimensions iterated around the rows or the tiles, outermost first.
+    unsigned int m_NumOuterDimensions;
+    Dimensions m_OuterDimensions;
+
+    /// For Transpose, the dimension which is contiguous in the source. The innermost dimension is contiguous in the
+    /// destination. Each part transposes a block of up to BlockSize x BlockSize elements of these two dimensions.
+    unsigned int m_TransposedDimension;
+    unsigned int m_NumRowBlocks;
+    unsigned int m_NumColumnBlocks;
+};
+
+} // namespace armnnUtils
@@ -120,7 +120,8 @@ public:
 
       {
           ARMNN_SCOPED_HEAP_PROFILING("Parsing");
-          network = parser->CreateNetworkFromBinaryFile(modelPath.c_str());
+          // The constant tensors of the network are read straight from the mapped model file.
+          network = parser->CreateNetworkFromMappedBinaryFile(modelPath.c_str());
       }
 
       inputBindings  = parser->GetNetworkInputBindingInfo(params.m_SubgraphId, params.m_InputBinding);
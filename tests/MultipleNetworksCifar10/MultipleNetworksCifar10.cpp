@@ -6,6 +6,7 @@
 #include <chrono>
 #include <vector>
 #include <array>
+#include <future>
 #include <boost/log/trivial.hpp>
 
 #include "armnn/ArmNN.hpp"
@@ -164,11 +165,18 @@ int main(int argc, char* argv[])
             // Tests inference.
             std::vector<std::array<float, 10>> outputs(networksCount);
 
+            // The inferences of the networks overlap on the worker pool of the runtime.
+            std::vector<std::future<armnn::Status>> inferences;
             for (unsigned int k = 0; k < networksCount; ++k)
             {
-                status = runtime->EnqueueWorkload(networks[k].m_Network,
+                inferences.push_back(runtime->EnqueueWorkloadAsync(networks[k].m_Network,
                     MakeInputTensors(networks[k].m_InputBindingInfo, testCaseData->m_InputImage),
-                    MakeOutputTensors(networks[k].m_OutputBindingInfo, outputs[k]));
+                    MakeOutputTensors(networks[k].m_OutputBindingInfo, outputs[k])));
+            }
+
+            for (auto&& inference : inferences)
+            {
+                status = inference.get();
                 if (status == armnn::Status::Failure)
                 {
                     BOOST_LOG_TRIVIAL(fatal) << "armnn::IRuntime: Failed to enqueue workload";
@@ -0,0 +1,260 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/ConvImpl.hpp"
+#include "backends/RefWorkloads/Gemm.hpp"
+#include "backends/RefWorkloads/Im2ColConvolution.hpp"
+#include "backends/RefWorkloads/WinogradConvolution.hpp"
+
+#include <boost/format.hpp>
+
+#include <cmath>
+
+namespace
+{
+
+struct ConvolutionCase
+{
+    const char* m_Name;
+    unsigned int m_ChannelsInput;
+    unsigned int m_HeightInput;
+    unsigned int m_WidthInput;
+    unsigned int m_ChannelsOutput;
+    unsigned int m_FilterSize;
+    unsigned int m_Stride;
+    unsigned int m_Padding;
+};
+
+// Representative layers of the models run by the tests/*-Armnn programs.
+const ConvolutionCase g_ConvolutionCases[] =
+{
+    { "CaffeMnist conv1",             1,  28,  28,  20,  5, 1, 0 },
+    { "CaffeMnist conv2",            20,  12,  12,  50,  5, 1, 0 },
+    { "CaffeCifar10 conv1",           3,  32,  32,  32,  5, 1, 2 },
+    { "CaffeCifar10 conv3",          32,   8,   8,  64,  5, 1, 2 },
+    { "CaffeAlexNet conv1",           3, 227, 227,  96, 11, 4, 0 },
+    { "CaffeAlexNet conv3",         256,  13,  13, 384,  3, 1, 1 },
+    { "CaffeVGG conv1_1",             3, 224, 224,  64,  3, 1, 1 },
+    { "CaffeVGG conv1_2",            64, 224, 224,  64,  3, 1, 1 },
+    { "CaffeVGG conv4_2",           512,  28,  28, 512,  3, 1, 1 },
+    { "CaffeResNet conv1",            3, 224, 224,  64,  7, 2, 3 },
+    { "CaffeResNet res2a_branch2a",  64,  56,  56,  64,  1, 1, 0 },
+    { "CaffeResNet res2a_branch2b",  64,  56,  56,  64,  3, 1, 1 },
+    { "CaffeYolo conv4",             64,  56,  56, 128,  3, 1, 1 },
+    { "TfMobileNet conv_pw_1",       32, 112, 112,  64,  1, 1, 0 },
+    { "TfMobileNet conv_pw_13",    1024,   7,   7, 1024, 1, 1, 0 },
+    { "TfInceptionV3 conv0",          3, 299, 299,  32,  3, 2, 0 },
+    { "TfInceptionV3 mixed_5b 5x5",  48,  35,  35,  64,  5, 1, 2 },
+};
+
+struct ConvolutionSetup
+{
+    armnn::TensorInfo m_InputInfo;
+    armnn::TensorInfo m_OutputInfo;
+    armnn::TensorInfo m_FilterInfo;
+    armnn::Convolution2dDescriptor m_Descriptor;
+    std::string m_Name;
+};
+
+ConvolutionSetup MakeSetup(const ConvolutionCase& convCase, armnn::DataType dataType)
+{
+    using namespace armnn;
+
+    const unsigned int heightOutput =
+        (convCase.m_HeightInput + 2 * convCase.m_Padding - convCase.m_FilterSize) / convCase.m_Stride + 1;
+    const unsigned int widthOutput =
+        (convCase.m_WidthInput + 2 * convCase.m_Padding - convCase.m_FilterSize) / convCase.m_Stride + 1;
+
+    ConvolutionSetup setup;
+    setup.m_InputInfo = TensorInfo({ 1, convCase.m_ChannelsInput, convCase.m_HeightInput, convCase.m_WidthInput },
+                                   dataType);
+    setup.m_OutputInfo = TensorInfo({ 1, convCase.m_ChannelsOutput, heightOutput, widthOutput }, dataType);
+    setup.m_FilterInfo = TensorInfo({ convCase.m_ChannelsOutput, convCase.m_ChannelsInput,
+                                      convCase.m_FilterSize, convCase.m_FilterSize }, dataType);
+
+    setup.m_Descriptor.m_PadLeft     = convCase.m_Padding;
+    setup.m_Descriptor.m_PadRight    = convCase.m_Padding;
+    setup.m_Descriptor.m_PadTop      = convCase.m_Padding;
+    setup.m_Descriptor.m_PadBottom   = convCase.m_Padding;
+    setup.m_Descriptor.m_StrideX     = convCase.m_Stride;
+    setup.m_Descriptor.m_StrideY     = convCase.m_Stride;
+    setup.m_Descriptor.m_BiasEnabled = true;
+
+    setup.m_Name = boost::str(boost::format("%s (%ux%u, %u->%u)")
+        % convCase.m_Name % convCase.m_FilterSize % convCase.m_FilterSize
+        % convCase.m_ChannelsInput % convCase.m_ChannelsOutput);
+    return setup;
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(Convolution2dFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("ConvImpl", "Im2Col");
+
+    for (const ConvolutionCase& convCase : g_ConvolutionCases)
+    {
+        const ConvolutionSetup setup = MakeSetup(convCase, DataType::Float32);
+        const TensorInfo& inputInfo = setup.m_InputInfo;
+        const TensorInfo& outputInfo = setup.m_OutputInfo;
+        const TensorInfo& filterInfo = setup.m_FilterInfo;
+        const Convolution2dDescriptor& descriptor = setup.m_Descriptor;
+        const std::string& caseName = setup.m_Name;
+
+        std::vector<float> input  = benchmark::MakeRandomData(inputInfo.GetNumElements());
+        std::vector<float> filter = benchmark::MakeRandomData(filterInfo.GetNumElements());
+        std::vector<float> bias   = benchmark::MakeRandomData(convCase.m_ChannelsOutput);
+        std::vector<float> baselineOutput(outputInfo.GetNumElements());
+        std::vector<float> optimisedOutput(outputInfo.GetNumElements());
+
+        PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+        PassthroughCpuTensorHandle outputHandle(outputInfo, baselineOutput.data());
+
+        Convolution2dQueueDescriptor queueDescriptor;
+        queueDescriptor.m_Parameters = descriptor;
+        queueDescriptor.m_Inputs.push_back(&inputHandle);
+        queueDescriptor.m_Outputs.push_back(&outputHandle);
+
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                ConvImpl<Convolution2dQueueDescriptor, float, float, float>(queueDescriptor,
+                    input.data(), 0.0f, 0, filter.data(), 0.0f, 0, bias.data(),
+                    baselineOutput.data(), 0.0f, 0, filterInfo);
+            });
+
+        if (!Im2ColConvolution::IsSupported(inputInfo, outputInfo, filterInfo, descriptor))
+        {
+            benchmark::PrintComparison(caseName, baselineMs, baselineMs, 0.0f);
+            continue;
+        }
+
+        Im2ColConvolution im2ColConvolution(inputInfo, outputInfo, filterInfo, descriptor);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                im2ColConvolution.Execute(input.data(), filter.data(), bias.data(), optimisedOutput.data());
+            });
+
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
+
+ARMNN_REF_BENCHMARK(Convolution2dUint8)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("ConvImpl", "Im2Col");
+
+    for (const ConvolutionCase& convCase : g_ConvolutionCases)
+    {
+        ConvolutionSetup setup = MakeSetup(convCase, DataType::QuantisedAsymm8);
+        const unsigned int patchSize = setup.m_FilterInfo.GetNumElements() / convCase.m_ChannelsOutput;
+
+        // The random values are centred on the zero points, so the sums of patchSize products of values about 74
+        // away from them grow like 5500 * sqrt(patchSize). The output scale keeps most of them in range.
+        setup.m_InputInfo.SetQuantizationScale(0.02f);
+        setup.m_InputInfo.SetQuantizationOffset(128);
+        setup.m_FilterInfo.SetQuantizationScale(0.005f);
+        setup.m_FilterInfo.SetQuantizationOffset(128);
+        setup.m_OutputInfo.SetQuantizationScale(0.02f * 0.005f * 5500.0f * std::sqrt(static_cast<float>(patchSize)) /
+                                                128.0f);
+        setup.m_OutputInfo.SetQuantizationOffset(128);
+
+        std::vector<uint8_t> input  = benchmark::MakeRandomQuantizedData(setup.m_InputInfo.GetNumElements());
+        std::vector<uint8_t> filter = benchmark::MakeRandomQuantizedData(setup.m_FilterInfo.GetNumElements());
+        std::vector<int32_t> bias(convCase.m_ChannelsOutput, 1000);
+        std::vector<uint8_t> baselineOutput(setup.m_OutputInfo.GetNumElements());
+        std::vector<uint8_t> optimisedOutput(setup.m_OutputInfo.GetNumElements());
+
+        PassthroughCpuTensorHandle inputHandle(setup.m_InputInfo, input.data());
+        PassthroughCpuTensorHandle outputHandle(setup.m_OutputInfo, baselineOutput.data());
+
+        Convolution2dQueueDescriptor queueDescriptor;
+        queueDescriptor.m_Parameters = setup.m_Descriptor;
+        queueDescriptor.m_Inputs.push_back(&inputHandle);
+        queueDescriptor.m_Outputs.push_back(&outputHandle);
+
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                ConvImpl<Convolution2dQueueDescriptor, uint8_t, int32_t, int32_t>(queueDescriptor,
+                    input.data(), setup.m_InputInfo.GetQuantizationScale(), setup.m_InputInfo.GetQuantizationOffset(),
+                    filter.data(), setup.m_FilterInfo.GetQuantizationScale(),
+                    setup.m_FilterInfo.GetQuantizationOffset(),
+                    bias.data(),
+                    baselineOutput.data(), setup.m_OutputInfo.GetQuantizationScale(),
+                    setup.m_OutputInfo.GetQuantizationOffset(), setup.m_FilterInfo);
+            });
+
+        if (!Im2ColConvolution::IsSupported(setup.m_InputInfo, setup.m_OutputInfo, setup.m_FilterInfo,
+                                            setup.m_Descriptor))
+        {
+            benchmark::PrintComparison(setup.m_Name, baselineMs, baselineMs, 0.0f);
+            continue;
+        }
+
+        // The sums of the filter rows are computed once, when the workload is created.
+        std::vector<int32_t> filterSums(convCase.m_ChannelsOutput);
+        SumRows(convCase.m_ChannelsOutput, patchSize, filter.data(), patchSize, filterSums.data());
+
+        Im2ColConvolution im2ColConvolution(setup.m_InputInfo, setup.m_OutputInfo, setup.m_FilterInfo,
+                                            setup.m_Descriptor);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                im2ColConvolution.Execute(input.data(), filter.data(), filterSums.data(), bias.data(),
+                                          optimisedOutput.data());
+            });
+
+        benchmark::PrintComparison(setup.m_Name, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
+
+// The 3x3 convolutions with unit strides, which were run as matrix multiplications before the Winograd algorithm.
+ARMNN_REF_BENCHMARK(Convolution2dWinogradFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Im2Col", "Winograd");
+
+    for (const ConvolutionCase& convCase : g_ConvolutionCases)
+    {
+        const ConvolutionSetup setup = MakeSetup(convCase, DataType::Float32);
+        if (!WinogradConvolution::IsSupported(setup.m_InputInfo, setup.m_OutputInfo, setup.m_FilterInfo,
+                                              setup.m_Descriptor))
+        {
+            continue;
+        }
+
+        std::vector<float> input  = benchmark::MakeRandomData(setup.m_InputInfo.GetNumElements());
+        std::vector<float> filter = benchmark::MakeRandomData(setup.m_FilterInfo.GetNumElements());
+        std::vector<float> bias   = benchmark::MakeRandomData(convCase.m_ChannelsOutput);
+        std::vector<float> baselineOutput(setup.m_OutputInfo.GetNumElements());
+        std::vector<float> optimisedOutput(setup.m_OutputInfo.GetNumElements());
+
+        Im2ColConvolution im2ColConvolution(setup.m_InputInfo, setup.m_OutputInfo, setup.m_FilterInfo,
+                                            setup.m_Descriptor);
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                im2ColConvolution.Execute(input.data(), filter.data(), bias.data(), baselineOutput.data());
+            });
+
+        WinogradConvolution winogradConvolution(setup.m_InputInfo, setup.m_OutputInfo, setup.m_FilterInfo,
+                                                filter.data(), setup.m_Descriptor);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                winogradConvolution.Execute(input.data(), bias.data(), optimisedOutput.data());
+            });
+
+        const std::string caseName = boost::str(boost::format("%s F(%ux%u)") % setup.m_Name
+            % winogradConvolution.GetOutputTileSize() % winogradConvolution.GetOutputTileSize());
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
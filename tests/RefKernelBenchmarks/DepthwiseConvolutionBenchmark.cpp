@@ -0,0 +1,196 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/ConvImpl.hpp"
+#include "backends/RefWorkloads/DepthwiseConvolution.hpp"
+#include "backends/RefWorkloads/Im2ColConvolution.hpp"
+
+#include <boost/format.hpp>
+
+#include <vector>
+
+namespace
+{
+
+struct DepthwiseCase
+{
+    const char* m_Name;
+    unsigned int m_Channels;
+    unsigned int m_InputSize;
+    unsigned int m_Stride;
+    unsigned int m_PadBefore;
+    unsigned int m_PadAfter;
+    unsigned int m_PointwiseChannelsOutput;
+};
+
+// The 3x3 depthwise convolutions of TfMobileNet, with TensorFlow's SAME padding, and the number of output channels of
+// the pointwise convolutions which follow them.
+const DepthwiseCase g_DepthwiseCases[] =
+{
+    { "TfMobileNet conv_dw_1",    32, 112, 1, 1, 1,   64 },
+    { "TfMobileNet conv_dw_2",    64, 112, 2, 0, 1,  128 },
+    { "TfMobileNet conv_dw_3",   128,  56, 1, 1, 1,  128 },
+    { "TfMobileNet conv_dw_4",   128,  56, 2, 0, 1,  256 },
+    { "TfMobileNet conv_dw_7",   512,  14, 1, 1, 1,  512 },
+    { "TfMobileNet conv_dw_13", 1024,   7, 1, 1, 1, 1024 },
+};
+
+struct DepthwiseSetup
+{
+    armnn::TensorInfo m_InputInfo;
+    armnn::TensorInfo m_OutputInfo;
+    armnn::TensorInfo m_FilterInfo;
+    armnn::DepthwiseConvolution2dDescriptor m_Descriptor;
+};
+
+DepthwiseSetup MakeSetup(const DepthwiseCase& depthwiseCase, armnn::DataLayout dataLayout)
+{
+    using namespace armnn;
+
+    const unsigned int channels = depthwiseCase.m_Channels;
+    const unsigned int inputSize = depthwiseCase.m_InputSize;
+    const unsigned int outputSize =
+        (inputSize + depthwiseCase.m_PadBefore + depthwiseCase.m_PadAfter - 3) / depthwiseCase.m_Stride + 1;
+    const bool isNhwc = dataLayout == DataLayout::NHWC;
+
+    DepthwiseSetup setup;
+    setup.m_InputInfo = TensorInfo(isNhwc ? TensorShape({ 1, inputSize, inputSize, channels })
+                                          : TensorShape({ 1, channels, inputSize, inputSize }), DataType::Float32);
+    setup.m_OutputInfo = TensorInfo(isNhwc ? TensorShape({ 1, outputSize, outputSize, channels })
+                                           : TensorShape({ 1, channels, outputSize, outputSize }), DataType::Float32);
+    setup.m_FilterInfo = TensorInfo(isNhwc ? TensorShape({ 1, 3, 3, channels })
+                                           : TensorShape({ 1, channels, 3, 3 }), DataType::Float32);
+
+    setup.m_Descriptor.m_PadLeft     = depthwiseCase.m_PadBefore;
+    setup.m_Descriptor.m_PadRight    = depthwiseCase.m_PadAfter;
+    setup.m_Descriptor.m_PadTop      = depthwiseCase.m_PadBefore;
+    setup.m_Descriptor.m_PadBottom   = depthwiseCase.m_PadAfter;
+    setup.m_Descriptor.m_StrideX     = depthwiseCase.m_Stride;
+    setup.m_Descriptor.m_StrideY     = depthwiseCase.m_Stride;
+    setup.m_Descriptor.m_BiasEnabled = true;
+    setup.m_Descriptor.m_DataLayout  = dataLayout;
+    return setup;
+}
+
+void RunDepthwiseCases(const armnn::benchmark::BenchmarkOptions& options, armnn::DataLayout dataLayout)
+{
+    using namespace armnn;
+
+    for (const DepthwiseCase& depthwiseCase : g_DepthwiseCases)
+    {
+        const DepthwiseSetup setup = MakeSetup(depthwiseCase, dataLayout);
+
+        std::vector<float> input  = benchmark::MakeRandomData(setup.m_InputInfo.GetNumElements());
+        std::vector<float> filter = benchmark::MakeRandomData(setup.m_FilterInfo.GetNumElements());
+        std::vector<float> bias   = benchmark::MakeRandomData(depthwiseCase.m_Channels);
+        std::vector<float> baselineOutput(setup.m_OutputInfo.GetNumElements());
+        std::vector<float> optimisedOutput(setup.m_OutputInfo.GetNumElements());
+
+        PassthroughCpuTensorHandle inputHandle(setup.m_InputInfo, input.data());
+        PassthroughCpuTensorHandle outputHandle(setup.m_OutputInfo, baselineOutput.data());
+
+        DepthwiseConvolution2dQueueDescriptor queueDescriptor;
+        queueDescriptor.m_Parameters = setup.m_Descriptor;
+        queueDescriptor.m_Inputs.push_back(&inputHandle);
+        queueDescriptor.m_Outputs.push_back(&outputHandle);
+
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                ConvImpl<DepthwiseConvolution2dQueueDescriptor, float, float, float>(queueDescriptor,
+                    input.data(), 0.0f, 0, filter.data(), 0.0f, 0, bias.data(),
+                    baselineOutput.data(), 0.0f, 0, setup.m_FilterInfo, true);
+            });
+
+        DepthwiseConvolution convolution(setup.m_InputInfo, setup.m_FilterInfo, filter.data(), setup.m_Descriptor);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                convolution.Execute(input.data(), bias.data(), optimisedOutput.data());
+            });
+
+        const std::string caseName = boost::str(boost::format("%s (3x3/%u, %u ch)")
+            % depthwiseCase.m_Name % depthwiseCase.m_Stride % depthwiseCase.m_Channels);
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(DepthwiseConvolution2dNchwFloat32)
+{
+    armnn::benchmark::PrintComparisonHeader("ConvImpl", "Depthwise");
+    RunDepthwiseCases(options, armnn::DataLayout::NCHW);
+}
+
+ARMNN_REF_BENCHMARK(DepthwiseConvolution2dNhwcFloat32)
+{
+    armnn::benchmark::PrintComparisonHeader("ConvImpl", "Depthwise");
+    RunDepthwiseCases(options, armnn::DataLayout::NHWC);
+}
+
+// The depthwise convolutions followed by their pointwise convolutions, computed one after the other through an
+// intermediate tensor as the two workloads do, and fused where the intermediate tensor does not fit in a tile.
+ARMNN_REF_BENCHMARK(DepthwiseSeparableConvolutionFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Depthwise+Im2Col", "Fused");
+
+    for (const DepthwiseCase& depthwiseCase : g_DepthwiseCases)
+    {
+        const DepthwiseSetup setup = MakeSetup(depthwiseCase, DataLayout::NCHW);
+        const unsigned int channels = depthwiseCase.m_Channels;
+        const unsigned int pointwiseChannels = depthwiseCase.m_PointwiseChannelsOutput;
+        const TensorShape& depthwiseOutputShape = setup.m_OutputInfo.GetShape();
+
+        const TensorInfo outputInfo({ 1, pointwiseChannels, depthwiseOutputShape[2], depthwiseOutputShape[3] },
+                                    DataType::Float32);
+        const TensorInfo pointwiseFilterInfo({ pointwiseChannels, channels, 1, 1 }, DataType::Float32);
+        Convolution2dDescriptor pointwiseDescriptor;
+        pointwiseDescriptor.m_StrideX     = 1;
+        pointwiseDescriptor.m_StrideY     = 1;
+        pointwiseDescriptor.m_BiasEnabled = true;
+
+        std::vector<float> input           = benchmark::MakeRandomData(setup.m_InputInfo.GetNumElements());
+        std::vector<float> filter          = benchmark::MakeRandomData(setup.m_FilterInfo.GetNumElements());
+        std::vector<float> bias            = benchmark::MakeRandomData(channels);
+        std::vector<float> pointwiseFilter = benchmark::MakeRandomData(pointwiseFilterInfo.GetNumElements());
+        std::vector<float> pointwiseBias   = benchmark::MakeRandomData(pointwiseChannels);
+        std::vector<float> intermediate(setup.m_OutputInfo.GetNumElements());
+        std::vector<float> baselineOutput(outputInfo.GetNumElements());
+        std::vector<float> optimisedOutput(outputInfo.GetNumElements());
+
+        DepthwiseConvolution depthwise(setup.m_InputInfo, setup.m_FilterInfo, filter.data(), setup.m_Descriptor);
+        Im2ColConvolution pointwise(setup.m_OutputInfo, outputInfo, pointwiseFilterInfo, pointwiseDescriptor);
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                depthwise.Execute(input.data(), bias.data(), intermediate.data());
+                pointwise.Execute(intermediate.data(), pointwiseFilter.data(), pointwiseBias.data(),
+                                  baselineOutput.data());
+            });
+
+        const std::string caseName = boost::str(boost::format("%s (3x3/%u, %u->%u)")
+            % depthwiseCase.m_Name % depthwiseCase.m_Stride % channels % pointwiseChannels);
+        if (!DepthwiseConvolution::IsPointwiseSupported(setup.m_OutputInfo, pointwiseFilterInfo, pointwiseDescriptor,
+                                                        DataLayout::NCHW))
+        {
+            benchmark::PrintComparison(caseName, baselineMs, baselineMs, 0.0f);
+            continue;
+        }
+
+        DepthwiseConvolution fused(setup.m_InputInfo, setup.m_FilterInfo, filter.data(), setup.m_Descriptor,
+                                   &pointwiseFilterInfo, pointwiseFilter.data());
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                fused.Execute(input.data(), bias.data(), optimisedOutput.data(), nullptr, pointwiseBias.data());
+            });
+
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
@@ -0,0 +1,256 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/RefWorkloads/Addition.hpp"
+#include "backends/RefWorkloads/Multiplication.hpp"
+#include "backends/RefWorkloads/QuantizedMultiplier.hpp"
+
+#include <armnn/Tensor.hpp>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <vector>
+
+namespace
+{
+
+struct ElementwiseCase
+{
+    const char* m_Name;
+    armnn::TensorShape m_Shape0;
+    armnn::TensorShape m_Shape1;
+};
+
+// The residual additions of ResNet-50, and the broadcasts of biases, scales and scalars.
+const ElementwiseCase g_ElementwiseCases[] =
+{
+    { "ResNet res2 residual",   armnn::TensorShape({ 1,  256, 56, 56 }), armnn::TensorShape({ 1,  256, 56, 56 }) },
+    { "ResNet res3 residual",   armnn::TensorShape({ 1,  512, 28, 28 }), armnn::TensorShape({ 1,  512, 28, 28 }) },
+    { "ResNet res4 residual",   armnn::TensorShape({ 1, 1024, 14, 14 }), armnn::TensorShape({ 1, 1024, 14, 14 }) },
+    { "ResNet res5 residual",   armnn::TensorShape({ 1, 2048,  7,  7 }), armnn::TensorShape({ 1, 2048,  7,  7 }) },
+    { "NCHW per-channel bias",  armnn::TensorShape({ 1,   64, 112, 112 }), armnn::TensorShape({ 1, 64, 1, 1 }) },
+    { "NHWC per-channel bias",  armnn::TensorShape({ 1, 112, 112,   64 }), armnn::TensorShape({ 1, 1, 1, 64 }) },
+    { "NCHW 7x7 per-channel",   armnn::TensorShape({ 1, 2048,  7,  7 }), armnn::TensorShape({ 1, 2048, 1, 1 }) },
+    { "Scalar",                 armnn::TensorShape({ 1,  256, 56, 56 }), armnn::TensorShape({ 1,    1, 1, 1 }) },
+};
+
+armnn::TensorShape GetOutputShape(const ElementwiseCase& elementwiseCase)
+{
+    unsigned int dims[armnn::MaxNumOfTensorDimensions];
+    for (unsigned int d = 0; d < elementwiseCase.m_Shape0.GetNumDimensions(); ++d)
+    {
+        dims[d] = std::max(elementwiseCase.m_Shape0[d], elementwiseCase.m_Shape1[d]);
+    }
+    return armnn::TensorShape(elementwiseCase.m_Shape0.GetNumDimensions(), dims);
+}
+
+// The broadcast loop before the dimensions were collapsed, recursing to every element of the output unless the
+// inputs have the same shape.
+class RecursiveBroadcast
+{
+public:
+    RecursiveBroadcast(const armnn::TensorShape& inShape0, const armnn::TensorShape& inShape1,
+                       const armnn::TensorShape& outShape)
+        : m_DimData(outShape.GetNumDimensions())
+        , m_SameShapes(inShape0 == inShape1)
+        , m_NumElements(outShape.GetNumElements())
+    {
+        const unsigned int numDims = outShape.GetNumDimensions();
+
+        unsigned int sIn0 = 1;
+        unsigned int sIn1 = 1;
+        unsigned int sOut = 1;
+
+        for (unsigned int j = numDims - 1, k = 0; k < numDims ; k++, j--)
+        {
+            m_DimData[j].m_DimSize = outShape[j];
+            m_DimData[j].m_Stride1 = (inShape0[j] > 1) ? sIn0 : 0;
+            m_DimData[j].m_Stride2 = (inShape1[j] > 1) ? sIn1 : 0;
+            m_DimData[j].m_StrideOut = sOut;
+
+            sIn0 *= inShape0[j];
+            sIn1 *= inShape1[j];
+            sOut *= outShape[j];
+        }
+    }
+
+    template <typename T, typename Func>
+    void Run(Func operationFunc, const T* inData0, const T* inData1, T* outData)
+    {
+        if (m_SameShapes)
+        {
+            for (unsigned int i = 0; i < m_NumElements; ++i)
+            {
+                outData[i] = operationFunc(inData0[i], inData1[i]);
+            }
+        }
+        else
+        {
+            Unroll(operationFunc, 0, inData0, inData1, outData);
+        }
+    }
+
+private:
+    template <typename T, typename Func>
+    void Unroll(Func operationFunc, unsigned int dimension, const T* inData0, const T* inData1, T* outData)
+    {
+        if (dimension >= m_DimData.size())
+        {
+            *outData = operationFunc(*inData0, *inData1);
+            return;
+        }
+
+        for (unsigned int i = 0; i < m_DimData[dimension].m_DimSize; i++)
+        {
+            Unroll(operationFunc, dimension + 1, inData0, inData1, outData);
+
+            inData0 += m_DimData[dimension].m_Stride1;
+            inData1 += m_DimData[dimension].m_Stride2;
+            outData += m_DimData[dimension].m_StrideOut;
+        }
+    }
+
+    struct BroadcastDimensionData
+    {
+        unsigned int m_DimSize;
+        unsigned int m_StrideOut;
+        unsigned int m_Stride1;
+        unsigned int m_Stride2;
+    };
+
+    std::vector<BroadcastDimensionData> m_DimData;
+    bool m_SameShapes;
+    unsigned int m_NumElements;
+};
+
+std::string GetCaseName(const ElementwiseCase& elementwiseCase)
+{
+    const armnn::TensorShape& shape0 = elementwiseCase.m_Shape0;
+    const armnn::TensorShape& shape1 = elementwiseCase.m_Shape1;
+    return boost::str(boost::format("%s (%ux%ux%ux%u + %ux%ux%ux%u)") % elementwiseCase.m_Name
+        % shape0[0] % shape0[1] % shape0[2] % shape0[3] % shape1[0] % shape1[1] % shape1[2] % shape1[3]);
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(AdditionFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Recursive", "Collapsed");
+
+    for (const ElementwiseCase& elementwiseCase : g_ElementwiseCases)
+    {
+        const TensorShape outShape = GetOutputShape(elementwiseCase);
+        const std::vector<float> input0 = benchmark::MakeRandomData(elementwiseCase.m_Shape0.GetNumElements());
+        const std::vector<float> input1 = benchmark::MakeRandomData(elementwiseCase.m_Shape1.GetNumElements());
+        std::vector<float> baselineOutput(outShape.GetNumElements());
+        std::vector<float> optimisedOutput(outShape.GetNumElements());
+
+        RecursiveBroadcast broadcast(elementwiseCase.m_Shape0, elementwiseCase.m_Shape1, outShape);
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                broadcast.Run(std::plus<float>(), input0.data(), input1.data(), baselineOutput.data());
+            });
+
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                Addition(elementwiseCase.m_Shape0, elementwiseCase.m_Shape1, outShape,
+                         input0.data(), input1.data(), optimisedOutput.data());
+            });
+
+        benchmark::PrintComparison(GetCaseName(elementwiseCase), baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
+
+ARMNN_REF_BENCHMARK(AdditionUint8)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Recursive", "Collapsed");
+
+    for (const ElementwiseCase& elementwiseCase : g_ElementwiseCases)
+    {
+        const TensorInfo inputInfo0(elementwiseCase.m_Shape0, DataType::QuantisedAsymm8, 0.05f, 120);
+        const TensorInfo inputInfo1(elementwiseCase.m_Shape1, DataType::QuantisedAsymm8, 0.04f, 130);
+        const TensorInfo outputInfo(GetOutputShape(elementwiseCase), DataType::QuantisedAsymm8, 0.1f, 128);
+
+        const std::vector<uint8_t> input0 = benchmark::MakeRandomQuantizedData(inputInfo0.GetNumElements());
+        const std::vector<uint8_t> input1 = benchmark::MakeRandomQuantizedData(inputInfo1.GetNumElements());
+        std::vector<uint8_t> baselineOutput(outputInfo.GetNumElements());
+        std::vector<uint8_t> optimisedOutput(outputInfo.GetNumElements());
+
+        // The integer arithmetic of the kernel, through the recursive loop.
+        const int32_t leftShiftFactor = 1 << 20;
+        const float twiceMaxInputScale = 2.0f * std::max(inputInfo0.GetQuantizationScale(),
+                                                         inputInfo1.GetQuantizationScale());
+        const QuantizedMultiplierSmallerThanOne inputMultiplier0(
+            inputInfo0.GetQuantizationScale() / twiceMaxInputScale);
+        const QuantizedMultiplierSmallerThanOne inputMultiplier1(
+            inputInfo1.GetQuantizationScale() / twiceMaxInputScale);
+        const QuantizedMultiplierSmallerThanOne outputRescale(
+            twiceMaxInputScale / (static_cast<float>(leftShiftFactor) * outputInfo.GetQuantizationScale()));
+        const int32_t inputOffset0 = inputInfo0.GetQuantizationOffset();
+        const int32_t inputOffset1 = inputInfo1.GetQuantizationOffset();
+        const int32_t outputOffset = outputInfo.GetQuantizationOffset();
+
+        RecursiveBroadcast broadcast(inputInfo0.GetShape(), inputInfo1.GetShape(), outputInfo.GetShape());
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                broadcast.Run([&](uint8_t in0, uint8_t in1)
+                    {
+                        const int32_t scaled0 = inputMultiplier0 *
+                            ((static_cast<int32_t>(in0) - inputOffset0) * leftShiftFactor);
+                        const int32_t scaled1 = inputMultiplier1 *
+                            ((static_cast<int32_t>(in1) - inputOffset1) * leftShiftFactor);
+                        const int32_t result = (outputRescale * (scaled0 + scaled1)) + outputOffset;
+                        return static_cast<uint8_t>(std::min(std::max(result, 0), 255));
+                    }, input0.data(), input1.data(), baselineOutput.data());
+            });
+
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                Addition(inputInfo0, inputInfo1, outputInfo, input0.data(), input1.data(), optimisedOutput.data());
+            });
+
+        benchmark::PrintComparison(GetCaseName(elementwiseCase), baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
+
+ARMNN_REF_BENCHMARK(MultiplicationFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Recursive", "Collapsed");
+
+    for (const ElementwiseCase& elementwiseCase : g_ElementwiseCases)
+    {
+        const TensorShape outShape = GetOutputShape(elementwiseCase);
+        const std::vector<float> input0 = benchmark::MakeRandomData(elementwiseCase.m_Shape0.GetNumElements());
+        const std::vector<float> input1 = benchmark::MakeRandomData(elementwiseCase.m_Shape1.GetNumElements());
+        std::vector<float> baselineOutput(outShape.GetNumElements());
+        std::vector<float> optimisedOutput(outShape.GetNumElements());
+
+        RecursiveBroadcast broadcast(elementwiseCase.m_Shape0, elementwiseCase.m_Shape1, outShape);
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                broadcast.Run(std::multiplies<float>(), input0.data(), input1.data(), baselineOutput.data());
+            });
+
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                Multiplication(elementwiseCase.m_Shape0, elementwiseCase.m_Shape1, outShape,
+                               input0.data(), input1.data(), optimisedOutput.data());
+            });
+
+        benchmark::PrintComparison(GetCaseName(elementwiseCase), baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
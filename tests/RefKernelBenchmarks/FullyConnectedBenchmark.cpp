@@ -0,0 +1,203 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/FullyConnected.hpp"
+#include "backends/RefWorkloads/RefFullyConnectedFloat32Workload.hpp"
+#include "backends/RefWorkloads/RefFullyConnectedUint8Workload.hpp"
+#include "backends/RefWorkloads/RefWorkloadUtils.hpp"
+
+#include <boost/format.hpp>
+
+#include <cmath>
+
+namespace
+{
+
+struct FullyConnectedCase
+{
+    const char* m_Name;
+    unsigned int m_BatchSize;
+    unsigned int m_InputSize;
+    unsigned int m_OutputSize;
+};
+
+// Representative layers of the models run by the tests/*-Armnn programs.
+const FullyConnectedCase g_FullyConnectedCases[] =
+{
+    { "CaffeMnist ip1",                1,  800,  500 },
+    { "CaffeMnist ip2",                1,  500,   10 },
+    { "CaffeAlexNet fc6",              1, 9216, 4096 },
+    { "CaffeAlexNet fc7",              1, 4096, 4096 },
+    { "TfMobileNet logits",            1, 1024, 1001 },
+    { "TfMobileNet logits, batch 8",   8, 1024, 1001 },
+};
+
+// The layers of a recommendation model's MLP, which run on whole batches of candidates, and classifiers.
+const FullyConnectedCase g_FloatFullyConnectedCases[] =
+{
+    { "CaffeMnist ip1",                1,  800,  500 },
+    { "CaffeAlexNet fc7",              1, 4096, 4096 },
+    { "TfMobileNet logits",            1, 1024, 1001 },
+    { "CaffeMnist ip1, batch 128",   128,  800,  500 },
+    { "MLP layer 1, batch 128",      128, 1024,  512 },
+    { "MLP layer 2, batch 128",      128,  512,  256 },
+    { "MLP output, batch 128",       128,  256,    1 },
+};
+
+// The implementation of FullyConnected() before it multiplied the whole batch with Gemm(), computing each output of
+// each batch in turn and choosing where to read the weights from for every product.
+void OutputByOutputFullyConnected(const float* inputData, float* outputData, const float* weightData,
+                                  const float* biasData, unsigned int batchSize, unsigned int K, unsigned int N,
+                                  bool transposeWeights)
+{
+    for (unsigned int output = 0; output < batchSize * N; output++)
+    {
+        const unsigned int n = output / N;
+        const unsigned int channelOutput = output % N;
+
+        float outval = 0.f;
+        for (unsigned int channelInput = 0; channelInput < K; channelInput++)
+        {
+            float weight;
+            if (transposeWeights)
+            {
+                weight = weightData[channelOutput * K + channelInput];
+            }
+            else
+            {
+                weight = weightData[channelInput * N + channelOutput];
+            }
+
+            outval += weight * inputData[n * K + channelInput];
+        }
+
+        outputData[n * N + channelOutput] = outval + biasData[channelOutput];
+    }
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(FullyConnectedFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Per output", "Batch GEMM");
+
+    for (bool transposeWeights : { false, true })
+    {
+        for (const FullyConnectedCase& fcCase : g_FloatFullyConnectedCases)
+        {
+            const TensorInfo inputInfo({ fcCase.m_BatchSize, fcCase.m_InputSize }, DataType::Float32);
+            const TensorInfo weightInfo(transposeWeights ? TensorShape({ fcCase.m_OutputSize, fcCase.m_InputSize })
+                                                         : TensorShape({ fcCase.m_InputSize, fcCase.m_OutputSize }),
+                                        DataType::Float32);
+            const TensorInfo biasInfo({ fcCase.m_OutputSize }, DataType::Float32);
+            const TensorInfo outputInfo({ fcCase.m_BatchSize, fcCase.m_OutputSize }, DataType::Float32);
+
+            std::vector<float> input   = benchmark::MakeRandomData(inputInfo.GetNumElements());
+            std::vector<float> weights = benchmark::MakeRandomData(weightInfo.GetNumElements());
+            std::vector<float> bias    = benchmark::MakeRandomData(biasInfo.GetNumElements());
+            std::vector<float> baselineOutput(outputInfo.GetNumElements());
+            std::vector<float> optimisedOutput(outputInfo.GetNumElements());
+
+            const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+                {
+                    OutputByOutputFullyConnected(input.data(), baselineOutput.data(), weights.data(), bias.data(),
+                                                 fcCase.m_BatchSize, fcCase.m_InputSize, fcCase.m_OutputSize,
+                                                 transposeWeights);
+                });
+
+            ScopedCpuTensorHandle weightHandle(ConstTensor(weightInfo, weights.data()));
+            ScopedCpuTensorHandle biasHandle(ConstTensor(biasInfo, bias.data()));
+            PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+            PassthroughCpuTensorHandle outputHandle(outputInfo, optimisedOutput.data());
+
+            FullyConnectedQueueDescriptor data;
+            data.m_Parameters.m_BiasEnabled = true;
+            data.m_Parameters.m_TransposeWeightMatrix = transposeWeights;
+            data.m_Weight = &weightHandle;
+            data.m_Bias = &biasHandle;
+            data.m_Inputs.push_back(&inputHandle);
+            data.m_Outputs.push_back(&outputHandle);
+
+            WorkloadInfo info;
+            info.m_InputTensorInfos = { inputInfo };
+            info.m_OutputTensorInfos = { outputInfo };
+
+            RefFullyConnectedFloat32Workload workload(data, info);
+            const double optimisedMs = benchmark::TimeMilliseconds(options, [&]() { workload.Execute(); });
+
+            const std::string caseName = boost::str(boost::format("%s (%u, %u->%u%s)")
+                % fcCase.m_Name % fcCase.m_BatchSize % fcCase.m_InputSize % fcCase.m_OutputSize
+                % (transposeWeights ? ", T" : ""));
+            benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                       benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+        }
+    }
+}
+
+ARMNN_REF_BENCHMARK(FullyConnectedUint8)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Dequantized", "Integer");
+
+    for (const FullyConnectedCase& fcCase : g_FullyConnectedCases)
+    {
+        TensorInfo inputInfo({ fcCase.m_BatchSize, fcCase.m_InputSize }, DataType::QuantisedAsymm8, 0.02f, 128);
+        TensorInfo weightInfo({ fcCase.m_InputSize, fcCase.m_OutputSize }, DataType::QuantisedAsymm8, 0.005f, 128);
+        TensorInfo biasInfo({ fcCase.m_OutputSize }, DataType::Signed32, 0.02f * 0.005f, 0);
+
+        // See Convolution2dUint8 for the choice of the output scale.
+        TensorInfo outputInfo({ fcCase.m_BatchSize, fcCase.m_OutputSize }, DataType::QuantisedAsymm8,
+            0.02f * 0.005f * 5500.0f * std::sqrt(static_cast<float>(fcCase.m_InputSize)) / 128.0f, 128);
+
+        std::vector<uint8_t> input   = benchmark::MakeRandomQuantizedData(inputInfo.GetNumElements());
+        std::vector<uint8_t> weights = benchmark::MakeRandomQuantizedData(weightInfo.GetNumElements());
+        std::vector<int32_t> bias(fcCase.m_OutputSize, 1000);
+        std::vector<uint8_t> baselineOutput(outputInfo.GetNumElements());
+        std::vector<uint8_t> optimisedOutput(outputInfo.GetNumElements());
+
+        // The previous implementation of RefFullyConnectedUint8Workload, which dequantized the weights at every
+        // inference, here through the current float kernel.
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                std::vector<float> dequantizedInput = Dequantize(input.data(), inputInfo);
+                std::vector<float> dequantizedWeights = Dequantize(weights.data(), weightInfo);
+                std::vector<float> dequantizedBias = Dequantize(bias.data(), biasInfo);
+                std::vector<float> results(outputInfo.GetNumElements());
+                FullyConnected(dequantizedInput.data(), results.data(), inputInfo, outputInfo,
+                               dequantizedWeights.data(), dequantizedBias.data(), false);
+                Quantize(baselineOutput.data(), results.data(), outputInfo);
+            });
+
+        ScopedCpuTensorHandle weightHandle(ConstTensor(weightInfo, weights.data()));
+        ScopedCpuTensorHandle biasHandle(ConstTensor(biasInfo, bias.data()));
+        PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+        PassthroughCpuTensorHandle outputHandle(outputInfo, optimisedOutput.data());
+
+        FullyConnectedQueueDescriptor data;
+        data.m_Parameters.m_BiasEnabled = true;
+        data.m_Weight = &weightHandle;
+        data.m_Bias = &biasHandle;
+        data.m_Inputs.push_back(&inputHandle);
+        data.m_Outputs.push_back(&outputHandle);
+
+        WorkloadInfo info;
+        info.m_InputTensorInfos = { inputInfo };
+        info.m_OutputTensorInfos = { outputInfo };
+
+        RefFullyConnectedUint8Workload workload(data, info);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]() { workload.Execute(); });
+
+        const std::string caseName = boost::str(boost::format("%s (%u, %u->%u)")
+            % fcCase.m_Name % fcCase.m_BatchSize % fcCase.m_InputSize % fcCase.m_OutputSize);
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
@@ -0,0 +1,247 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/RefLstmFloat32Workload.hpp"
+
+#include <boost/format.hpp>
+
+#include <cmath>
+#include <memory>
+
+namespace
+{
+
+struct LstmCase
+{
+    const char* m_Name;
+    unsigned int m_BatchSize;
+    unsigned int m_InputSize;
+    unsigned int m_NumUnits;
+    unsigned int m_OutputSize;
+    bool m_CifgEnabled;
+    bool m_PeepholeEnabled;
+    bool m_ProjectionEnabled;
+};
+
+// Typical sizes of recurrent models, one timestep at a time.
+const LstmCase g_LstmCases[] =
+{
+    { "Keyword spotting",             1,   40,  128,  128, false, false, false },
+    { "Speech recognition LSTMP",     1,   80, 1024,  512, false,  true,  true },
+    { "Language model",               1,  512,  512,  512, false, false, false },
+    { "Language model, batch 8",      8,  512,  512,  512, false, false, false },
+    { "CIFG with peephole",           1,  256,  256,  256,  true,  true, false },
+    { "Translation LSTMP, batch 16", 16,  256, 1024,  256, false,  true,  true },
+};
+
+float Sigmoid(float value)
+{
+    return 1.f / (1.f + expf(-value));
+}
+
+// Adds the product of a numUnits x size row-major matrix and a vector to result.
+void AddMatrixVectorProduct(const float* matrix, const float* vector, unsigned int numUnits, unsigned int size,
+                            float* result)
+{
+    for (unsigned int unit = 0; unit < numUnits; ++unit)
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            result[unit] += matrix[unit * size + i] * vector[i];
+        }
+    }
+}
+
+// Straightforward LSTM timestep with tanh activation, computing one gate after the other with separate
+// matrix-vector products for the input and the recurrent weights.
+void NaiveLstm(const armnn::LstmQueueDescriptor& data, const LstmCase& lstmCase,
+               const float* input, const float* outputStateIn, const float* cellStateIn,
+               float* cellStateOut, float* output)
+{
+    const unsigned int numUnits = lstmCase.m_NumUnits;
+    const unsigned int inputSize = lstmCase.m_InputSize;
+    const unsigned int outputSize = lstmCase.m_OutputSize;
+
+    auto gate = [&](const armnn::ConstCpuTensorHandle* inputWeights,
+                    const armnn::ConstCpuTensorHandle* recurrentWeights,
+                    const armnn::ConstCpuTensorHandle* bias,
+                    const float* x, const float* h)
+    {
+        std::vector<float> result(bias->GetConstTensor<float>(), bias->GetConstTensor<float>() + numUnits);
+        AddMatrixVectorProduct(inputWeights->GetConstTensor<float>(), x, numUnits, inputSize, result.data());
+        AddMatrixVectorProduct(recurrentWeights->GetConstTensor<float>(), h, numUnits, outputSize, result.data());
+        return result;
+    };
+
+    for (unsigned int b = 0; b < lstmCase.m_BatchSize; ++b)
+    {
+        const float* x = input + b * inputSize;
+        const float* h = outputStateIn + b * outputSize;
+        const float* c = cellStateIn + b * numUnits;
+
+        std::vector<float> forgetGate = gate(data.m_InputToForgetWeights, data.m_RecurrentToForgetWeights,
+                                             data.m_ForgetGateBias, x, h);
+        std::vector<float> cellGate = gate(data.m_InputToCellWeights, data.m_RecurrentToCellWeights,
+                                           data.m_CellBias, x, h);
+        std::vector<float> outputGate = gate(data.m_InputToOutputWeights, data.m_RecurrentToOutputWeights,
+                                             data.m_OutputGateBias, x, h);
+        std::vector<float> inputGate(numUnits);
+        if (!lstmCase.m_CifgEnabled)
+        {
+            inputGate = gate(data.m_InputToInputWeights, data.m_RecurrentToInputWeights,
+                             data.m_InputGateBias, x, h);
+        }
+
+        std::vector<float> cellOutput(numUnits);
+        for (unsigned int u = 0; u < numUnits; ++u)
+        {
+            float forget = forgetGate[u];
+            float in = inputGate[u];
+            if (lstmCase.m_PeepholeEnabled)
+            {
+                forget += data.m_CellToForgetWeights->GetConstTensor<float>()[u] * c[u];
+                if (!lstmCase.m_CifgEnabled)
+                {
+                    in += data.m_CellToInputWeights->GetConstTensor<float>()[u] * c[u];
+                }
+            }
+            forget = Sigmoid(forget);
+            in = lstmCase.m_CifgEnabled ? 1.0f - forget : Sigmoid(in);
+
+            const float cell = forget * c[u] + in * tanhf(cellGate[u]);
+            cellStateOut[b * numUnits + u] = cell;
+
+            float out = outputGate[u];
+            if (lstmCase.m_PeepholeEnabled)
+            {
+                out += data.m_CellToOutputWeights->GetConstTensor<float>()[u] * cell;
+            }
+            cellOutput[u] = Sigmoid(out) * tanhf(cell);
+        }
+
+        float* const outputRow = output + b * outputSize;
+        if (lstmCase.m_ProjectionEnabled)
+        {
+            const float* projectionBias = data.m_ProjectionBias->GetConstTensor<float>();
+            std::copy(projectionBias, projectionBias + outputSize, outputRow);
+            AddMatrixVectorProduct(data.m_ProjectionWeights->GetConstTensor<float>(), cellOutput.data(),
+                                   outputSize, numUnits, outputRow);
+        }
+        else
+        {
+            std::copy(cellOutput.begin(), cellOutput.end(), outputRow);
+        }
+    }
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(LstmFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Per gate", "Fused");
+
+    for (const LstmCase& lstmCase : g_LstmCases)
+    {
+        const unsigned int batchSize = lstmCase.m_BatchSize;
+        const unsigned int numUnits = lstmCase.m_NumUnits;
+
+        std::vector<std::unique_ptr<ScopedCpuTensorHandle>> parameters;
+        auto makeParameter = [&](const TensorShape& shape)
+        {
+            const TensorInfo info(shape, DataType::Float32);
+            // Small weights keep the gates away from the saturated parts of the activation functions.
+            const std::vector<float> values = benchmark::MakeRandomData(info.GetNumElements(), -0.1f, 0.1f);
+            parameters.push_back(std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, values.data())));
+            return parameters.back().get();
+        };
+
+        const TensorShape inputWeightsShape({ numUnits, lstmCase.m_InputSize });
+        const TensorShape recurrentWeightsShape({ numUnits, lstmCase.m_OutputSize });
+        const TensorShape unitsShape({ numUnits });
+
+        LstmQueueDescriptor data;
+        data.m_Parameters.m_ActivationFunc    = 4;
+        data.m_Parameters.m_CifgEnabled       = lstmCase.m_CifgEnabled;
+        data.m_Parameters.m_PeepholeEnabled   = lstmCase.m_PeepholeEnabled;
+        data.m_Parameters.m_ProjectionEnabled = lstmCase.m_ProjectionEnabled;
+
+        data.m_InputToForgetWeights     = makeParameter(inputWeightsShape);
+        data.m_InputToCellWeights       = makeParameter(inputWeightsShape);
+        data.m_InputToOutputWeights     = makeParameter(inputWeightsShape);
+        data.m_RecurrentToForgetWeights = makeParameter(recurrentWeightsShape);
+        data.m_RecurrentToCellWeights   = makeParameter(recurrentWeightsShape);
+        data.m_RecurrentToOutputWeights = makeParameter(recurrentWeightsShape);
+        data.m_ForgetGateBias           = makeParameter(unitsShape);
+        data.m_CellBias                 = makeParameter(unitsShape);
+        data.m_OutputGateBias           = makeParameter(unitsShape);
+        if (!lstmCase.m_CifgEnabled)
+        {
+            data.m_InputToInputWeights     = makeParameter(inputWeightsShape);
+            data.m_RecurrentToInputWeights = makeParameter(recurrentWeightsShape);
+            data.m_InputGateBias           = makeParameter(unitsShape);
+            if (lstmCase.m_PeepholeEnabled)
+            {
+                data.m_CellToInputWeights = makeParameter(unitsShape);
+            }
+        }
+        if (lstmCase.m_PeepholeEnabled)
+        {
+            data.m_CellToForgetWeights = makeParameter(unitsShape);
+            data.m_CellToOutputWeights = makeParameter(unitsShape);
+        }
+        if (lstmCase.m_ProjectionEnabled)
+        {
+            data.m_ProjectionWeights = makeParameter(TensorShape({ lstmCase.m_OutputSize, numUnits }));
+            data.m_ProjectionBias    = makeParameter(TensorShape({ lstmCase.m_OutputSize }));
+        }
+
+        const TensorInfo inputInfo({ batchSize, lstmCase.m_InputSize }, DataType::Float32);
+        const TensorInfo outputStateInfo({ batchSize, lstmCase.m_OutputSize }, DataType::Float32);
+        const TensorInfo cellStateInfo({ batchSize, numUnits }, DataType::Float32);
+        const TensorInfo scratchInfo({ batchSize, numUnits * (lstmCase.m_CifgEnabled ? 3 : 4) }, DataType::Float32);
+
+        std::vector<float> input         = benchmark::MakeRandomData(inputInfo.GetNumElements());
+        std::vector<float> outputStateIn = benchmark::MakeRandomData(outputStateInfo.GetNumElements());
+        std::vector<float> cellStateIn   = benchmark::MakeRandomData(cellStateInfo.GetNumElements());
+        std::vector<float> scratch(scratchInfo.GetNumElements());
+        std::vector<float> outputStateOut(outputStateInfo.GetNumElements());
+        std::vector<float> cellStateOut(cellStateInfo.GetNumElements());
+        std::vector<float> baselineOutput(outputStateInfo.GetNumElements());
+        std::vector<float> optimisedOutput(outputStateInfo.GetNumElements());
+
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                NaiveLstm(data, lstmCase, input.data(), outputStateIn.data(), cellStateIn.data(),
+                          cellStateOut.data(), baselineOutput.data());
+            });
+
+        PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+        PassthroughCpuTensorHandle outputStateInHandle(outputStateInfo, outputStateIn.data());
+        PassthroughCpuTensorHandle cellStateInHandle(cellStateInfo, cellStateIn.data());
+        PassthroughCpuTensorHandle scratchHandle(scratchInfo, scratch.data());
+        PassthroughCpuTensorHandle outputStateOutHandle(outputStateInfo, outputStateOut.data());
+        PassthroughCpuTensorHandle cellStateOutHandle(cellStateInfo, cellStateOut.data());
+        PassthroughCpuTensorHandle outputHandle(outputStateInfo, optimisedOutput.data());
+
+        WorkloadInfo info;
+        data.m_Inputs  = { &inputHandle, &outputStateInHandle, &cellStateInHandle };
+        data.m_Outputs = { &scratchHandle, &outputStateOutHandle, &cellStateOutHandle, &outputHandle };
+        info.m_InputTensorInfos  = { inputInfo, outputStateInfo, cellStateInfo };
+        info.m_OutputTensorInfos = { scratchInfo, outputStateInfo, cellStateInfo, outputStateInfo };
+
+        RefLstmFloat32Workload workload(data, info);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]() { workload.Execute(); });
+
+        const std::string caseName = boost::str(boost::format("%s (%u, %u->%u->%u)")
+            % lstmCase.m_Name % batchSize % lstmCase.m_InputSize % numUnits % lstmCase.m_OutputSize);
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
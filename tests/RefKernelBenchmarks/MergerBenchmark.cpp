@@ -0,0 +1,176 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/RefWorkloadFactory.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/RefMergerFloat32Workload.hpp"
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+struct MergerCase
+{
+    const char* m_Name;
+    std::vector<unsigned int> m_BranchChannels;
+    unsigned int m_Height;
+    unsigned int m_Width;
+    bool m_IsNhwc;
+};
+
+// The concatenations of the branches of GoogLeNet's inception modules, along the channels of NCHW and NHWC tensors.
+// Only the NCHW ones are contiguous in the output, so only their inputs can be sub-tensors of it.
+const MergerCase g_MergerCases[] =
+{
+    { "Inception 3a NCHW", { 64, 128, 32, 32 },    28, 28, false },
+    { "Inception 4e NCHW", { 256, 320, 128, 128 }, 14, 14, false },
+    { "Inception 5b NCHW", { 384, 384, 128, 128 },  7,  7, false },
+    { "Inception 3a NHWC", { 64, 128, 32, 32 },    28, 28, true },
+    { "Inception 4e NHWC", { 256, 320, 128, 128 }, 14, 14, true },
+    { "Inception 5b NHWC", { 384, 384, 128, 128 },  7,  7, true },
+};
+
+armnn::TensorShape MakeShape(const MergerCase& mergerCase, unsigned int channels)
+{
+    return mergerCase.m_IsNhwc ? armnn::TensorShape({ 1, mergerCase.m_Height, mergerCase.m_Width, channels })
+                               : armnn::TensorShape({ 1, channels, mergerCase.m_Height, mergerCase.m_Width });
+}
+
+// The implementation of Merger before the views were copied in runs, finding the view of every element of the output
+// from its coordinates.
+void ElementScanMerger(const armnn::TensorShape& outputShape,
+                       const std::vector<std::vector<unsigned int>>& origins,
+                       const std::vector<armnn::TensorShape>& inputShapes,
+                       const std::vector<std::vector<float>>& inputs,
+                       std::vector<float>& output)
+{
+    for (unsigned int index = 0; index < outputShape.GetNumElements(); ++index)
+    {
+        unsigned int indices[armnn::MaxNumOfTensorDimensions] = { 0 };
+
+        unsigned int indexRemainder = index;
+        unsigned int dimensionStride = outputShape.GetNumElements();
+
+        for (unsigned int i = 0; i < outputShape.GetNumDimensions(); i++)
+        {
+            dimensionStride /= outputShape[i];
+            indices[i] = indexRemainder / dimensionStride;
+            indexRemainder -= indices[i] * dimensionStride;
+        }
+
+        for (unsigned int viewIdx = 0; viewIdx < origins.size(); ++viewIdx)
+        {
+            const armnn::TensorShape& inputShape = inputShapes[viewIdx];
+
+            bool insideView = true;
+            for (unsigned int i = 0; i < inputShape.GetNumDimensions(); i++)
+            {
+                if (indices[i] < origins[viewIdx][i] || indices[i] >= origins[viewIdx][i] + inputShape[i])
+                {
+                    insideView = false;
+                }
+            }
+
+            if (insideView)
+            {
+                unsigned int inIndex = 0;
+                unsigned int inputStride = 1;
+
+                for (unsigned int i = inputShape.GetNumDimensions(); i-- > 0;)
+                {
+                    inIndex += inputStride * (indices[i] - origins[viewIdx][i]);
+                    inputStride *= inputShape[i];
+                }
+
+                output[index] = inputs[viewIdx][inIndex];
+                break;
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(MergerFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Element scan", "Sub-tensors");
+
+    for (const MergerCase& mergerCase : g_MergerCases)
+    {
+        const unsigned int channelsIndex = mergerCase.m_IsNhwc ? 3 : 1;
+        unsigned int outputChannels = 0;
+        std::vector<std::vector<unsigned int>> origins;
+        std::vector<TensorShape> inputShapes;
+        std::vector<std::vector<float>> inputs;
+        for (unsigned int branchChannels : mergerCase.m_BranchChannels)
+        {
+            std::vector<unsigned int> origin(4, 0);
+            origin[channelsIndex] = outputChannels;
+            origins.push_back(origin);
+            inputShapes.push_back(MakeShape(mergerCase, branchChannels));
+            inputs.push_back(benchmark::MakeRandomData(inputShapes.back().GetNumElements()));
+            outputChannels += branchChannels;
+        }
+        const TensorInfo outputInfo(MakeShape(mergerCase, outputChannels), DataType::Float32);
+
+        std::vector<float> baselineOutput(outputInfo.GetNumElements());
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                ElementScanMerger(outputInfo.GetShape(), origins, inputShapes, inputs, baselineOutput);
+            });
+
+        // The branches write their outputs into sub-tensors of the output wherever the factory can make them, as when
+        // the network is loaded, and into tensors of their own otherwise.
+        RefWorkloadFactory factory;
+        std::unique_ptr<ITensorHandle> outputHandle = factory.CreateTensorHandle(outputInfo);
+        outputHandle->Allocate();
+
+        MergerQueueDescriptor data;
+        WorkloadInfo info;
+        std::vector<std::unique_ptr<ITensorHandle>> inputHandles;
+        for (unsigned int i = 0; i < inputs.size(); ++i)
+        {
+            const TensorInfo inputInfo(inputShapes[i], DataType::Float32);
+            std::unique_ptr<ITensorHandle> inputHandle =
+                factory.CreateSubTensorHandle(*outputHandle, inputShapes[i], origins[i].data());
+            if (!inputHandle)
+            {
+                inputHandle = factory.CreateTensorHandle(inputInfo);
+                inputHandle->Allocate();
+            }
+
+            float* inputData = static_cast<CpuTensorHandle*>(inputHandle.get())->GetTensor<float>();
+            std::copy(inputs[i].begin(), inputs[i].end(), inputData);
+
+            data.m_Inputs.push_back(inputHandle.get());
+            data.m_ViewOrigins.emplace_back(origins[i]);
+            info.m_InputTensorInfos.push_back(inputInfo);
+            inputHandles.push_back(std::move(inputHandle));
+        }
+        data.m_Outputs.push_back(outputHandle.get());
+        info.m_OutputTensorInfos.push_back(outputInfo);
+
+        RefMergerFloat32Workload workload(data, info);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]() { workload.Execute(); });
+
+        const float* outputData = static_cast<CpuTensorHandle*>(outputHandle.get())->GetTensor<float>();
+        const std::vector<float> optimisedOutput(outputData, outputData + outputInfo.GetNumElements());
+
+        const TensorShape& shape = outputInfo.GetShape();
+        const std::string caseName = boost::str(boost::format("%s (%ux%ux%ux%u)")
+            % mergerCase.m_Name % shape[0] % shape[1] % shape[2] % shape[3]);
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
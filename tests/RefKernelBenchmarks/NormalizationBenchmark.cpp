@@ -0,0 +1,145 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/RefNormalizationFloat32Workload.hpp"
+
+#include <boost/format.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+struct NormalizationCase
+{
+    const char* m_Name;
+    armnn::NormalizationAlgorithmChannel m_Channel;
+    unsigned int m_Channels;
+    unsigned int m_Size;
+    unsigned int m_NormSize;
+};
+
+// The local response normalizations of the models run by the tests/*-Armnn programs.
+const NormalizationCase g_NormalizationCases[] =
+{
+    { "CaffeAlexNet norm1",         armnn::NormalizationAlgorithmChannel::Across,  96, 55, 5 },
+    { "CaffeAlexNet norm2",         armnn::NormalizationAlgorithmChannel::Across, 256, 27, 5 },
+    { "GoogLeNet pool1/norm1",      armnn::NormalizationAlgorithmChannel::Across,  64, 56, 5 },
+    { "GoogLeNet conv2/norm2",      armnn::NormalizationAlgorithmChannel::Across, 192, 56, 5 },
+    { "CaffeCifar10 norm1",         armnn::NormalizationAlgorithmChannel::Across,  32, 16, 3 },
+    { "Cifar10 norm1 within",       armnn::NormalizationAlgorithmChannel::Within,  32, 16, 3 },
+    { "AlexNet norm1 shape within", armnn::NormalizationAlgorithmChannel::Within,  96, 55, 5 },
+};
+
+// The implementation of the normalization before the sums of the squares were slid along the windows, summing the
+// whole window of every element.
+void WindowSumNormalization(const float* inputData, float* outputData, const NormalizationCase& normalizationCase,
+                            float alpha, float beta, float kappa)
+{
+    const unsigned int depth = normalizationCase.m_Channels;
+    const unsigned int rows = normalizationCase.m_Size;
+    const unsigned int cols = normalizationCase.m_Size;
+    const int radius = boost::numeric_cast<int>(normalizationCase.m_NormSize / 2u);
+    const bool across = normalizationCase.m_Channel == armnn::NormalizationAlgorithmChannel::Across;
+
+    for (unsigned int c = 0; c < depth; c++)
+    {
+        for (unsigned int h = 0; h < rows; h++)
+        {
+            for (unsigned int w = 0; w < cols; w++)
+            {
+                float accumulated_scale = 0.0;
+                if (across)
+                {
+                    for (int z = -radius; z <= radius; z++)
+                    {
+                        int k = boost::numeric_cast<int>(c) + z;
+                        if ((k < 0) || (k >= boost::numeric_cast<int>(depth)))
+                        {
+                            continue;
+                        }
+                        float inval = inputData[(boost::numeric_cast<unsigned int>(k) * rows + h) * cols + w];
+                        accumulated_scale += inval*inval;
+                    }
+                }
+                else
+                {
+                    for (int y = -radius; y <= radius; y++)
+                    {
+                        for (int x = -radius; x <= radius; x++)
+                        {
+                            int i = boost::numeric_cast<int>(w) + x;
+                            int j = boost::numeric_cast<int>(h) + y;
+                            if ((i < 0) || (i >= boost::numeric_cast<int>(cols)) ||
+                                (j < 0) || (j >= boost::numeric_cast<int>(rows)))
+                            {
+                                continue;
+                            }
+                            float inval = inputData[(c * rows + boost::numeric_cast<unsigned int>(j)) * cols +
+                                                    boost::numeric_cast<unsigned int>(i)];
+                            accumulated_scale += inval*inval;
+                        }
+                    }
+                }
+                const unsigned int index = (c * rows + h) * cols + w;
+                outputData[index] = inputData[index] * powf(kappa + (accumulated_scale * alpha), -beta);
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(NormalizationFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Window sums", "Sliding sums");
+
+    for (const NormalizationCase& normalizationCase : g_NormalizationCases)
+    {
+        const TensorInfo tensorInfo(TensorShape({ 1, normalizationCase.m_Channels, normalizationCase.m_Size,
+                                                  normalizationCase.m_Size }), DataType::Float32);
+        std::vector<float> input = benchmark::MakeRandomData(tensorInfo.GetNumElements(), -100.0f, 100.0f);
+        std::vector<float> baselineOutput(tensorInfo.GetNumElements());
+        std::vector<float> optimisedOutput(tensorInfo.GetNumElements());
+
+        NormalizationQueueDescriptor data;
+        data.m_Parameters.m_NormChannelType = normalizationCase.m_Channel;
+        data.m_Parameters.m_NormMethodType = NormalizationAlgorithmMethod::LocalBrightness;
+        data.m_Parameters.m_NormSize = normalizationCase.m_NormSize;
+        data.m_Parameters.m_Alpha = 1e-4f;
+        data.m_Parameters.m_Beta = 0.75f;
+        data.m_Parameters.m_K = 1.0f;
+
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                WindowSumNormalization(input.data(), baselineOutput.data(), normalizationCase,
+                                       data.m_Parameters.m_Alpha, data.m_Parameters.m_Beta, data.m_Parameters.m_K);
+            });
+
+        PassthroughCpuTensorHandle inputHandle(tensorInfo, input.data());
+        PassthroughCpuTensorHandle outputHandle(tensorInfo, optimisedOutput.data());
+        data.m_Inputs = { &inputHandle };
+        data.m_Outputs = { &outputHandle };
+        WorkloadInfo info;
+        info.m_InputTensorInfos = { tensorInfo };
+        info.m_OutputTensorInfos = { tensorInfo };
+
+        RefNormalizationFloat32Workload workload(data, info);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]() { workload.Execute(); });
+
+        const std::string caseName = boost::str(boost::format("%s (%ux%ux%u, size %u)") % normalizationCase.m_Name
+            % normalizationCase.m_Channels % normalizationCase.m_Size % normalizationCase.m_Size
+            % normalizationCase.m_NormSize);
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
@@ -0,0 +1,154 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/CpuTensorHandle.hpp"
+#include "backends/WorkloadData.hpp"
+#include "backends/RefWorkloads/RefPermuteWorkload.hpp"
+
+#include <Permute.hpp>
+
+#include <boost/format.hpp>
+
+#include <array>
+
+namespace
+{
+
+struct PermuteCase
+{
+    const char* m_Name;
+    armnn::TensorShape m_SrcShape;
+    armnn::PermutationVector m_Mappings;
+};
+
+const armnn::PermutationVector NchwToNhwc = { 0, 3, 1, 2 };
+const armnn::PermutationVector NhwcToNchw = { 0, 2, 3, 1 };
+
+// The swizzles the parsers and the preprocessing of the test programs used to insert around each layer, the
+// swizzling of TensorFlow weights and a permutation which keeps the innermost dimension.
+const PermuteCase g_PermuteCases[] =
+{
+    { "Image NHWC->NCHW",          armnn::TensorShape({ 1, 224, 224,    3 }), NhwcToNchw },
+    { "Image NCHW->NHWC",          armnn::TensorShape({ 1,   3, 224,  224 }), NchwToNhwc },
+    { "ResNet conv2 NCHW->NHWC",   armnn::TensorShape({ 1,  64,  56,   56 }), NchwToNhwc },
+    { "ResNet conv2 NHWC->NCHW",   armnn::TensorShape({ 1,  56,  56,   64 }), NhwcToNchw },
+    { "MobileNet pw13 NHWC->NCHW", armnn::TensorShape({ 1,   7,   7, 1024 }), NhwcToNchw },
+    { "Batch 8 NCHW->NHWC",        armnn::TensorShape({ 8,  32, 112,  112 }), NchwToNhwc },
+    { "Weights HWIO->OIHW",        armnn::TensorShape({ 3,   3, 256,  384 }), { 2, 3, 1, 0 } },
+    { "NCHW->NHCW",                armnn::TensorShape({ 1,  64, 112,  112 }), { 0, 2, 1, 3 } },
+};
+
+// The implementation of armnnUtils::Permute before the tiled one, recursing over the dimensions for every element.
+class RecursivePermute
+{
+public:
+    RecursivePermute(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings)
+        : m_DstShape(dstShape)
+    {
+        const unsigned int numDims = dstShape.GetNumDimensions();
+
+        unsigned int srcStride = 1U;
+        unsigned int dstStride = 1U;
+
+        for (unsigned int i = numDims - 1U, k = 0U; k < numDims; ++k, --i)
+        {
+            m_SrcStrides[mappings[i]] = srcStride;
+            m_DstStrides[i] = dstStride;
+
+            srcStride *= dstShape[mappings[i]];
+            dstStride *= dstShape[i];
+        }
+    }
+
+    template <typename T>
+    void Unroll(const T* srcData, T* dstData)
+    {
+        Unroll(0, srcData, dstData);
+    }
+
+private:
+    template <typename T>
+    void Unroll(unsigned int dimension, const T* srcData, T* dstData)
+    {
+        if (dimension >= m_DstShape.GetNumDimensions())
+        {
+            *dstData = *srcData;
+        }
+        else
+        {
+            for (unsigned int i = 0; i < m_DstShape[dimension]; i++)
+            {
+                Unroll(dimension + 1, srcData, dstData);
+
+                srcData += m_SrcStrides[dimension];
+                dstData += m_DstStrides[dimension];
+            }
+        }
+    }
+
+    armnn::TensorShape m_DstShape;
+    std::array<unsigned int, armnn::MaxNumOfTensorDimensions> m_SrcStrides;
+    std::array<unsigned int, armnn::MaxNumOfTensorDimensions> m_DstStrides;
+};
+
+template <armnn::DataType DataType, typename MakeInput>
+void RunPermuteCases(const armnn::benchmark::BenchmarkOptions& options, MakeInput&& makeInput)
+{
+    using namespace armnn;
+
+    for (const PermuteCase& permuteCase : g_PermuteCases)
+    {
+        const TensorInfo inputInfo(permuteCase.m_SrcShape, DataType);
+        const TensorInfo outputInfo = armnnUtils::Permuted(inputInfo, permuteCase.m_Mappings);
+
+        auto input = makeInput(inputInfo.GetNumElements());
+        using T = typename decltype(input)::value_type;
+        std::vector<T> baselineOutput(outputInfo.GetNumElements());
+        std::vector<T> optimisedOutput(outputInfo.GetNumElements());
+
+        RecursivePermute recursivePermute(outputInfo.GetShape(), permuteCase.m_Mappings);
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                recursivePermute.Unroll(input.data(), baselineOutput.data());
+            });
+
+        PassthroughCpuTensorHandle inputHandle(inputInfo, input.data());
+        PassthroughCpuTensorHandle outputHandle(outputInfo, optimisedOutput.data());
+
+        PermuteQueueDescriptor data;
+        data.m_Parameters.m_DimMappings = permuteCase.m_Mappings;
+        data.m_Inputs = { &inputHandle };
+        data.m_Outputs = { &outputHandle };
+        WorkloadInfo info;
+        info.m_InputTensorInfos = { inputInfo };
+        info.m_OutputTensorInfos = { outputInfo };
+
+        RefPermuteWorkload<DataType> workload(data, info);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]() { workload.Execute(); });
+
+        const TensorShape& shape = permuteCase.m_SrcShape;
+        const std::string caseName = boost::str(boost::format("%s (%ux%ux%ux%u)")
+            % permuteCase.m_Name % shape[0] % shape[1] % shape[2] % shape[3]);
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(PermuteFloat32)
+{
+    armnn::benchmark::PrintComparisonHeader("Recursive", "Tiled");
+    RunPermuteCases<armnn::DataType::Float32>(options,
+        [](size_t size) { return armnn::benchmark::MakeRandomData(size); });
+}
+
+ARMNN_REF_BENCHMARK(PermuteUint8)
+{
+    armnn::benchmark::PrintComparisonHeader("Recursive", "Tiled");
+    RunPermuteCases<armnn::DataType::QuantisedAsymm8>(options,
+        [](size_t size) { return armnn::benchmark::MakeRandomQuantizedData(size); });
+}
@@ -0,0 +1,177 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/RefWorkloads/Pooling2d.hpp"
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+struct PoolingCase
+{
+    const char* m_Name;
+    armnn::PoolingAlgorithm m_Algorithm;
+    unsigned int m_Channels;
+    unsigned int m_InputSize;
+    unsigned int m_PoolSize;
+    unsigned int m_Stride;
+    unsigned int m_PadBefore;
+    unsigned int m_PadAfter;
+};
+
+// Representative poolings of the models run by the tests/*-Armnn programs, including the global average poolings
+// the classifiers end with.
+const PoolingCase g_PoolingCases[] =
+{
+    { "CaffeAlexNet pool1 max",       armnn::PoolingAlgorithm::Max,       96,  55, 3, 2, 0, 0 },
+    { "CaffeVGG pool1 max",           armnn::PoolingAlgorithm::Max,       64, 224, 2, 2, 0, 0 },
+    { "CaffeResNet pool1 max",        armnn::PoolingAlgorithm::Max,       64, 112, 3, 2, 0, 1 },
+    { "TfInceptionV3 mixed_5b avg",   armnn::PoolingAlgorithm::Average,  192,  35, 3, 1, 1, 1 },
+    { "CaffeResNet pool5 global avg", armnn::PoolingAlgorithm::Average, 2048,   7, 7, 1, 0, 0 },
+    { "TfMobileNet global avg",       armnn::PoolingAlgorithm::Average, 1024,   7, 7, 1, 0, 0 },
+};
+
+// The implementation of Pooling2d before the kernels were specialised, calling std::function accumulators for every
+// input element and clamping the window of every output element.
+void FunctionPooling2d(const float* in, float* out, const armnn::TensorInfo& inputInfo,
+                       const armnn::TensorInfo& outputInfo, const armnn::Pooling2dDescriptor& params)
+{
+    using namespace armnn;
+
+    const bool isNhwc = params.m_DataLayout == DataLayout::NHWC;
+    const int channels     = static_cast<int>(outputInfo.GetShape()[isNhwc ? 3 : 1]);
+    const int heightOutput = static_cast<int>(outputInfo.GetShape()[isNhwc ? 1 : 2]);
+    const int widthOutput  = static_cast<int>(outputInfo.GetShape()[isNhwc ? 2 : 3]);
+    const int heightInput  = static_cast<int>(inputInfo.GetShape()[isNhwc ? 1 : 2]);
+    const int widthInput   = static_cast<int>(inputInfo.GetShape()[isNhwc ? 2 : 3]);
+    const int padTop       = static_cast<int>(params.m_PadTop);
+    const int padLeft      = static_cast<int>(params.m_PadLeft);
+    const int padBottom    = static_cast<int>(params.m_PadBottom);
+    const int padRight     = static_cast<int>(params.m_PadRight);
+
+    const bool isMax = params.m_PoolType == PoolingAlgorithm::Max;
+    const float initializer = isMax ? std::numeric_limits<float>::lowest() : 0.0f;
+    const std::function<void(float&, float)> accumulate = isMax ?
+        std::function<void(float&, float)>([](float& accu, float value) { if (value > accu) { accu = value; } }) :
+        std::function<void(float&, float)>([](float& accu, float value) { accu += value; });
+    const std::function<void(float&, float)> execute = isMax ?
+        std::function<void(float&, float)>([](float&, float) {}) :
+        std::function<void(float&, float)>([](float& accumulated, float kernelSize) { accumulated /= kernelSize; });
+
+    for (int c = 0; c < channels; c++)
+    {
+        for (int yOutput = 0; yOutput < heightOutput; yOutput++)
+        {
+            for (int xOutput = 0; xOutput < widthOutput; xOutput++)
+            {
+                int hstart = yOutput * static_cast<int>(params.m_StrideY) - padTop;
+                int wstart = xOutput * static_cast<int>(params.m_StrideX) - padLeft;
+                int hend = std::min(hstart + static_cast<int>(params.m_PoolHeight), heightInput + padBottom);
+                int wend = std::min(wstart + static_cast<int>(params.m_PoolWidth), widthInput + padRight);
+
+                const bool onPaddingOnly = hend <= 0 || hstart > heightInput - padBottom ||
+                                           wend <= 0 || wstart > widthInput - padRight;
+
+                hstart = std::min(std::max(hstart, 0), heightInput);
+                hend   = std::min(std::max(hend, 0), heightInput);
+                wstart = std::min(std::max(wstart, 0), widthInput);
+                wend   = std::min(std::max(wend, 0), widthInput);
+
+                float result = onPaddingOnly ? 0.0f : initializer;
+                for (int yInput = hstart; yInput < hend; yInput++)
+                {
+                    for (int xInput = wstart; xInput < wend; xInput++)
+                    {
+                        accumulate(result, in[isNhwc ? (yInput * widthInput + xInput) * channels + c
+                                                     : (c * heightInput + yInput) * widthInput + xInput]);
+                    }
+                }
+
+                execute(result, static_cast<float>((hend - hstart) * (wend - wstart)));
+
+                out[isNhwc ? (yOutput * widthOutput + xOutput) * channels + c
+                           : (c * heightOutput + yOutput) * widthOutput + xOutput] = result;
+            }
+        }
+    }
+}
+
+void RunPoolingCases(const armnn::benchmark::BenchmarkOptions& options, armnn::DataLayout dataLayout)
+{
+    using namespace armnn;
+
+    for (const PoolingCase& poolingCase : g_PoolingCases)
+    {
+        const unsigned int outputSize = (poolingCase.m_InputSize + poolingCase.m_PadBefore + poolingCase.m_PadAfter -
+                                         poolingCase.m_PoolSize) / poolingCase.m_Stride + 1;
+
+        Pooling2dDescriptor descriptor;
+        descriptor.m_PoolType      = poolingCase.m_Algorithm;
+        descriptor.m_PoolWidth     = poolingCase.m_PoolSize;
+        descriptor.m_PoolHeight    = poolingCase.m_PoolSize;
+        descriptor.m_StrideX       = poolingCase.m_Stride;
+        descriptor.m_StrideY       = poolingCase.m_Stride;
+        descriptor.m_PadLeft       = poolingCase.m_PadBefore;
+        descriptor.m_PadTop        = poolingCase.m_PadBefore;
+        descriptor.m_PadRight      = poolingCase.m_PadAfter;
+        descriptor.m_PadBottom     = poolingCase.m_PadAfter;
+        descriptor.m_PaddingMethod = PaddingMethod::Exclude;
+        descriptor.m_DataLayout    = dataLayout;
+
+        const unsigned int channels = poolingCase.m_Channels;
+        const bool isNhwc = dataLayout == DataLayout::NHWC;
+        const TensorInfo inputInfo(isNhwc ?
+            TensorShape({ 1, poolingCase.m_InputSize, poolingCase.m_InputSize, channels }) :
+            TensorShape({ 1, channels, poolingCase.m_InputSize, poolingCase.m_InputSize }), DataType::Float32);
+        const TensorInfo outputInfo(isNhwc ?
+            TensorShape({ 1, outputSize, outputSize, channels }) :
+            TensorShape({ 1, channels, outputSize, outputSize }), DataType::Float32);
+
+        const std::vector<float> input = benchmark::MakeRandomData(inputInfo.GetNumElements());
+        std::vector<float> baselineOutput(outputInfo.GetNumElements());
+        std::vector<float> optimisedOutput(outputInfo.GetNumElements());
+
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                FunctionPooling2d(input.data(), baselineOutput.data(), inputInfo, outputInfo, descriptor);
+            });
+
+        // Like the workload, the pooling works out its windows once, outside of the timed runs.
+        const Pooling2d pooling(inputInfo, outputInfo, descriptor);
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                pooling.Execute(input.data(), optimisedOutput.data());
+            });
+
+        const std::string caseName = boost::str(boost::format("%s (%ux%u/%u, %u ch)") % poolingCase.m_Name
+            % poolingCase.m_PoolSize % poolingCase.m_PoolSize % poolingCase.m_Stride % channels);
+        benchmark::PrintComparison(caseName, baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(Pooling2dNchwFloat32)
+{
+    armnn::benchmark::PrintComparisonHeader("std::function", "Specialised");
+    RunPoolingCases(options, armnn::DataLayout::NCHW);
+}
+
+ARMNN_REF_BENCHMARK(Pooling2dNhwcFloat32)
+{
+    armnn::benchmark::PrintComparisonHeader("std::function", "Specialised");
+    RunPoolingCases(options, armnn::DataLayout::NHWC);
+}
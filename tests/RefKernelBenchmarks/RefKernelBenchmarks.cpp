@@ -0,0 +1,169 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/RefWorkloads/RefThreadPool.hpp"
+
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+
+namespace armnn
+{
+namespace benchmark
+{
+
+namespace
+{
+
+std::map<std::string, BenchmarkFunction>& GetBenchmarks()
+{
+    static std::map<std::string, BenchmarkFunction> benchmarks;
+    return benchmarks;
+}
+
+} // anonymous namespace
+
+BenchmarkRegistrar::BenchmarkRegistrar(const char* name, BenchmarkFunction function)
+{
+    GetBenchmarks()[name] = function;
+}
+
+std::vector<float> MakeRandomData(size_t size, float min, float max)
+{
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(size));
+    std::uniform_real_distribution<float> distribution(min, max);
+
+    std::vector<float> data(size);
+    std::generate(data.begin(), data.end(), [&]() { return distribution(generator); });
+    return data;
+}
+
+std::vector<uint8_t> MakeRandomQuantizedData(size_t size)
+{
+    std::mt19937 generator(static_cast<std::mt19937::result_type>(size));
+    std::uniform_int_distribution<int> distribution(0, 255);
+
+    std::vector<uint8_t> data(size);
+    std::generate(data.begin(), data.end(), [&]() { return static_cast<uint8_t>(distribution(generator)); });
+    return data;
+}
+
+float MaxAbsDifference(const std::vector<float>& a, const std::vector<float>& b)
+{
+    float maxDifference = 0.0f;
+    for (size_t i = 0; i < std::min(a.size(), b.size()); ++i)
+    {
+        maxDifference = std::max(maxDifference, std::fabs(a[i] - b[i]));
+    }
+    return maxDifference;
+}
+
+float MaxAbsDifference(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b)
+{
+    int maxDifference = 0;
+    for (size_t i = 0; i < std::min(a.size(), b.size()); ++i)
+    {
+        maxDifference = std::max(maxDifference, std::abs(static_cast<int>(a[i]) - static_cast<int>(b[i])));
+    }
+    return static_cast<float>(maxDifference);
+}
+
+void PrintComparisonHeader(const std::string& baselineName, const std::string& optimisedName)
+{
+    std::cout << boost::format("%-48s %14s %14s %9s %12s")
+        % "Case" % (baselineName + " ms") % (optimisedName + " ms") % "Speedup" % "Max diff" << std::endl;
+}
+
+void PrintComparison(const std::string& caseName, double baselineMs, double optimisedMs, float maxDifference)
+{
+    std::cout << boost::format("%-48s %14.3f %14.3f %8.2fx %12.3g")
+        % caseName % baselineMs % optimisedMs % (baselineMs / optimisedMs) % maxDifference << std::endl;
+}
+
+} // namespace benchmark
+} // namespace armnn
+
+int main(int argc, const char* argv[])
+{
+    namespace po = boost::program_options;
+
+    std::string filter;
+    unsigned int iterations = 0;
+    unsigned int numThreads = 0;
+
+    po::options_description desc("Options");
+    desc.add_options()
+        ("help", "Display usage information")
+        ("list", "List the available benchmarks")
+        ("benchmark,b", po::value(&filter)->default_value(""),
+            "Only run the benchmarks whose name contains this string")
+        ("iterations,i", po::value(&iterations)->default_value(10), "Number of timed runs of each kernel")
+        ("threads,t", po::value(&numThreads)->default_value(1),
+            "Number of threads running the kernels. 0 uses one per hardware thread");
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+    }
+    catch (const po::error& e)
+    {
+        std::cerr << e.what() << std::endl << desc << std::endl;
+        return 1;
+    }
+
+    const auto& benchmarks = armnn::benchmark::GetBenchmarks();
+    if (vm.count("help") || vm.count("list"))
+    {
+        if (vm.count("help"))
+        {
+            std::cout << "Compares the optimised CpuRef kernels with their naive implementations." << std::endl
+                      << desc << std::endl;
+        }
+        std::cout << "Benchmarks:" << std::endl;
+        for (auto&& benchmark : benchmarks)
+        {
+            std::cout << "  " << benchmark.first << std::endl;
+        }
+        return 0;
+    }
+
+    if (iterations == 0)
+    {
+        std::cerr << "The number of iterations must be at least 1" << std::endl;
+        return 1;
+    }
+
+    std::unique_ptr<armnn::RefThreadPool> threadPool;
+    if (numThreads != 1)
+    {
+        threadPool = std::make_unique<armnn::RefThreadPool>(numThreads);
+    }
+    armnn::ScopedRefThreadPool scopedThreadPool(threadPool.get());
+
+    armnn::benchmark::BenchmarkOptions options;
+    options.m_Iterations = iterations;
+
+    for (auto&& benchmark : benchmarks)
+    {
+        if (benchmark.first.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        std::cout << std::endl << benchmark.first << std::endl;
+        benchmark.second(options);
+    }
+
+    return 0;
+}
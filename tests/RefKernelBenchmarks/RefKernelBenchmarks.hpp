@@ -0,0 +1,71 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace armnn
+{
+namespace benchmark
+{
+
+struct BenchmarkOptions
+{
+    /// Number of timed runs of each kernel, after an untimed warm-up run.
+    unsigned int m_Iterations;
+};
+
+using BenchmarkFunction = void (*)(const BenchmarkOptions& options);
+
+/// Registers a benchmark with the RefKernelBenchmarks program. Meant to be used through ARMNN_REF_BENCHMARK.
+class BenchmarkRegistrar
+{
+public:
+    BenchmarkRegistrar(const char* name, BenchmarkFunction function);
+};
+
+#define ARMNN_REF_BENCHMARK(Name) \
+    void Name(const armnn::benchmark::BenchmarkOptions& options); \
+    static armnn::benchmark::BenchmarkRegistrar Name##Registrar(#Name, &Name); \
+    void Name(const armnn::benchmark::BenchmarkOptions& options)
+
+/// Returns the average duration, in milliseconds, of a call to the given function.
+template <typename Function>
+double TimeMilliseconds(const BenchmarkOptions& options, Function&& function)
+{
+    function();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < options.m_Iterations; ++i)
+    {
+        function();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count() / options.m_Iterations;
+}
+
+/// Returns the given number of pseudo-random values, the same at every run.
+std::vector<float> MakeRandomData(size_t size, float min = -1.0f, float max = 1.0f);
+
+/// Returns the given number of pseudo-random uint8 values covering their whole range, the same at every run.
+std::vector<uint8_t> MakeRandomQuantizedData(size_t size);
+
+/// Returns the largest absolute difference between the elements of two buffers of the same size.
+float MaxAbsDifference(const std::vector<float>& a, const std::vector<float>& b);
+float MaxAbsDifference(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+
+/// Prints the header of a table comparing a baseline kernel with an optimised one.
+void PrintComparisonHeader(const std::string& baselineName, const std::string& optimisedName);
+
+/// Prints one row of a table started with PrintComparisonHeader().
+void PrintComparison(const std::string& caseName, double baselineMs, double optimisedMs, float maxDifference);
+
+} // namespace benchmark
+} // namespace armnn
@@ -0,0 +1,147 @@
+//
+// Copyright © 2017 Arm Ltd. All rights reserved.
+// See LICENSE file in the project root for full license information.
+//
+#include "RefKernelBenchmarks.hpp"
+
+#include "backends/RefWorkloads/Softmax.hpp"
+
+#include <armnn/Tensor.hpp>
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/format.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+struct SoftmaxCase
+{
+    const char* m_Name;
+    unsigned int m_NumRows;
+    unsigned int m_NumClasses;
+};
+
+// The classifiers of the tests/*-Armnn programs, a large vocabulary and the class scores of the anchors of SSD.
+const SoftmaxCase g_SoftmaxCases[] =
+{
+    { "ImageNet classifier",      1,  1000 },
+    { "ImageNet classifier",      8,  1000 },
+    { "Large vocabulary",         1, 32000 },
+    { "SSD MobileNet class head", 1917,  91 },
+};
+
+// The implementation of Softmax before it was made allocation-free, allocating the exponentials of every row.
+void AllocatingSoftmax(const float* in, float* out, const armnn::TensorInfo& tensorInfo, float beta)
+{
+    unsigned int numChannels = tensorInfo.GetShape()[1];
+    for (unsigned int n = 0; n < tensorInfo.GetShape()[0]; n++)
+    {
+        float max = in[n * numChannels];
+        for (unsigned int c = 1; c < numChannels; c++)
+        {
+            float val = in[n * numChannels + c];
+            if (val > max)
+            {
+                max = val;
+            }
+        }
+
+        std::vector<float> exponentials(numChannels);
+        float              sum = 0.0f;
+        for (unsigned int c = 0; c < numChannels; c++)
+        {
+            float val       = in[n * numChannels + c];
+            exponentials[c] = expf((val - max) * beta);
+            sum += exponentials[c];
+        }
+
+        for (unsigned int c = 0; c < numChannels; c++)
+        {
+            out[n * numChannels + c] = exponentials[c] / sum;
+        }
+    }
+}
+
+std::string GetCaseName(const SoftmaxCase& softmaxCase)
+{
+    return boost::str(boost::format("%s (%ux%u)") % softmaxCase.m_Name % softmaxCase.m_NumRows
+        % softmaxCase.m_NumClasses);
+}
+
+} // anonymous namespace
+
+ARMNN_REF_BENCHMARK(SoftmaxFloat32)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Allocating", "In place");
+
+    for (const SoftmaxCase& softmaxCase : g_SoftmaxCases)
+    {
+        const TensorInfo tensorInfo(TensorShape({ softmaxCase.m_NumRows, softmaxCase.m_NumClasses }),
+                                    DataType::Float32);
+        const std::vector<float> input = benchmark::MakeRandomData(tensorInfo.GetNumElements(), -10.0f, 10.0f);
+        std::vector<float> baselineOutput(tensorInfo.GetNumElements());
+        std::vector<float> optimisedOutput(tensorInfo.GetNumElements());
+
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                AllocatingSoftmax(input.data(), baselineOutput.data(), tensorInfo, 1.0f);
+            });
+
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                Softmax(input.data(), optimisedOutput.data(), tensorInfo, 1.0f);
+            });
+
+        benchmark::PrintComparison(GetCaseName(softmaxCase), baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}
+
+ARMNN_REF_BENCHMARK(SoftmaxUint8)
+{
+    using namespace armnn;
+
+    benchmark::PrintComparisonHeader("Dequantizing", "Lookup table");
+
+    for (const SoftmaxCase& softmaxCase : g_SoftmaxCases)
+    {
+        const TensorShape shape({ softmaxCase.m_NumRows, softmaxCase.m_NumClasses });
+        const TensorInfo inputInfo(shape, DataType::QuantisedAsymm8, 0.1f, 128);
+        const TensorInfo outputInfo(shape, DataType::QuantisedAsymm8, 1.0f / 256.0f, 0);
+
+        const std::vector<uint8_t> input = benchmark::MakeRandomQuantizedData(inputInfo.GetNumElements());
+        std::vector<uint8_t> baselineOutput(outputInfo.GetNumElements());
+        std::vector<uint8_t> optimisedOutput(outputInfo.GetNumElements());
+
+        // What RefSoftmaxUint8Workload did: dequantize the whole tensor, take its softmax and quantize it back.
+        const double baselineMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                std::vector<float> dequantized(inputInfo.GetNumElements());
+                for (unsigned int i = 0; i < dequantized.size(); ++i)
+                {
+                    dequantized[i] = Dequantize(input[i], inputInfo.GetQuantizationScale(),
+                                                inputInfo.GetQuantizationOffset());
+                }
+                std::vector<float> results(outputInfo.GetNumElements());
+                AllocatingSoftmax(dequantized.data(), results.data(), inputInfo, 1.0f);
+                for (unsigned int i = 0; i < results.size(); ++i)
+                {
+                    baselineOutput[i] = Quantize<uint8_t>(results[i], outputInfo.GetQuantizationScale(),
+                                                          outputInfo.GetQuantizationOffset());
+                }
+            });
+
+        const double optimisedMs = benchmark::TimeMilliseconds(options, [&]()
+            {
+                Softmax(input.data(), optimisedOutput.data(), inputInfo, outputInfo, 1.0f);
+            });
+
+        benchmark::PrintComparison(GetCaseName(softmaxCase), baselineMs, optimisedMs,
+                                   benchmark::MaxAbsDifference(baselineOutput, optimisedOutput));
+    }
+}